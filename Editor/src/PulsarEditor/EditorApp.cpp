@@ -0,0 +1,84 @@
+#include "EditorApp.hpp"
+
+#include "PulsarCore/Math/Quat.hpp"
+
+#include <cmath>
+#include <numbers>
+
+namespace Pulsar {
+    namespace {
+        constexpr u32 RING_COUNT     = 256;
+        constexpr u32 NODES_PER_RING = 16;
+        constexpr f32 RING_SPACING   = 8.0F;
+        constexpr f32 RING_RADIUS    = 3.0F;
+        /// Radians per second
+        constexpr f32 SPIN_SPEED = 1.5F;
+
+        Vec3 world_position(const Mat4& world) {
+            const Vec4 translation = world.column(3);
+            return {translation.x, translation.y, translation.z};
+        }
+    } // namespace
+
+    EditorApp::EditorApp(JobSystem& jobs) : m_Jobs(jobs) {
+        const auto side = static_cast<u32>(std::sqrt(static_cast<f32>(RING_COUNT)));
+        for (u32 ring = 0; ring < RING_COUNT; ring++) {
+            const Vec3 center = {static_cast<f32>(ring % side) * RING_SPACING, 0.0F,
+                static_cast<f32>(ring / side) * RING_SPACING};
+            const TransformNode_t root = m_Transforms.create(NULL_TRANSFORM, center);
+            m_Roots.push_back(root);
+            for (u32 node = 0; node < NODES_PER_RING; node++) {
+                const f32 angle = 2.0F * std::numbers::pi_v<f32> * static_cast<f32>(node)
+                                  / static_cast<f32>(NODES_PER_RING);
+                m_Nodes.push_back(m_Transforms.create(
+                    root, {std::cos(angle) * RING_RADIUS, 0.0F, std::sin(angle) * RING_RADIUS}));
+            }
+        }
+        m_Transforms.update(m_Jobs);
+        m_Current.resize(m_Nodes.size());
+        for (usize i = 0; i < m_Nodes.size(); i++) {
+            m_Current[i] = world_position(m_Transforms.world(m_Nodes[i]));
+        }
+        m_Previous      = m_Current;
+        m_DrawPositions = m_Current;
+    }
+
+    void EditorApp::handle_events(std::span<const Event_t> events) {
+        for (const Event_t& event : events) {
+            if (event.m_Type == EventType::KEY && event.m_Key.m_Key == Key::SPACE
+                && event.m_Key.m_Pressed && !event.m_Key.m_Repeat) {
+                m_Paused = !m_Paused;
+            }
+        }
+    }
+
+    void EditorApp::fixed_update(f64 stepSeconds) {
+        if (!m_Paused) {
+            m_Angle += SPIN_SPEED * static_cast<f32>(stepSeconds);
+        }
+        const Vec3 up = {0.0F, 1.0F, 0.0F};
+        for (usize i = 0; i < m_Roots.size(); i++) {
+            // Neighbouring rings spin out of phase
+            m_Transforms.set_rotation(
+                m_Roots[i], Quat::from_axis_angle(up, m_Angle + static_cast<f32>(i) * 0.1F));
+        }
+        m_Transforms.update(m_Jobs);
+
+        m_Previous.swap(m_Current);
+        for (usize i = 0; i < m_Nodes.size(); i++) {
+            m_Current[i] = world_position(m_Transforms.world(m_Nodes[i]));
+        }
+    }
+
+    void EditorApp::render(f64 alpha) {
+        const auto blend = static_cast<f32>(alpha);
+        for (usize i = 0; i < m_DrawPositions.size(); i++) {
+            const Vec3& from   = m_Previous[i];
+            const Vec3& to     = m_Current[i];
+            m_DrawPositions[i] = {from.x + (to.x - from.x) * blend,
+                from.y + (to.y - from.y) * blend, from.z + (to.z - from.z) * blend};
+        }
+        // Nothing runs on the job system between frames
+        m_Jobs.end_frame();
+    }
+} // namespace Pulsar
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "PulsarCore/Types.hpp"
+#include "PulsarEngine/App/MainLoop.hpp"
+#include "PulsarEngine/Jobs/JobSystem.hpp"
+#include "PulsarEngine/Scene/TransformHierarchy.hpp"
+
+#include <vector>
+
+namespace Pulsar {
+    /// The editor scene until there is a renderer: rings of nodes spinning around their roots
+    /// # Usage
+    /// Gives the main loop the work a real scene has: the simulation animates a transform
+    /// hierarchy and updates it on the job system, rendering interpolates the world positions
+    /// of the last two steps into the list a renderer would draw.
+    class EditorApp final : public Application {
+    public:
+        explicit EditorApp(JobSystem& jobs);
+
+        void handle_events(std::span<const Event_t> events) override;
+        void fixed_update(f64 stepSeconds) override;
+        void render(f64 alpha) override;
+
+        [[nodiscard]] std::span<const Vec3> draw_positions() const {
+            return m_DrawPositions;
+        }
+
+    private:
+        JobSystem&                   m_Jobs;
+        TransformHierarchy           m_Transforms;
+        std::vector<TransformNode_t> m_Roots;
+        std::vector<TransformNode_t> m_Nodes;
+        f32                          m_Angle  = 0.0F;
+        bool                         m_Paused = false;
+        /// World positions of `m_Nodes` before and after the last step
+        std::vector<Vec3> m_Previous;
+        std::vector<Vec3> m_Current;
+        std::vector<Vec3> m_DrawPositions;
+    };
+} // namespace Pulsar
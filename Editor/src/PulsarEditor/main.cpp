@@ -1,11 +1,106 @@
+#include "EditorApp.hpp"
 #include "PulsarCore/Log.hpp"
+#include "PulsarCore/Result.hpp"
+#include "PulsarEngine/App/MainLoop.hpp"
+#include "PulsarEngine/Jobs/JobSystem.hpp"
+#include "PulsarWindow/GlfwWindow.hpp"
+#include "PulsarWindow/HeadlessWindow.hpp"
 
-int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
+#include <charconv>
+#include <fmt/format.h>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace {
+    struct Options_t {
+        /// Runs this many frames on a headless window and prints the frame time stats
+        std::optional<Pulsar::u64> m_BenchFrames;
+        /// 0 leaves the frame rate uncapped
+        Pulsar::f64 m_TargetFps = 60.0;
+    };
+
+    template<typename T> std::optional<T> parse_number(std::string_view text) {
+        T value {};
+        const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+        if (error != std::errc {} || end != text.data() + text.size()) {
+            return std::nullopt;
+        }
+        return value;
+    }
+
+    Pulsar::Result<Options_t, std::string> parse_options(std::span<char*> args) {
+        Options_t options;
+        for (Pulsar::usize i = 1; i < args.size(); i++) {
+            const std::string_view arg = args[i];
+            if (arg != "--bench-frames" && arg != "--target-fps") {
+                return Pulsar::Err(fmt::format("Unknown option: {}", arg));
+            }
+            if (i + 1 == args.size()) {
+                return Pulsar::Err(fmt::format("Missing value for {}", arg));
+            }
+            const std::string_view value = args[++i];
+            if (arg == "--bench-frames") {
+                options.m_BenchFrames = parse_number<Pulsar::u64>(value);
+                if (!options.m_BenchFrames) {
+                    return Pulsar::Err(fmt::format("Invalid frame count: {}", value));
+                }
+            }
+            else {
+                const auto fps = parse_number<Pulsar::f64>(value);
+                if (!fps || *fps < 0.0) {
+                    return Pulsar::Err(fmt::format("Invalid frame rate: {}", value));
+                }
+                options.m_TargetFps = *fps;
+            }
+        }
+        return options;
+    }
+} // namespace
+
+int main(int argc, char* argv[]) {
     auto res = Pulsar::Log::init();
     if (!res.has_value()) {
         PL_LOG_ERROR("Failed to initialize logging: {}", res.error());
         return 1;
     }
+    const auto options = parse_options(std::span(argv, static_cast<Pulsar::usize>(argc)));
+    if (!options.has_value()) {
+        PL_LOG_ERROR("{}", options.error());
+        PL_LOG_ERROR("Usage: PulsarEditor [--bench-frames N] [--target-fps F]");
+        return 1;
+    }
+
+    Pulsar::MainLoopConfig_t config;
+    if (options->m_TargetFps > 0.0) {
+        config.m_TargetFrameNs = static_cast<Pulsar::u64>(1e9 / options->m_TargetFps);
+    }
+    Pulsar::JobSystem jobs;
+    Pulsar::EditorApp app(jobs);
+
+    if (options->m_BenchFrames) {
+        // The headless clock advances one simulation step per frame, so the simulation does the
+        // same work every run and only the frame times vary
+        Pulsar::HeadlessWindow window({.m_FrameCount = *options->m_BenchFrames,
+            .m_FrameTimeNs = config.m_SimulationStepNs});
+        Pulsar::MainLoop loop(window, app, config);
+        loop.run();
+        const Pulsar::FrameStats_t& stats = loop.stats();
+        fmt::print("{}\n", stats.summary());
+        fmt::print("dropped simulation: {:.3f} ms\n",
+            static_cast<Pulsar::f64>(stats.m_DroppedSimulationNs) * 1e-6);
+        return 0;
+    }
+
     PL_LOG_INFO("Starting Pulsar Editor...");
+    auto window = Pulsar::GlfwWindow::create({.title = "Pulsar Editor"});
+    if (!window.has_value()) {
+        PL_LOG_ERROR("Failed to create the window: {}", window.error());
+        return 1;
+    }
+    Pulsar::MainLoop loop(**window, app, config);
+    loop.run();
+    PL_LOG_INFO("Frame times: {}", loop.stats().summary());
     return 0;
 }
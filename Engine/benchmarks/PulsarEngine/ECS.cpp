@@ -0,0 +1,205 @@
+// NOLINTBEGIN(*)
+#include "PulsarCore/BenchmarkPerfCounters.hpp"
+#include "PulsarEngine/ECS/CommandBuffer.hpp"
+#include "PulsarEngine/ECS/Query.hpp"
+#include "PulsarEngine/ECS/World.hpp"
+#include "PulsarEngine/ThreadCounts.hpp"
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace Pulsar;
+
+namespace {
+    constexpr usize ENTITIES = 1'000'000;
+    constexpr f32   DT       = 1.0F / 60.0F;
+
+    struct Position_t {
+        f32 m_X = 0.0F, m_Y = 0.0F, m_Z = 0.0F;
+    };
+
+    struct Velocity_t {
+        f32 m_X = 1.0F, m_Y = 0.0F, m_Z = 0.0F;
+    };
+
+    struct Acceleration_t {
+        f32 m_X = 0.0F, m_Y = -9.81F, m_Z = 0.0F;
+    };
+
+    struct Damping_t {
+        f32 m_Factor = 0.99F;
+    };
+
+    struct Tag_t {};
+
+    /// range(0) components per entity, 2 to 4
+    std::unique_ptr<World> make_world(i64 components) {
+        auto world = std::make_unique<World>();
+        for (usize i = 0; i < ENTITIES; i++) {
+            switch (components) {
+                case 2:
+                    world->create(Position_t {}, Velocity_t {});
+                    break;
+                case 3:
+                    world->create(Position_t {}, Velocity_t {}, Acceleration_t {});
+                    break;
+                default:
+                    world->create(Position_t {}, Velocity_t {}, Acceleration_t {}, Damping_t {});
+                    break;
+            }
+        }
+        return world;
+    }
+
+    void integrate(Position_t& position, const Velocity_t& velocity) {
+        position.m_X += velocity.m_X * DT;
+        position.m_Y += velocity.m_Y * DT;
+        position.m_Z += velocity.m_Z * DT;
+    }
+
+    void accelerate(Velocity_t& velocity, const Acceleration_t& acceleration) {
+        velocity.m_X += acceleration.m_X * DT;
+        velocity.m_Y += acceleration.m_Y * DT;
+        velocity.m_Z += acceleration.m_Z * DT;
+    }
+
+    /// One update over every entity, touching each of its components once
+    template<typename Each> void update(i64 components, World& world, Each&& each) {
+        if (components == 2) {
+            Query<Position_t, const Velocity_t> query(world);
+            each(query, [](Position_t& p, const Velocity_t& v) { integrate(p, v); });
+        }
+        else if (components == 3) {
+            Query<Position_t, Velocity_t, const Acceleration_t> query(world);
+            each(query, [](Position_t& p, Velocity_t& v, const Acceleration_t& a) {
+                accelerate(v, a);
+                integrate(p, v);
+            });
+        }
+        else {
+            Query<Position_t, Velocity_t, const Acceleration_t, const Damping_t> query(world);
+            each(query,
+                 [](Position_t& p, Velocity_t& v, const Acceleration_t& a, const Damping_t& d) {
+                     accelerate(v, a);
+                     v.m_X *= d.m_Factor;
+                     v.m_Y *= d.m_Factor;
+                     v.m_Z *= d.m_Factor;
+                     integrate(p, v);
+                 });
+        }
+    }
+
+    /// What the ECS replaces: one heap object per entity behind a virtual update
+    class Object {
+    public:
+        virtual ~Object() = default;
+        virtual void update() = 0;
+    };
+
+    class Mover final : public Object {
+    public:
+        void update() override {
+            integrate(m_Position, m_Velocity);
+        }
+
+    private:
+        Position_t m_Position;
+        Velocity_t m_Velocity;
+    };
+} // namespace
+
+static void BM_EcsIterate(benchmark::State& state) {
+    const auto                  world = make_world(state.range(0));
+    const BenchmarkPerfCounters perf(state);
+    for (auto _ : state) {
+        update(state.range(0), *world, [](auto& query, auto function) { query.each(function); });
+    }
+    state.SetItemsProcessed(i64(state.iterations() * ENTITIES));
+}
+
+static void BM_EcsIterateParallel(benchmark::State& state) {
+    const auto world = make_world(3);
+    JobSystem  jobs({.m_WorkerCount = static_cast<u32>(state.range(0)) - 1});
+    for (auto _ : state) {
+        update(3, *world, [&jobs](auto& query, auto function) { query.par_each(jobs, function); });
+        jobs.end_frame();
+    }
+    state.SetItemsProcessed(i64(state.iterations() * ENTITIES));
+}
+
+static void BM_PointerPerObjectIterate(benchmark::State& state) {
+    std::vector<std::unique_ptr<Object>> objects;
+    objects.reserve(ENTITIES);
+    for (usize i = 0; i < ENTITIES; i++) {
+        objects.push_back(std::make_unique<Mover>());
+    }
+    // Objects created over time end up in update order that does not match memory order
+    std::shuffle(objects.begin(), objects.end(), std::mt19937(42));
+    const BenchmarkPerfCounters perf(state);
+    for (auto _ : state) {
+        for (const auto& object : objects) {
+            object->update();
+        }
+    }
+    state.SetItemsProcessed(i64(state.iterations() * ENTITIES));
+}
+
+/// Adds a tag to range(0) entities and removes it again, moving each between archetypes twice
+static void BM_EcsComponentChurn(benchmark::State& state) {
+    const auto                  world = make_world(3);
+    const auto                  churn = static_cast<usize>(state.range(0));
+    std::vector<Entity_t>       picked;
+    Query<const Position_t>     query(*world);
+    std::mt19937                random(42);
+    query.each([&](Entity_t entity, const Position_t&) {
+        if (random() % (ENTITIES / churn) == 0 && picked.size() < churn) {
+            picked.push_back(entity);
+        }
+    });
+    for (auto _ : state) {
+        for (const Entity_t entity : picked) {
+            world->add<Tag_t>(entity);
+        }
+        for (const Entity_t entity : picked) {
+            world->remove<Tag_t>(entity);
+        }
+    }
+    state.SetItemsProcessed(i64(state.iterations() * picked.size() * 2));
+}
+
+static void BM_EcsCommandBufferChurn(benchmark::State& state) {
+    const auto              world = make_world(3);
+    const auto              churn = static_cast<usize>(state.range(0));
+    std::vector<Entity_t>   picked;
+    Query<const Position_t> query(*world);
+    query.each([&](Entity_t entity, const Position_t&) {
+        if (picked.size() < churn && entity.m_Index % (ENTITIES / churn) == 0) {
+            picked.push_back(entity);
+        }
+    });
+    CommandBuffer commands(*world);
+    for (auto _ : state) {
+        for (const Entity_t entity : picked) {
+            commands.add(entity, Tag_t {});
+        }
+        world->apply(commands);
+        for (const Entity_t entity : picked) {
+            commands.remove<Tag_t>(entity);
+        }
+        world->apply(commands);
+    }
+    state.SetItemsProcessed(i64(state.iterations() * picked.size() * 2));
+}
+
+BENCHMARK(BM_EcsIterate)->DenseRange(2, 4)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_EcsIterateParallel)
+    ->Apply(thread_counts)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_PointerPerObjectIterate)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_EcsComponentChurn)->Arg(1'000)->Arg(10'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_EcsCommandBufferChurn)->Arg(1'000)->Arg(10'000)->Unit(benchmark::kMicrosecond);
+// NOLINTEND(*)
@@ -0,0 +1,235 @@
+// NOLINTBEGIN(*)
+#include "PulsarCore/BenchmarkPerfCounters.hpp"
+#include "PulsarEngine/Jobs/Fiber.hpp"
+#include "PulsarEngine/Jobs/JobSystem.hpp"
+#include "PulsarEngine/ThreadCounts.hpp"
+
+#include <atomic>
+#include <benchmark/benchmark.h>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <ucontext.h>
+#include <vector>
+
+using namespace Pulsar;
+
+namespace {
+    constexpr usize STACK_SIZE = usize {64} * 1024;
+
+    struct FiberPingPong_t {
+        Fiber  m_Caller;
+        Fiber* m_Self = nullptr;
+    };
+
+    void fiber_ping_pong(void* argument) {
+        auto& state = *static_cast<FiberPingPong_t*>(argument);
+        while (true) {
+            state.m_Self->switch_to(state.m_Caller);
+        }
+    }
+
+    struct UcontextPingPong_t {
+        ucontext_t m_Caller;
+        ucontext_t m_Self;
+    };
+
+    UcontextPingPong_t* g_Ucontext = nullptr;
+
+    void ucontext_ping_pong() {
+        while (true) {
+            swapcontext(&g_Ucontext->m_Self, &g_Ucontext->m_Caller);
+        }
+    }
+
+    /// The scheduler most engines start with: one FIFO queue, and waiting blocks the thread
+    class BlockingScheduler {
+    public:
+        explicit BlockingScheduler(u32 threads) {
+            for (u32 i = 0; i < threads; i++) {
+                m_Threads.emplace_back([this] { worker_main(); });
+            }
+        }
+
+        ~BlockingScheduler() {
+            {
+                std::lock_guard lock(m_Mutex);
+                m_Stopping = true;
+            }
+            m_Ready.notify_all();
+            for (auto& thread : m_Threads) {
+                thread.join();
+            }
+        }
+
+        void run(std::atomic<u32>& counter, std::function<void()> job) {
+            counter.fetch_add(1, std::memory_order_relaxed);
+            {
+                std::lock_guard lock(m_Mutex);
+                m_Queue.push_back({std::move(job), &counter});
+            }
+            m_Ready.notify_one();
+        }
+
+        static void wait(std::atomic<u32>& counter) {
+            for (u32 pending = counter.load(std::memory_order_acquire); pending != 0;
+                 pending     = counter.load(std::memory_order_acquire)) {
+                counter.wait(pending, std::memory_order_acquire);
+            }
+        }
+
+    private:
+        struct Job_t {
+            std::function<void()> m_Function;
+            std::atomic<u32>*     m_Counter;
+        };
+
+        void worker_main() {
+            while (true) {
+                Job_t job;
+                {
+                    std::unique_lock lock(m_Mutex);
+                    m_Ready.wait(lock, [this] { return m_Stopping || !m_Queue.empty(); });
+                    if (m_Queue.empty()) {
+                        return;
+                    }
+                    job = std::move(m_Queue.front());
+                    m_Queue.pop_front();
+                }
+                job.m_Function();
+                if (job.m_Counter->fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    job.m_Counter->notify_all();
+                }
+            }
+        }
+
+        std::mutex               m_Mutex;
+        std::condition_variable  m_Ready;
+        std::deque<Job_t>        m_Queue;
+        bool                     m_Stopping = false;
+        std::vector<std::thread> m_Threads;
+    };
+
+    // A graph of LEVELS x WIDTH jobs submitted up front, every job waits for the whole previous
+    // level: the worst case for schedulers that cannot suspend a waiting job
+    constexpr usize LEVELS = 64;
+    constexpr usize WIDTH  = 16;
+    constexpr usize WORK   = 2000;
+
+    void work() {
+        u64 value = 1;
+        for (usize i = 0; i < WORK; i++) {
+            value = value * 6364136223846793005ULL + 1442695040888963407ULL;
+        }
+        benchmark::DoNotOptimize(value);
+    }
+} // namespace
+
+#ifdef PULSAR_HAS_FIBERS
+// One iteration is two switches, there and back
+static void BM_FiberSwitch(benchmark::State& state) {
+    FiberPingPong_t pingPong;
+    Fiber           fiber(FiberStack(STACK_SIZE), &fiber_ping_pong, &pingPong);
+    pingPong.m_Self = &fiber;
+    const BenchmarkPerfCounters perf(state);
+    for (auto _ : state) {
+        pingPong.m_Caller.switch_to(fiber);
+    }
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+BENCHMARK(BM_FiberSwitch);
+#endif
+
+// swapcontext also saves and restores the signal mask, a system call each way
+static void BM_UcontextSwitch(benchmark::State& state) {
+    UcontextPingPong_t pingPong {};
+    std::vector<char>  stack(STACK_SIZE);
+    g_Ucontext = &pingPong;
+    getcontext(&pingPong.m_Self);
+    pingPong.m_Self.uc_stack.ss_sp   = stack.data();
+    pingPong.m_Self.uc_stack.ss_size = stack.size();
+    pingPong.m_Self.uc_link          = nullptr;
+    makecontext(&pingPong.m_Self, &ucontext_ping_pong, 0);
+    const BenchmarkPerfCounters perf(state);
+    for (auto _ : state) {
+        swapcontext(&pingPong.m_Caller, &pingPong.m_Self);
+    }
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+BENCHMARK(BM_UcontextSwitch);
+
+// Two threads handing a token back and forth through the kernel, what a thread-blocking wait
+// costs once the waiter actually sleeps
+static void BM_ThreadSwitch(benchmark::State& state) {
+    std::atomic<u32>  turn {0};
+    std::atomic<bool> stop {false};
+    std::thread       partner([&] {
+        while (true) {
+            turn.wait(0, std::memory_order_acquire);
+            if (stop.load(std::memory_order_relaxed)) {
+                return;
+            }
+            turn.store(0, std::memory_order_release);
+            turn.notify_one();
+        }
+    });
+    for (auto _ : state) {
+        turn.store(1, std::memory_order_release);
+        turn.notify_one();
+        turn.wait(1, std::memory_order_acquire);
+    }
+    stop.store(true, std::memory_order_relaxed);
+    turn.store(1, std::memory_order_release);
+    turn.notify_one();
+    partner.join();
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+BENCHMARK(BM_ThreadSwitch)->UseRealTime();
+
+template<bool Fibers> static void BM_DependencyGraph(benchmark::State& state) {
+    JobSystem jobs({.m_WorkerCount = static_cast<u32>(state.range(0) - 1), .m_UseFibers = Fibers});
+    for (auto _ : state) {
+        std::vector<JobCounter> levels(LEVELS);
+        for (usize level = 0; level < LEVELS; level++) {
+            for (usize i = 0; i < WIDTH; i++) {
+                jobs.run(levels[level], [&jobs, &levels, level] {
+                    if (level > 0) {
+                        jobs.wait(levels[level - 1]);
+                    }
+                    work();
+                });
+            }
+        }
+        jobs.wait(levels.back());
+        jobs.end_frame();
+    }
+    state.SetItemsProcessed(state.iterations() * LEVELS * WIDTH);
+}
+
+static void BM_DependencyGraphBlocking(benchmark::State& state) {
+    BlockingScheduler scheduler(static_cast<u32>(state.range(0)));
+    for (auto _ : state) {
+        std::vector<std::atomic<u32>> levels(LEVELS);
+        for (usize level = 0; level < LEVELS; level++) {
+            for (usize i = 0; i < WIDTH; i++) {
+                scheduler.run(levels[level], [&levels, level] {
+                    if (level > 0) {
+                        BlockingScheduler::wait(levels[level - 1]);
+                    }
+                    work();
+                });
+            }
+        }
+        BlockingScheduler::wait(levels.back());
+    }
+    state.SetItemsProcessed(state.iterations() * LEVELS * WIDTH);
+}
+
+#ifdef PULSAR_HAS_FIBERS
+BENCHMARK_TEMPLATE(BM_DependencyGraph, true)->Apply(thread_counts)->UseRealTime();
+#endif
+BENCHMARK_TEMPLATE(BM_DependencyGraph, false)->Apply(thread_counts)->UseRealTime();
+BENCHMARK(BM_DependencyGraphBlocking)->Apply(thread_counts)->UseRealTime();
+// NOLINTEND(*)
@@ -0,0 +1,92 @@
+// NOLINTBEGIN(*)
+#include "PulsarCore/BenchmarkPerfCounters.hpp"
+#include "PulsarEngine/Jobs/JobSystem.hpp"
+#include "PulsarEngine/ThreadCounts.hpp"
+
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <vector>
+
+using namespace Pulsar;
+
+namespace {
+    constexpr usize JOB_BATCH      = 1024;
+    constexpr usize PARALLEL_COUNT = usize {1} << 20;
+    constexpr usize GRAIN          = 4096;
+
+    void work(std::vector<f32>& values, usize begin, usize end) {
+        for (usize i = begin; i < end; i++) {
+            values[i] = std::sqrt(values[i] * 1.0001F + 1.0F);
+        }
+    }
+} // namespace
+
+// Submitting and running empty jobs: the cost the system adds to every job
+static void BM_JobOverhead(benchmark::State& state) {
+    JobSystem                   jobs({.m_WorkerCount = static_cast<u32>(state.range(0) - 1)});
+    const BenchmarkPerfCounters perf(state);
+    for (auto _ : state) {
+        JobCounter counter;
+        for (usize i = 0; i < JOB_BATCH; i++) {
+            jobs.run(counter, [] {});
+        }
+        jobs.wait(counter);
+        jobs.end_frame();
+    }
+    state.SetItemsProcessed(state.iterations() * JOB_BATCH);
+}
+
+// The same jobs, spawned from inside jobs so the workers submit them to their own deques
+static void BM_JobOverheadNested(benchmark::State& state) {
+    JobSystem                   jobs({.m_WorkerCount = static_cast<u32>(state.range(0) - 1)});
+    const BenchmarkPerfCounters perf(state);
+    for (auto _ : state) {
+        JobCounter outer;
+        JobCounter inner;
+        for (usize i = 0; i < JOB_BATCH / 32; i++) {
+            jobs.run(outer, [&jobs, &inner] {
+                for (usize j = 0; j < 31; j++) {
+                    jobs.run(inner, [] {});
+                }
+            });
+        }
+        jobs.wait(outer);
+        jobs.wait(inner);
+        jobs.end_frame();
+    }
+    state.SetItemsProcessed(state.iterations() * JOB_BATCH);
+}
+
+static void BM_SerialFor(benchmark::State& state) {
+    std::vector<f32>            values(PARALLEL_COUNT, 1.0F);
+    const BenchmarkPerfCounters perf(state);
+    for (auto _ : state) {
+        work(values, 0, values.size());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * PARALLEL_COUNT);
+}
+
+// Scaling over 1M items, compare against BM_SerialFor for the overhead at one thread
+static void BM_ParallelFor(benchmark::State& state) {
+    JobSystem                   jobs({.m_WorkerCount = static_cast<u32>(state.range(0) - 1)});
+    std::vector<f32>            values(PARALLEL_COUNT, 1.0F);
+    const BenchmarkPerfCounters perf(state);
+    for (auto _ : state) {
+        jobs.parallel_for(values.size(), GRAIN, [&values](usize begin, usize end) {
+            work(values, begin, end);
+        });
+        benchmark::ClobberMemory();
+        jobs.end_frame();
+    }
+    state.SetItemsProcessed(state.iterations() * PARALLEL_COUNT);
+    state.counters["threads"] = static_cast<double>(jobs.thread_count());
+}
+
+BENCHMARK(BM_JobOverhead)->Apply(thread_counts)->UseRealTime();
+BENCHMARK(BM_JobOverheadNested)->Apply(thread_counts)->UseRealTime();
+BENCHMARK(BM_SerialFor)->UseRealTime();
+BENCHMARK(BM_ParallelFor)->Apply(thread_counts)->UseRealTime();
+
+BENCHMARK_MAIN();
+// NOLINTEND(*)
@@ -0,0 +1,81 @@
+// NOLINTBEGIN(*)
+#include "PulsarCore/BenchmarkPerfCounters.hpp"
+#include "PulsarEngine/Jobs/TaskGraph.hpp"
+#include "PulsarEngine/ThreadCounts.hpp"
+
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+#include <memory>
+#include <random>
+
+using namespace Pulsar;
+
+namespace {
+    // A synthetic frame: 200 systems over 96 resources, each reading a few and writing one or two,
+    // with costs spread like real systems, a few heavy ones and many small ones
+    constexpr usize SYSTEMS   = 200;
+    constexpr usize RESOURCES = 96;
+
+    void work(u32 iterations) {
+        u64 value = 1;
+        for (u32 i = 0; i < iterations; i++) {
+            value = value * 6364136223846793005ULL + 1442695040888963407ULL;
+        }
+        benchmark::DoNotOptimize(value);
+    }
+
+    std::unique_ptr<TaskGraph> synthetic_frame(f64& totalCost) {
+        auto                    graph = std::make_unique<TaskGraph>();
+        std::mt19937            random(42);
+        std::vector<ResourceId> resources;
+        for (usize i = 0; i < RESOURCES; i++) {
+            resources.push_back(graph->resource(fmt::format("Resource{}", i)));
+        }
+        std::uniform_int_distribution<usize> pick(0, RESOURCES - 1);
+        std::uniform_int_distribution<usize> count(1, 3);
+        std::lognormal_distribution<f64>     cost(8.5, 1.0);
+        for (usize i = 0; i < SYSTEMS; i++) {
+            TaskDesc_t desc {.m_Name = fmt::format("System{}", i)};
+            for (usize j = count(random); j > 0; j--) {
+                desc.m_Reads.push_back(resources[pick(random)]);
+            }
+            for (usize j = count(random) / 2 + 1; j > 0; j--) {
+                desc.m_Writes.push_back(resources[pick(random)]);
+            }
+            const auto iterations = static_cast<u32>(std::min(cost(random), 200000.0));
+            desc.m_Cost           = iterations;
+            totalCost += iterations;
+            static_cast<void>(graph->add(std::move(desc), [iterations] { work(iterations); }));
+        }
+        graph->compile();
+        return graph;
+    }
+} // namespace
+
+static void BM_TaskGraphSerial(benchmark::State& state) {
+    f64                         totalCost = 0.0;
+    const auto                  graph     = synthetic_frame(totalCost);
+    const BenchmarkPerfCounters perf(state);
+    for (auto _ : state) {
+        graph->run_serial();
+    }
+    state.SetItemsProcessed(state.iterations() * SYSTEMS);
+}
+BENCHMARK(BM_TaskGraphSerial)->Unit(benchmark::kMicrosecond);
+
+static void BM_TaskGraph(benchmark::State& state) {
+    JobSystem  jobs({.m_WorkerCount = static_cast<u32>(state.range(0) - 1)});
+    f64        totalCost = 0.0;
+    const auto graph     = synthetic_frame(totalCost);
+    for (auto _ : state) {
+        graph->run(jobs);
+        jobs.end_frame();
+    }
+    state.SetItemsProcessed(state.iterations() * SYSTEMS);
+    // The speedup over serial is bounded by the total work over the longest chain
+    state.counters["max_speedup"]   = totalCost / graph->priority(graph->critical_path().front());
+    state.counters["edges_removed"] = static_cast<f64>(graph->redundant_edge_count());
+    state.counters["edges_removed"]       = static_cast<f64>(graph->redundant_edge_count());
+}
+BENCHMARK(BM_TaskGraph)->Apply(thread_counts)->Unit(benchmark::kMicrosecond)->UseRealTime();
+// NOLINTEND(*)
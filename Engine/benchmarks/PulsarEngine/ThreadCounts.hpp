@@ -0,0 +1,18 @@
+#pragma once
+
+#include "PulsarCore/Types.hpp"
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <thread>
+
+namespace Pulsar {
+    /// Registers thread counts from 1 up to one per core as the first argument
+    inline void thread_counts(benchmark::internal::Benchmark* benchmark) {
+        const auto cores = std::max(std::thread::hardware_concurrency(), 1U);
+        for (u32 threads = 1; threads < cores; threads *= 2) {
+            benchmark->Arg(threads);
+        }
+        benchmark->Arg(cores);
+    }
+} // namespace Pulsar
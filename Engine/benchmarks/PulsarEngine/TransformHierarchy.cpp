@@ -0,0 +1,136 @@
+// NOLINTBEGIN(*)
+#include "PulsarCore/BenchmarkPerfCounters.hpp"
+#include "PulsarEngine/Jobs/JobSystem.hpp"
+#include "PulsarEngine/Scene/TransformHierarchy.hpp"
+#include "PulsarEngine/ThreadCounts.hpp"
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace Pulsar;
+
+namespace {
+    /// Every node below a random earlier one (a random recursive tree, about 14 levels deep at
+    /// 1M nodes), except for a few roots
+    struct Scene_t {
+        explicit Scene_t(usize count) {
+            std::mt19937                          rng(42);
+            std::uniform_real_distribution<float> offset(-1.0F, 1.0F);
+            nodes.reserve(count);
+            for (usize i = 0; i < count; i++) {
+                const TransformNode_t parent =
+                    i < 16 ? NULL_TRANSFORM : nodes[rng() % nodes.size()];
+                nodes.push_back(hierarchy.create(parent, {offset(rng), offset(rng), offset(rng)},
+                    Quat::from_axis_angle({0.0F, 0.6F, 0.8F}, offset(rng))));
+            }
+            hierarchy.update();
+        }
+
+        /// The nodes to move every frame, `percent` of all of them
+        std::vector<TransformNode_t> pick(i64 percent) const {
+            std::vector<TransformNode_t> picked = nodes;
+            std::shuffle(picked.begin(), picked.end(), std::mt19937(7));
+            picked.resize(nodes.size() * static_cast<usize>(percent) / 100);
+            return picked;
+        }
+
+        TransformHierarchy           hierarchy;
+        std::vector<TransformNode_t> nodes;
+    };
+
+    void move(TransformHierarchy& hierarchy, const std::vector<TransformNode_t>& picked, float t) {
+        for (const TransformNode_t node : picked) {
+            hierarchy.set_translation(node, {t, 0.0F, 0.0F});
+        }
+    }
+
+    /// What the hierarchy replaces: a heap object per node, and every frame a recursive walk
+    /// recomputing all of them
+    struct NaiveNode_t {
+        Vec3                                      m_Translation {};
+        Quat                                      m_Rotation = Quat::identity();
+        Vec3                                      m_Scale {1.0F, 1.0F, 1.0F};
+        Mat4                                      m_World {};
+        std::vector<std::unique_ptr<NaiveNode_t>> m_Children;
+    };
+
+    void naive_update(NaiveNode_t& node, const Mat4& parent) {
+        node.m_World = parent * Mat4::from_trs(node.m_Translation, node.m_Rotation, node.m_Scale);
+        for (const auto& child : node.m_Children) {
+            naive_update(*child, node.m_World);
+        }
+    }
+} // namespace
+
+/// range(0) nodes, range(1) percent of them moved per frame
+static void BM_TransformUpdate(benchmark::State& state) {
+    Scene_t                     scene(static_cast<usize>(state.range(0)));
+    const auto                  picked     = scene.pick(state.range(1));
+    usize                       recomputed = 0;
+    float                       t          = 0.0F;
+    const BenchmarkPerfCounters perf(state);
+    for (auto _ : state) {
+        move(scene.hierarchy, picked, t += 1.0F);
+        recomputed += scene.hierarchy.update();
+    }
+    state.SetItemsProcessed(i64(recomputed));
+    state.counters["Recomputed"] =
+        benchmark::Counter(f64(recomputed), benchmark::Counter::kAvgIterations);
+}
+
+/// 1M nodes with `Percent` of them moved per frame, range(0) threads
+template<i64 Percent> static void BM_TransformUpdateParallel(benchmark::State& state) {
+    Scene_t    scene(1'000'000);
+    const auto picked     = scene.pick(Percent);
+    usize      recomputed = 0;
+    float      t          = 0.0F;
+    JobSystem  jobs({.m_WorkerCount = static_cast<u32>(state.range(0)) - 1});
+    for (auto _ : state) {
+        move(scene.hierarchy, picked, t += 1.0F);
+        recomputed += scene.hierarchy.update(jobs);
+        jobs.end_frame();
+    }
+    state.SetItemsProcessed(i64(recomputed));
+}
+
+static void BM_TransformNaive(benchmark::State& state) {
+    const auto                                count = static_cast<usize>(state.range(0));
+    std::mt19937                              rng(42);
+    std::vector<NaiveNode_t*>                 nodes;
+    std::vector<std::unique_ptr<NaiveNode_t>> roots;
+    for (usize i = 0; i < count; i++) {
+        auto  node = std::make_unique<NaiveNode_t>();
+        auto* raw  = node.get();
+        if (i < 16) {
+            roots.push_back(std::move(node));
+        }
+        else {
+            nodes[rng() % nodes.size()]->m_Children.push_back(std::move(node));
+        }
+        nodes.push_back(raw);
+    }
+    const BenchmarkPerfCounters perf(state);
+    for (auto _ : state) {
+        for (const auto& root : roots) {
+            naive_update(*root, Mat4::identity());
+        }
+    }
+    state.SetItemsProcessed(i64(state.iterations() * count));
+}
+
+BENCHMARK(BM_TransformUpdate)
+    ->ArgsProduct({{100'000, 1'000'000}, {1, 10, 100}})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TransformUpdateParallel<10>)
+    ->Apply(thread_counts)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TransformUpdateParallel<100>)
+    ->Apply(thread_counts)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TransformNaive)->Arg(100'000)->Arg(1'000'000)->Unit(benchmark::kMillisecond);
+// NOLINTEND(*)
@@ -0,0 +1,98 @@
+#include "MainLoop.hpp"
+
+#include "PulsarCore/Util/Profiler.hpp"
+#include "PulsarCore/Util/Sleep.hpp"
+#include "PulsarCore/Util/Timestamp.hpp"
+
+#include <algorithm>
+#include <fmt/format.h>
+
+namespace Pulsar {
+    Application::~Application() = default;
+
+    std::string FrameStats_t::summary() const {
+        constexpr f64 MS = 1e-6;
+        return fmt::format("{} frames, mean {:.3f} ms, p50 {:.3f} ms, p99 {:.3f} ms, "
+                           "max {:.3f} ms, {} late, {} simulation steps",
+            m_Frames, m_FrameTimes.mean() * MS,
+            static_cast<f64>(m_FrameTimes.percentile(0.5)) * MS,
+            static_cast<f64>(m_FrameTimes.percentile(0.99)) * MS,
+            static_cast<f64>(m_FrameTimes.max()) * MS, m_LateFrames, m_SimulationSteps);
+    }
+
+    MainLoop::MainLoop(Window& window, Application& application, const MainLoopConfig_t& config)
+        : m_Window(window), m_Application(application), m_Config(config),
+          m_SimulatedUntilNs(window.time_ns()), m_NextFrameNs(monotonic_ns()),
+          m_LastFrameNs(m_NextFrameNs) {
+        m_Config.m_SimulationStepNs = std::max<u64>(m_Config.m_SimulationStepNs, 1);
+        if (m_Config.m_FrameBudgetNs == 0) {
+            m_Config.m_FrameBudgetNs = m_Config.m_TargetFrameNs * 3 / 2;
+        }
+    }
+
+    void MainLoop::run() {
+        // Time spent between construction and the first frame is not a frame
+        m_NextFrameNs = monotonic_ns();
+        m_LastFrameNs = m_NextFrameNs;
+        while (!m_Window.should_close()
+               && (m_Config.m_FrameLimit == 0 || m_Stats.m_Frames < m_Config.m_FrameLimit)) {
+            frame();
+        }
+    }
+
+    void MainLoop::frame() {
+        PULSAR_PROFILE_SCOPE("Frame");
+        m_Window.poll_events();
+        m_Application.handle_events(m_Window.events());
+
+        const u64 now   = m_Window.time_ns();
+        u64       delta = now - m_SimulatedUntilNs;
+        m_SimulatedUntilNs = now;
+        if (delta > m_Config.m_MaxFrameDeltaNs) {
+            m_Stats.m_DroppedSimulationNs += delta - m_Config.m_MaxFrameDeltaNs;
+            delta = m_Config.m_MaxFrameDeltaNs;
+        }
+        m_AccumulatorNs += delta;
+
+        const u64 step  = m_Config.m_SimulationStepNs;
+        u32       steps = 0;
+        while (m_AccumulatorNs >= step && steps < m_Config.m_MaxStepsPerFrame) {
+            m_Application.fixed_update(static_cast<f64>(step) * 1e-9);
+            m_AccumulatorNs -= step;
+            steps++;
+        }
+        if (m_AccumulatorNs >= step) {
+            // Out of steps: keep the fraction for interpolation, drop the whole steps
+            m_Stats.m_DroppedSimulationNs += m_AccumulatorNs - m_AccumulatorNs % step;
+            m_AccumulatorNs %= step;
+        }
+        m_Stats.m_SimulationSteps += steps;
+
+        m_Application.render(static_cast<f64>(m_AccumulatorNs) / static_cast<f64>(step));
+        pace();
+
+        const u64 end       = monotonic_ns();
+        const u64 frameTime = end - m_LastFrameNs;
+        m_LastFrameNs       = end;
+        m_Stats.m_FrameTimes.record(frameTime);
+        if (m_Config.m_FrameBudgetNs != 0 && frameTime > m_Config.m_FrameBudgetNs) {
+            m_Stats.m_LateFrames++;
+        }
+        m_Stats.m_Frames++;
+    }
+
+    void MainLoop::pace() {
+        if (m_Config.m_TargetFrameNs == 0) {
+            return;
+        }
+        PULSAR_PROFILE_SCOPE("Frame pacing");
+        m_NextFrameNs += m_Config.m_TargetFrameNs;
+        const u64 now = monotonic_ns();
+        if (m_NextFrameNs <= now) {
+            // Missed the slot: start the schedule over rather than rushing to catch up
+            m_NextFrameNs = now;
+            return;
+        }
+        sleep_until_ns(m_NextFrameNs, m_Config.m_PacingSpinNs);
+    }
+} // namespace Pulsar
@@ -0,0 +1,112 @@
+#pragma once
+
+#include "PulsarCore/Types.hpp"
+#include "PulsarCore/Util/Histogram.hpp"
+#include "PulsarWindow/Event.hpp"
+#include "PulsarWindow/Window.hpp"
+
+#include <span>
+#include <string>
+
+namespace Pulsar {
+    /// What the main loop drives
+    class Application {
+    public:
+        Application() = default;
+        virtual ~Application();
+        Application(const Application&)            = delete;
+        Application(Application&&)                 = delete;
+        Application& operator=(const Application&) = delete;
+        Application& operator=(Application&&)      = delete;
+
+        /// Once per frame, with the events `poll_events` just collected
+        virtual void handle_events([[maybe_unused]] std::span<const Event_t> events) {
+        }
+
+        /// Advances the simulation by exactly one step, `stepSeconds` is always the same
+        virtual void fixed_update(f64 stepSeconds) = 0;
+
+        /// Draws the simulation `alpha` (in [0, 1)) of the way from the state before the last
+        /// `fixed_update` to the state after it
+        virtual void render(f64 alpha) = 0;
+    };
+
+    struct MainLoopConfig_t {
+        /// Length of a simulation step
+        u64 m_SimulationStepNs = 16'666'667;
+        /// Frame period the loop paces to, 0 renders as fast as it can
+        u64 m_TargetFrameNs = 0;
+        /// The last part of every pacing sleep is spun out instead of slept, for accuracy
+        u64 m_PacingSpinNs = 200'000;
+        /// Frames that take longer count as late in the stats, 0 uses one and a half target periods
+        /// (a frame that missed its slot)
+        u64 m_FrameBudgetNs = 0;
+        /// Longest frame the simulation catches up on, the rest is dropped (after a breakpoint,
+        /// a stall loading assets) so a slow frame cannot snowball into slower ones
+        u64 m_MaxFrameDeltaNs = 250'000'000;
+        /// Simulation steps one frame runs at most, the time left over is dropped
+        u32 m_MaxStepsPerFrame = 8;
+        /// Frames `run` renders before it returns, 0 runs until the window closes
+        u64 m_FrameLimit = 0;
+    };
+
+    struct FrameStats_t {
+        /// Time between the ends of consecutive frames, sleeping included
+        LatencyHistogram m_FrameTimes;
+        u64              m_Frames          = 0;
+        u64              m_SimulationSteps = 0;
+        /// Frames over the frame budget
+        u64 m_LateFrames = 0;
+        /// Simulation time skipped by the catch-up limits
+        u64 m_DroppedSimulationNs = 0;
+
+        /// One line for logs and benchmarks: frame count, frame time mean, p50, p99 and max in
+        /// milliseconds, late frames and simulation steps
+        [[nodiscard]] std::string summary() const;
+    };
+
+    /// A fixed-timestep game loop: the simulation advances in equal steps, rendering runs at
+    /// whatever rate the frame pacing allows and interpolates between the last two steps
+    /// # Usage
+    /// Every frame polls the window, hands the events to the application, runs as many
+    /// `fixed_update` steps as the window clock advanced, then renders. The simulation runs on
+    /// `Window::time_ns`, so it is deterministic on a `HeadlessWindow`. Pacing and the stats run
+    /// on the real monotonic clock.
+    /// # Latency
+    /// The pacing sleep sits between rendering a frame and polling the next one: input is read
+    /// right before it is simulated, never a whole frame period earlier. Pacing deadlines are
+    /// absolute, so sleep overshoot does not accumulate. A frame that misses its deadline moves
+    /// the schedule instead of rushing the next frames to catch up.
+    class MainLoop {
+    public:
+        MainLoop(Window& window, Application& application, const MainLoopConfig_t& config = {});
+
+        /// Runs frames until the window should close or the frame limit is reached
+        void run();
+
+        /// Runs one frame, for hosts that drive the loop themselves
+        void frame();
+
+        [[nodiscard]] const FrameStats_t& stats() const {
+            return m_Stats;
+        }
+
+        [[nodiscard]] const MainLoopConfig_t& config() const {
+            return m_Config;
+        }
+
+    private:
+        void pace();
+
+        Window&          m_Window;
+        Application&     m_Application;
+        MainLoopConfig_t m_Config;
+        FrameStats_t     m_Stats;
+        /// Window time the simulation has caught up to, and the part of a step not simulated yet
+        u64 m_SimulatedUntilNs = 0;
+        u64 m_AccumulatorNs    = 0;
+        /// Monotonic times of the next pacing deadline and of the end of the last frame
+        u64 m_NextFrameNs = 0;
+        u64 m_LastFrameNs = 0;
+    };
+} // namespace Pulsar
@@ -0,0 +1,104 @@
+#include "Archetype.hpp"
+
+#include "PulsarCore/Util/Macros.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fmt/format.h>
+
+namespace Pulsar {
+    namespace {
+        constexpr u32 align_up(u32 value, u32 alignment) {
+            return (value + alignment - 1) / alignment * alignment;
+        }
+    } // namespace
+
+    Archetype::Archetype(const ComponentMask& mask, GC::PoolAllocator& chunkPool)
+        : m_Mask(mask), m_ChunkPool(&chunkPool) {
+        u32 bytesPerEntity = sizeof(Entity_t);
+        for (ComponentId id = 0; id < MAX_COMPONENTS; id++) {
+            if (mask.test(id)) {
+                m_Components.push_back(id);
+                m_Infos.push_back(&component_info(id));
+                m_ColumnOf[id]  = static_cast<u8>(m_Components.size());
+                bytesPerEntity += m_Infos.back()->m_Size;
+            }
+        }
+        m_Offsets.resize(m_Components.size());
+
+        // The padding between columns can push the estimate over, then take fewer rows
+        m_ChunkCapacity = static_cast<u32>(CHUNK_SIZE) / bytesPerEntity;
+        while (true) {
+            u32 offset = m_ChunkCapacity * static_cast<u32>(sizeof(Entity_t));
+            for (usize i = 0; i < m_Components.size(); i++) {
+                offset       = align_up(offset, m_Infos[i]->m_Alignment);
+                m_Offsets[i] = offset;
+                offset      += m_ChunkCapacity * m_Infos[i]->m_Size;
+            }
+            if (offset <= CHUNK_SIZE) {
+                break;
+            }
+            m_ChunkCapacity--;
+        }
+        PULSAR_ASSERT(m_ChunkCapacity > 0, "One entity's components do not fit in a chunk");
+        // Asserts compile out, and without a row per chunk every push_back writes past its chunk
+        if (m_ChunkCapacity == 0) {
+            fmt::print(stderr, "An archetype needs {} bytes per entity, chunks have {}\n",
+                bytesPerEntity, CHUNK_SIZE);
+            std::abort();
+        }
+    }
+
+    Archetype::~Archetype() {
+        for (const Chunk_t& chunk : m_Chunks) {
+            for (usize c = 0; c < m_Components.size(); c++) {
+                if (m_Infos[c]->m_Destroy == nullptr) {
+                    continue;
+                }
+                for (u32 row = 0; row < chunk.m_Count; row++) {
+                    m_Infos[c]->m_Destroy(column_at(chunk, static_cast<u32>(c), row));
+                }
+            }
+            m_ChunkPool->deallocate(chunk.m_Data);
+        }
+    }
+
+    EntityLocation_t Archetype::push_back(Entity_t entity) {
+        if (m_Chunks.empty() || m_Chunks.back().m_Count == m_ChunkCapacity) {
+            m_Chunks.push_back({static_cast<std::byte*>(m_ChunkPool->allocate()), 0});
+        }
+        Chunk_t&  chunk      = m_Chunks.back();
+        const u32 row        = chunk.m_Count++;
+        entities(chunk)[row] = entity;
+        return {static_cast<u32>(m_Chunks.size() - 1), row};
+    }
+
+    Entity_t Archetype::erase(EntityLocation_t location, bool destroy) {
+        Chunk_t& chunk = m_Chunks[location.m_Chunk];
+        if (destroy) {
+            for (usize c = 0; c < m_Components.size(); c++) {
+                if (m_Infos[c]->m_Destroy != nullptr) {
+                    m_Infos[c]->m_Destroy(column_at(chunk, static_cast<u32>(c), location.m_Row));
+                }
+            }
+        }
+
+        Chunk_t&  last    = m_Chunks.back();
+        const u32 lastRow = last.m_Count - 1;
+        Entity_t  moved   = NULL_ENTITY;
+        if (&last != &chunk || lastRow != location.m_Row) {
+            for (usize c = 0; c < m_Components.size(); c++) {
+                const auto column = static_cast<u32>(c);
+                internal::relocate(*m_Infos[c], column_at(chunk, column, location.m_Row),
+                         column_at(last, column, lastRow));
+            }
+            moved                           = entities(last)[lastRow];
+            entities(chunk)[location.m_Row] = moved;
+        }
+        if (--last.m_Count == 0) {
+            m_ChunkPool->deallocate(last.m_Data);
+            m_Chunks.pop_back();
+        }
+        return moved;
+    }
+} // namespace Pulsar
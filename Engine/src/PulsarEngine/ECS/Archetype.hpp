@@ -0,0 +1,116 @@
+#pragma once
+
+#include "PulsarCore/GC/Allocators/Pool.hpp"
+#include "PulsarCore/Types.hpp"
+#include "PulsarEngine/ECS/Component.hpp"
+#include "PulsarEngine/ECS/Entity.hpp"
+
+#include <array>
+#include <cstddef>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace Pulsar {
+    /// Size of the blocks the components of an archetype are stored in
+    constexpr usize CHUNK_SIZE = usize {16} * 1024;
+
+    /// A block of `CHUNK_SIZE` bytes holding the components of up to `Archetype::chunk_capacity`
+    /// entities, one column per component type
+    struct Chunk_t {
+        std::byte* m_Data  = nullptr;
+        u32        m_Count = 0;
+    };
+
+    /// Where an entity's components live
+    struct EntityLocation_t {
+        u32 m_Chunk = 0;
+        u32 m_Row   = 0;
+    };
+
+    /// The entities that have exactly one set of component types, stored column by column
+    /// # Layout
+    /// Every chunk starts with the entity handles, followed by one array per component type in
+    /// the order of their ids. Entities are kept dense: only the last chunk has free rows, a
+    /// removed entity's row is filled with the archetype's last one. Iterating an archetype is
+    /// therefore a linear walk over full chunks.
+    class Archetype {
+    public:
+        Archetype(const ComponentMask& mask, GC::PoolAllocator& chunkPool);
+        ~Archetype();
+
+        Archetype(const Archetype&)            = delete;
+        Archetype& operator=(const Archetype&) = delete;
+        Archetype(Archetype&&)                 = delete;
+        Archetype& operator=(Archetype&&)      = delete;
+
+        [[nodiscard]] const ComponentMask& mask() const {
+            return m_Mask;
+        }
+
+        /// Component ids in column order
+        [[nodiscard]] std::span<const ComponentId> components() const {
+            return m_Components;
+        }
+
+        /// Column of a component type, -1 if the archetype does not have it
+        [[nodiscard]] i32 column_of(ComponentId id) const {
+            return static_cast<i32>(m_ColumnOf[id]) - 1;
+        }
+
+        [[nodiscard]] u32 chunk_capacity() const {
+            return m_ChunkCapacity;
+        }
+
+        [[nodiscard]] std::span<const Chunk_t> chunks() const {
+            return m_Chunks;
+        }
+
+        [[nodiscard]] usize entity_count() const {
+            if (m_Chunks.empty()) {
+                return 0;
+            }
+            return (m_Chunks.size() - 1) * m_ChunkCapacity + m_Chunks.back().m_Count;
+        }
+
+        [[nodiscard]] Entity_t* entities(const Chunk_t& chunk) const {
+            return reinterpret_cast<Entity_t*>(chunk.m_Data);
+        }
+
+        /// Start of a column in a chunk
+        [[nodiscard]] void* column(const Chunk_t& chunk, u32 column) const {
+            return chunk.m_Data + m_Offsets[column];
+        }
+
+        [[nodiscard]] void* component(EntityLocation_t location, u32 column) const {
+            return column_at(m_Chunks[location.m_Chunk], column, location.m_Row);
+        }
+
+        /// Appends a row for `entity`, the caller constructs its components
+        [[nodiscard]] EntityLocation_t push_back(Entity_t entity);
+
+        /// Removes a row by moving the last row into it. Destroys the row's components first if
+        /// `destroy` is set, otherwise they must have been moved out already. Returns the entity
+        /// that was moved into the row, or `NULL_ENTITY` if the row was the last one.
+        Entity_t erase(EntityLocation_t location, bool destroy);
+
+        /// Archetypes one component away from this one, filled in by the `World`
+        std::unordered_map<ComponentId, u32> m_AddEdges;
+        std::unordered_map<ComponentId, u32> m_RemoveEdges;
+
+    private:
+        [[nodiscard]] void* column_at(const Chunk_t& chunk, u32 column, u32 row) const {
+            return chunk.m_Data + m_Offsets[column] +
+                   static_cast<usize>(row) * m_Infos[column]->m_Size;
+        }
+
+        ComponentMask                       m_Mask;
+        std::vector<ComponentId>            m_Components;
+        std::vector<const ComponentInfo_t*> m_Infos;
+        std::vector<u32>                    m_Offsets;
+        std::array<u8, MAX_COMPONENTS>      m_ColumnOf {};
+        u32                                 m_ChunkCapacity = 0;
+        std::vector<Chunk_t>                m_Chunks;
+        GC::PoolAllocator*                  m_ChunkPool;
+    };
+} // namespace Pulsar
@@ -0,0 +1,17 @@
+#include "CommandBuffer.hpp"
+
+namespace Pulsar {
+    void CommandBuffer::clear() {
+        for (const Command_t& command : m_Commands) {
+            if (command.m_Payload == nullptr) {
+                continue;
+            }
+            if (const ComponentInfo_t& info = component_info(command.m_Value);
+                info.m_Destroy != nullptr) {
+                info.m_Destroy(command.m_Payload);
+            }
+        }
+        m_Commands.clear();
+        m_Payloads.reset();
+    }
+} // namespace Pulsar
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "PulsarCore/GC/Allocators/Frame.hpp"
+#include "PulsarCore/Types.hpp"
+#include "PulsarEngine/ECS/Component.hpp"
+#include "PulsarEngine/ECS/Entity.hpp"
+#include "PulsarEngine/ECS/World.hpp"
+
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Pulsar {
+    /// Structural changes recorded while a `World` is iterated, applied later by `World::apply`
+    /// # Usage
+    /// Give every thread that iterates its own buffer, record into it from query callbacks and
+    /// apply the buffers once the iteration is done. Commands apply in recording order; commands
+    /// for entities that are no longer alive by then are skipped. Entities created here get
+    /// their id right away, so later commands and components can refer to them.
+    /// # Performance
+    /// Recording appends to a vector and moves component values into a frame allocator, both
+    /// reused after `apply`. A created entity is placed in its final archetype at once.
+    class CommandBuffer {
+    public:
+        explicit CommandBuffer(World& world) : m_World(&world) {
+        }
+
+        ~CommandBuffer() {
+            clear();
+        }
+
+        CommandBuffer(const CommandBuffer&)            = delete;
+        CommandBuffer& operator=(const CommandBuffer&) = delete;
+        CommandBuffer(CommandBuffer&&)                 = delete;
+        CommandBuffer& operator=(CommandBuffer&&)      = delete;
+
+        /// Creates an entity with the given components
+        template<typename... Ts> Entity_t create(Ts&&... components) {
+            static_assert(internal::DISTINCT_TYPES<std::decay_t<Ts>...>,
+                "An entity has at most one component of each type");
+            const Entity_t entity = m_World->reserve_entity();
+            m_Commands.push_back({Op::Create, entity, static_cast<u32>(sizeof...(Ts)), nullptr});
+            (record<std::decay_t<Ts>>(Op::Init, entity, std::forward<Ts>(components)), ...);
+            return entity;
+        }
+
+        void destroy(Entity_t entity) {
+            m_Commands.push_back({Op::Destroy, entity, 0, nullptr});
+        }
+
+        /// Adds a component, or replaces it if the entity has one by then
+        template<typename T> void add(Entity_t entity, T&& component) {
+            record<std::decay_t<T>>(Op::Add, entity, std::forward<T>(component));
+        }
+
+        template<Component T> void remove(Entity_t entity) {
+            m_Commands.push_back({Op::Remove, entity, component_id<T>(), nullptr});
+        }
+
+        [[nodiscard]] bool empty() const {
+            return m_Commands.empty();
+        }
+
+        [[nodiscard]] usize size() const {
+            return m_Commands.size();
+        }
+
+        /// Drops the recorded commands without applying them. Entities created by them stay
+        /// reserved: their ids are never handed out again.
+        void clear();
+
+    private:
+        friend class World;
+
+        enum class Op : u8 {
+            Create,
+            /// A component of the entity created by the preceding `Create`
+            Init,
+            Destroy,
+            Add,
+            Remove,
+        };
+
+        struct Command_t {
+            Op       m_Op;
+            Entity_t m_Entity;
+            /// The component type, or the number of `Init` commands following a `Create`
+            u32   m_Value;
+            void* m_Payload;
+        };
+
+        template<Component T, typename U> void record(Op op, Entity_t entity, U&& component) {
+            T* payload = m_Payloads.create<T>(std::forward<U>(component));
+            m_Commands.push_back({op, entity, component_id<T>(), payload});
+        }
+
+        World*                 m_World;
+        std::vector<Command_t> m_Commands;
+        GC::FrameAllocator     m_Payloads {usize {16} * 1024, GC::MemoryTag::Engine};
+    };
+} // namespace Pulsar
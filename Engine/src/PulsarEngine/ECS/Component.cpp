@@ -0,0 +1,36 @@
+#include "Component.hpp"
+
+#include "PulsarCore/Sync/Mutex.hpp"
+
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+#include <fmt/format.h>
+#include <mutex>
+
+namespace Pulsar {
+    namespace {
+        // Written once per type under the lock, before its id is handed out
+        // NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+        std::array<ComponentInfo_t, MAX_COMPONENTS> g_Components;
+        u32                                         g_ComponentCount = 0;
+        Mutex                                       g_ComponentMutex;
+        // NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
+    } // namespace
+
+    namespace internal {
+        ComponentId register_component(const ComponentInfo_t& info) {
+            std::lock_guard lock(g_ComponentMutex);
+            if (g_ComponentCount == MAX_COMPONENTS) {
+                fmt::print(stderr, "More than {} component types registered\n", MAX_COMPONENTS);
+                std::abort();
+            }
+            g_Components[g_ComponentCount] = info;
+            return g_ComponentCount++;
+        }
+    } // namespace internal
+
+    const ComponentInfo_t& component_info(ComponentId id) {
+        return g_Components[id];
+    }
+} // namespace Pulsar
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "PulsarCore/Types.hpp"
+
+#include <bitset>
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Pulsar {
+    using ComponentId = u32;
+
+    constexpr usize MAX_COMPONENTS = 128;
+
+    /// The set of component types of an archetype or a query
+    using ComponentMask = std::bitset<MAX_COMPONENTS>;
+
+    /// A quarter of a chunk: large state belongs behind a pointer, and an entity with a few large
+    /// components still gets several rows per chunk
+    constexpr usize MAX_COMPONENT_SIZE = 4096;
+
+    /// What can be stored as a component: chunks move components around whenever entities change
+    /// archetype or are removed, so moving must not throw. Chunks are only aligned like
+    /// `std::max_align_t`, and one entity's components have to fit in a chunk.
+    template<typename T>
+    concept Component = std::is_object_v<T> && !std::is_const_v<T> && !std::is_volatile_v<T> &&
+                        std::is_nothrow_move_constructible_v<T> &&
+                        std::is_nothrow_destructible_v<T> &&
+                        alignof(T) <= alignof(std::max_align_t) && sizeof(T) <= MAX_COMPONENT_SIZE;
+
+    /// How to handle the components of one type without knowing the type
+    struct ComponentInfo_t {
+        u32 m_Size      = 0;
+        u32 m_Alignment = 0;
+        /// Move-constructs into `dst` and destroys `src`, nullptr when a `memcpy` does
+        void (*m_Relocate)(void* dst, void* src) = nullptr;
+        /// nullptr when the type is trivially destructible
+        void (*m_Destroy)(void* component) = nullptr;
+    };
+
+    namespace internal {
+        /// Assigns the next id, aborts once `MAX_COMPONENTS` types are registered
+        ComponentId register_component(const ComponentInfo_t& info);
+
+        template<typename T> void relocate_component(void* dst, void* src) {
+            T* source = std::launder(static_cast<T*>(src));
+            ::new (dst) T(std::move(*source));
+            source->~T();
+        }
+
+        template<typename T> void destroy_component(void* component) {
+            std::launder(static_cast<T*>(component))->~T();
+        }
+
+        template<typename T, typename... Ts>
+        constexpr usize TYPE_COUNT = (usize {std::is_same_v<T, Ts>} + ... + 0);
+
+        /// No type appears twice in `Ts`: an entity has at most one component of a type
+        template<typename... Ts>
+        constexpr bool DISTINCT_TYPES = ((TYPE_COUNT<Ts, Ts...> == 1) && ...);
+
+        inline void relocate(const ComponentInfo_t& info, void* dst, void* src) {
+            if (info.m_Relocate != nullptr) {
+                info.m_Relocate(dst, src);
+            }
+            else {
+                std::memcpy(dst, src, info.m_Size);
+            }
+        }
+    } // namespace internal
+
+    /// The id of a component type, assigned on first use. Ids differ between runs, never persist
+    /// them.
+    template<Component T> [[nodiscard]] ComponentId component_id() {
+        static const ComponentId ID = internal::register_component({
+            .m_Size      = sizeof(T),
+            .m_Alignment = alignof(T),
+            .m_Relocate =
+                std::is_trivially_copyable_v<T> ? nullptr : &internal::relocate_component<T>,
+            .m_Destroy =
+                std::is_trivially_destructible_v<T> ? nullptr : &internal::destroy_component<T>,
+        });
+        return ID;
+    }
+
+    [[nodiscard]] const ComponentInfo_t& component_info(ComponentId id);
+} // namespace Pulsar
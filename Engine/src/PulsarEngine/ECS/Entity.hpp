@@ -0,0 +1,28 @@
+#pragma once
+
+#include "PulsarCore/Types.hpp"
+
+#include <limits>
+
+namespace Pulsar {
+    /// A handle to an entity of a `World`
+    /// # Usage
+    /// The index names a slot that is reused once the entity is destroyed, the generation tells
+    /// the entities that used the slot apart: a handle to a destroyed entity stays invalid (see
+    /// `World::is_alive`) even after its slot was reused. Cheap to copy and to store in
+    /// components.
+    struct Entity_t {
+        static constexpr u32 INVALID_INDEX = std::numeric_limits<u32>::max();
+
+        u32 m_Index      = INVALID_INDEX;
+        u32 m_Generation = 0;
+
+        [[nodiscard]] bool is_null() const {
+            return m_Index == INVALID_INDEX;
+        }
+
+        [[nodiscard]] bool operator==(const Entity_t& other) const = default;
+    };
+
+    constexpr Entity_t NULL_ENTITY {};
+} // namespace Pulsar
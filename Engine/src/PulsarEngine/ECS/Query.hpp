@@ -0,0 +1,153 @@
+#pragma once
+
+#include "PulsarCore/Types.hpp"
+#include "PulsarEngine/ECS/Archetype.hpp"
+#include "PulsarEngine/ECS/Component.hpp"
+#include "PulsarEngine/ECS/World.hpp"
+#include "PulsarEngine/Jobs/JobSystem.hpp"
+
+#include <array>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Pulsar {
+    /// The entities of a world that have all of `Ts`, and access to those components
+    /// # Usage
+    /// `Query<Transform, const Velocity> query(world)` then `query.each([](Transform&, const
+    /// Velocity&) {...})`; the callback may take the `Entity_t` first. `const` components are
+    /// only read, which is what parallel systems touching the same types rely on. Keep a query
+    /// around between frames: it remembers the matching archetypes and only checks archetypes
+    /// created since. Never change the world's structure while iterating, record the changes in
+    /// a `CommandBuffer` instead.
+    /// # Performance
+    /// Iteration walks each matching archetype chunk by chunk and calls the callback with
+    /// references into the chunk's columns, so the inner loop reads contiguous arrays. `par_each`
+    /// hands out whole chunks, so no two jobs share a cache line.
+    template<typename... Ts> class Query {
+    public:
+        explicit Query(World& world) : m_World(&world) {
+            (m_Mask.set(component_id<std::remove_const_t<Ts>>()), ...);
+        }
+
+        /// Calls `function(Ts&...)` or `function(Entity_t, Ts&...)` for every matching entity
+        template<typename F> void each(F&& function) {
+            update();
+            for (const Match_t& match : m_Matches) {
+                for (const Chunk_t& chunk : match.m_Archetype->chunks()) {
+                    run_chunk(match, chunk, function, std::index_sequence_for<Ts...> {});
+                }
+            }
+        }
+
+        /// Calls `function(std::span<const Entity_t>, std::span<Ts>...)` for every chunk with
+        /// matching entities, for loops that want to work on whole arrays
+        template<typename F> void each_chunk(F&& function) {
+            update();
+            for (const Match_t& match : m_Matches) {
+                for (const Chunk_t& chunk : match.m_Archetype->chunks()) {
+                    run_span(match, chunk, function, std::index_sequence_for<Ts...> {});
+                }
+            }
+        }
+
+        /// `each` spread over the job system in ranges of `chunksPerJob` chunks, and returns once
+        /// all ran. 0 picks a grain that gives every thread a few ranges to balance with.
+        /// `function` is called concurrently and must only write the entity it is given.
+        template<typename F>
+        void par_each(JobSystem& jobs, const F& function, usize chunksPerJob = 0) {
+            update();
+            m_Work.clear();
+            for (u32 m = 0; m < m_Matches.size(); m++) {
+                const auto chunkCount = static_cast<u32>(m_Matches[m].m_Archetype->chunks().size());
+                for (u32 c = 0; c < chunkCount; c++) {
+                    m_Work.push_back({m, c});
+                }
+            }
+            if (chunksPerJob == 0) {
+                chunksPerJob = m_Work.size() / (usize {jobs.thread_count()} * RANGES_PER_THREAD);
+            }
+            jobs.parallel_for(
+                m_Work.size(), chunksPerJob, [this, &function](usize begin, usize end) {
+                    for (usize i = begin; i < end; i++) {
+                        const Match_t& match = m_Matches[m_Work[i].m_Match];
+                        run_chunk(match, match.m_Archetype->chunks()[m_Work[i].m_Chunk], function,
+                                  std::index_sequence_for<Ts...> {});
+                    }
+                });
+        }
+
+        /// Number of matching entities
+        [[nodiscard]] usize count() {
+            update();
+            usize total = 0;
+            for (const Match_t& match : m_Matches) {
+                total += match.m_Archetype->entity_count();
+            }
+            return total;
+        }
+
+    private:
+        static constexpr usize RANGES_PER_THREAD = 8;
+
+        struct Match_t {
+            const Archetype*               m_Archetype;
+            std::array<u32, sizeof...(Ts)> m_Columns;
+        };
+
+        struct WorkItem_t {
+            u32 m_Match;
+            u32 m_Chunk;
+        };
+
+        /// Picks up the archetypes created since the last iteration
+        void update() {
+            const auto archetypes = m_World->archetypes();
+            for (; m_SeenArchetypes < archetypes.size(); m_SeenArchetypes++) {
+                const Archetype& archetype = *archetypes[m_SeenArchetypes];
+                if ((archetype.mask() & m_Mask) == m_Mask) {
+                    m_Matches.push_back({&archetype,
+                                         {static_cast<u32>(archetype.column_of(
+                                             component_id<std::remove_const_t<Ts>>()))...}});
+                }
+            }
+        }
+
+        template<typename F, usize... Is>
+        static void run_chunk(const Match_t& match, const Chunk_t& chunk, F& function,
+                              std::index_sequence<Is...> /*indices*/) {
+            const Archetype&         archetype = *match.m_Archetype;
+            const std::tuple<Ts*...> columns {
+                static_cast<Ts*>(archetype.column(chunk, match.m_Columns[Is]))...};
+            if constexpr (std::is_invocable_v<F&, Entity_t, Ts&...>) {
+                const Entity_t* entities = archetype.entities(chunk);
+                for (u32 row = 0; row < chunk.m_Count; row++) {
+                    function(entities[row], std::get<Is>(columns)[row]...);
+                }
+            }
+            else {
+                for (u32 row = 0; row < chunk.m_Count; row++) {
+                    function(std::get<Is>(columns)[row]...);
+                }
+            }
+        }
+
+        template<typename F, usize... Is>
+        static void run_span(const Match_t& match, const Chunk_t& chunk, F& function,
+                             std::index_sequence<Is...> /*indices*/) {
+            const Archetype& archetype = *match.m_Archetype;
+            function(std::span<const Entity_t>(archetype.entities(chunk), chunk.m_Count),
+                     std::span<Ts>(
+                         static_cast<Ts*>(archetype.column(chunk, match.m_Columns[Is])),
+                         chunk.m_Count)...);
+        }
+
+        World*                  m_World;
+        ComponentMask           m_Mask;
+        std::vector<Match_t>    m_Matches;
+        usize                   m_SeenArchetypes = 0;
+        std::vector<WorkItem_t> m_Work;
+    };
+} // namespace Pulsar
@@ -0,0 +1,226 @@
+#include "World.hpp"
+
+#include "PulsarEngine/ECS/CommandBuffer.hpp"
+
+namespace Pulsar {
+    namespace {
+        /// Chunks reserved from the heap at once, 256 KiB
+        constexpr usize CHUNKS_PER_BLOCK = 16;
+    } // namespace
+
+    World::World() : m_ChunkPool(CHUNK_SIZE, CHUNKS_PER_BLOCK, GC::MemoryTag::Engine) {
+        // Archetype 0 holds the entities without components
+        PULSAR_IGNORE_RESULT(archetype_for({}));
+    }
+
+    // Archetypes destroy their components and hand their chunks back before the pool goes
+    World::~World() = default;
+
+    void World::destroy(Entity_t entity) {
+        if (!is_alive(entity)) {
+            return;
+        }
+        EntityRecord_t& record = m_Records[entity.m_Index];
+        const Entity_t  moved  = m_Archetypes[record.m_Archetype]->erase(record.m_Location, true);
+        if (!moved.is_null()) {
+            m_Records[moved.m_Index].m_Location = record.m_Location;
+        }
+        record.m_Archetype = DEAD;
+        record.m_Generation++;
+        m_FreeIndices.push_back(entity.m_Index);
+        m_AliveCount--;
+    }
+
+    Entity_t World::reserve_entity() {
+        const u32 offset = m_Reserved.fetch_add(1, std::memory_order_relaxed);
+        return {static_cast<u32>(m_Records.size()) + offset, 0};
+    }
+
+    usize World::chunk_count() const {
+        usize count = 0;
+        for (const auto& archetype : m_Archetypes) {
+            count += archetype->chunks().size();
+        }
+        return count;
+    }
+
+    Entity_t World::allocate_entity() {
+        flush_reserved();
+        if (!m_FreeIndices.empty()) {
+            const u32 index = m_FreeIndices.back();
+            m_FreeIndices.pop_back();
+            return {index, m_Records[index].m_Generation};
+        }
+        m_Records.emplace_back();
+        return {static_cast<u32>(m_Records.size() - 1), 0};
+    }
+
+    void World::flush_reserved() {
+        const u32 reserved = m_Reserved.exchange(0, std::memory_order_relaxed);
+        if (reserved != 0) {
+            m_Records.resize(m_Records.size() + reserved, {0, RESERVED, {}});
+        }
+    }
+
+    u32 World::archetype_for(const ComponentMask& mask) {
+        const auto [it, inserted] =
+            m_ArchetypeIndex.try_emplace(mask, static_cast<u32>(m_Archetypes.size()));
+        if (inserted) {
+            m_Archetypes.push_back(std::make_unique<Archetype>(mask, m_ChunkPool));
+        }
+        return it->second;
+    }
+
+    EntityLocation_t World::place(Entity_t entity, u32 archetype) {
+        EntityRecord_t& record = m_Records[entity.m_Index];
+        record.m_Archetype     = archetype;
+        record.m_Location      = m_Archetypes[archetype]->push_back(entity);
+        m_AliveCount++;
+        return record.m_Location;
+    }
+
+    EntityLocation_t World::move_entity(Entity_t entity, u32 target) {
+        EntityRecord_t&        record = m_Records[entity.m_Index];
+        Archetype&             from   = *m_Archetypes[record.m_Archetype];
+        Archetype&             to     = *m_Archetypes[target];
+        const EntityLocation_t source = record.m_Location;
+        const EntityLocation_t dest   = to.push_back(entity);
+
+        const std::span<const ComponentId> components = from.components();
+        for (u32 column = 0; column < components.size(); column++) {
+            const ComponentInfo_t& info     = component_info(components[column]);
+            void*                  src      = from.component(source, column);
+            const i32              toColumn = to.column_of(components[column]);
+            if (toColumn >= 0) {
+                internal::relocate(info, to.component(dest, static_cast<u32>(toColumn)), src);
+            }
+            else if (info.m_Destroy != nullptr) {
+                info.m_Destroy(src);
+            }
+        }
+        const Entity_t moved = from.erase(source, false);
+        if (!moved.is_null()) {
+            m_Records[moved.m_Index].m_Location = source;
+        }
+        record.m_Archetype = target;
+        record.m_Location  = dest;
+        return dest;
+    }
+
+    void* World::add_raw(Entity_t entity, ComponentId id) {
+        if (!is_alive(entity)) {
+            return nullptr;
+        }
+        EntityRecord_t& record  = m_Records[entity.m_Index];
+        Archetype&      current = *m_Archetypes[record.m_Archetype];
+        if (const i32 column = current.column_of(id); column >= 0) {
+            // Replaced in place
+            void* existing = current.component(record.m_Location, static_cast<u32>(column));
+            if (const ComponentInfo_t& info = component_info(id); info.m_Destroy != nullptr) {
+                info.m_Destroy(existing);
+            }
+            return existing;
+        }
+
+        u32 target = 0;
+        if (auto edge = current.m_AddEdges.find(id); edge != current.m_AddEdges.end()) {
+            target = edge->second;
+        }
+        else {
+            ComponentMask mask = current.mask();
+            mask.set(id);
+            target = archetype_for(mask);
+            // `current` is still valid, archetypes are never moved
+            current.m_AddEdges.emplace(id, target);
+            m_Archetypes[target]->m_RemoveEdges.emplace(id, record.m_Archetype);
+        }
+        const EntityLocation_t location = move_entity(entity, target);
+        Archetype&             to       = *m_Archetypes[target];
+        return to.component(location, static_cast<u32>(to.column_of(id)));
+    }
+
+    void World::remove_raw(Entity_t entity, ComponentId id) {
+        if (!is_alive(entity)) {
+            return;
+        }
+        const EntityRecord_t& record  = m_Records[entity.m_Index];
+        Archetype&            current = *m_Archetypes[record.m_Archetype];
+        if (current.column_of(id) < 0) {
+            return;
+        }
+        u32 target = 0;
+        if (auto edge = current.m_RemoveEdges.find(id); edge != current.m_RemoveEdges.end()) {
+            target = edge->second;
+        }
+        else {
+            ComponentMask mask = current.mask();
+            mask.reset(id);
+            target = archetype_for(mask);
+            current.m_RemoveEdges.emplace(id, target);
+            m_Archetypes[target]->m_AddEdges.emplace(id, record.m_Archetype);
+        }
+        move_entity(entity, target);
+    }
+
+    void* World::get_raw(Entity_t entity, ComponentId id) const {
+        if (!is_alive(entity)) {
+            return nullptr;
+        }
+        const EntityRecord_t& record    = m_Records[entity.m_Index];
+        const Archetype&      archetype = *m_Archetypes[record.m_Archetype];
+        const i32             column    = archetype.column_of(id);
+        if (column < 0) {
+            return nullptr;
+        }
+        return archetype.component(record.m_Location, static_cast<u32>(column));
+    }
+
+    void World::apply(CommandBuffer& commands) {
+        using Op = CommandBuffer::Op;
+
+        flush_reserved();
+        std::vector<CommandBuffer::Command_t>& list = commands.m_Commands;
+        for (usize i = 0; i < list.size(); i++) {
+            CommandBuffer::Command_t& command = list[i];
+            switch (command.m_Op) {
+                case Op::Create: {
+                    const std::span inits(list.data() + i + 1, command.m_Value);
+                    ComponentMask   mask;
+                    for (const auto& init : inits) {
+                        mask.set(init.m_Value);
+                    }
+                    const u32              archetype = archetype_for(mask);
+                    const EntityLocation_t location  = place(command.m_Entity, archetype);
+                    Archetype&             target    = *m_Archetypes[archetype];
+                    for (auto& init : inits) {
+                        const auto column = static_cast<u32>(target.column_of(init.m_Value));
+                        internal::relocate(component_info(init.m_Value),
+                                           target.component(location, column), init.m_Payload);
+                        init.m_Payload = nullptr;
+                    }
+                    i += inits.size();
+                    break;
+                }
+                case Op::Init:
+                    break;
+                case Op::Destroy:
+                    destroy(command.m_Entity);
+                    break;
+                case Op::Add:
+                    // The payload of an add to a dead entity is destroyed by `clear` below
+                    if (void* storage = add_raw(command.m_Entity, command.m_Value);
+                        storage != nullptr) {
+                        internal::relocate(
+                            component_info(command.m_Value), storage, command.m_Payload);
+                        command.m_Payload = nullptr;
+                    }
+                    break;
+                case Op::Remove:
+                    remove_raw(command.m_Entity, command.m_Value);
+                    break;
+            }
+        }
+        // Destroys the payloads of skipped commands
+        commands.clear();
+    }
+} // namespace Pulsar
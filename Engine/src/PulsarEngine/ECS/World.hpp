@@ -0,0 +1,154 @@
+#pragma once
+
+#include "PulsarCore/GC/Allocators/Pool.hpp"
+#include "PulsarCore/Types.hpp"
+#include "PulsarEngine/ECS/Archetype.hpp"
+#include "PulsarEngine/ECS/Component.hpp"
+#include "PulsarEngine/ECS/Entity.hpp"
+
+#include <atomic>
+#include <memory>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Pulsar {
+    class CommandBuffer;
+
+    /// The entities of a scene and their components, grouped in archetypes
+    /// # Usage
+    /// Entities are created, given components and destroyed through the world or, while systems
+    /// iterate it, recorded in a `CommandBuffer` and applied afterwards. Components are read and
+    /// written through a `Query` or `get`.
+    /// # Performance
+    /// Components of one set of types live in `CHUNK_SIZE` chunks from a pool allocator, column
+    /// by column, so queries walk memory linearly. Adding or removing a component moves the
+    /// entity's components to another archetype: cheap for a few entities, but tag components
+    /// toggled on many entities each frame are better expressed as data. Archetype transitions
+    /// are cached, so a repeated change costs one hash lookup.
+    /// # Thread safety
+    /// Structural changes (create, destroy, add, remove, apply) need exclusive access. Queries
+    /// and `get` may run concurrently with each other, and `reserve_entity` from any thread.
+    class World {
+    public:
+        World();
+        ~World();
+
+        World(const World&)            = delete;
+        World& operator=(const World&) = delete;
+        World(World&&)                 = delete;
+        World& operator=(World&&)      = delete;
+
+        /// Creates an entity with the given components
+        template<typename... Ts> Entity_t create(Ts&&... components) {
+            static_assert(internal::DISTINCT_TYPES<std::decay_t<Ts>...>,
+                "An entity has at most one component of each type");
+            const Entity_t entity = allocate_entity();
+            ComponentMask  mask;
+            (mask.set(component_id<std::decay_t<Ts>>()), ...);
+            const u32 archetype = archetype_for(mask);
+            // Unused when created without components
+            [[maybe_unused]] const EntityLocation_t location = place(entity, archetype);
+            [[maybe_unused]] Archetype&             target   = *m_Archetypes[archetype];
+            (construct<std::decay_t<Ts>>(target, location, std::forward<Ts>(components)), ...);
+            return entity;
+        }
+
+        /// Destroys an entity and its components, does nothing if it is not alive
+        void destroy(Entity_t entity);
+
+        [[nodiscard]] bool is_alive(Entity_t entity) const {
+            return entity.m_Index < m_Records.size() &&
+                   m_Records[entity.m_Index].m_Generation == entity.m_Generation &&
+                   m_Records[entity.m_Index].m_Archetype < m_Archetypes.size();
+        }
+
+        /// Adds a component, or replaces it if the entity has one. Returns the component, nullptr
+        /// (and constructs nothing) if the entity is not alive.
+        template<Component T, typename... Args> T* add(Entity_t entity, Args&&... args) {
+            void* storage = add_raw(entity, component_id<T>());
+            if (storage == nullptr) {
+                return nullptr;
+            }
+            return ::new (storage) T(std::forward<Args>(args)...);
+        }
+
+        /// Removes a component, does nothing if the entity does not have it
+        template<Component T> void remove(Entity_t entity) {
+            remove_raw(entity, component_id<T>());
+        }
+
+        /// The entity's component, nullptr if it has none of this type or is not alive
+        template<Component T> [[nodiscard]] T* get(Entity_t entity) const {
+            return std::launder(static_cast<T*>(get_raw(entity, component_id<T>())));
+        }
+
+        template<Component T> [[nodiscard]] bool has(Entity_t entity) const {
+            return get_raw(entity, component_id<T>()) != nullptr;
+        }
+
+        /// Applies and clears the commands recorded in `commands`, in recording order
+        void apply(CommandBuffer& commands);
+
+        /// An id for an entity created later by `apply`, can be called from any thread while
+        /// the world is iterated. The entity is not alive until the creating command is applied.
+        [[nodiscard]] Entity_t reserve_entity();
+
+        [[nodiscard]] usize entity_count() const {
+            return m_AliveCount;
+        }
+
+        [[nodiscard]] std::span<const std::unique_ptr<Archetype>> archetypes() const {
+            return m_Archetypes;
+        }
+
+        [[nodiscard]] usize chunk_count() const;
+
+    private:
+        /// Records of reserved entities that no command created yet
+        static constexpr u32 RESERVED = 0xFFFF'FFFE;
+        static constexpr u32 DEAD     = 0xFFFF'FFFF;
+
+        struct EntityRecord_t {
+            u32              m_Generation = 0;
+            u32              m_Archetype  = DEAD;
+            EntityLocation_t m_Location;
+        };
+
+        friend class CommandBuffer;
+
+        template<Component T, typename U>
+        static void construct(Archetype& archetype, EntityLocation_t location, U&& value) {
+            const auto column = static_cast<u32>(archetype.column_of(component_id<T>()));
+            ::new (archetype.component(location, column)) T(std::forward<U>(value));
+        }
+
+        /// A dead index from the free list or a new one, alive once placed
+        [[nodiscard]] Entity_t allocate_entity();
+        /// Turns the indices handed out by `reserve_entity` into records
+        void flush_reserved();
+        [[nodiscard]] u32 archetype_for(const ComponentMask& mask);
+        /// Appends a row for `entity` to an archetype and records its location
+        EntityLocation_t place(Entity_t entity, u32 archetype);
+        /// Moves an entity to another archetype. Components both have are moved, the ones only
+        /// the old archetype has are destroyed and the ones only the new one has are left for the
+        /// caller to construct.
+        EntityLocation_t move_entity(Entity_t entity, u32 target);
+
+        /// Uninitialized storage for a component the entity gets, nullptr if it is not alive
+        [[nodiscard]] void* add_raw(Entity_t entity, ComponentId id);
+        void remove_raw(Entity_t entity, ComponentId id);
+        [[nodiscard]] void* get_raw(Entity_t entity, ComponentId id) const;
+
+        GC::PoolAllocator                       m_ChunkPool;
+        std::vector<std::unique_ptr<Archetype>> m_Archetypes;
+        std::unordered_map<ComponentMask, u32>  m_ArchetypeIndex;
+        std::vector<EntityRecord_t>             m_Records;
+        std::vector<u32>                        m_FreeIndices;
+        usize                                   m_AliveCount = 0;
+        std::atomic<u32>                        m_Reserved {0};
+    };
+} // namespace Pulsar
@@ -0,0 +1,206 @@
+#include "Fiber.hpp"
+
+#include "PulsarCore/Util/Macros.hpp"
+
+#include <cstring>
+#include <new>
+
+#ifdef __linux__
+    #include <sys/mman.h>
+    #include <unistd.h>
+#endif
+
+#ifdef PULSAR_HAS_FIBERS
+// pulsar_fiber_switch(void** save, void* load) pushes the callee-saved registers and the floating
+// point control state, stores the stack pointer in *save, then pops the same layout from load.
+// pulsar_fiber_start is where new fibers "return" to, it calls entry(argument) from the saved
+// registers. Keep the frame layouts in sync with Fiber::Fiber below.
+extern "C" {
+    void pulsar_fiber_switch(void** save, void* load);
+    void pulsar_fiber_start();
+}
+
+    #if defined(__x86_64__)
+// Frame, from the saved stack pointer up: mxcsr, x87 control word, r15, r14, r13, r12, rbx, rbp,
+// return address
+asm(R"(
+    .text
+    .globl pulsar_fiber_switch
+    .hidden pulsar_fiber_switch
+    .type pulsar_fiber_switch, @function
+pulsar_fiber_switch:
+    pushq %rbp
+    pushq %rbx
+    pushq %r12
+    pushq %r13
+    pushq %r14
+    pushq %r15
+    subq $16, %rsp
+    stmxcsr (%rsp)
+    fnstcw 4(%rsp)
+    movq %rsp, (%rdi)
+    movq %rsi, %rsp
+    ldmxcsr (%rsp)
+    fldcw 4(%rsp)
+    addq $16, %rsp
+    popq %r15
+    popq %r14
+    popq %r13
+    popq %r12
+    popq %rbx
+    popq %rbp
+    ret
+    .size pulsar_fiber_switch, .-pulsar_fiber_switch
+
+    .globl pulsar_fiber_start
+    .hidden pulsar_fiber_start
+    .type pulsar_fiber_start, @function
+pulsar_fiber_start:
+    movq %r13, %rdi
+    callq *%r12
+    ud2
+    .size pulsar_fiber_start, .-pulsar_fiber_start
+)");
+    #elif defined(__aarch64__)
+// Frame, from the saved stack pointer up: x19-x30, d8-d15, fpcr and padding
+asm(R"(
+    .text
+    .globl pulsar_fiber_switch
+    .hidden pulsar_fiber_switch
+    .type pulsar_fiber_switch, %function
+pulsar_fiber_switch:
+    sub sp, sp, #176
+    stp x19, x20, [sp, #0]
+    stp x21, x22, [sp, #16]
+    stp x23, x24, [sp, #32]
+    stp x25, x26, [sp, #48]
+    stp x27, x28, [sp, #64]
+    stp x29, x30, [sp, #80]
+    stp d8, d9, [sp, #96]
+    stp d10, d11, [sp, #112]
+    stp d12, d13, [sp, #128]
+    stp d14, d15, [sp, #144]
+    mrs x2, fpcr
+    str x2, [sp, #160]
+    mov x2, sp
+    str x2, [x0]
+    mov sp, x1
+    ldp x19, x20, [sp, #0]
+    ldp x21, x22, [sp, #16]
+    ldp x23, x24, [sp, #32]
+    ldp x25, x26, [sp, #48]
+    ldp x27, x28, [sp, #64]
+    ldp x29, x30, [sp, #80]
+    ldp d8, d9, [sp, #96]
+    ldp d10, d11, [sp, #112]
+    ldp d12, d13, [sp, #128]
+    ldp d14, d15, [sp, #144]
+    ldr x2, [sp, #160]
+    msr fpcr, x2
+    add sp, sp, #176
+    ret
+    .size pulsar_fiber_switch, .-pulsar_fiber_switch
+
+    .globl pulsar_fiber_start
+    .hidden pulsar_fiber_start
+    .type pulsar_fiber_start, %function
+pulsar_fiber_start:
+    mov x0, x20
+    blr x19
+    brk #0
+    .size pulsar_fiber_start, .-pulsar_fiber_start
+)");
+    #endif
+#endif
+
+namespace Pulsar {
+    namespace {
+#ifdef PULSAR_HAS_FIBERS
+        usize page_size() {
+            static const auto SIZE = static_cast<usize>(sysconf(_SC_PAGESIZE));
+            return SIZE;
+        }
+
+        template<typename T> void write(std::byte* at, T value) {
+            std::memcpy(at, &value, sizeof(T));
+        }
+#endif
+    } // namespace
+
+    FiberStack::FiberStack([[maybe_unused]] usize size) {
+#ifdef PULSAR_HAS_FIBERS
+        const usize page   = page_size();
+        const usize usable = (size + page - 1) / page * page;
+        m_MappingSize      = usable + page;
+        m_Mapping          = mmap(nullptr, m_MappingSize, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_STACK | MAP_NORESERVE, -1, 0);
+        if (m_Mapping == MAP_FAILED) {
+            m_Mapping     = nullptr;
+            m_MappingSize = 0;
+            throw std::bad_alloc();
+        }
+        // Stacks grow down, so the guard goes at the lowest address
+        PULSAR_IGNORE_RESULT(mprotect(m_Mapping, page, PROT_NONE));
+#else
+        throw std::bad_alloc();
+#endif
+    }
+
+    FiberStack::~FiberStack() {
+#ifdef PULSAR_HAS_FIBERS
+        if (m_Mapping != nullptr) {
+            munmap(m_Mapping, m_MappingSize);
+        }
+#endif
+    }
+
+    void* FiberStack::top() const {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        return static_cast<std::byte*>(m_Mapping) + m_MappingSize;
+    }
+
+    usize FiberStack::size() const {
+#ifdef PULSAR_HAS_FIBERS
+        return m_Mapping != nullptr ? m_MappingSize - page_size() : 0;
+#else
+        return 0;
+#endif
+    }
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    Fiber::Fiber(FiberStack stack, [[maybe_unused]] Entry entry, [[maybe_unused]] void* argument)
+        : m_Stack(std::move(stack)) {
+#ifdef PULSAR_HAS_FIBERS
+        auto* top = static_cast<std::byte*>(m_Stack.top());
+    #if defined(__x86_64__)
+        // The return address sits 8 below the 16-byte aligned top, so pulsar_fiber_start runs
+        // with an aligned stack for its call
+        constexpr usize FRAME = 72;
+        auto*           frame = top - FRAME;
+        std::memset(frame, 0, FRAME);
+        write<u32>(frame, 0x1F80);      // mxcsr: all exceptions masked, round to nearest
+        write<u16>(frame + 4, 0x037F);  // x87: all exceptions masked, extended precision
+        write(frame + 32, argument);    // r13
+        write(frame + 40, entry);       // r12
+        write(frame + 64, &pulsar_fiber_start);
+    #elif defined(__aarch64__)
+        constexpr usize FRAME = 176;
+        auto*           frame = top - FRAME;
+        std::memset(frame, 0, FRAME);
+        write(frame, entry);           // x19
+        write(frame + 8, argument);    // x20
+        write(frame + 88, &pulsar_fiber_start); // x30
+    #endif
+        m_StackPointer = frame;
+#endif
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    void Fiber::switch_to([[maybe_unused]] Fiber& target) {
+#ifdef PULSAR_HAS_FIBERS
+        pulsar_fiber_switch(&m_StackPointer, target.m_StackPointer);
+#else
+        PULSAR_ASSERT(false, "Fibers are not supported on this platform");
+#endif
+    }
+} // namespace Pulsar
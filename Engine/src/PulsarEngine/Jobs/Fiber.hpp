@@ -0,0 +1,87 @@
+#pragma once
+
+#include "PulsarCore/Types.hpp"
+
+#include <utility>
+
+#if defined(__linux__) && (defined(__x86_64__) || defined(__aarch64__))
+    #define PULSAR_HAS_FIBERS
+#endif
+
+namespace Pulsar {
+    /// Stack memory for a fiber, with an inaccessible guard page below it so an overflow faults
+    /// instead of corrupting the neighbouring memory
+    /// # Performance
+    /// The stack is reserved with `mmap`, pages are only committed once touched. Creating one is
+    /// two system calls, so keep them pooled.
+    class FiberStack {
+    public:
+        FiberStack() = default;
+        /// Rounded up to whole pages, plus the guard page
+        explicit FiberStack(usize size);
+        ~FiberStack();
+
+        FiberStack(const FiberStack&)            = delete;
+        FiberStack& operator=(const FiberStack&) = delete;
+        FiberStack(FiberStack&& other) noexcept
+            : m_Mapping(std::exchange(other.m_Mapping, nullptr)),
+              m_MappingSize(std::exchange(other.m_MappingSize, 0)) {
+        }
+        FiberStack& operator=(FiberStack&& other) noexcept {
+            std::swap(m_Mapping, other.m_Mapping);
+            std::swap(m_MappingSize, other.m_MappingSize);
+            return *this;
+        }
+
+        /// One past the highest usable byte, stacks grow down from here
+        [[nodiscard]] void* top() const;
+        /// Usable bytes, without the guard page
+        [[nodiscard]] usize size() const;
+
+    private:
+        void* m_Mapping     = nullptr;
+        usize m_MappingSize = 0;
+    };
+
+    /// A user-mode execution context: a stack and the registers saved when switching away
+    /// # Usage
+    /// A default constructed fiber stands for the calling thread, switching away from it saves
+    /// the thread's own context so another fiber can switch back. Fibers created with an entry
+    /// function start running it on their first switch; the entry must never return, it switches
+    /// away for good instead.
+    /// # Performance
+    /// A switch saves only the callee-saved registers and the floating point control state in a
+    /// hand-written routine, no system calls (unlike `swapcontext`, which also swaps the signal
+    /// mask). Only x86-64 and AArch64 Linux are supported, see `PULSAR_HAS_FIBERS`.
+    class Fiber {
+    public:
+        using Entry = void (*)(void* argument);
+
+        static constexpr bool SUPPORTED =
+#ifdef PULSAR_HAS_FIBERS
+            true;
+#else
+            false;
+#endif
+
+        Fiber() = default;
+        Fiber(FiberStack stack, Entry entry, void* argument);
+
+        Fiber(const Fiber&)            = delete;
+        Fiber& operator=(const Fiber&) = delete;
+        Fiber(Fiber&&)                 = delete;
+        Fiber& operator=(Fiber&&)      = delete;
+
+        /// Saves the running context into this fiber and continues `target` where it left off.
+        /// Returns once some fiber switches back to this one, possibly on another thread.
+        void switch_to(Fiber& target);
+
+        [[nodiscard]] const FiberStack& stack() const {
+            return m_Stack;
+        }
+
+    private:
+        void*      m_StackPointer = nullptr;
+        FiberStack m_Stack;
+    };
+} // namespace Pulsar
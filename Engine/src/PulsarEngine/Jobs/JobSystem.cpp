@@ -0,0 +1,350 @@
+#include "JobSystem.hpp"
+
+#include "PulsarCore/Util/CpuFeatures.hpp"
+#include "PulsarCore/Util/Profiler.hpp"
+
+#include <fmt/format.h>
+
+#ifdef __linux__
+    #include <pthread.h>
+    #include <sched.h>
+#endif
+
+namespace Pulsar {
+    namespace {
+        struct ThreadBinding_t {
+            const JobSystem* m_System = nullptr;
+            i32              m_Index  = -1;
+        };
+
+        constinit thread_local ThreadBinding_t t_Binding;
+
+        /// Idle rounds a worker spins through before it goes to sleep
+        constexpr u32 SPIN_ROUNDS = 64;
+
+        u64 next_random(u64& state) {
+            // xorshift64
+            state ^= state << 13U;
+            state ^= state >> 7U;
+            state ^= state << 17U;
+            return state;
+        }
+
+        void pin_to_core([[maybe_unused]] std::thread& thread, [[maybe_unused]] u32 core) {
+#ifdef __linux__
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(core, &set);
+            // Best effort, cgroups or a restricted affinity mask may not allow the core
+            PULSAR_IGNORE_RESULT(pthread_setaffinity_np(thread.native_handle(), sizeof(set), &set));
+#endif
+        }
+    } // namespace
+
+    JobSystem::JobSystem(const JobSystemConfig_t& config)
+        : m_UseFibers(config.m_UseFibers && Fiber::SUPPORTED),
+          m_FiberStackSize(config.m_FiberStackSize) {
+        const u32 cores   = std::max(std::thread::hardware_concurrency(), 1U);
+        const u32 workers = config.m_WorkerCount != 0 ? config.m_WorkerCount : cores - 1;
+
+        m_States.reserve(workers + 1);
+        for (u32 i = 0; i <= workers; i++) {
+            m_States.push_back(
+                std::make_unique<ThreadState_t>(config.m_QueueCapacity, config.m_FrameBlockSize));
+            m_States.back()->m_Random = 0x9E3779B97F4A7C15ULL * (i + 1);
+        }
+        t_Binding = {this, 0};
+
+        m_Workers.reserve(workers);
+        for (u32 i = 1; i <= workers; i++) {
+            m_Workers.emplace_back([this, i] { worker_main(i); });
+            if (config.m_PinWorkers && cores > 1) {
+                pin_to_core(m_Workers.back(), i % cores);
+            }
+        }
+    }
+
+    JobSystem::~JobSystem() {
+        m_Stopping.store(true, std::memory_order_seq_cst);
+        m_Signal.fetch_add(1, std::memory_order_seq_cst);
+        m_Signal.notify_all();
+        for (auto& worker : m_Workers) {
+            worker.join();
+        }
+        if (t_Binding.m_System == this) {
+            t_Binding = {};
+        }
+    }
+
+    i32 JobSystem::thread_index() const {
+        return t_Binding.m_System == this ? t_Binding.m_Index : -1;
+    }
+
+    JobSystem::ThreadState_t* JobSystem::current_state() const {
+        if (t_Binding.m_System != this) [[unlikely]] {
+            return nullptr;
+        }
+        return m_States[static_cast<usize>(t_Binding.m_Index)].get();
+    }
+
+    void JobSystem::wait(const JobCounter& counter) {
+        if (counter.is_done()) {
+            return;
+        }
+        ThreadState_t* self = current_state();
+        if (self != nullptr && m_UseFibers) {
+            wait_on_fiber(*self, counter);
+            return;
+        }
+        while (!counter.is_done()) {
+            if (self != nullptr) {
+                if (JobBase_t* job = find_job(*self)) {
+                    execute(job);
+                    continue;
+                }
+            }
+            cpu_relax();
+        }
+    }
+
+    void JobSystem::end_frame() {
+        for (auto& state : m_States) {
+            PULSAR_ASSERT(state->m_Queue.empty(), "end_frame while jobs are queued");
+            state->m_Frame.reset();
+        }
+    }
+
+    void JobSystem::submit(ThreadState_t& self, JobBase_t* job) {
+        if (!self.m_Queue.push(job)) [[unlikely]] {
+            execute(job);
+            return;
+        }
+        // Pairs with the fence in worker_main: either the worker sees the job before sleeping or
+        // we see it sleeping
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_Sleeping.load(std::memory_order_relaxed) != 0) {
+            wake_worker();
+        }
+    }
+
+    JobSystem::JobBase_t* JobSystem::find_job(ThreadState_t& self) {
+        if (JobBase_t* job = self.m_Queue.pop()) {
+            return job;
+        }
+        const usize count = m_States.size();
+        if (count < 2) {
+            return nullptr;
+        }
+        const usize start = next_random(self.m_Random) % count;
+        for (usize i = 0; i < count; i++) {
+            ThreadState_t& victim = *m_States[(start + i) % count];
+            if (&victim == &self) {
+                continue;
+            }
+            if (JobBase_t* job = victim.m_Queue.steal()) {
+                return job;
+            }
+        }
+        return nullptr;
+    }
+
+    void JobSystem::execute(JobBase_t* job) {
+        JobCounter* counter = job->m_Counter;
+        job->m_Invoke(job);
+        complete(*counter);
+    }
+
+    void JobSystem::complete(JobCounter& counter) {
+        // Sequentially consistent against park_locked: either we see the fiber parked or it sees
+        // the counter done. The counter may be gone once it reached zero, so
+        // waiters are matched by address only.
+        const JobCounter* address = &counter;
+        if (counter.m_Pending.fetch_sub(1, std::memory_order_seq_cst) != 1
+            || m_ParkedCount.load(std::memory_order_seq_cst) == 0) {
+            return;
+        }
+        u32 woken = 0;
+        {
+            const std::lock_guard lock(m_FiberMutex);
+            for (usize i = 0; i < m_ParkedFibers.size();) {
+                if (m_ParkedFibers[i]->m_WaitingOn == address) {
+                    m_ReadyFibers.push_back(m_ParkedFibers[i]);
+                    m_ParkedFibers[i] = m_ParkedFibers.back();
+                    m_ParkedFibers.pop_back();
+                    woken++;
+                }
+                else {
+                    i++;
+                }
+            }
+            m_ParkedCount.fetch_sub(woken, std::memory_order_relaxed);
+            m_ReadyCount.fetch_add(woken, std::memory_order_relaxed);
+        }
+        // Pairs with the fence in worker_main, like submit: either a worker about to sleep sees
+        // the ready fibers or we see it sleeping
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        // A job thread resumes one of the fibers itself, any other thread leaves them all to the
+        // workers
+        const u32 resumedHere = t_Binding.m_System == this ? 1 : 0;
+        for (u32 i = resumedHere; i < woken && m_Sleeping.load(std::memory_order_relaxed) != 0;
+             i++) {
+            wake_worker();
+        }
+    }
+
+    void JobSystem::wake_worker() {
+        m_Signal.fetch_add(1, std::memory_order_relaxed);
+        m_Signal.notify_one();
+    }
+
+    void JobSystem::worker_main(u32 index) {
+        t_Binding = {this, static_cast<i32>(index)};
+        PULSAR_PROFILE_THREAD_NAME(fmt::format("Job worker {}", index));
+        if (m_UseFibers) {
+            // The thread's own stack only waits for the shutdown, jobs run on pooled fibers
+            ThreadState_t& self = *m_States[index];
+            switch_fiber(self, *acquire_fiber(), {});
+            return;
+        }
+        schedule();
+    }
+
+    void JobSystem::schedule() {
+        u32 idleRounds = 0;
+        while (!m_Stopping.load(std::memory_order_relaxed)) {
+            ThreadState_t& self = *current_state();
+            if (m_UseFibers) {
+                JobFiber_t* root = self.m_ParkedRoot;
+                if (root != nullptr && root->m_WaitingOn->is_done()) {
+                    self.m_ParkedRoot = nullptr;
+                    switch_fiber(self, *root, {.m_Release = self.m_Current});
+                    idleRounds = 0;
+                    continue;
+                }
+                if (JobFiber_t* fiber = take_ready_fiber()) {
+                    switch_fiber(self, *fiber, {.m_Release = self.m_Current});
+                    idleRounds = 0;
+                    continue;
+                }
+            }
+            if (JobBase_t* job = find_job(self)) {
+                execute(job);
+                idleRounds = 0;
+                continue;
+            }
+            if (++idleRounds < SPIN_ROUNDS) {
+                cpu_relax();
+                continue;
+            }
+            if (self.m_ParkedRoot != nullptr) {
+                // Nobody wakes this thread when the counter of its own stack is done
+                std::this_thread::yield();
+                continue;
+            }
+
+            // Announce the sleep, then look once more: a job submitted before the announcement
+            // is found here, one submitted after it bumps the signal we wait on
+            const u32 signal = m_Signal.load(std::memory_order_seq_cst);
+            m_Sleeping.fetch_add(1, std::memory_order_seq_cst);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            bool idle = m_ReadyCount.load(std::memory_order_relaxed) == 0;
+            for (const auto& state : m_States) {
+                idle = idle && state->m_Queue.empty();
+            }
+            if (idle && !m_Stopping.load(std::memory_order_seq_cst)) {
+                m_Signal.wait(signal, std::memory_order_seq_cst);
+            }
+            m_Sleeping.fetch_sub(1, std::memory_order_relaxed);
+            idleRounds = 0;
+        }
+    }
+
+    void JobSystem::fiber_main(void* system) {
+        auto* jobs = static_cast<JobSystem*>(system);
+        jobs->finish_switch();
+        while (true) {
+            // Only returns when the system stops, hand the thread back to its own stack
+            jobs->schedule();
+            ThreadState_t& self = *jobs->current_state();
+            jobs->switch_fiber(self, self.m_Root, {.m_Release = self.m_Current});
+        }
+    }
+
+    void JobSystem::wait_on_fiber(ThreadState_t& self, const JobCounter& counter) {
+        JobFiber_t* current  = self.m_Current;
+        current->m_WaitingOn = &counter;
+        switch_fiber(self, *acquire_fiber(), {.m_Park = current});
+        // Resumed by schedule() once the counter is done, possibly on another thread
+    }
+
+    JobSystem::JobFiber_t* JobSystem::take_ready_fiber() {
+        if (m_ReadyCount.load(std::memory_order_relaxed) == 0) {
+            return nullptr;
+        }
+        const std::lock_guard lock(m_FiberMutex);
+        while (!m_ReadyFibers.empty()) {
+            JobFiber_t* fiber = m_ReadyFibers.back();
+            m_ReadyFibers.pop_back();
+            m_ReadyCount.fetch_sub(1, std::memory_order_relaxed);
+            // Normally done, unless it was woken for an earlier counter at the same address
+            if (!park_locked(fiber)) {
+                fiber->m_WaitingOn = nullptr;
+                return fiber;
+            }
+        }
+        return nullptr;
+    }
+
+    bool JobSystem::park_locked(JobFiber_t* fiber) {
+        // Announce first, then check: pairs with complete(), which decrements first, then looks
+        m_ParkedCount.fetch_add(1, std::memory_order_seq_cst);
+        if (fiber->m_WaitingOn->m_Pending.load(std::memory_order_seq_cst) == 0) {
+            m_ParkedCount.fetch_sub(1, std::memory_order_relaxed);
+            return false;
+        }
+        m_ParkedFibers.push_back(fiber);
+        return true;
+    }
+
+    JobSystem::JobFiber_t* JobSystem::acquire_fiber() {
+        const std::lock_guard lock(m_FiberMutex);
+        if (!m_IdleFibers.empty()) {
+            JobFiber_t* fiber = m_IdleFibers.back();
+            m_IdleFibers.pop_back();
+            return fiber;
+        }
+        m_Fibers.push_back(
+            std::make_unique<JobFiber_t>(FiberStack(m_FiberStackSize), &fiber_main, this));
+        return m_Fibers.back().get();
+    }
+
+    void JobSystem::switch_fiber(
+        ThreadState_t& self, JobFiber_t& target, const PostSwitch_t& post) {
+        JobFiber_t* current = self.m_Current;
+        self.m_PostSwitch   = post;
+        self.m_Current      = &target;
+        current->switch_to(target);
+        finish_switch();
+    }
+
+    void JobSystem::finish_switch() {
+        // The fiber we came from is fully switched away from, others may resume it now
+        ThreadState_t&     self = *current_state();
+        const PostSwitch_t post = std::exchange(self.m_PostSwitch, {});
+        if (post.m_Park == &self.m_Root) {
+            self.m_ParkedRoot = post.m_Park;
+        }
+        else if (post.m_Park != nullptr) {
+            const std::lock_guard lock(m_FiberMutex);
+            if (!park_locked(post.m_Park)) {
+                // Completed while we were switching
+                m_ReadyFibers.push_back(post.m_Park);
+                m_ReadyCount.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+        if (post.m_Release != nullptr) {
+            const std::lock_guard lock(m_FiberMutex);
+            m_IdleFibers.push_back(post.m_Release);
+        }
+    }
+} // namespace Pulsar
@@ -0,0 +1,241 @@
+#pragma once
+
+#include "PulsarCore/GC/Allocators/Frame.hpp"
+#include "PulsarCore/Types.hpp"
+#include "PulsarCore/Util/Macros.hpp"
+#include "PulsarEngine/Jobs/Fiber.hpp"
+#include "PulsarEngine/Jobs/WorkStealingDeque.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Pulsar {
+    /// Number of jobs still running for a `JobSystem::run` batch
+    /// # Usage
+    /// Pass the same counter to every job of a batch, then `JobSystem::wait` on it. A counter is
+    /// done once all its jobs ran and can be reused afterwards.
+    class JobCounter {
+    public:
+        JobCounter() = default;
+
+        JobCounter(const JobCounter&)            = delete;
+        JobCounter& operator=(const JobCounter&) = delete;
+        JobCounter(JobCounter&&)                 = delete;
+        JobCounter& operator=(JobCounter&&)      = delete;
+
+        [[nodiscard]] bool is_done() const {
+            return m_Pending.load(std::memory_order_acquire) == 0;
+        }
+
+        [[nodiscard]] u32 pending() const {
+            return m_Pending.load(std::memory_order_relaxed);
+        }
+
+    private:
+        friend class JobSystem;
+
+        std::atomic<u32> m_Pending {0};
+    };
+
+    struct JobSystemConfig_t {
+        /// Worker threads next to the thread creating the system, 0 uses one per other core
+        u32 m_WorkerCount = 0;
+        /// Pins the worker with thread index `i` to core `i`, leaving core 0 to the creating thread
+        bool m_PinWorkers = true;
+        /// Jobs a thread can have queued, further jobs run inline on the submitting thread
+        usize m_QueueCapacity = 4096;
+        /// Block size of the per-thread frame allocators the jobs are stored in
+        usize m_FrameBlockSize = usize {64} * 1024;
+        /// Runs jobs on fibers so `wait` can park them, ignored where `Fiber::SUPPORTED` is false
+        bool m_UseFibers = Fiber::SUPPORTED;
+        /// Usable stack of every fiber, reserved up front but committed as it is touched
+        usize m_FiberStackSize = usize {256} * 1024;
+    };
+
+    /// A fixed pool of worker threads that balance jobs by work stealing
+    /// # Usage
+    /// The creating thread takes part as thread 0: it submits jobs with `run` or `parallel_for`
+    /// and runs jobs itself while it `wait`s. Jobs may submit and wait for further jobs. Threads
+    /// outside the system can call `run` too, their jobs run inline.
+    /// A job and its captures live in the frame allocator of the submitting thread, so call
+    /// `end_frame` once per frame while no jobs are queued or running to recycle the memory.
+    /// # Waiting
+    /// `wait` never blocks the thread. With fibers (the default where supported) it parks the
+    /// waiting fiber and the thread continues on a pooled fiber, a parked fiber resumes on
+    /// whichever thread picks it up once the job completing its counter readied it. Jobs must
+    /// not keep thread-local state across a `wait`. The creating thread only ever resumes on
+    /// itself. Without fibers `wait` runs other jobs until the counter is done, nesting them on
+    /// the waiting stack, which gets deep when long dependency chains are submitted up front.
+    /// # Performance
+    /// Every thread owns a Chase-Lev deque: submitting and taking local jobs is uncontended, idle
+    /// threads steal from random victims. Workers spin briefly when they run out of work, then
+    /// sleep until a job is submitted. Parking and resuming a fiber take the fiber pool lock, so
+    /// they cost far more than a job that does not wait.
+    class JobSystem {
+    public:
+        explicit JobSystem(const JobSystemConfig_t& config = {});
+        ~JobSystem();
+
+        JobSystem(const JobSystem&)            = delete;
+        JobSystem& operator=(const JobSystem&) = delete;
+        JobSystem(JobSystem&&)                 = delete;
+        JobSystem& operator=(JobSystem&&)      = delete;
+
+        /// Queues `function()` as a job of `counter`
+        template<typename F> void run(JobCounter& counter, F&& function) {
+            using Function_t = std::decay_t<F>;
+            counter.m_Pending.fetch_add(1, std::memory_order_relaxed);
+            ThreadState_t* self = current_state();
+            if (self == nullptr) [[unlikely]] {
+                Function_t(std::forward<F>(function))();
+                complete(counter);
+                return;
+            }
+            auto* job = self->m_Frame.create<Job_t<Function_t>>(std::forward<F>(function));
+            job->m_Invoke  = &Job_t<Function_t>::invoke;
+            job->m_Counter = &counter;
+            submit(*self, job);
+        }
+
+        /// Runs `function(begin, end)` over `[0, count)` in ranges of at most `grain` items and
+        /// returns once all of them ran. Ranges are split in halves, so thieves take large ones.
+        template<typename F> void parallel_for(usize count, usize grain, const F& function) {
+            JobCounter counter;
+            split_range(counter, 0, count, std::max<usize>(grain, 1), function);
+            wait(counter);
+        }
+
+        /// Runs jobs until `counter` is done
+        void wait(const JobCounter& counter);
+
+        /// Rewinds the frame allocators of all threads, no job may be queued or running
+        void end_frame();
+
+        /// Threads running jobs, the workers and the creating thread
+        [[nodiscard]] u32 thread_count() const {
+            return static_cast<u32>(m_States.size());
+        }
+
+        /// Index of the calling thread in this system, 0 for the creating thread, -1 outside
+        [[nodiscard]] i32 thread_index() const;
+
+    private:
+        struct JobBase_t {
+            void (*m_Invoke)(JobBase_t*) = nullptr;
+            JobCounter* m_Counter        = nullptr;
+        };
+
+        template<typename F> struct Job_t : JobBase_t {
+            template<typename G>
+            explicit Job_t(G&& function) : m_Function(std::forward<G>(function)) {
+            }
+
+            static void invoke(JobBase_t* base) {
+                auto* job = static_cast<Job_t*>(base);
+                job->m_Function();
+                // Frame memory is never destructed by the allocator
+                job->~Job_t();
+            }
+
+            F m_Function;
+        };
+
+        struct JobFiber_t : Fiber {
+            using Fiber::Fiber;
+
+            /// Counter the fiber is parked on
+            const JobCounter* m_WaitingOn = nullptr;
+        };
+
+        /// Work to do on the fiber that was switched to, once the previous one is switched away
+        /// from and can safely be resumed elsewhere
+        struct PostSwitch_t {
+            JobFiber_t* m_Release = nullptr;
+            JobFiber_t* m_Park    = nullptr;
+        };
+
+        struct alignas(64) ThreadState_t {
+            ThreadState_t(usize queueCapacity, usize frameBlockSize)
+                : m_Queue(queueCapacity), m_Frame(frameBlockSize, GC::MemoryTag::Engine) {
+            }
+
+            WorkStealingDeque<JobBase_t> m_Queue;
+            GC::FrameAllocator           m_Frame;
+            u64                          m_Random = 0;
+
+            /// The thread's own stack, only ever resumed on this thread
+            JobFiber_t  m_Root;
+            JobFiber_t* m_Current = &m_Root;
+            /// Set while the root waits, checked by the fibers running on this thread
+            JobFiber_t*  m_ParkedRoot = nullptr;
+            PostSwitch_t m_PostSwitch;
+        };
+
+        template<typename F>
+        void split_range(
+            JobCounter& counter, usize begin, usize end, usize grain, const F& function) {
+            while (end - begin > grain) {
+                const usize middle = begin + (end - begin) / 2;
+                run(counter, [this, &counter, middle, end, grain, &function] {
+                    split_range(counter, middle, end, grain, function);
+                });
+                end = middle;
+            }
+            if (begin < end) {
+                function(begin, end);
+            }
+        }
+
+        /// State of the calling thread, nullptr if it does not belong to this system. Never
+        /// inlined, so the thread-local is read again after a fiber moved to another thread.
+        PULSAR_NO_INLINE [[nodiscard]] ThreadState_t* current_state() const;
+
+        void submit(ThreadState_t& self, JobBase_t* job);
+        /// Own jobs first, then stolen ones
+        [[nodiscard]] JobBase_t* find_job(ThreadState_t& self);
+        void execute(JobBase_t* job);
+        /// Counts a job of `counter` as done and readies the fibers waiting for it
+        void complete(JobCounter& counter);
+        void        wake_worker();
+        void        worker_main(u32 index);
+
+        /// Runs jobs and resumes parked fibers, what every pooled fiber executes
+        void schedule();
+        static void fiber_main(void* system);
+        void        wait_on_fiber(ThreadState_t& self, const JobCounter& counter);
+        /// A fiber that was parked on a counter that is done now, nullptr if there is none
+        [[nodiscard]] JobFiber_t* take_ready_fiber();
+        /// Parks `fiber` on its counter unless that is done already, `m_FiberMutex` must be held
+        [[nodiscard]] bool park_locked(JobFiber_t* fiber);
+        /// An idle fiber from the pool, a new one if the pool is empty
+        [[nodiscard]] JobFiber_t* acquire_fiber();
+        void switch_fiber(ThreadState_t& self, JobFiber_t& target, const PostSwitch_t& post);
+        /// Completes the `PostSwitch_t` of the calling thread, right after every switch
+        void finish_switch();
+
+        std::vector<std::unique_ptr<ThreadState_t>> m_States;
+        std::vector<std::thread>                    m_Workers;
+        bool                                        m_UseFibers;
+        usize                                       m_FiberStackSize;
+
+        std::mutex                               m_FiberMutex;
+        std::vector<std::unique_ptr<JobFiber_t>> m_Fibers;
+        std::vector<JobFiber_t*>                 m_IdleFibers;
+        /// Waiting for their counters, moved to m_ReadyFibers by the job that completes them
+        std::vector<JobFiber_t*> m_ParkedFibers;
+        std::vector<JobFiber_t*> m_ReadyFibers;
+        /// Sizes of the lists above, read without the lock
+        std::atomic<u32> m_ParkedCount {0};
+        std::atomic<u32> m_ReadyCount {0};
+
+        alignas(64) std::atomic<u32> m_Signal {0};
+        std::atomic<u32>  m_Sleeping {0};
+        std::atomic<bool> m_Stopping {false};
+    };
+} // namespace Pulsar
@@ -0,0 +1,303 @@
+#include "TaskGraph.hpp"
+
+#include "PulsarCore/Util/Macros.hpp"
+#include "PulsarCore/Util/Profiler.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fmt/format.h>
+#include <fstream>
+#include <iterator>
+#include <optional>
+
+namespace Pulsar {
+    namespace {
+        u64 now_ns() {
+            return static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch())
+                                        .count());
+        }
+
+        /// Last writer and the readers since, per resource, while the dependencies are collected
+        struct ResourceState_t {
+            std::optional<TaskId> m_Writer;
+            std::vector<TaskId>   m_Readers;
+        };
+
+        /// A task that refers to an id the graph does not have would corrupt `compile`
+        [[noreturn]] void reject_task(std::string_view name, std::string_view problem) {
+            fmt::print(stderr, "Task \"{}\" {}\n", name, problem);
+            std::abort();
+        }
+
+        void append_escaped(std::string& out, std::string_view text) {
+            for (const char character : text) {
+                if (character == '"' || character == '\\') {
+                    out += '\\';
+                }
+                out += character;
+            }
+        }
+    } // namespace
+
+    ResourceId TaskGraph::resource(std::string_view name) {
+        const auto found = std::ranges::find(m_Resources, name);
+        if (found != m_Resources.end()) {
+            return static_cast<ResourceId>(found - m_Resources.begin());
+        }
+        m_Resources.emplace_back(name);
+        return static_cast<ResourceId>(m_Resources.size() - 1);
+    }
+
+    TaskId TaskGraph::add(TaskDesc_t desc, std::function<void()> function) {
+        PULSAR_ASSERT(!m_Compiled, "Tasks can't be added to a compiled graph");
+        const auto id = static_cast<TaskId>(m_Tasks.size());
+        for (const TaskId dependency : desc.m_After) {
+            if (dependency >= id) {
+                reject_task(desc.m_Name,
+                    fmt::format("runs after task {}, which is not an earlier task", dependency));
+            }
+        }
+        for (const auto* resources : {&desc.m_Reads, &desc.m_Writes}) {
+            for (const ResourceId resource : *resources) {
+                if (resource >= m_Resources.size()) {
+                    reject_task(desc.m_Name,
+                        fmt::format("uses resource {}, which is not registered", resource));
+                }
+            }
+        }
+        m_Tasks.push_back({
+            .m_Name     = std::move(desc.m_Name),
+            .m_Function = std::move(function),
+            .m_Reads    = std::move(desc.m_Reads),
+            .m_Writes   = std::move(desc.m_Writes),
+            .m_After    = std::move(desc.m_After),
+            .m_Cost     = desc.m_Cost,
+        });
+        return id;
+    }
+
+    void TaskGraph::compile() {
+        PULSAR_ASSERT(!m_Compiled, "The graph is already compiled");
+        const usize count = m_Tasks.size();
+        const usize words = (count + 63) / 64;
+
+        std::vector<ResourceState_t> resources(m_Resources.size());
+        // Tasks reachable backwards from each task, its dependencies included
+        std::vector<u64>    reachable(count * words, 0);
+        std::vector<TaskId> direct;
+        m_RedundantEdges = 0;
+
+        for (TaskId id = 0; id < count; id++) {
+            Task_t& task = m_Tasks[id];
+            direct.assign(task.m_After.begin(), task.m_After.end());
+            for (const ResourceId read : task.m_Reads) {
+                // Reading and writing the same resource is a write
+                if (std::ranges::find(task.m_Writes, read) != task.m_Writes.end()) {
+                    continue;
+                }
+                ResourceState_t& state = resources[read];
+                if (state.m_Writer) {
+                    direct.push_back(*state.m_Writer);
+                }
+                state.m_Readers.push_back(id);
+            }
+            for (const ResourceId write : task.m_Writes) {
+                ResourceState_t& state = resources[write];
+                if (state.m_Writer) {
+                    direct.push_back(*state.m_Writer);
+                }
+                direct.insert(direct.end(), state.m_Readers.begin(), state.m_Readers.end());
+                state.m_Writer = id;
+                state.m_Readers.clear();
+            }
+            std::ranges::sort(direct, std::greater {});
+            const auto duplicates = std::ranges::unique(direct);
+            direct.erase(duplicates.begin(), duplicates.end());
+
+            // A dependency reachable through a later one is implied by it. Every path between
+            // two tasks runs through increasing ids, so checking the latest dependencies first
+            // finds all of them.
+            u64* const own = &reachable[id * words];
+            for (const TaskId dependency : direct) {
+                PULSAR_ASSERT(dependency < id, "Tasks can only run after earlier tasks");
+                if ((own[dependency / 64] & (u64 {1} << (dependency % 64))) != 0) {
+                    m_RedundantEdges++;
+                    continue;
+                }
+                const u64* const inherited = &reachable[dependency * words];
+                for (usize word = 0; word < words; word++) {
+                    own[word] |= inherited[word];
+                }
+                own[dependency / 64] |= u64 {1} << (dependency % 64);
+                task.m_Dependencies.push_back(dependency);
+                m_Tasks[dependency].m_Dependents.push_back(id);
+            }
+            std::ranges::reverse(task.m_Dependencies);
+
+            for (const TaskId dependency : task.m_Dependencies) {
+                task.m_Level = std::max(task.m_Level, m_Tasks[dependency].m_Level + 1);
+            }
+        }
+
+        m_Pending = std::make_unique<std::atomic<u32>[]>(count);
+        m_Ready.reserve(count);
+        m_Compiled = true;
+        compute_priorities();
+    }
+
+    void TaskGraph::compute_priorities() {
+        for (usize i = m_Tasks.size(); i-- > 0;) {
+            Task_t& task = m_Tasks[i];
+            f64     rest = 0.0;
+            for (const TaskId dependent : task.m_Dependents) {
+                rest = std::max(rest, m_Tasks[dependent].m_Priority);
+            }
+            task.m_Priority = task.m_Cost + rest;
+        }
+
+        m_Roots.clear();
+        for (TaskId id = 0; id < m_Tasks.size(); id++) {
+            if (m_Tasks[id].m_Dependencies.empty()) {
+                m_Roots.push_back(id);
+            }
+        }
+        std::ranges::sort(m_Roots, [this](TaskId a, TaskId b) { return runs_before(a, b); });
+    }
+
+    bool TaskGraph::runs_before(TaskId a, TaskId b) const {
+        const f64 priorityA = m_Tasks[a].m_Priority;
+        const f64 priorityB = m_Tasks[b].m_Priority;
+        return priorityA != priorityB ? priorityA > priorityB : a < b;
+    }
+
+    void TaskGraph::run(JobSystem& jobs) {
+        PULSAR_ASSERT(m_Compiled, "The graph has to be compiled before it runs");
+        PULSAR_PROFILE_FUNCTION();
+        for (TaskId id = 0; id < m_Tasks.size(); id++) {
+            m_Pending[id].store(static_cast<u32>(m_Tasks[id].m_Dependencies.size()),
+                std::memory_order_relaxed);
+        }
+        m_RunStartNs = now_ns();
+
+        // The heap orders by `runs_before`, so its top is the task that runs first
+        const auto after = [this](TaskId a, TaskId b) { return runs_before(b, a); };
+        {
+            std::lock_guard lock(m_ReadyMutex);
+            m_Ready.assign(m_Roots.begin(), m_Roots.end());
+            std::ranges::make_heap(m_Ready, after);
+        }
+        JobCounter counter;
+        for (usize i = 0; i < m_Roots.size(); i++) {
+            jobs.run(counter, [this, &jobs, &counter] { run_next(jobs, counter); });
+        }
+        jobs.wait(counter);
+    }
+
+    void TaskGraph::run_next(JobSystem& jobs, JobCounter& counter) {
+        const auto after = [this](TaskId a, TaskId b) { return runs_before(b, a); };
+        // Jobs don't own a task, each takes whichever ready task matters most when it starts
+        TaskId id = 0;
+        {
+            std::lock_guard lock(m_ReadyMutex);
+            std::ranges::pop_heap(m_Ready, after);
+            id = m_Ready.back();
+            m_Ready.pop_back();
+        }
+        Task_t& task = m_Tasks[id];
+        execute(task, jobs.thread_index());
+
+        usize readied = 0;
+        for (const TaskId dependent : task.m_Dependents) {
+            if (m_Pending[dependent].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                std::lock_guard lock(m_ReadyMutex);
+                m_Ready.push_back(dependent);
+                std::ranges::push_heap(m_Ready, after);
+                readied++;
+            }
+        }
+        for (usize i = 0; i < readied; i++) {
+            jobs.run(counter, [this, &jobs, &counter] { run_next(jobs, counter); });
+        }
+    }
+
+    void TaskGraph::run_serial() {
+        PULSAR_ASSERT(m_Compiled, "The graph has to be compiled before it runs");
+        PULSAR_PROFILE_FUNCTION();
+        m_RunStartNs = now_ns();
+        for (Task_t& task : m_Tasks) {
+            execute(task, 0);
+        }
+    }
+
+    void TaskGraph::execute(Task_t& task, i32 thread) {
+        task.m_StartNs = now_ns() - m_RunStartNs;
+        task.m_Function();
+        task.m_EndNs  = now_ns() - m_RunStartNs;
+        task.m_Thread = thread;
+    }
+
+    void TaskGraph::use_measured_costs() {
+        for (Task_t& task : m_Tasks) {
+            task.m_Cost = static_cast<f64>(std::max<u64>(task.m_EndNs - task.m_StartNs, 1));
+        }
+        compute_priorities();
+    }
+
+    std::vector<TaskId> TaskGraph::critical_path() const {
+        std::vector<TaskId> path;
+        if (m_Roots.empty()) {
+            return path;
+        }
+        // The highest priority root starts the longest path, and each step follows the dependent
+        // that continues it
+        path.push_back(m_Roots.front());
+        while (!m_Tasks[path.back()].m_Dependents.empty()) {
+            const auto& dependents = m_Tasks[path.back()].m_Dependents;
+            path.push_back(*std::ranges::min_element(
+                dependents, [this](TaskId a, TaskId b) { return runs_before(a, b); }));
+        }
+        return path;
+    }
+
+    std::string TaskGraph::to_dot() const {
+        std::vector<bool> critical(m_Tasks.size(), false);
+        for (const TaskId id : critical_path()) {
+            critical[id] = true;
+        }
+
+        std::string out = "digraph TaskGraph {\n    rankdir=LR;\n    node [shape=box];\n";
+        for (TaskId id = 0; id < m_Tasks.size(); id++) {
+            const Task_t& task = m_Tasks[id];
+            fmt::format_to(std::back_inserter(out), "    t{} [label=\"", id);
+            append_escaped(out, task.m_Name);
+            fmt::format_to(std::back_inserter(out), "\\npriority {:.4g}, level {}", task.m_Priority,
+                task.m_Level);
+            if (task.m_Thread >= 0) {
+                fmt::format_to(std::back_inserter(out), "\\n{:.3f}-{:.3f} ms on thread {}",
+                    static_cast<f64>(task.m_StartNs) / 1e6, static_cast<f64>(task.m_EndNs) / 1e6,
+                    task.m_Thread);
+            }
+            out += critical[id] ? "\", color=red];\n" : "\"];\n";
+        }
+        for (TaskId id = 0; id < m_Tasks.size(); id++) {
+            for (const TaskId dependent : m_Tasks[id].m_Dependents) {
+                fmt::format_to(std::back_inserter(out), "    t{} -> t{}{};\n", id, dependent,
+                    critical[id] && critical[dependent] ? " [color=red]" : "");
+            }
+        }
+        out += "}\n";
+        return out;
+    }
+
+    Result<bool, std::string> TaskGraph::export_dot(const std::filesystem::path& path) const {
+        const std::string dot = to_dot();
+        std::ofstream     file(path, std::ios::binary | std::ios::trunc);
+        if (!file || !file.write(dot.data(), static_cast<std::streamsize>(dot.size()))) {
+            return Err<std::string>(fmt::format("Failed to write task graph to {}", path.string()));
+        }
+        return Result<bool, std::string>(true);
+    }
+} // namespace Pulsar
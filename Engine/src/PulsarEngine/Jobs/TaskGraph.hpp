@@ -0,0 +1,156 @@
+#pragma once
+
+#include "PulsarCore/Result.hpp"
+#include "PulsarCore/Types.hpp"
+#include "PulsarEngine/Jobs/JobSystem.hpp"
+
+#include <atomic>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Pulsar {
+    using TaskId     = u32;
+    using ResourceId = u32;
+
+    struct TaskDesc_t {
+        std::string m_Name {};
+        /// Resources the task only reads, it runs after their previous writer
+        std::vector<ResourceId> m_Reads {};
+        /// Resources the task writes, it runs after their previous writer and readers
+        std::vector<ResourceId> m_Writes {};
+        /// Earlier tasks to run after regardless of the resources, for effects the resources do not
+        /// describe
+        std::vector<TaskId> m_After {};
+        /// Estimated duration in any unit shared by all tasks, weights the critical path
+        f64 m_Cost = 1.0;
+    };
+
+    /// Systems that run each frame, ordered by the resources they declare to read and write
+    /// # Usage
+    /// Register resources with `resource`, add the tasks in the order they would run serially, then
+    /// `compile` once. Declaration order decides the conflicts: a task sees the writes of every
+    /// earlier task to the resources it uses, and tasks with disjoint resources run in parallel.
+    /// `run` executes one frame on a `JobSystem` and returns once every task ran; call
+    /// `JobSystem::end_frame` afterwards as for any other jobs.
+    /// # Scheduling
+    /// `compile` turns the declarations into a DAG and drops every edge already implied by a longer
+    /// path (transitive reduction), so each finished task only notifies the tasks that directly
+    /// wait for it. A task's priority is the cost of the longest path from it to the end of the
+    /// frame; among the ready tasks the highest priority runs first, which keeps the critical path
+    /// moving. `use_measured_costs` replaces the estimates by the durations of the last run.
+    /// # Performance
+    /// Each ready task costs one job and a short lock on the ready heap, so tasks should do at
+    /// least a few microseconds of work. Compiling is quadratic in the task count and meant for
+    /// setup, not for every frame.
+    class TaskGraph {
+    public:
+        TaskGraph() = default;
+
+        TaskGraph(const TaskGraph&)            = delete;
+        TaskGraph& operator=(const TaskGraph&) = delete;
+        TaskGraph(TaskGraph&&)                 = delete;
+        TaskGraph& operator=(TaskGraph&&)      = delete;
+
+        /// Id of the resource called `name`, registering it on first use
+        [[nodiscard]] ResourceId resource(std::string_view name);
+        /// Aborts if `desc` runs after a task that is not added yet or uses an unknown resource
+        [[nodiscard]] TaskId add(TaskDesc_t desc, std::function<void()> function);
+
+        /// Builds the dependency DAG and the priorities, tasks can't be added afterwards
+        void compile();
+
+        /// Runs every task once on `jobs`, respecting the dependencies
+        void run(JobSystem& jobs);
+        /// Runs every task once in declaration order on the calling thread
+        void run_serial();
+
+        /// Sets the cost of every task to its duration in the last run and recomputes priorities
+        void use_measured_costs();
+
+        [[nodiscard]] usize task_count() const {
+            return m_Tasks.size();
+        }
+
+        [[nodiscard]] bool is_compiled() const {
+            return m_Compiled;
+        }
+
+        /// Direct dependencies after the transitive reduction
+        [[nodiscard]] const std::vector<TaskId>& dependencies(TaskId task) const {
+            return m_Tasks[task].m_Dependencies;
+        }
+
+        [[nodiscard]] const std::vector<TaskId>& dependents(TaskId task) const {
+            return m_Tasks[task].m_Dependents;
+        }
+
+        /// Cost of the longest path from the start of `task` to the end of the frame
+        [[nodiscard]] f64 priority(TaskId task) const {
+            return m_Tasks[task].m_Priority;
+        }
+
+        /// Length of the longest dependency chain before `task`, 0 for tasks without dependencies
+        [[nodiscard]] u32 level(TaskId task) const {
+            return m_Tasks[task].m_Level;
+        }
+
+        /// Edges the reduction removed, they were implied by other paths
+        [[nodiscard]] usize redundant_edge_count() const {
+            return m_RedundantEdges;
+        }
+
+        /// Longest path through the graph, from a task without dependencies to one without
+        /// dependents
+        [[nodiscard]] std::vector<TaskId> critical_path() const;
+
+        /// The compiled graph in Graphviz format: reduced edges, priorities, levels and the timings
+        /// of the last run, with the critical path highlighted
+        [[nodiscard]] std::string to_dot() const;
+        [[nodiscard]] Result<bool, std::string> export_dot(const std::filesystem::path& path) const;
+
+    private:
+        struct Task_t {
+            std::string             m_Name;
+            std::function<void()>   m_Function;
+            std::vector<ResourceId> m_Reads {};
+            std::vector<ResourceId> m_Writes {};
+            std::vector<TaskId>     m_After;
+            f64                     m_Cost;
+
+            std::vector<TaskId> m_Dependencies {};
+            std::vector<TaskId> m_Dependents {};
+            f64                 m_Priority = 0.0;
+            u32                 m_Level    = 0;
+
+            /// Timings of the last run, in nanoseconds since its start
+            u64 m_StartNs = 0;
+            u64 m_EndNs   = 0;
+            i32 m_Thread  = -1;
+        };
+
+        void compute_priorities();
+        /// Runs the highest priority ready task, one job per task that became ready
+        void run_next(JobSystem& jobs, JobCounter& counter);
+        void execute(Task_t& task, i32 thread);
+        /// Whether `a` runs before `b` when both are ready
+        [[nodiscard]] bool runs_before(TaskId a, TaskId b) const;
+
+        std::vector<Task_t>      m_Tasks;
+        std::vector<std::string> m_Resources;
+        std::vector<TaskId>      m_Roots;
+        usize                    m_RedundantEdges = 0;
+        bool                     m_Compiled       = false;
+
+        /// Predecessors left to finish in the current run, per task
+        std::unique_ptr<std::atomic<u32>[]> m_Pending;
+        std::mutex                          m_ReadyMutex;
+        /// Ready tasks as a heap, highest priority on top
+        std::vector<TaskId> m_Ready;
+        u64                 m_RunStartNs = 0;
+    };
+} // namespace Pulsar
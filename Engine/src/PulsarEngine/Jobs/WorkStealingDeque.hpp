@@ -0,0 +1,104 @@
+#pragma once
+
+#include "PulsarCore/Types.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <memory>
+
+namespace Pulsar {
+    /// A Chase-Lev work-stealing deque of pointers
+    /// # Usage
+    /// One owner thread pushes and pops at the bottom (LIFO, so it keeps working on hot data),
+    /// any thread steals from the top (FIFO, so thieves take the oldest and usually largest work).
+    /// The capacity is fixed, `push` fails when the deque is full.
+    /// # Memory ordering
+    /// Follows "Correct and Efficient Work-Stealing for Weak Memory Models" (Lê et al. 2013): the
+    /// owner only pays for a full fence in `pop`, `push` is a relaxed and a release store.
+    template<typename T> class WorkStealingDeque {
+    public:
+        explicit WorkStealingDeque(usize capacity)
+            : m_Capacity(std::bit_ceil(std::max<usize>(capacity, 2))), m_Mask(m_Capacity - 1),
+              m_Buffer(std::make_unique<std::atomic<T*>[]>(m_Capacity)) { // NOLINT(*-c-arrays)
+        }
+
+        /// Owner only
+        [[nodiscard]] bool push(T* item) {
+            const i64 bottom = m_Bottom.load(std::memory_order_relaxed);
+            const i64 top    = m_Top.load(std::memory_order_acquire);
+            if (bottom - top >= static_cast<i64>(m_Capacity)) {
+                return false;
+            }
+            slot(bottom).store(item, std::memory_order_relaxed);
+            m_Bottom.store(bottom + 1, std::memory_order_release);
+            return true;
+        }
+
+        /// Owner only, the most recently pushed item or nullptr
+        [[nodiscard]] T* pop() {
+            const i64 bottom = m_Bottom.load(std::memory_order_relaxed) - 1;
+            m_Bottom.store(bottom, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            i64 top = m_Top.load(std::memory_order_relaxed);
+            if (top > bottom) {
+                m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+                return nullptr;
+            }
+            T* item = slot(bottom).load(std::memory_order_relaxed);
+            if (top == bottom) {
+                // The last item, race the thieves for it
+                if (!m_Top.compare_exchange_strong(
+                        top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                    item = nullptr;
+                }
+                m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+            }
+            return item;
+        }
+
+        /// Any thread, the oldest item or nullptr if the deque is empty or another thread won
+        [[nodiscard]] T* steal() {
+            i64 top = m_Top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const i64 bottom = m_Bottom.load(std::memory_order_acquire);
+            if (top >= bottom) {
+                return nullptr;
+            }
+            T* item = slot(top).load(std::memory_order_relaxed);
+            if (!m_Top.compare_exchange_strong(
+                    top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                return nullptr;
+            }
+            return item;
+        }
+
+        /// A snapshot that may be stale by the time it is used
+        [[nodiscard]] usize size() const {
+            const i64 bottom = m_Bottom.load(std::memory_order_relaxed);
+            const i64 top    = m_Top.load(std::memory_order_relaxed);
+            return bottom > top ? static_cast<usize>(bottom - top) : 0;
+        }
+
+        [[nodiscard]] bool empty() const {
+            return size() == 0;
+        }
+
+        [[nodiscard]] usize capacity() const {
+            return m_Capacity;
+        }
+
+    private:
+        std::atomic<T*>& slot(i64 index) {
+            return m_Buffer[static_cast<usize>(index) & m_Mask];
+        }
+
+        usize                              m_Capacity;
+        usize                              m_Mask;
+        std::unique_ptr<std::atomic<T*>[]> m_Buffer; // NOLINT(*-avoid-c-arrays)
+
+        // Thieves hammer the top, keep the owner's bottom off their cache line
+        alignas(64) std::atomic<i64> m_Top {0};
+        alignas(64) std::atomic<i64> m_Bottom {0};
+    };
+} // namespace Pulsar
@@ -0,0 +1,376 @@
+#include "TransformHierarchy.hpp"
+
+#include "PulsarCore/Util/CpuFeatures.hpp"
+#include "PulsarCore/Util/Macros.hpp"
+#include "PulsarEngine/Jobs/JobSystem.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+
+#ifdef PULSAR_ARCH_X86
+    #include <immintrin.h>
+#endif
+
+namespace Pulsar {
+    namespace {
+        constexpr u32 INVALID_INDEX = TransformNode_t::INVALID_INDEX;
+
+        /// Below this many words of the dirty mask a level is updated without jobs
+        constexpr usize MIN_WORDS_PER_JOB = 16;
+
+        /// `parent * from_trs(translation, rotation, scale)`. The local matrix is affine, so its
+        /// last row is skipped: three multiply-adds per column, one column per SSE register.
+        PULSAR_ALWAYS_INLINE inline void compose_world(const Mat4& parent, const Vec3& translation,
+            const Quat& rotation, const Vec3& scale, Mat4& world) {
+            const Mat4 local = Mat4::from_trs(translation, rotation, scale);
+#ifdef PULSAR_ARCH_X86
+            // SSE is part of the x86-64 baseline, no runtime dispatch needed
+            const __m128 p0 = _mm_load_ps(&parent.m[0]);
+            const __m128 p1 = _mm_load_ps(&parent.m[4]);
+            const __m128 p2 = _mm_load_ps(&parent.m[8]);
+            const __m128 p3 = _mm_load_ps(&parent.m[12]);
+            for (usize c = 0; c < 4; c++) {
+                __m128 column = _mm_mul_ps(p0, _mm_set1_ps(local.m[c * 4]));
+                column        = _mm_add_ps(column, _mm_mul_ps(p1, _mm_set1_ps(local.m[c * 4 + 1])));
+                column        = _mm_add_ps(column, _mm_mul_ps(p2, _mm_set1_ps(local.m[c * 4 + 2])));
+                if (c == 3) {
+                    column = _mm_add_ps(column, p3);
+                }
+                _mm_store_ps(&world.m[c * 4], column);
+            }
+#else
+            world = parent * local;
+#endif
+        }
+
+        /// Collects the bits a job sets in the dirty words of the next level, which neighbouring
+        /// jobs may share at the edges of their ranges, and ORs them in a word at a time
+        class DirtyMarker {
+        public:
+            explicit DirtyMarker(std::vector<u64>& dirty) : m_Dirty(dirty) {
+            }
+
+            ~DirtyMarker() {
+                flush();
+            }
+
+            DirtyMarker(const DirtyMarker&)            = delete;
+            DirtyMarker& operator=(const DirtyMarker&) = delete;
+            DirtyMarker(DirtyMarker&&)                 = delete;
+            DirtyMarker& operator=(DirtyMarker&&)      = delete;
+
+            void mark(usize first, usize count) {
+                const usize end = first + count;
+                while (first < end) {
+                    const usize word = first / 64;
+                    const usize bit  = first % 64;
+                    const usize bits = std::min<usize>(64 - bit, end - first);
+                    const u64   mask = (bits == 64 ? ~u64 {0} : (u64 {1} << bits) - 1) << bit;
+                    if (word != m_Word) {
+                        flush();
+                        m_Word = word;
+                    }
+                    m_Bits |= mask;
+                    first += bits;
+                }
+            }
+
+        private:
+            void flush() {
+                if (m_Bits != 0) {
+                    std::atomic_ref(m_Dirty[m_Word]).fetch_or(m_Bits, std::memory_order_relaxed);
+                    m_Bits = 0;
+                }
+            }
+
+            std::vector<u64>& m_Dirty;
+            usize             m_Word = 0;
+            u64               m_Bits = 0;
+        };
+    } // namespace
+
+    TransformNode_t TransformHierarchy::create(TransformNode_t parent, const Vec3& translation,
+        const Quat& rotation, const Vec3& scale) {
+        PULSAR_ASSERT(parent.is_null() || is_alive(parent), "Parent transform is not alive");
+        u32 index = 0;
+        if (!m_FreeNodes.empty()) {
+            index = m_FreeNodes.back();
+            m_FreeNodes.pop_back();
+        }
+        else {
+            index = static_cast<u32>(m_Nodes.size());
+            m_Nodes.emplace_back();
+        }
+        m_Nodes[index].m_Slot = push_slot(index, translation, rotation, scale);
+        link(index, parent.m_Index);
+        m_Size++;
+        m_LayoutDirty = true;
+        return {index, m_Nodes[index].m_Generation};
+    }
+
+    void TransformHierarchy::destroy(TransformNode_t node) {
+        if (!is_alive(node)) {
+            return;
+        }
+        unlink(node.m_Index);
+        std::vector<u32> pending {node.m_Index};
+        while (!pending.empty()) {
+            const u32 index = pending.back();
+            pending.pop_back();
+            Node_t& destroyed = m_Nodes[index];
+            for (u32 child = destroyed.m_FirstChild; child != INVALID_INDEX;
+                child      = m_Nodes[child].m_NextSibling) {
+                pending.push_back(child);
+            }
+            const u32 slot   = destroyed.m_Slot;
+            m_SlotNode[slot] = INVALID_INDEX;
+            m_Dirty[slot / BITS_PER_WORD] &= ~(u64 {1} << (slot % BITS_PER_WORD));
+            destroyed = {.m_Slot = INVALID_SLOT, .m_Generation = destroyed.m_Generation + 1};
+            m_FreeNodes.push_back(index);
+            m_Size--;
+        }
+        m_LayoutDirty = true;
+    }
+
+    bool TransformHierarchy::set_parent(TransformNode_t node, TransformNode_t parent) {
+        PULSAR_ASSERT(is_alive(node), "Transform is not alive");
+        PULSAR_ASSERT(parent.is_null() || is_alive(parent), "Parent transform is not alive");
+        for (u32 ancestor = parent.m_Index; ancestor != INVALID_INDEX;
+            ancestor      = m_Nodes[ancestor].m_Parent) {
+            if (ancestor == node.m_Index) {
+                return false;
+            }
+        }
+        unlink(node.m_Index);
+        link(node.m_Index, parent.m_Index);
+        mark_dirty(m_Nodes[node.m_Index].m_Slot);
+        m_LayoutDirty = true;
+        return true;
+    }
+
+    TransformNode_t TransformHierarchy::parent(TransformNode_t node) const {
+        const u32 index = m_Nodes[node.m_Index].m_Parent;
+        if (index == INVALID_INDEX) {
+            return NULL_TRANSFORM;
+        }
+        return {index, m_Nodes[index].m_Generation};
+    }
+
+    void TransformHierarchy::set_local(
+        TransformNode_t node, const Vec3& translation, const Quat& rotation, const Vec3& scale) {
+        const u32 slot      = m_Nodes[node.m_Index].m_Slot;
+        m_Translation[slot] = translation;
+        m_Rotation[slot]    = rotation;
+        m_Scale[slot]       = scale;
+        mark_dirty(slot);
+    }
+
+    usize TransformHierarchy::update() {
+        if (m_LayoutDirty) {
+            relayout();
+        }
+        if (!m_HasDirty) {
+            return 0;
+        }
+        usize updated = 0;
+        for (usize level = 0; level + 1 < m_LevelStarts.size(); level++) {
+            const usize firstWord = m_LevelStarts[level] / BITS_PER_WORD;
+            const usize lastWord  = (m_LevelStarts[level + 1] + BITS_PER_WORD - 1) / BITS_PER_WORD;
+            updated += update_words(level, firstWord, lastWord);
+        }
+        m_HasDirty = false;
+        return updated;
+    }
+
+    usize TransformHierarchy::update(JobSystem& jobs) {
+        if (m_LayoutDirty) {
+            relayout();
+        }
+        if (!m_HasDirty) {
+            return 0;
+        }
+        std::atomic<usize> updated {0};
+        for (usize level = 0; level + 1 < m_LevelStarts.size(); level++) {
+            const usize firstWord = m_LevelStarts[level] / BITS_PER_WORD;
+            const usize lastWord  = (m_LevelStarts[level + 1] + BITS_PER_WORD - 1) / BITS_PER_WORD;
+            const usize words     = lastWord - firstWord;
+            if (words <= MIN_WORDS_PER_JOB) {
+                updated.fetch_add(
+                    update_words(level, firstWord, lastWord), std::memory_order_relaxed);
+                continue;
+            }
+            // A few ranges per thread so thieves can even out the dirty spots
+            const usize grain =
+                std::max(words / (usize {jobs.thread_count()} * 4), MIN_WORDS_PER_JOB);
+            jobs.parallel_for(words, grain, [&](usize begin, usize end) {
+                updated.fetch_add(update_words(level, firstWord + begin, firstWord + end),
+                    std::memory_order_relaxed);
+            });
+        }
+        m_HasDirty = false;
+        return updated.load(std::memory_order_relaxed);
+    }
+
+    u32 TransformHierarchy::push_slot(
+        u32 index, const Vec3& translation, const Quat& rotation, const Vec3& scale) {
+        const auto slot = static_cast<u32>(m_SlotNode.size());
+        m_SlotNode.push_back(index);
+        // The parent and child slots are filled in by the relayout before the next update
+        m_ParentSlot.push_back(INVALID_SLOT);
+        m_FirstChildSlot.push_back(INVALID_SLOT);
+        m_ChildCount.push_back(0);
+        m_Translation.push_back(translation);
+        m_Rotation.push_back(rotation);
+        m_Scale.push_back(scale);
+        m_World.push_back(Mat4::identity());
+        if (slot / BITS_PER_WORD >= m_Dirty.size()) {
+            m_Dirty.push_back(0);
+        }
+        mark_dirty(slot);
+        return slot;
+    }
+
+    void TransformHierarchy::link(u32 index, u32 parent) {
+        Node_t& node = m_Nodes[index];
+        node.m_Parent = parent;
+        if (parent == INVALID_INDEX) {
+            return;
+        }
+        Node_t& parentNode = m_Nodes[parent];
+        node.m_NextSibling = parentNode.m_FirstChild;
+        if (parentNode.m_FirstChild != INVALID_INDEX) {
+            m_Nodes[parentNode.m_FirstChild].m_PrevSibling = index;
+        }
+        parentNode.m_FirstChild = index;
+        parentNode.m_ChildCount++;
+    }
+
+    void TransformHierarchy::unlink(u32 index) {
+        Node_t& node = m_Nodes[index];
+        if (node.m_Parent != INVALID_INDEX) {
+            Node_t& parentNode = m_Nodes[node.m_Parent];
+            if (node.m_PrevSibling != INVALID_INDEX) {
+                m_Nodes[node.m_PrevSibling].m_NextSibling = node.m_NextSibling;
+            }
+            else {
+                parentNode.m_FirstChild = node.m_NextSibling;
+            }
+            if (node.m_NextSibling != INVALID_INDEX) {
+                m_Nodes[node.m_NextSibling].m_PrevSibling = node.m_PrevSibling;
+            }
+            parentNode.m_ChildCount--;
+        }
+        node.m_Parent      = INVALID_INDEX;
+        node.m_NextSibling = INVALID_INDEX;
+        node.m_PrevSibling = INVALID_INDEX;
+    }
+
+    void TransformHierarchy::relayout() {
+        // Breadth-first, roots and siblings keep their relative order
+        std::vector<u32> order;
+        order.reserve(m_Size);
+        std::vector<u32> level;
+        for (const u32 index : m_SlotNode) {
+            if (index != INVALID_INDEX && m_Nodes[index].m_Parent == INVALID_INDEX) {
+                level.push_back(index);
+            }
+        }
+        m_LevelStarts.clear();
+        std::vector<u32> next;
+        while (!level.empty()) {
+            order.resize((order.size() + BITS_PER_WORD - 1) / BITS_PER_WORD * BITS_PER_WORD,
+                INVALID_INDEX);
+            m_LevelStarts.push_back(static_cast<u32>(order.size()));
+            next.clear();
+            for (const u32 index : level) {
+                order.push_back(index);
+                for (u32 child = m_Nodes[index].m_FirstChild; child != INVALID_INDEX;
+                    child      = m_Nodes[child].m_NextSibling) {
+                    next.push_back(child);
+                }
+            }
+            std::swap(level, next);
+        }
+        m_LevelStarts.push_back(static_cast<u32>(order.size()));
+
+        const usize       slots = order.size();
+        std::vector<Vec3> translation(slots, Vec3 {0.0F, 0.0F, 0.0F});
+        std::vector<Quat> rotation(slots, Quat::identity());
+        std::vector<Vec3> scale(slots, Vec3 {1.0F, 1.0F, 1.0F});
+        std::vector<Mat4> world(slots, Mat4::identity());
+        std::vector<u64>  dirty((slots + BITS_PER_WORD - 1) / BITS_PER_WORD, 0);
+        for (usize slot = 0; slot < slots; slot++) {
+            const u32 index = order[slot];
+            if (index == INVALID_INDEX) {
+                continue;
+            }
+            const u32 old      = m_Nodes[index].m_Slot;
+            translation[slot]  = m_Translation[old];
+            rotation[slot]     = m_Rotation[old];
+            scale[slot]        = m_Scale[old];
+            world[slot]        = m_World[old];
+            const u64 wasDirty = (m_Dirty[old / BITS_PER_WORD] >> (old % BITS_PER_WORD)) & 1U;
+            dirty[slot / BITS_PER_WORD] |= wasDirty << (slot % BITS_PER_WORD);
+            m_Nodes[index].m_Slot = static_cast<u32>(slot);
+        }
+
+        m_ParentSlot.assign(slots, INVALID_SLOT);
+        m_FirstChildSlot.assign(slots, INVALID_SLOT);
+        m_ChildCount.assign(slots, 0);
+        for (usize slot = 0; slot < slots; slot++) {
+            const u32 index = order[slot];
+            if (index == INVALID_INDEX) {
+                continue;
+            }
+            const Node_t& node = m_Nodes[index];
+            if (node.m_Parent != INVALID_INDEX) {
+                m_ParentSlot[slot] = m_Nodes[node.m_Parent].m_Slot;
+            }
+            if (node.m_FirstChild != INVALID_INDEX) {
+                m_FirstChildSlot[slot] = m_Nodes[node.m_FirstChild].m_Slot;
+                m_ChildCount[slot]     = node.m_ChildCount;
+            }
+        }
+
+        m_SlotNode    = std::move(order);
+        m_Translation = std::move(translation);
+        m_Rotation    = std::move(rotation);
+        m_Scale       = std::move(scale);
+        m_World       = std::move(world);
+        m_Dirty       = std::move(dirty);
+        m_LayoutDirty = false;
+    }
+
+    usize TransformHierarchy::update_words(usize level, usize firstWord, usize lastWord) {
+        usize       updated = 0;
+        DirtyMarker children(m_Dirty);
+        for (usize word = firstWord; word < lastWord; word++) {
+            // Words of this level are only written by the job owning them, the previous level
+            // finished marking them before this one started
+            u64 bits = m_Dirty[word];
+            if (bits == 0) {
+                continue;
+            }
+            m_Dirty[word] = 0;
+            while (bits != 0) {
+                const usize slot =
+                    word * BITS_PER_WORD + static_cast<usize>(std::countr_zero(bits));
+                bits &= bits - 1;
+                if (level == 0) {
+                    m_World[slot] =
+                        Mat4::from_trs(m_Translation[slot], m_Rotation[slot], m_Scale[slot]);
+                }
+                else {
+                    compose_world(m_World[m_ParentSlot[slot]], m_Translation[slot],
+                        m_Rotation[slot], m_Scale[slot], m_World[slot]);
+                }
+                if (m_ChildCount[slot] != 0) {
+                    children.mark(m_FirstChildSlot[slot], m_ChildCount[slot]);
+                }
+                updated++;
+            }
+        }
+        return updated;
+    }
+} // namespace Pulsar
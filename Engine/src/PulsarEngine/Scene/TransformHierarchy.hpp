@@ -0,0 +1,182 @@
+#pragma once
+
+#include "PulsarCore/Math/Matrix.hpp"
+#include "PulsarCore/Math/Quat.hpp"
+#include "PulsarCore/Types.hpp"
+
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace Pulsar {
+    class JobSystem;
+
+    /// A handle to a node of a `TransformHierarchy`, see `Entity_t` for how handles are reused
+    struct TransformNode_t {
+        static constexpr u32 INVALID_INDEX = std::numeric_limits<u32>::max();
+
+        u32 m_Index      = INVALID_INDEX;
+        u32 m_Generation = 0;
+
+        [[nodiscard]] bool is_null() const {
+            return m_Index == INVALID_INDEX;
+        }
+
+        [[nodiscard]] bool operator==(const TransformNode_t& other) const = default;
+    };
+
+    constexpr TransformNode_t NULL_TRANSFORM {};
+
+    /// Parent/child transforms and their local-to-world matrices
+    /// # Usage
+    /// Nodes have a local translation, rotation and scale relative to their parent. Setting any
+    /// of them marks the node dirty, `update` then recomputes the world matrices of the dirty
+    /// nodes and their descendants. `world` returns the matrix of the last `update`.
+    /// # Layout
+    /// Nodes are sorted breadth-first: all nodes of one depth form a level, and the children of
+    /// a node are contiguous in the next level. Each field lives in its own array indexed by that
+    /// order. Levels start on a multiple of 64 nodes, so every word of the dirty bitmask belongs
+    /// to exactly one level. Structural changes (create, destroy, `set_parent`) append or leave
+    /// holes, the next `update` restores the order in one pass.
+    /// # Performance
+    /// `update` walks the levels top-down and skips clean words of the dirty mask, so a frame
+    /// that moves a few nodes costs their subtrees plus a scan of one bit per node. A recomputed
+    /// node marks its children's range in the next level, a whole word at a time. Levels are
+    /// split over the job system, and world matrices are composed with SSE where available.
+    /// # Thread safety
+    /// Not thread-safe, `update` uses the job system internally.
+    class TransformHierarchy {
+    public:
+        TransformHierarchy() = default;
+
+        /// A node below `parent`, or a root when `parent` is null
+        TransformNode_t create(TransformNode_t parent = NULL_TRANSFORM,
+            const Vec3& translation = {0.0F, 0.0F, 0.0F}, const Quat& rotation = Quat::identity(),
+            const Vec3& scale = {1.0F, 1.0F, 1.0F});
+
+        /// Destroys the node and all its descendants, does nothing if it is not alive
+        void destroy(TransformNode_t node);
+
+        [[nodiscard]] bool is_alive(TransformNode_t node) const {
+            return node.m_Index < m_Nodes.size() &&
+                   m_Nodes[node.m_Index].m_Generation == node.m_Generation &&
+                   m_Nodes[node.m_Index].m_Slot != INVALID_SLOT;
+        }
+
+        /// Moves the node below `parent` (a root for null), keeping its local transform. Returns
+        /// false and changes nothing if `parent` is the node itself or one of its descendants.
+        bool set_parent(TransformNode_t node, TransformNode_t parent);
+
+        [[nodiscard]] TransformNode_t parent(TransformNode_t node) const;
+
+        void set_translation(TransformNode_t node, const Vec3& translation) {
+            const u32 slot      = m_Nodes[node.m_Index].m_Slot;
+            m_Translation[slot] = translation;
+            mark_dirty(slot);
+        }
+
+        void set_rotation(TransformNode_t node, const Quat& rotation) {
+            const u32 slot   = m_Nodes[node.m_Index].m_Slot;
+            m_Rotation[slot] = rotation;
+            mark_dirty(slot);
+        }
+
+        void set_scale(TransformNode_t node, const Vec3& scale) {
+            const u32 slot = m_Nodes[node.m_Index].m_Slot;
+            m_Scale[slot]  = scale;
+            mark_dirty(slot);
+        }
+
+        void set_local(
+            TransformNode_t node, const Vec3& translation, const Quat& rotation, const Vec3& scale);
+
+        [[nodiscard]] const Vec3& translation(TransformNode_t node) const {
+            return m_Translation[m_Nodes[node.m_Index].m_Slot];
+        }
+
+        [[nodiscard]] const Quat& rotation(TransformNode_t node) const {
+            return m_Rotation[m_Nodes[node.m_Index].m_Slot];
+        }
+
+        [[nodiscard]] const Vec3& scale(TransformNode_t node) const {
+            return m_Scale[m_Nodes[node.m_Index].m_Slot];
+        }
+
+        /// Local-to-world matrix as of the last `update`
+        [[nodiscard]] const Mat4& world(TransformNode_t node) const {
+            return m_World[m_Nodes[node.m_Index].m_Slot];
+        }
+
+        /// Recomputes the world matrices of dirty nodes and their descendants, level by level.
+        /// Returns how many nodes were recomputed.
+        usize update();
+
+        /// The same with every level split over `jobs`, call it from a thread of `jobs`
+        usize update(JobSystem& jobs);
+
+        /// Live nodes
+        [[nodiscard]] usize size() const {
+            return m_Size;
+        }
+
+        /// Levels as of the last `update`, the depth of the deepest node plus one
+        [[nodiscard]] usize level_count() const {
+            return m_LevelStarts.empty() ? 0 : m_LevelStarts.size() - 1;
+        }
+
+        /// World matrices in layout order including holes, for uploading them as a whole. Only
+        /// meaningful directly after `update`.
+        [[nodiscard]] std::span<const Mat4> world_matrices() const {
+            return m_World;
+        }
+
+    private:
+        static constexpr u32   INVALID_SLOT  = std::numeric_limits<u32>::max();
+        static constexpr usize BITS_PER_WORD = 64;
+
+        /// Per handle, cold: only touched by structural changes and the relayout
+        struct Node_t {
+            u32 m_Slot        = INVALID_SLOT;
+            u32 m_Generation  = 0;
+            u32 m_Parent      = TransformNode_t::INVALID_INDEX;
+            u32 m_FirstChild  = TransformNode_t::INVALID_INDEX;
+            u32 m_NextSibling = TransformNode_t::INVALID_INDEX;
+            u32 m_PrevSibling = TransformNode_t::INVALID_INDEX;
+            u32 m_ChildCount  = 0;
+        };
+
+        void mark_dirty(u32 slot) {
+            m_Dirty[slot / BITS_PER_WORD] |= u64 {1} << (slot % BITS_PER_WORD);
+            m_HasDirty = true;
+        }
+
+        u32 push_slot(
+            u32 index, const Vec3& translation, const Quat& rotation, const Vec3& scale);
+        void link(u32 index, u32 parent);
+        void unlink(u32 index);
+        /// Sorts the slots breadth-first again after structural changes
+        void relayout();
+        /// Recomputes the dirty nodes in `[firstWord, lastWord)` of level `level`, returns how many
+        usize update_words(usize level, usize firstWord, usize lastWord);
+
+        std::vector<Node_t> m_Nodes;
+        std::vector<u32>    m_FreeNodes;
+        usize               m_Size = 0;
+
+        // Per slot, in layout order
+        std::vector<u32>  m_SlotNode;
+        std::vector<u32>  m_ParentSlot;
+        std::vector<u32>  m_FirstChildSlot;
+        std::vector<u32>  m_ChildCount;
+        std::vector<Vec3> m_Translation;
+        std::vector<Quat> m_Rotation;
+        std::vector<Vec3> m_Scale;
+        std::vector<Mat4> m_World;
+        std::vector<u64>  m_Dirty;
+
+        /// First slot of every level, followed by the end of the last one
+        std::vector<u32> m_LevelStarts;
+        bool             m_LayoutDirty = false;
+        bool             m_HasDirty    = false;
+    };
+} // namespace Pulsar
@@ -0,0 +1,85 @@
+// NOLINTBEGIN(*)
+#include "PulsarCore/Util/Timestamp.hpp"
+#include "PulsarEngine/App/MainLoop.hpp"
+#include "PulsarWindow/HeadlessWindow.hpp"
+
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace Pulsar;
+
+namespace {
+    class RecordingApp final : public Application {
+    public:
+        void handle_events(std::span<const Event_t> events) override {
+            m_Events += events.size();
+        }
+
+        void fixed_update(f64 stepSeconds) override {
+            m_Steps++;
+            m_StepSeconds = stepSeconds;
+        }
+
+        void render(f64 alpha) override {
+            m_Alphas.push_back(alpha);
+        }
+
+        u64              m_Events      = 0;
+        u64              m_Steps       = 0;
+        f64              m_StepSeconds = 0.0;
+        std::vector<f64> m_Alphas;
+    };
+} // namespace
+
+TEST(MainLoop, FixedStepsWithInterpolation) {
+    HeadlessWindow window({.m_FrameCount = 10, .m_FrameTimeNs = 10'000'000});
+    RecordingApp   app;
+    MainLoop       loop(window, app, {.m_SimulationStepNs = 4'000'000});
+    window.inject(Event_t::key(Key::A, true));
+    loop.run();
+
+    // 100 ms of window time in 4 ms steps
+    EXPECT_EQ(app.m_Steps, 25U);
+    EXPECT_DOUBLE_EQ(app.m_StepSeconds, 0.004);
+    ASSERT_EQ(app.m_Alphas.size(), 10U);
+    // 10 ms per frame leaves 2, 0, 2, 0... ms of a step over
+    EXPECT_DOUBLE_EQ(app.m_Alphas[0], 0.5);
+    EXPECT_DOUBLE_EQ(app.m_Alphas[1], 0.0);
+    EXPECT_DOUBLE_EQ(app.m_Alphas[2], 0.5);
+    EXPECT_EQ(app.m_Events, 1U);
+    EXPECT_EQ(loop.stats().m_Frames, 10U);
+    EXPECT_EQ(loop.stats().m_SimulationSteps, 25U);
+    EXPECT_EQ(loop.stats().m_FrameTimes.count(), 10U);
+}
+
+TEST(MainLoop, LimitsCatchUp) {
+    HeadlessWindow         window({.m_FrameTimeNs = 1'000'000});
+    RecordingApp           app;
+    const MainLoopConfig_t config = {.m_SimulationStepNs = 1'000'000,
+        .m_MaxFrameDeltaNs = 100'000'000, .m_MaxStepsPerFrame = 8, .m_FrameLimit = 2};
+    MainLoop               loop(window, app, config);
+    // A one second stall before the first frame
+    window.advance(1'000'000'000);
+    loop.run();
+
+    // The stall is cut to 100 ms, of which a frame simulates 8 ms and drops the rest
+    EXPECT_EQ(app.m_Steps, 9U);
+    EXPECT_EQ(loop.stats().m_DroppedSimulationNs, 900'000'000U + 93'000'000U);
+    EXPECT_EQ(loop.stats().m_Frames, 2U);
+}
+
+TEST(MainLoop, PacesToTargetFrameTime) {
+    constexpr u64  FRAME_NS = 2'000'000;
+    HeadlessWindow window({.m_FrameCount = 20});
+    RecordingApp   app;
+    MainLoop       loop(window, app, {.m_TargetFrameNs = FRAME_NS, .m_PacingSpinNs = 100'000});
+    const u64      start = monotonic_ns();
+    loop.run();
+    const u64 elapsed = monotonic_ns() - start;
+
+    // Deadlines are absolute, so 20 frames take at least 20 periods however the sleeps land
+    EXPECT_GE(elapsed, 19 * FRAME_NS);
+    EXPECT_GE(loop.stats().m_FrameTimes.percentile(0.5), FRAME_NS * 9 / 10);
+    EXPECT_GE(loop.stats().m_FrameTimes.mean(), FRAME_NS * 0.9);
+}
+// NOLINTEND(*)
@@ -0,0 +1,312 @@
+// NOLINTBEGIN(*)
+#include "PulsarEngine/ECS/CommandBuffer.hpp"
+#include "PulsarEngine/ECS/Query.hpp"
+#include "PulsarEngine/ECS/World.hpp"
+
+#include <array>
+#include <atomic>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace Pulsar;
+
+namespace {
+    struct Position_t {
+        f32 m_X = 0.0F;
+        f32 m_Y = 0.0F;
+    };
+
+    struct Velocity_t {
+        f32 m_X = 0.0F;
+        f32 m_Y = 0.0F;
+    };
+
+    struct Frozen_t {};
+
+    /// Non-trivial, counts live instances to catch leaks and double destruction
+    struct Name_t {
+        static inline int s_Alive = 0;
+
+        explicit Name_t(std::string name) : m_Name(std::make_unique<std::string>(std::move(name))) {
+            s_Alive++;
+        }
+
+        Name_t(Name_t&& other) noexcept : m_Name(std::move(other.m_Name)) {
+            s_Alive++;
+        }
+
+        Name_t& operator=(Name_t&& other) noexcept {
+            m_Name = std::move(other.m_Name);
+            return *this;
+        }
+
+        ~Name_t() {
+            s_Alive--;
+        }
+
+        std::unique_ptr<std::string> m_Name;
+    };
+
+    /// Larger than a chunk, rejected at compile time
+    struct Huge_t {
+        std::array<std::byte, CHUNK_SIZE + 1> m_Bytes {};
+    };
+    static_assert(!Component<Huge_t>);
+
+    /// As large as a component can be, a few of them together still overflow a chunk
+    template<int N> struct Large_t {
+        std::array<std::byte, MAX_COMPONENT_SIZE> m_Bytes {};
+    };
+    static_assert(Component<Large_t<0>>);
+
+    static_assert(internal::DISTINCT_TYPES<Position_t, Velocity_t, Frozen_t>);
+    static_assert(!internal::DISTINCT_TYPES<Position_t, Velocity_t, Position_t>);
+
+    JobSystemConfig_t test_config() {
+        return {.m_WorkerCount = 3, .m_PinWorkers = false};
+    }
+} // namespace
+
+TEST(World, CreatesEntitiesWithComponents) {
+    World          world;
+    const Entity_t a = world.create(Position_t {1, 2}, Velocity_t {3, 4});
+    const Entity_t b = world.create(Position_t {5, 6});
+    const Entity_t c = world.create();
+    EXPECT_EQ(world.entity_count(), 3u);
+    EXPECT_TRUE(world.is_alive(c));
+    ASSERT_NE(world.get<Position_t>(a), nullptr);
+    EXPECT_EQ(world.get<Position_t>(a)->m_Y, 2.0F);
+    EXPECT_EQ(world.get<Velocity_t>(a)->m_X, 3.0F);
+    EXPECT_EQ(world.get<Position_t>(b)->m_X, 5.0F);
+    EXPECT_FALSE(world.has<Velocity_t>(b));
+    EXPECT_FALSE(world.has<Position_t>(c));
+}
+
+TEST(World, DestroyedHandlesStayInvalidAfterReuse) {
+    World          world;
+    const Entity_t first = world.create(Position_t {1, 1});
+    world.destroy(first);
+    EXPECT_FALSE(world.is_alive(first));
+    EXPECT_EQ(world.get<Position_t>(first), nullptr);
+
+    const Entity_t second = world.create(Position_t {2, 2});
+    EXPECT_EQ(second.m_Index, first.m_Index);
+    EXPECT_NE(second.m_Generation, first.m_Generation);
+    EXPECT_FALSE(world.is_alive(first));
+    EXPECT_TRUE(world.is_alive(second));
+    // Destroying the stale handle again must not touch the new entity
+    world.destroy(first);
+    EXPECT_TRUE(world.is_alive(second));
+    EXPECT_FALSE(world.is_alive(NULL_ENTITY));
+}
+
+TEST(World, AddAndRemoveKeepOtherComponents) {
+    World          world;
+    const Entity_t entity = world.create(Position_t {1, 2}, Name_t("player"));
+    world.add<Velocity_t>(entity, 3.0F, 4.0F);
+    EXPECT_EQ(world.get<Position_t>(entity)->m_X, 1.0F);
+    EXPECT_EQ(*world.get<Name_t>(entity)->m_Name, "player");
+    EXPECT_EQ(world.get<Velocity_t>(entity)->m_Y, 4.0F);
+
+    // Replacing keeps the archetype
+    world.add<Velocity_t>(entity, 5.0F, 6.0F);
+    EXPECT_EQ(world.get<Velocity_t>(entity)->m_X, 5.0F);
+
+    world.remove<Position_t>(entity);
+    EXPECT_FALSE(world.has<Position_t>(entity));
+    EXPECT_EQ(*world.get<Name_t>(entity)->m_Name, "player");
+    world.remove<Position_t>(entity);
+    EXPECT_EQ(Name_t::s_Alive, 1);
+}
+
+TEST(World, AddToADestroyedEntityDoesNothing) {
+    World          world;
+    const Entity_t dead = world.create(Position_t {1, 2});
+    world.destroy(dead);
+    EXPECT_EQ(world.add<Name_t>(dead, "dead"), nullptr);
+    EXPECT_EQ(Name_t::s_Alive, 0);
+
+    // The stale handle must not reach the entity that reuses its slot
+    const Entity_t reused = world.create(Position_t {3, 4});
+    ASSERT_EQ(reused.m_Index, dead.m_Index);
+    EXPECT_EQ(world.add<Velocity_t>(dead, 5.0F, 6.0F), nullptr);
+    EXPECT_FALSE(world.has<Velocity_t>(reused));
+    EXPECT_EQ(world.entity_count(), 1u);
+}
+
+TEST(World, DenseAfterRemovalAcrossChunks) {
+    World                 world;
+    std::vector<Entity_t> entities;
+    for (int i = 0; i < 5000; i++) {
+        entities.push_back(world.create(Position_t {f32(i), 0}, Name_t(std::to_string(i))));
+    }
+    const Archetype& archetype = *world.archetypes().back();
+    EXPECT_GT(archetype.chunks().size(), 1u);
+    EXPECT_LE(archetype.chunk_capacity() * (sizeof(Entity_t) + sizeof(Position_t) + sizeof(Name_t)),
+              CHUNK_SIZE);
+
+    // Remove every other entity, the rest must keep their own components
+    for (usize i = 0; i < entities.size(); i += 2) {
+        world.destroy(entities[i]);
+    }
+    EXPECT_EQ(archetype.entity_count(), 2500u);
+    EXPECT_EQ(Name_t::s_Alive, 2500);
+    for (usize i = 1; i < entities.size(); i += 2) {
+        ASSERT_EQ(world.get<Position_t>(entities[i])->m_X, f32(i));
+        ASSERT_EQ(*world.get<Name_t>(entities[i])->m_Name, std::to_string(i));
+    }
+    for (usize c = 0; c + 1 < archetype.chunks().size(); c++) {
+        EXPECT_EQ(archetype.chunks()[c].m_Count, archetype.chunk_capacity());
+    }
+}
+
+TEST(WorldDeathTest, RejectsEntitiesLargerThanAChunk) {
+    GTEST_FLAG_SET(death_test_style, "threadsafe");
+    EXPECT_DEATH(
+        {
+            World world;
+            world.create(Large_t<0> {}, Large_t<1> {}, Large_t<2> {}, Large_t<3> {});
+        },
+        "bytes per entity");
+}
+
+TEST(World, DestroysComponentsWithTheWorld) {
+    {
+        World world;
+        for (int i = 0; i < 100; i++) {
+            world.create(Name_t("entity"));
+        }
+        EXPECT_EQ(Name_t::s_Alive, 100);
+    }
+    EXPECT_EQ(Name_t::s_Alive, 0);
+}
+
+TEST(Query, VisitsExactlyTheMatchingEntities) {
+    World world;
+    for (int i = 0; i < 1000; i++) {
+        world.create(Position_t {}, Velocity_t {1, 2});
+        world.create(Position_t {});
+        world.create(Velocity_t {});
+    }
+    Query<Position_t, const Velocity_t> moving(world);
+    EXPECT_EQ(moving.count(), 1000u);
+    moving.each([](Position_t& position, const Velocity_t& velocity) {
+        position.m_X += velocity.m_X;
+        position.m_Y += velocity.m_Y;
+    });
+
+    // Archetypes created after the query was first used are picked up
+    const Entity_t late = world.create(Position_t {}, Velocity_t {1, 2}, Frozen_t {});
+    EXPECT_EQ(moving.count(), 1001u);
+
+    f32 sum = 0.0F;
+    moving.each_chunk([&](std::span<const Entity_t> entities, std::span<Position_t> positions,
+                          std::span<const Velocity_t>) {
+        EXPECT_EQ(entities.size(), positions.size());
+        for (const Position_t& position : positions) {
+            sum += position.m_Y;
+        }
+    });
+    EXPECT_EQ(sum, 2000.0F);
+
+    bool sawLate = false;
+    moving.each(
+        [&](Entity_t entity, Position_t&, const Velocity_t&) { sawLate |= entity == late; });
+    EXPECT_TRUE(sawLate);
+}
+
+TEST(Query, ParallelIterationCoversEveryEntityOnce) {
+    World world;
+    for (int i = 0; i < 20'000; i++) {
+        if (i % 3 == 0) {
+            world.create(Position_t {}, Velocity_t {1, 0}, Frozen_t {});
+        }
+        else {
+            world.create(Position_t {}, Velocity_t {1, 0});
+        }
+    }
+    JobSystem                           jobs(test_config());
+    Query<Position_t, const Velocity_t> query(world);
+    std::atomic<usize>                  visited {0};
+    query.par_each(jobs, [&](Position_t& position, const Velocity_t& velocity) {
+        position.m_X += velocity.m_X;
+        visited.fetch_add(1, std::memory_order_relaxed);
+    });
+    EXPECT_EQ(visited.load(), 20'000u);
+    Query<const Position_t> positions(world);
+    positions.each([](const Position_t& position) { ASSERT_EQ(position.m_X, 1.0F); });
+}
+
+TEST(CommandBuffer, AppliesInRecordingOrder) {
+    World          world;
+    const Entity_t existing = world.create(Position_t {1, 1});
+    const Entity_t doomed   = world.create(Position_t {2, 2});
+
+    CommandBuffer  commands(world);
+    const Entity_t created = commands.create(Position_t {3, 3}, Name_t("created"));
+    commands.add(created, Velocity_t {1, 0});
+    commands.add(existing, Name_t("existing"));
+    commands.remove<Position_t>(existing);
+    commands.destroy(doomed);
+    // Skipped, the entity is gone by then; its payload must still be destroyed
+    commands.add(doomed, Name_t("skipped"));
+    EXPECT_FALSE(world.is_alive(created));
+    EXPECT_EQ(commands.size(), 8u);
+
+    world.apply(commands);
+    EXPECT_TRUE(commands.empty());
+    EXPECT_TRUE(world.is_alive(created));
+    EXPECT_EQ(world.get<Position_t>(created)->m_X, 3.0F);
+    EXPECT_EQ(*world.get<Name_t>(created)->m_Name, "created");
+    EXPECT_TRUE(world.has<Velocity_t>(created));
+    EXPECT_FALSE(world.has<Position_t>(existing));
+    EXPECT_EQ(*world.get<Name_t>(existing)->m_Name, "existing");
+    EXPECT_FALSE(world.is_alive(doomed));
+    EXPECT_EQ(Name_t::s_Alive, 2);
+
+    // Direct creation after the apply never reuses the reserved index
+    const Entity_t direct = world.create();
+    EXPECT_NE(direct.m_Index, created.m_Index);
+}
+
+TEST(CommandBuffer, RecordsFromParallelQueries) {
+    World world;
+    for (int i = 0; i < 10'000; i++) {
+        world.create(Position_t {f32(i), 0});
+    }
+    JobSystem jobs(test_config());
+    std::vector<std::unique_ptr<CommandBuffer>> buffers;
+    for (u32 t = 0; t < jobs.thread_count(); t++) {
+        buffers.push_back(std::make_unique<CommandBuffer>(world));
+    }
+    Query<const Position_t> query(world);
+    query.par_each(jobs, [&](Entity_t entity, const Position_t& position) {
+        CommandBuffer& commands = *buffers[jobs.thread_index()];
+        if (i32(position.m_X) % 2 == 0) {
+            commands.add(entity, Frozen_t {});
+        }
+        else {
+            commands.create(Velocity_t {position.m_X, 0});
+        }
+    });
+    for (auto& commands : buffers) {
+        world.apply(*commands);
+    }
+    EXPECT_EQ(world.entity_count(), 15'000u);
+    EXPECT_EQ(Query<const Frozen_t>(world).count(), 5'000u);
+    EXPECT_EQ(Query<const Velocity_t>(world).count(), 5'000u);
+}
+
+TEST(CommandBuffer, ClearDestroysUnappliedComponents) {
+    World world;
+    {
+        CommandBuffer commands(world);
+        commands.create(Name_t("never"));
+        commands.add(world.create(), Name_t("never"));
+        EXPECT_EQ(Name_t::s_Alive, 2);
+    }
+    EXPECT_EQ(Name_t::s_Alive, 0);
+}
+// NOLINTEND(*)
@@ -0,0 +1,100 @@
+// NOLINTBEGIN(*)
+#include "PulsarEngine/Jobs/Fiber.hpp"
+
+#include "PulsarCore/Util/Macros.hpp"
+
+#include <cfenv>
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace Pulsar;
+
+#ifdef PULSAR_HAS_FIBERS
+namespace {
+    struct PingPong_t {
+        Fiber*           m_Caller = nullptr;
+        Fiber*           m_Self   = nullptr;
+        std::vector<int> m_Trace;
+    };
+
+    void ping_pong(void* argument) {
+        auto& state = *static_cast<PingPong_t*>(argument);
+        for (int i = 0;; i++) {
+            state.m_Trace.push_back(i);
+            state.m_Self->switch_to(*state.m_Caller);
+        }
+    }
+} // namespace
+
+TEST(FiberStack, HasUsableMemory) {
+    FiberStack stack(10000);
+    EXPECT_GE(stack.size(), 10000u);
+    auto* top = static_cast<volatile char*>(stack.top());
+    top[-1]   = 1;
+    top[-static_cast<std::ptrdiff_t>(stack.size())] = 2;
+    EXPECT_EQ(top[-1], 1);
+}
+
+TEST(Fiber, SwitchesBackAndForth) {
+    Fiber      caller;
+    PingPong_t state;
+    Fiber      fiber(FiberStack(16 * 1024), &ping_pong, &state);
+    state.m_Caller = &caller;
+    state.m_Self   = &fiber;
+    for (int i = 0; i < 3; i++) {
+        caller.switch_to(fiber);
+        state.m_Trace.push_back(100 + i);
+    }
+    EXPECT_EQ(state.m_Trace, (std::vector<int> {0, 100, 1, 101, 2, 102}));
+}
+
+// Every fiber has its own floating point control state, like a thread
+TEST(Fiber, KeepsRoundingModePerFiber) {
+    struct State_t {
+        Fiber* m_Caller = nullptr;
+        Fiber* m_Self   = nullptr;
+        int    m_Mode   = 0;
+    } state;
+    const auto entry = [](void* argument) {
+        auto& s = *static_cast<State_t*>(argument);
+        std::fesetround(FE_UPWARD);
+        while (true) {
+            s.m_Mode = std::fegetround();
+            s.m_Self->switch_to(*s.m_Caller);
+        }
+    };
+    Fiber caller;
+    Fiber fiber(FiberStack(16 * 1024), entry, &state);
+    state.m_Caller = &caller;
+    state.m_Self   = &fiber;
+    caller.switch_to(fiber);
+    EXPECT_EQ(state.m_Mode, FE_UPWARD);
+    EXPECT_EQ(std::fegetround(), FE_TONEAREST);
+    caller.switch_to(fiber);
+    EXPECT_EQ(state.m_Mode, FE_UPWARD);
+}
+
+namespace {
+    PULSAR_NO_INLINE int recurse(int depth) {
+        volatile char buffer[1024];
+        buffer[0] = static_cast<char>(depth);
+        return recurse(depth + 1) + buffer[0];
+    }
+
+    void overflow(void*) {
+        recurse(0);
+    }
+} // namespace
+
+TEST(FiberDeathTest, GuardPageCatchesOverflow) {
+    GTEST_FLAG_SET(death_test_style, "threadsafe");
+    EXPECT_DEATH(
+        {
+            Fiber caller;
+            Fiber fiber(FiberStack(16 * 1024), &overflow, nullptr);
+            caller.switch_to(fiber);
+        },
+        "");
+}
+#endif
+// NOLINTEND(*)
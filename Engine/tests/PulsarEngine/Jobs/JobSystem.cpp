@@ -0,0 +1,208 @@
+// NOLINTBEGIN(*)
+#include "PulsarEngine/Jobs/JobSystem.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <gtest/gtest.h>
+#include <memory>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace Pulsar;
+
+// Every test runs with and without fibers
+class JobSystemTest : public ::testing::TestWithParam<bool> {
+protected:
+    JobSystemConfig_t test_config(u32 workers = 3) const {
+        // Fixed so stealing is exercised on any machine, unpinned so tests don't fight over cores
+        return {.m_WorkerCount = workers, .m_PinWorkers = false, .m_UseFibers = GetParam()};
+    }
+};
+
+INSTANTIATE_TEST_SUITE_P(JobSystem, JobSystemTest, ::testing::Values(false, Fiber::SUPPORTED),
+    [](const ::testing::TestParamInfo<bool>& info) {
+        return info.param ? "Fibers" : "HelpOut";
+    });
+
+TEST_P(JobSystemTest, RunsEveryJob) {
+    JobSystem        jobs(test_config());
+    JobCounter       counter;
+    std::atomic<int> sum {0};
+    for (int i = 1; i <= 1000; i++) {
+        jobs.run(counter, [&sum, i] { sum.fetch_add(i, std::memory_order_relaxed); });
+    }
+    jobs.wait(counter);
+    EXPECT_TRUE(counter.is_done());
+    EXPECT_EQ(sum.load(), 500500);
+    EXPECT_EQ(jobs.thread_count(), 4u);
+}
+
+TEST_P(JobSystemTest, RunsWithoutWorkers) {
+    JobSystem  jobs(test_config(0));
+    JobCounter counter;
+    int        value = 0;
+    jobs.run(counter, [&value] { value = 42; });
+    EXPECT_EQ(counter.pending(), 1u);
+    jobs.wait(counter);
+    EXPECT_EQ(value, 42);
+}
+
+TEST_P(JobSystemTest, JobsSpreadOverThreads) {
+    JobSystem             jobs(test_config());
+    JobCounter            counter;
+    std::atomic<int>      started {0};
+    std::vector<i32>      indices(4, -2);
+    for (usize i = 0; i < indices.size(); i++) {
+        jobs.run(counter, [&, i] {
+            indices[i] = jobs.thread_index();
+            // Hold every thread until all four jobs run at once
+            started.fetch_add(1);
+            while (started.load() < 4) {
+                std::this_thread::yield();
+            }
+        });
+    }
+    jobs.wait(counter);
+    EXPECT_EQ(std::set<i32>(indices.begin(), indices.end()).size(), 4u);
+    EXPECT_EQ(jobs.thread_index(), 0);
+}
+
+TEST_P(JobSystemTest, NestedJobsWaitWithoutBlocking) {
+    // With a single thread, the outer job can only finish if its wait runs the inner jobs
+    JobSystem        jobs(test_config(0));
+    JobCounter       outer;
+    std::atomic<int> inner {0};
+    jobs.run(outer, [&] {
+        JobCounter counter;
+        for (int i = 0; i < 10; i++) {
+            jobs.run(counter, [&inner] { inner.fetch_add(1); });
+        }
+        jobs.wait(counter);
+        EXPECT_EQ(inner.load(), 10);
+    });
+    jobs.wait(outer);
+    EXPECT_EQ(inner.load(), 10);
+}
+
+TEST_P(JobSystemTest, CountersChainDependencies) {
+    JobSystem        jobs(test_config());
+    JobCounter       first;
+    JobCounter       second;
+    std::atomic<int> stage {0};
+    std::atomic<bool> ordered {true};
+    for (int i = 0; i < 8; i++) {
+        jobs.run(first, [&stage] { stage.fetch_add(1); });
+    }
+    jobs.run(second, [&] {
+        jobs.wait(first);
+        ordered = stage.load() == 8;
+    });
+    jobs.wait(second);
+    EXPECT_TRUE(ordered.load());
+}
+
+TEST_P(JobSystemTest, ParallelForCoversTheRangeOnce) {
+    JobSystem                     jobs(test_config());
+    constexpr usize               COUNT = 100003;
+    std::vector<std::atomic<int>> hits(COUNT);
+    jobs.parallel_for(COUNT, 1000, [&](usize begin, usize end) {
+        EXPECT_LE(end - begin, 1000u);
+        for (usize i = begin; i < end; i++) {
+            hits[i].fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+    for (usize i = 0; i < COUNT; i++) {
+        ASSERT_EQ(hits[i].load(), 1) << "index " << i;
+    }
+    jobs.end_frame();
+}
+
+TEST_P(JobSystemTest, FullQueueRunsInline) {
+    JobSystemConfig_t config = test_config(0);
+    config.m_QueueCapacity   = 2;
+    JobSystem  jobs(config);
+    JobCounter counter;
+    int        ran = 0;
+    for (int i = 0; i < 5; i++) {
+        jobs.run(counter, [&ran] { ran++; });
+    }
+    // Three did not fit and ran right away
+    EXPECT_EQ(ran, 3);
+    jobs.wait(counter);
+    EXPECT_EQ(ran, 5);
+}
+
+TEST_P(JobSystemTest, OutsideThreadsRunInline) {
+    JobSystem  jobs(test_config(1));
+    JobCounter counter;
+    bool       ran = false;
+    std::thread([&] {
+        EXPECT_EQ(jobs.thread_index(), -1);
+        jobs.run(counter, [&ran] { ran = true; });
+        EXPECT_TRUE(ran);
+    }).join();
+    EXPECT_TRUE(counter.is_done());
+}
+
+TEST_P(JobSystemTest, CapturesAreDestroyed) {
+    JobSystem  jobs(test_config());
+    auto       shared = std::make_shared<int>(7);
+    JobCounter counter;
+    for (int i = 0; i < 100; i++) {
+        jobs.run(counter, [shared] { EXPECT_EQ(*shared, 7); });
+    }
+    jobs.wait(counter);
+    EXPECT_EQ(shared.use_count(), 1);
+    jobs.end_frame();
+}
+// Levels submitted up front, each waiting for the previous one: with fibers the waiting jobs
+// park instead of piling up on one stack
+TEST_P(JobSystemTest, DeepDependencyChain) {
+    JobSystem                     jobs(test_config());
+    constexpr usize               LEVELS = 64;
+    constexpr usize               WIDTH  = 4;
+    std::vector<JobCounter>       levels(LEVELS);
+    std::vector<std::atomic<int>> done(LEVELS);
+    std::atomic<bool>             ordered {true};
+    for (usize level = 0; level < LEVELS; level++) {
+        for (usize i = 0; i < WIDTH; i++) {
+            jobs.run(levels[level], [&, level] {
+                if (level > 0) {
+                    jobs.wait(levels[level - 1]);
+                    if (done[level - 1].load() != WIDTH) {
+                        ordered = false;
+                    }
+                }
+                done[level].fetch_add(1);
+            });
+        }
+    }
+    jobs.wait(levels.back());
+    EXPECT_TRUE(ordered.load());
+    EXPECT_EQ(done.back().load(), static_cast<int>(WIDTH));
+    // Waiting moved the creating thread between fibers, it still comes back as itself
+    EXPECT_EQ(jobs.thread_index(), 0);
+    jobs.end_frame();
+}
+
+TEST(JobSystem, ParkedFibersResumeOnAnyThread) {
+    if constexpr (!Fiber::SUPPORTED) {
+        GTEST_SKIP() << "No fibers on this platform";
+    }
+    JobSystem         jobs({.m_WorkerCount = 3, .m_PinWorkers = false});
+    JobCounter        outer;
+    std::atomic<int>  resumed {0};
+    for (int i = 0; i < 16; i++) {
+        jobs.run(outer, [&] {
+            JobCounter inner;
+            jobs.run(inner, [] { std::this_thread::yield(); });
+            jobs.wait(inner);
+            EXPECT_GE(jobs.thread_index(), 0);
+            resumed.fetch_add(1);
+        });
+    }
+    jobs.wait(outer);
+    EXPECT_EQ(resumed.load(), 16);
+}
+// NOLINTEND(*)
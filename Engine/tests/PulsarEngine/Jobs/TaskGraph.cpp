@@ -0,0 +1,145 @@
+// NOLINTBEGIN(*)
+#include "PulsarEngine/Jobs/TaskGraph.hpp"
+
+#include <atomic>
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace Pulsar;
+
+namespace {
+    JobSystemConfig_t test_config() {
+        return {.m_WorkerCount = 3, .m_PinWorkers = false};
+    }
+} // namespace
+
+TEST(TaskGraph, OrdersByDeclaredAccess) {
+    TaskGraph  graph;
+    const auto a = graph.resource("A");
+    const auto b = graph.resource("B");
+    EXPECT_EQ(graph.resource("A"), a);
+
+    const auto writeA = graph.add({.m_Name = "WriteA", .m_Writes = {a}}, [] {});
+    const auto writeB = graph.add({.m_Name = "WriteB", .m_Writes = {b}}, [] {});
+    const auto readA1 = graph.add({.m_Name = "ReadA1", .m_Reads = {a}}, [] {});
+    const auto readA2 = graph.add({.m_Name = "ReadA2", .m_Reads = {a}}, [] {});
+    const auto both = graph.add({.m_Name = "WriteAB", .m_Reads = {b}, .m_Writes = {a}}, [] {});
+    graph.compile();
+
+    EXPECT_TRUE(graph.dependencies(writeA).empty());
+    EXPECT_TRUE(graph.dependencies(writeB).empty());
+    // Readers of the same resource don't depend on each other
+    EXPECT_EQ(graph.dependencies(readA1), std::vector<TaskId>({writeA}));
+    EXPECT_EQ(graph.dependencies(readA2), std::vector<TaskId>({writeA}));
+    // The writer waits for the readers before it, which already imply the previous writer
+    EXPECT_EQ(graph.dependencies(both), std::vector<TaskId>({writeB, readA1, readA2}));
+    EXPECT_EQ(graph.redundant_edge_count(), 1u);
+    EXPECT_EQ(graph.level(both), 2u);
+}
+
+TEST(TaskGraph, ReducesTransitiveEdges) {
+    TaskGraph  graph;
+    const auto r = graph.resource("R");
+    // A chain of writers where every task also explicitly runs after all earlier ones
+    std::vector<TaskId> tasks;
+    for (int i = 0; i < 10; i++) {
+        tasks.push_back(graph.add({.m_Name = "Step", .m_Writes = {r}, .m_After = tasks}, [] {}));
+    }
+    graph.compile();
+    for (usize i = 1; i < tasks.size(); i++) {
+        EXPECT_EQ(graph.dependencies(tasks[i]), std::vector<TaskId>({tasks[i - 1]}));
+    }
+    EXPECT_EQ(graph.redundant_edge_count(), 36u);
+    EXPECT_EQ(graph.critical_path(), tasks);
+}
+
+TEST(TaskGraph, PrioritizesTheCriticalPath) {
+    TaskGraph  graph;
+    const auto a         = graph.resource("A");
+    const auto b         = graph.resource("B");
+    const auto shortTask = graph.add({.m_Name = "Short", .m_Writes = {b}, .m_Cost = 5.0}, [] {});
+    const auto head      = graph.add({.m_Name = "Head", .m_Writes = {a}, .m_Cost = 1.0}, [] {});
+    const auto tail      = graph.add({.m_Name = "Tail", .m_Reads = {a}, .m_Cost = 10.0}, [] {});
+    graph.compile();
+    EXPECT_DOUBLE_EQ(graph.priority(head), 11.0);
+    EXPECT_DOUBLE_EQ(graph.priority(tail), 10.0);
+    EXPECT_DOUBLE_EQ(graph.priority(shortTask), 5.0);
+    EXPECT_EQ(graph.critical_path(), std::vector<TaskId>({head, tail}));
+}
+
+TEST(TaskGraph, RunsEveryTaskAfterItsDependencies) {
+    JobSystem  jobs(test_config());
+    TaskGraph  graph;
+    const auto resources = std::vector<ResourceId> {
+        graph.resource("A"), graph.resource("B"), graph.resource("C"), graph.resource("D")};
+    constexpr usize COUNT = 200;
+    std::vector<std::atomic<u32>> finished(COUNT);
+    std::atomic<u32>              clock {0};
+    std::atomic<u32>              violations {0};
+    for (usize i = 0; i < COUNT; i++) {
+        TaskDesc_t desc {.m_Name = "Task"};
+        desc.m_Reads.push_back(resources[i % 4]);
+        if (i % 3 == 0) {
+            desc.m_Writes.push_back(resources[(i / 3) % 4]);
+        }
+        static_cast<void>(graph.add(std::move(desc), [&, i] {
+            finished[i].store(clock.fetch_add(1) + 1);
+        }));
+    }
+    graph.compile();
+
+    for (int frame = 0; frame < 20; frame++) {
+        clock.store(0);
+        for (auto& value : finished) {
+            value.store(0);
+        }
+        graph.run(jobs);
+        jobs.end_frame();
+        for (usize i = 0; i < COUNT; i++) {
+            ASSERT_NE(finished[i].load(), 0u);
+            for (const TaskId dependency : graph.dependencies(static_cast<TaskId>(i))) {
+                if (finished[dependency].load() >= finished[i].load()) {
+                    violations.fetch_add(1);
+                }
+            }
+        }
+    }
+    EXPECT_EQ(violations.load(), 0u);
+}
+
+TEST(TaskGraph, ExportsTheSchedule) {
+    TaskGraph  graph;
+    const auto a = graph.resource("A");
+    static_cast<void>(graph.add({.m_Name = "Physics \"step\"", .m_Writes = {a}}, [] {}));
+    static_cast<void>(graph.add({.m_Name = "Render", .m_Reads = {a}}, [] {}));
+    graph.compile();
+    graph.run_serial();
+    graph.use_measured_costs();
+
+    const std::string dot = graph.to_dot();
+    EXPECT_NE(dot.find("digraph TaskGraph"), std::string::npos);
+    EXPECT_NE(dot.find("Physics \\\"step\\\""), std::string::npos);
+    EXPECT_NE(dot.find("t0 -> t1 [color=red]"), std::string::npos);
+    EXPECT_NE(dot.find("on thread 0"), std::string::npos);
+    EXPECT_GT(graph.priority(0), graph.priority(1));
+}
+
+TEST(TaskGraphDeathTest, RejectsUnknownIds) {
+    GTEST_FLAG_SET(death_test_style, "threadsafe");
+    TaskGraph  graph;
+    const auto a     = graph.resource("A");
+    const auto first = graph.add({.m_Name = "First", .m_Writes = {a}}, [] {});
+    // Forward, itself, and out of range
+    EXPECT_DEATH(static_cast<void>(graph.add({.m_Name = "Forward", .m_After = {first + 2}}, [] {})),
+                 "Task \"Forward\" runs after task 2");
+    EXPECT_DEATH(static_cast<void>(graph.add({.m_Name = "Self", .m_After = {first + 1}}, [] {})),
+                 "not an earlier task");
+    EXPECT_DEATH(static_cast<void>(graph.add({.m_Name = "Far", .m_After = {1'000'000}}, [] {})),
+                 "not an earlier task");
+    EXPECT_DEATH(static_cast<void>(graph.add({.m_Name = "Reader", .m_Reads = {a + 1}}, [] {})),
+                 "uses resource 1, which is not registered");
+    EXPECT_DEATH(static_cast<void>(graph.add({.m_Name = "Writer", .m_Writes = {a + 7}}, [] {})),
+                 "uses resource 7");
+    EXPECT_EQ(graph.task_count(), 1u);
+}
+// NOLINTEND(*)
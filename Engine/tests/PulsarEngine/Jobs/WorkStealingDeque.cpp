@@ -0,0 +1,84 @@
+// NOLINTBEGIN(*)
+#include "PulsarEngine/Jobs/WorkStealingDeque.hpp"
+
+#include <atomic>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+using namespace Pulsar;
+
+TEST(WorkStealingDeque, OwnerPopsLifoThievesStealFifo) {
+    WorkStealingDeque<int> deque(8);
+    int                    values[3] = {1, 2, 3};
+    for (int& value : values) {
+        ASSERT_TRUE(deque.push(&value));
+    }
+    EXPECT_EQ(deque.size(), 3u);
+    EXPECT_EQ(deque.steal(), &values[0]);
+    EXPECT_EQ(deque.pop(), &values[2]);
+    EXPECT_EQ(deque.pop(), &values[1]);
+    EXPECT_EQ(deque.pop(), nullptr);
+    EXPECT_EQ(deque.steal(), nullptr);
+    EXPECT_TRUE(deque.empty());
+}
+
+TEST(WorkStealingDeque, PushFailsWhenFull) {
+    WorkStealingDeque<int> deque(3);
+    EXPECT_EQ(deque.capacity(), 4u);
+    int value = 0;
+    for (int i = 0; i < 4; i++) {
+        ASSERT_TRUE(deque.push(&value));
+    }
+    EXPECT_FALSE(deque.push(&value));
+    EXPECT_NE(deque.steal(), nullptr);
+    EXPECT_TRUE(deque.push(&value));
+}
+
+// Every item is taken exactly once, whether the owner pops it or a thief steals it
+TEST(WorkStealingDeque, ConcurrentStealsTakeEachItemOnce) {
+    constexpr int             COUNT   = 200000;
+    constexpr int             THIEVES = 3;
+    WorkStealingDeque<int>    deque(1024);
+    std::vector<int>          items(COUNT);
+    std::vector<std::atomic<int>> taken(COUNT);
+    std::atomic<bool>         done {false};
+
+    const auto take = [&](int* item) { taken[item - items.data()].fetch_add(1); };
+
+    std::vector<std::thread> thieves;
+    for (int t = 0; t < THIEVES; t++) {
+        thieves.emplace_back([&] {
+            while (!done.load()) {
+                if (int* item = deque.steal()) {
+                    take(item);
+                }
+            }
+        });
+    }
+
+    for (int i = 0; i < COUNT; i++) {
+        while (!deque.push(&items[i])) {
+            if (int* item = deque.pop()) {
+                take(item);
+            }
+        }
+        if (i % 3 == 0) {
+            if (int* item = deque.pop()) {
+                take(item);
+            }
+        }
+    }
+    while (int* item = deque.pop()) {
+        take(item);
+    }
+    done.store(true);
+    for (auto& thief : thieves) {
+        thief.join();
+    }
+
+    for (int i = 0; i < COUNT; i++) {
+        ASSERT_EQ(taken[i].load(), 1) << "item " << i;
+    }
+}
+// NOLINTEND(*)
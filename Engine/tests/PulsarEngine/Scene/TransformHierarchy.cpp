@@ -0,0 +1,188 @@
+// NOLINTBEGIN(*)
+#include "PulsarEngine/Jobs/JobSystem.hpp"
+#include "PulsarEngine/Scene/TransformHierarchy.hpp"
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+using namespace Pulsar;
+
+namespace {
+    JobSystemConfig_t test_config() {
+        return {.m_WorkerCount = 3, .m_PinWorkers = false};
+    }
+
+    void expect_near(const Mat4& actual, const Mat4& expected) {
+        for (usize i = 0; i < 16; i++) {
+            EXPECT_NEAR(actual.m[i], expected.m[i], 1e-3F) << "element " << i;
+        }
+    }
+
+    Mat4 local_of(const TransformHierarchy& hierarchy, TransformNode_t node) {
+        return Mat4::from_trs(
+            hierarchy.translation(node), hierarchy.rotation(node), hierarchy.scale(node));
+    }
+
+    /// Walks up the parents, what the hierarchy computes incrementally
+    Mat4 reference_world(const TransformHierarchy& hierarchy, TransformNode_t node) {
+        const TransformNode_t parent = hierarchy.parent(node);
+        const Mat4            local  = local_of(hierarchy, node);
+        return parent.is_null() ? local : reference_world(hierarchy, parent) * local;
+    }
+
+    /// Every node below a random earlier one, with small random local transforms
+    std::vector<TransformNode_t> random_tree(TransformHierarchy& hierarchy, usize count, u32 seed) {
+        std::mt19937                          rng(seed);
+        std::uniform_real_distribution<float> offset(-1.0F, 1.0F);
+        std::vector<TransformNode_t>          nodes;
+        for (usize i = 0; i < count; i++) {
+            const TransformNode_t parent = i < 4 ? NULL_TRANSFORM : nodes[rng() % nodes.size()];
+            const Quat            rotation =
+                Quat::from_axis_angle({0.0F, 0.6F, 0.8F}, offset(rng) * 0.5F);
+            nodes.push_back(hierarchy.create(
+                parent, {offset(rng), offset(rng), offset(rng)}, rotation, {1.0F, 1.0F, 1.0F}));
+        }
+        return nodes;
+    }
+} // namespace
+
+TEST(TransformHierarchy, ChildFollowsParent) {
+    TransformHierarchy    hierarchy;
+    const TransformNode_t root  = hierarchy.create(NULL_TRANSFORM, {10, 0, 0});
+    const TransformNode_t child = hierarchy.create(root, {0, 5, 0}, Quat::identity(), {2, 2, 2});
+    const TransformNode_t leaf  = hierarchy.create(child, {1, 0, 0});
+    EXPECT_EQ(hierarchy.update(), 3U);
+    EXPECT_EQ(hierarchy.level_count(), 3U);
+    EXPECT_EQ(hierarchy.parent(leaf), child);
+    EXPECT_TRUE(hierarchy.parent(root).is_null());
+
+    const Vec3 origin = hierarchy.world(leaf).transform_point({0, 0, 0});
+    EXPECT_FLOAT_EQ(origin.x, 12.0F);
+    EXPECT_FLOAT_EQ(origin.y, 5.0F);
+
+    hierarchy.set_rotation(root, Quat::from_axis_angle({0, 0, 1}, 3.14159265F / 2));
+    EXPECT_EQ(hierarchy.update(), 3U);
+    const Vec3 rotated = hierarchy.world(leaf).transform_point({0, 0, 0});
+    EXPECT_NEAR(rotated.x, 5.0F, 1e-4F);
+    EXPECT_NEAR(rotated.y, 2.0F, 1e-4F);
+    expect_near(hierarchy.world(leaf), reference_world(hierarchy, leaf));
+}
+
+TEST(TransformHierarchy, UpdatesOnlyDirtySubtrees) {
+    TransformHierarchy    hierarchy;
+    const TransformNode_t left  = hierarchy.create();
+    const TransformNode_t right = hierarchy.create();
+
+    std::vector<TransformNode_t> leftChildren;
+    for (int i = 0; i < 100; i++) {
+        leftChildren.push_back(hierarchy.create(left));
+        hierarchy.create(right);
+    }
+    EXPECT_EQ(hierarchy.update(), 202U);
+    EXPECT_EQ(hierarchy.update(), 0U);
+
+    hierarchy.set_translation(left, {1, 0, 0});
+    EXPECT_EQ(hierarchy.update(), 101U);
+
+    // Dirty both directly and through the parent, still recomputed once
+    hierarchy.set_translation(left, {2, 0, 0});
+    hierarchy.set_translation(leftChildren[7], {0, 1, 0});
+    EXPECT_EQ(hierarchy.update(), 101U);
+    const Vec3 origin = hierarchy.world(leftChildren[7]).transform_point({0, 0, 0});
+    EXPECT_FLOAT_EQ(origin.x, 2.0F);
+    EXPECT_FLOAT_EQ(origin.y, 1.0F);
+
+    hierarchy.set_scale(leftChildren[3], {2, 2, 2});
+    EXPECT_EQ(hierarchy.update(), 1U);
+}
+
+TEST(TransformHierarchy, Reparent) {
+    TransformHierarchy    hierarchy;
+    const TransformNode_t a     = hierarchy.create(NULL_TRANSFORM, {1, 0, 0});
+    const TransformNode_t b     = hierarchy.create(NULL_TRANSFORM, {0, 1, 0});
+    const TransformNode_t child = hierarchy.create(a, {0, 0, 1});
+    const TransformNode_t leaf  = hierarchy.create(child);
+    hierarchy.update();
+
+    EXPECT_FALSE(hierarchy.set_parent(a, leaf));
+    EXPECT_FALSE(hierarchy.set_parent(a, a));
+    EXPECT_TRUE(hierarchy.set_parent(child, b));
+    hierarchy.update();
+    EXPECT_EQ(hierarchy.parent(child), b);
+    const Vec3 moved = hierarchy.world(leaf).transform_point({0, 0, 0});
+    EXPECT_FLOAT_EQ(moved.x, 0.0F);
+    EXPECT_FLOAT_EQ(moved.y, 1.0F);
+    EXPECT_FLOAT_EQ(moved.z, 1.0F);
+
+    EXPECT_TRUE(hierarchy.set_parent(child, NULL_TRANSFORM));
+    hierarchy.update();
+    EXPECT_EQ(hierarchy.level_count(), 2U);
+    EXPECT_FLOAT_EQ(hierarchy.world(leaf).transform_point({0, 0, 0}).y, 0.0F);
+}
+
+TEST(TransformHierarchy, DestroyRemovesSubtree) {
+    TransformHierarchy    hierarchy;
+    const TransformNode_t root  = hierarchy.create(NULL_TRANSFORM, {1, 0, 0});
+    const TransformNode_t child = hierarchy.create(root);
+    const TransformNode_t leaf  = hierarchy.create(child);
+    const TransformNode_t other = hierarchy.create(root, {0, 3, 0});
+    hierarchy.update();
+
+    hierarchy.destroy(child);
+    EXPECT_FALSE(hierarchy.is_alive(child));
+    EXPECT_FALSE(hierarchy.is_alive(leaf));
+    EXPECT_TRUE(hierarchy.is_alive(other));
+    EXPECT_EQ(hierarchy.size(), 2U);
+    hierarchy.destroy(child);
+    EXPECT_EQ(hierarchy.size(), 2U);
+
+    // Reuses a freed handle, the old one stays dead
+    const TransformNode_t reused = hierarchy.create(other, {0, 0, 4});
+    EXPECT_TRUE(reused.m_Index == child.m_Index || reused.m_Index == leaf.m_Index);
+    EXPECT_EQ(hierarchy.update(), 1U);
+    const Vec3 origin = hierarchy.world(reused).transform_point({0, 0, 0});
+    EXPECT_FLOAT_EQ(origin.x, 1.0F);
+    EXPECT_FLOAT_EQ(origin.y, 3.0F);
+    EXPECT_FLOAT_EQ(origin.z, 4.0F);
+}
+
+TEST(TransformHierarchy, MatchesReference) {
+    TransformHierarchy hierarchy;
+    const auto         nodes = random_tree(hierarchy, 5000, 1);
+    EXPECT_EQ(hierarchy.update(), nodes.size());
+    for (usize i = 0; i < nodes.size(); i += 37) {
+        expect_near(hierarchy.world(nodes[i]), reference_world(hierarchy, nodes[i]));
+    }
+}
+
+TEST(TransformHierarchy, ParallelMatchesSerial) {
+    JobSystem          jobs(test_config());
+    TransformHierarchy serial;
+    TransformHierarchy parallel;
+    const auto         serialNodes   = random_tree(serial, 20000, 7);
+    const auto         parallelNodes = random_tree(parallel, 20000, 7);
+    EXPECT_EQ(parallel.update(jobs), serial.update());
+
+    std::mt19937 rng(3);
+    for (int frame = 0; frame < 10; frame++) {
+        for (int i = 0; i < 200; i++) {
+            const usize index       = rng() % serialNodes.size();
+            const Vec3  translation = {float(frame), float(i), 0.0F};
+            serial.set_translation(serialNodes[index], translation);
+            parallel.set_translation(parallelNodes[index], translation);
+        }
+        const usize updated = serial.update();
+        EXPECT_EQ(parallel.update(jobs), updated);
+        EXPECT_LT(updated, serialNodes.size());
+        jobs.end_frame();
+    }
+    for (usize i = 0; i < serialNodes.size(); i++) {
+        ASSERT_EQ(serial.world(serialNodes[i]), parallel.world(parallelNodes[i])) << i;
+    }
+    for (usize i = 0; i < serialNodes.size(); i += 101) {
+        expect_near(serial.world(serialNodes[i]), reference_world(serial, serialNodes[i]));
+    }
+}
+// NOLINTEND(*)
@@ -1,11 +1,14 @@
 // NOLINTBEGIN(*)
+#include "PulsarCore/BenchmarkPerfCounters.hpp"
 #include "PulsarCore/GC/Allocators/Arena.hpp"
+#include "PulsarCore/GC/MemoryTracker.hpp"
 
 #include <benchmark/benchmark.h>
 #include <memory>
 #include <random>
 #include <vector>
 
+using namespace Pulsar;
 using namespace Pulsar::GC;
 
 // Test structure with some typical game object size
@@ -28,6 +31,7 @@ static void BM_StandardAllocator(benchmark::State& state) {
     std::vector<TestObject_t*> objects;
     objects.reserve(N);
 
+    const BenchmarkPerfCounters perf(state);
     for (auto _ : state) {
         state.PauseTiming(); // Don't count cleanup time
         objects.clear();
@@ -53,6 +57,7 @@ static void BM_ArenaAllocator(benchmark::State& state) {
     std::vector<TestObject_t*> objects;
     objects.reserve(N);
 
+    const BenchmarkPerfCounters perf(state);
     for (auto _ : state) {
         state.PauseTiming(); // Don't count cleanup/setup time
         objects.clear();
@@ -82,6 +87,7 @@ static void BM_STLAllocator(benchmark::State& state) {
     objects.reserve(N);
     std::allocator<TestObject_t> alloc;
 
+    const BenchmarkPerfCounters perf(state);
     for (auto _ : state) {
         state.PauseTiming();
         objects.clear();
@@ -107,6 +113,7 @@ static void BM_STLAllocator(benchmark::State& state) {
 static void BM_ArenaAllocatorBatch(benchmark::State& state) {
     const int N = state.range(0);
 
+    const BenchmarkPerfCounters perf(state);
     for (auto _ : state) {
         ArenaAllocator<TestObject_t> arena(N * sizeof(TestObject_t));
         auto* objects = std::allocator_traits<ArenaAllocator<TestObject_t>>::allocate(arena, N);
@@ -164,6 +171,7 @@ static void BM_MixedSizeAllocations(benchmark::State& state) {
     typename std::allocator_traits<ArenaAllocator<std::byte>>::template rebind_alloc<LargeObject>
         largeAlloc(baseArena);
 
+    const BenchmarkPerfCounters perf(state);
     for (auto _ : state) {
         // Allocate in rotating pattern
         for (int i = 0; i < N; ++i) {
@@ -196,6 +204,7 @@ static void BM_RandomAccessPattern(benchmark::State& state) {
     std::vector<int> access_pattern(N);
     std::iota(access_pattern.begin(), access_pattern.end(), 0);
 
+    const BenchmarkPerfCounters perf(state);
     for (auto _ : state) {
         ArenaAllocator<MediumObject> arena(N * sizeof(MediumObject));
 
@@ -230,6 +239,7 @@ static void BM_FragmentationPattern(benchmark::State& state) {
     std::vector<MediumObject*> objects;
     objects.reserve(N);
 
+    const BenchmarkPerfCounters perf(state);
     for (auto _ : state) {
         ArenaAllocator<MediumObject> arena(
             N * sizeof(MediumObject) * 2); // Extra space for fragmentation
@@ -279,6 +289,7 @@ template<size_t Alignment> static void BM_AlignmentTest(benchmark::State& state)
     std::vector<AlignedObject*> objects;
     objects.reserve(N);
 
+    const BenchmarkPerfCounters perf(state);
     for (auto _ : state) {
         ArenaAllocator<AlignedObject> arena(N * sizeof(AlignedObject));
 
@@ -302,6 +313,14 @@ template<size_t Alignment> static void BM_AlignmentTest(benchmark::State& state)
     state.SetBytesProcessed(state.iterations() * N * sizeof(AlignedObject));
 }
 
+// The same with the memory tracker enabled, only builds with PULSAR_MEMORY_TRACKING report
+template<void (*Benchmark)(benchmark::State&)> static void BM_Tracked(benchmark::State& state) {
+    MemoryTracker::enable();
+    Benchmark(state);
+    MemoryTracker::disable();
+    state.counters["tracking_compiled_in"] = MemoryTracker::COMPILED_IN ? 1 : 0;
+}
+
 // Register benchmarks
 BENCHMARK(BM_MixedSizeAllocations)->Range(100, 10000);
 BENCHMARK(BM_RandomAccessPattern)->Range(100, 10000);
@@ -315,6 +334,8 @@ BENCHMARK(BM_StandardAllocator)->Range(100, 10000);
 BENCHMARK(BM_ArenaAllocator)->Range(100, 10000);
 BENCHMARK(BM_STLAllocator)->Range(100, 10000);
 BENCHMARK(BM_ArenaAllocatorBatch)->Range(100, 10000);
+BENCHMARK(BM_Tracked<BM_StandardAllocator>)->Range(100, 10000)->Name("BM_StandardAllocatorTracked");
+BENCHMARK(BM_Tracked<BM_ArenaAllocator>)->Range(100, 10000)->Name("BM_ArenaAllocatorTracked");
 
 BENCHMARK_MAIN();
 // NOLINTEND(*)
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "PulsarCore/Util/PerfCounters.hpp"
+
+#include <benchmark/benchmark.h>
+
+namespace Pulsar {
+    /// Reports the hardware counters of the calling thread over its lifetime as per-iteration
+    /// user counters (`cycles`, `instructions`, ...). Created right before the benchmark loop, so
+    /// work done while the timing is paused is counted too. Counters that can't be read, in
+    /// containers or without permission, are left out.
+    class BenchmarkPerfCounters {
+    public:
+        explicit BenchmarkPerfCounters(benchmark::State& state)
+            : m_State(state), m_Start(PerfCounterGroup::for_current_thread().read()) {
+        }
+
+        ~BenchmarkPerfCounters() {
+            const PerfCounterValues_t delta =
+                PerfCounterGroup::for_current_thread().read() - m_Start;
+            for (usize i = 0; i < PERF_COUNTER_COUNT; i++) {
+                const auto counter = static_cast<PerfCounter>(i);
+                if (delta.has(counter)) {
+                    m_State.counters[to_string(counter)] =
+                        benchmark::Counter(static_cast<double>(delta.get(counter)),
+                                           benchmark::Counter::kAvgIterations);
+                }
+            }
+        }
+
+        BenchmarkPerfCounters(const BenchmarkPerfCounters&)            = delete;
+        BenchmarkPerfCounters& operator=(const BenchmarkPerfCounters&) = delete;
+        BenchmarkPerfCounters(BenchmarkPerfCounters&&)                 = delete;
+        BenchmarkPerfCounters& operator=(BenchmarkPerfCounters&&)      = delete;
+
+    private:
+        benchmark::State&   m_State;
+        PerfCounterValues_t m_Start;
+    };
+} // namespace Pulsar
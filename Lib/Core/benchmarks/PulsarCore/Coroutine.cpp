@@ -0,0 +1,146 @@
+// NOLINTBEGIN(*)
+#include "PulsarCore/Async/Executor.hpp"
+#include "PulsarCore/Async/FramePool.hpp"
+#include "PulsarCore/Async/Generator.hpp"
+#include "PulsarCore/Async/Task.hpp"
+#include "PulsarCore/BenchmarkPerfCounters.hpp"
+#include "PulsarCore/Util/Macros.hpp"
+
+#include <array>
+#include <benchmark/benchmark.h>
+#include <functional>
+#include <string>
+
+using namespace Pulsar;
+
+namespace {
+    // What a typical asset callback captures: a path and a few pointers
+    struct Request_t {
+        std::string m_Path = "assets/textures/terrain/grass_albedo.ktx2";
+        void*       m_Asset = nullptr;
+        void*       m_Cache = nullptr;
+        u64         m_Hash  = 0;
+    };
+
+    Generator<int> counter() {
+        for (int i = 0;; i++) {
+            co_yield i;
+        }
+    }
+
+    PULSAR_NO_INLINE Task<u64> load(const Request_t& request) {
+        co_return request.m_Hash + request.m_Path.size();
+    }
+
+    Task<void> await_loop(benchmark::State& state, const Request_t& request) {
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(co_await load(request));
+        }
+    }
+
+    PULSAR_NO_INLINE void load_with_callback(
+        const Request_t& request, const std::function<void(u64)>& done) {
+        done(request.m_Hash + request.m_Path.size());
+    }
+} // namespace
+
+// Resuming a suspended coroutine up to its next co_yield and back, no allocation
+static void BM_CoroutineResume(benchmark::State& state) {
+    auto                        generator = counter();
+    auto                        it        = generator.begin();
+    const BenchmarkPerfCounters perf(state);
+    for (auto _ : state) {
+        ++it;
+        benchmark::DoNotOptimize(*it);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CoroutineResume);
+
+// Creating, awaiting and destroying a task that completes synchronously: frame allocation from
+// the pool, two symmetric transfers and the result
+static void BM_TaskAwait(benchmark::State& state) {
+    const Request_t             request {};
+    const BenchmarkPerfCounters perf(state);
+    sync_wait(await_loop(state, request));
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TaskAwait);
+
+// The callback version of the same step, its capture is too large for std::function's small
+// buffer so every callback is a heap allocation
+static void BM_StdFunctionCallback(benchmark::State& state) {
+    const Request_t             request {};
+    u64                         total = 0;
+    const BenchmarkPerfCounters perf(state);
+    for (auto _ : state) {
+        Request_t copy = request;
+        load_with_callback(
+            request, [&total, copy](u64 result) { total += result + copy.m_Hash; });
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_StdFunctionCallback);
+
+// Callbacks whose capture fits the small buffer, the best case for std::function
+static void BM_StdFunctionCallbackSmall(benchmark::State& state) {
+    const Request_t             request {};
+    u64                         total = 0;
+    const BenchmarkPerfCounters perf(state);
+    for (auto _ : state) {
+        load_with_callback(request, [&total](u64 result) { total += result; });
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_StdFunctionCallbackSmall);
+
+// Frame allocation alone, the pool against the global heap for typical frame sizes
+static void BM_FramePoolAllocate(benchmark::State& state) {
+    const auto                  size = static_cast<usize>(state.range(0));
+    std::array<void*, 16>       frames {};
+    const BenchmarkPerfCounters perf(state);
+    for (auto _ : state) {
+        for (auto& frame : frames) {
+            frame = internal::allocate_coroutine_frame(size);
+        }
+        benchmark::DoNotOptimize(frames.data());
+        for (auto* frame : frames) {
+            internal::deallocate_coroutine_frame(frame, size);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * frames.size());
+}
+BENCHMARK(BM_FramePoolAllocate)->Arg(96)->Arg(400)->Arg(1500);
+
+static void BM_FrameHeapAllocate(benchmark::State& state) {
+    const auto                  size = static_cast<usize>(state.range(0));
+    std::array<void*, 16>       frames {};
+    const BenchmarkPerfCounters perf(state);
+    for (auto _ : state) {
+        for (auto& frame : frames) {
+            frame = ::operator new(size);
+        }
+        benchmark::DoNotOptimize(frames.data());
+        for (auto* frame : frames) {
+            ::operator delete(frame, size);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * frames.size());
+}
+BENCHMARK(BM_FrameHeapAllocate)->Arg(96)->Arg(400)->Arg(1500);
+
+// A round trip through the thread pool: queue, wake a worker, resume there
+static void BM_ThreadPoolHop(benchmark::State& state) {
+    ThreadPoolExecutor pool(1);
+    auto               hops = [&]() -> Task<void> {
+        for (auto _ : state) {
+            co_await pool.schedule();
+        }
+    };
+    sync_wait(hops());
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ThreadPoolHop)->UseRealTime();
+// NOLINTEND(*)
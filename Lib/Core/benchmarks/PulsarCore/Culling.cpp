@@ -0,0 +1,197 @@
+// NOLINTBEGIN(*)
+#include "PulsarCore/Math/Culling.hpp"
+
+#include <array>
+#include <atomic>
+#include <barrier>
+#include <benchmark/benchmark.h>
+#include <functional>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace Pulsar;
+
+static Frustum make_frustum() {
+    const float                 near = 1.0F;
+    const float                 far  = 500.0F;
+    const std::array<float, 16> matrix {
+        1.0F, 0.0F, 0.0F,                        0.0F,
+        0.0F, 1.0F, 0.0F,                        0.0F,
+        0.0F, 0.0F, far / (near - far),          -1.0F,
+        0.0F, 0.0F, (near * far) / (near - far), 0.0F,
+    };
+    return Frustum::from_view_projection(matrix);
+}
+
+// Objects spread all around the camera, so roughly a sixth of them end up visible
+static std::vector<AABB> make_boxes(usize count) {
+    std::mt19937                          rng(42);
+    std::uniform_real_distribution<float> position(-500.0F, 500.0F);
+    std::uniform_real_distribution<float> size(0.5F, 4.0F);
+    std::vector<AABB>                     boxes;
+    boxes.reserve(count);
+    for (usize i = 0; i < count; i++) {
+        boxes.push_back(AABB::from_center_extents(
+            {position(rng), position(rng), position(rng)}, {size(rng), size(rng), size(rng)}));
+    }
+    return boxes;
+}
+
+static void BM_CullAABBScalarAoS(benchmark::State& state) {
+    const usize      N       = state.range(0);
+    const Frustum    frustum = make_frustum();
+    const auto       boxes   = make_boxes(N);
+    std::vector<u32> visible;
+    visible.reserve(N);
+    for (auto _ : state) {
+        visible.clear();
+        for (usize i = 0; i < N; i++) {
+            if (frustum.intersects(boxes[i])) {
+                visible.push_back(static_cast<u32>(i));
+            }
+        }
+        benchmark::DoNotOptimize(visible.data());
+    }
+    state.SetItemsProcessed(state.iterations() * N);
+    state.counters["visible"] = double(visible.size());
+}
+
+static void BM_CullAABBSoA(benchmark::State& state) {
+    const usize      N       = state.range(0);
+    const Frustum    frustum = make_frustum();
+    Culling::AABBSoA boxes;
+    boxes.reserve(N);
+    for (const auto& box : make_boxes(N)) {
+        boxes.push_back(box);
+    }
+    std::vector<u64> visibility(Culling::mask_words(N));
+    for (auto _ : state) {
+        Culling::cull(frustum, boxes, visibility);
+        benchmark::DoNotOptimize(visibility.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * N);
+    state.counters["visible"] = double(Culling::count_visible(visibility, N));
+}
+
+static void BM_CullAABBSoACompact(benchmark::State& state) {
+    const usize      N       = state.range(0);
+    const Frustum    frustum = make_frustum();
+    Culling::AABBSoA boxes;
+    boxes.reserve(N);
+    for (const auto& box : make_boxes(N)) {
+        boxes.push_back(box);
+    }
+    std::vector<u64> visibility(Culling::mask_words(N));
+    std::vector<u32> indices;
+    indices.reserve(N);
+    for (auto _ : state) {
+        indices.clear();
+        Culling::cull(frustum, boxes, visibility);
+        Culling::compact(visibility, N, indices);
+        benchmark::DoNotOptimize(indices.data());
+    }
+    state.SetItemsProcessed(state.iterations() * N);
+    state.counters["visible"] = double(indices.size());
+}
+
+static void BM_CullSphereSoA(benchmark::State& state) {
+    const usize        N       = state.range(0);
+    const Frustum      frustum = make_frustum();
+    Culling::SphereSoA spheres;
+    spheres.reserve(N);
+    for (const auto& box : make_boxes(N)) {
+        const Vec3 extents = box.extents();
+        spheres.push_back({box.center(), std::max({extents.x, extents.y, extents.z})});
+    }
+    std::vector<u64> visibility(Culling::mask_words(N));
+    for (auto _ : state) {
+        Culling::cull(frustum, spheres, visibility);
+        benchmark::DoNotOptimize(visibility.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * N);
+}
+
+// Minimal fork/join pool, so the benchmark does not depend on the engine's job system
+class ForkJoinPool {
+public:
+    explicit ForkJoinPool(usize threads)
+        : m_Start(static_cast<std::ptrdiff_t>(threads + 1)),
+          m_End(static_cast<std::ptrdiff_t>(threads + 1)) {
+        for (usize i = 0; i < threads; i++) {
+            m_Threads.emplace_back([this] {
+                while (true) {
+                    m_Start.arrive_and_wait();
+                    if (m_Stop) {
+                        return;
+                    }
+                    run();
+                    m_End.arrive_and_wait();
+                }
+            });
+        }
+    }
+
+    ~ForkJoinPool() {
+        m_Stop = true;
+        m_Start.arrive_and_wait();
+        for (auto& thread : m_Threads) {
+            thread.join();
+        }
+    }
+
+    template<typename Body> void parallel_for(usize count, const Body& body) {
+        m_Body  = [&body](usize i) { body(i); };
+        m_Count = count;
+        m_Next.store(0);
+        m_Start.arrive_and_wait();
+        run();
+        m_End.arrive_and_wait();
+    }
+
+private:
+    void run() {
+        for (usize i = m_Next.fetch_add(1); i < m_Count; i = m_Next.fetch_add(1)) {
+            m_Body(i);
+        }
+    }
+
+    std::vector<std::thread>   m_Threads;
+    std::barrier<>             m_Start;
+    std::barrier<>             m_End;
+    std::function<void(usize)> m_Body;
+    usize                      m_Count = 0;
+    std::atomic<usize>         m_Next {0};
+    bool                       m_Stop = false;
+};
+
+static void BM_CullAABBSoAParallel(benchmark::State& state) {
+    const usize      N       = state.range(0);
+    const usize      threads = state.range(1);
+    const Frustum    frustum = make_frustum();
+    Culling::AABBSoA boxes;
+    boxes.reserve(N);
+    for (const auto& box : make_boxes(N)) {
+        boxes.push_back(box);
+    }
+    std::vector<u64> visibility(Culling::mask_words(N));
+    ForkJoinPool     pool(threads - 1);
+    for (auto _ : state) {
+        Culling::cull_parallel(frustum, boxes, visibility,
+            [&](usize chunks, const auto& body) { pool.parallel_for(chunks, body); });
+        benchmark::DoNotOptimize(visibility.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * N);
+}
+
+BENCHMARK(BM_CullAABBScalarAoS)->Arg(100'000)->Arg(1'000'000);
+BENCHMARK(BM_CullAABBSoA)->Arg(100'000)->Arg(1'000'000);
+BENCHMARK(BM_CullAABBSoACompact)->Arg(100'000)->Arg(1'000'000);
+BENCHMARK(BM_CullSphereSoA)->Arg(100'000)->Arg(1'000'000);
+BENCHMARK(BM_CullAABBSoAParallel)
+    ->ArgsProduct({{100'000, 1'000'000}, {1, 2, 4, 8}})
+    ->UseRealTime();
+// NOLINTEND(*)
@@ -0,0 +1,175 @@
+// NOLINTBEGIN(*)
+#include "PulsarCore/BenchmarkPerfCounters.hpp"
+#include "PulsarCore/IO/IoService.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <benchmark/benchmark.h>
+#include <fcntl.h>
+#include <filesystem>
+#include <fstream>
+#include <numeric>
+#include <random>
+#include <unistd.h>
+#include <vector>
+
+using namespace Pulsar;
+
+namespace {
+    /// Every variant reads 16 MiB out of a 64 MiB file, in reads of range(0) KiB at shuffled
+    /// offsets: 4096 small reads or 16 large ones
+    constexpr usize FILE_BYTES = usize {64} << 20;
+    constexpr usize READ_BYTES = usize {16} << 20;
+
+    /// In the temp directory. Cold runs need a disk-backed one (set `TMPDIR`): pages of a tmpfs
+    /// cannot be evicted.
+    const std::filesystem::path& data_file() {
+        static const std::filesystem::path path = [] {
+            auto result = std::filesystem::temp_directory_path() / "pulsar_io_bench.bin";
+            if (!std::filesystem::exists(result)
+                || std::filesystem::file_size(result) != FILE_BYTES) {
+                std::vector<u64> block(1 << 17);
+                std::ofstream    out(result, std::ios::binary);
+                for (usize offset = 0; offset < FILE_BYTES; offset += block.size() * 8) {
+                    std::iota(block.begin(), block.end(), offset / 8);
+                    out.write(reinterpret_cast<const char*>(block.data()),
+                        std::streamsize(block.size() * 8));
+                }
+            }
+            return result;
+        }();
+        return path;
+    }
+
+    void evict(int fd) {
+        fdatasync(fd);
+        posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+    }
+
+    /// Offsets of the reads, whole blocks of `readSize` in a fixed random order
+    std::vector<u64> read_offsets(usize readSize) {
+        std::vector<u64> offsets(FILE_BYTES / readSize);
+        for (usize i = 0; i < offsets.size(); i++) {
+            offsets[i] = i * readSize;
+        }
+        std::shuffle(offsets.begin(), offsets.end(), std::mt19937_64(42));
+        offsets.resize(READ_BYTES / readSize);
+        return offsets;
+    }
+
+    /// Wakes the benchmark thread when the last read of an iteration completes
+    struct Counter_t {
+        std::atomic<usize> m_Done = 0;
+        usize              m_Total;
+
+        static void count(const IoCompletion_t& completion) {
+            auto* self = static_cast<Counter_t*>(completion.m_Context);
+            if (completion.m_Result < 0) {
+                std::abort();
+            }
+            if (self->m_Done.fetch_add(1, std::memory_order_acq_rel) + 1 == self->m_Total) {
+                self->m_Done.notify_one();
+            }
+        }
+    };
+
+    void set_counters(benchmark::State& state, usize readCount, bool cold) {
+        state.SetBytesProcessed(i64(state.iterations() * READ_BYTES));
+        // Items are reads, so items_per_second is IOPS
+        state.SetItemsProcessed(i64(state.iterations() * readCount));
+        state.counters["cold"] = cold ? 1.0 : 0.0;
+    }
+} // namespace
+
+/// The baseline: one blocking `pread` after another on the benchmark thread
+static void BM_IoReadBlocking(benchmark::State& state) {
+    const auto             readSize = usize(state.range(0)) << 10;
+    const bool             cold     = state.range(1) != 0;
+    const auto             offsets  = read_offsets(readSize);
+    const int              fd       = ::open(data_file().c_str(), O_RDONLY);
+    std::vector<std::byte> arena(READ_BYTES);
+    const BenchmarkPerfCounters perf(state);
+    for (auto _ : state) {
+        if (cold) {
+            state.PauseTiming();
+            evict(fd);
+            state.ResumeTiming();
+        }
+        for (usize i = 0; i < offsets.size(); i++) {
+            if (pread(fd, arena.data() + i * readSize, readSize, off_t(offsets[i]))
+                != ssize_t(readSize)) {
+                std::abort();
+            }
+        }
+        benchmark::DoNotOptimize(arena.data());
+    }
+    ::close(fd);
+    set_counters(state, offsets.size(), cold);
+}
+
+/// Every read of an iteration submitted as one batch. range(2) picks the backend (0 io_uring,
+/// 1 thread pool), range(3) registers the file and the destination buffer.
+static void BM_IoReadService(benchmark::State& state) {
+    const auto readSize   = usize(state.range(0)) << 10;
+    const bool cold       = state.range(1) != 0;
+    const auto backend    = state.range(2) == 0 ? IoBackend::IoUring : IoBackend::ThreadPool;
+    const bool registered = state.range(3) != 0;
+    const auto offsets    = read_offsets(readSize);
+    const int  fd         = ::open(data_file().c_str(), O_RDONLY);
+    auto       service    = IoService::create({.m_Backend = backend, .m_QueueDepth = 64});
+    if (!service.has_value()) {
+        ::close(fd);
+        state.SkipWithError(service.error().c_str());
+        return;
+    }
+    std::vector<std::byte> arena(READ_BYTES);
+    IoFile_t               file = {.m_Fd = fd};
+    if (registered) {
+        const int                  fds[]     = {fd};
+        const std::span<std::byte> buffers[] = {arena};
+        const auto                 files     = (*service)->register_files(fds);
+        if (!files.has_value() || !(*service)->register_buffers(buffers).has_value()) {
+            ::close(fd);
+            state.SkipWithError("Registration failed");
+            return;
+        }
+        file = (*files)[0];
+    }
+
+    Counter_t             counter {.m_Total = offsets.size()};
+    std::vector<IoRead_t> reads;
+    for (usize i = 0; i < offsets.size(); i++) {
+        reads.push_back({.m_File = file, .m_Offset = offsets[i],
+            .m_Buffer = std::span(arena).subspan(i * readSize, readSize),
+            .m_BufferIndex = registered ? 0 : -1, .m_Callback = &Counter_t::count,
+            .m_Context = &counter});
+    }
+    const BenchmarkPerfCounters perf(state);
+    for (auto _ : state) {
+        if (cold) {
+            state.PauseTiming();
+            evict(fd);
+            state.ResumeTiming();
+        }
+        counter.m_Done = 0;
+        (*service)->submit(reads);
+        for (usize done = counter.m_Done.load(); done != offsets.size();
+             done       = counter.m_Done.load()) {
+            counter.m_Done.wait(done);
+        }
+        benchmark::DoNotOptimize(arena.data());
+    }
+    service->reset();
+    ::close(fd);
+    set_counters(state, offsets.size(), cold);
+}
+
+BENCHMARK(BM_IoReadBlocking)
+    ->ArgsProduct({{4, 1024}, {0, 1}})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_IoReadService)
+    ->ArgsProduct({{4, 1024}, {0, 1}, {0, 1}, {0, 1}})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+// NOLINTEND(*)
@@ -0,0 +1,96 @@
+// NOLINTBEGIN(*)
+#include "PulsarCore/Sync/Event.hpp"
+#include "PulsarCore/Sync/Mutex.hpp"
+#include "PulsarCore/Sync/Once.hpp"
+#include "PulsarCore/Sync/SharedMutex.hpp"
+#include "PulsarCore/Util/Macros.hpp"
+
+#include <array>
+#include <benchmark/benchmark.h>
+#include <mutex>
+#include <shared_mutex>
+
+using namespace Pulsar;
+
+namespace {
+    /// What a short critical section touches, like a free list head and a counter
+    struct Guarded_t {
+        u64 m_Value = 0;
+        u64 m_Count = 0;
+    };
+
+    template<typename L> struct Shared_t {
+        L         m_Lock;
+        Guarded_t m_Data;
+    };
+
+    template<typename L> Shared_t<L> g_Shared;
+
+    template<typename L> void BM_LockContention(benchmark::State& state) {
+        auto& shared = g_Shared<L>;
+        for (auto _ : state) {
+            std::lock_guard lock(shared.m_Lock);
+            shared.m_Data.m_Value += shared.m_Data.m_Count++;
+        }
+        benchmark::DoNotOptimize(shared.m_Data.m_Value);
+    }
+
+    /// Readers look a value up under a shared lock, thread 0 also writes every range(0)th round
+    template<typename L> void BM_ReadMostly(benchmark::State& state) {
+        auto&       shared     = g_Shared<L>;
+        const auto  writeEvery = static_cast<u64>(state.range(0));
+        const bool  writer     = state.thread_index() == 0 && writeEvery != 0;
+        u64         round      = 0;
+        for (auto _ : state) {
+            if (writer && ++round % writeEvery == 0) {
+                std::lock_guard lock(shared.m_Lock);
+                shared.m_Data.m_Value++;
+            }
+            else {
+                std::shared_lock lock(shared.m_Lock);
+                benchmark::DoNotOptimize(shared.m_Data.m_Value);
+            }
+        }
+    }
+
+    /// The hot path once initialization is done, what every call site of `PULSAR_RUN_ONCE` pays
+    void BM_OnceFlagDone(benchmark::State& state) {
+        static OnceFlag flag;
+        for (auto _ : state) {
+            call_once(flag, [] { benchmark::ClobberMemory(); });
+        }
+    }
+
+    void BM_StdCallOnceDone(benchmark::State& state) {
+        static std::once_flag flag;
+        for (auto _ : state) {
+            std::call_once(flag, [] { benchmark::ClobberMemory(); });
+        }
+    }
+
+    void BM_RunOnceMacro(benchmark::State& state) {
+        for (auto _ : state) {
+            PULSAR_RUN_ONCE {
+                benchmark::ClobberMemory();
+            }
+        }
+    }
+
+    void BM_EventWaitSet(benchmark::State& state) {
+        static Event event(true);
+        for (auto _ : state) {
+            event.wait();
+        }
+    }
+} // namespace
+
+BENCHMARK(BM_LockContention<Mutex>)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_LockContention<TicketLock>)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_LockContention<std::mutex>)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_ReadMostly<SharedMutex>)->Arg(0)->Arg(1000)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_ReadMostly<std::shared_mutex>)->Arg(0)->Arg(1000)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_OnceFlagDone)->ThreadRange(1, 8);
+BENCHMARK(BM_StdCallOnceDone)->ThreadRange(1, 8);
+BENCHMARK(BM_RunOnceMacro)->ThreadRange(1, 8);
+BENCHMARK(BM_EventWaitSet)->ThreadRange(1, 8);
+// NOLINTEND(*)
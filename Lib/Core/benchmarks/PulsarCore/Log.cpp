@@ -0,0 +1,193 @@
+// NOLINTBEGIN(*)
+#include "PulsarCore/Log.hpp"
+#include "PulsarCore/Log/AsyncSink.hpp"
+
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <spdlog/sinks/basic_file_sink.h>
+#include <spdlog/sinks/null_sink.h>
+
+using namespace Pulsar;
+
+// Every run logs into a fresh file, so the sync numbers include the real formatting and I/O cost
+static const std::filesystem::path LOG_PATH =
+    std::filesystem::temp_directory_path() / "pulsar_log_benchmark.log";
+
+static void init_logger(LogMode mode, LogOverflowPolicy policy) {
+    LogConfig_t config;
+    config.m_Mode           = mode;
+    config.m_OverflowPolicy = policy;
+    config.m_Sinks = {std::make_shared<spdlog::sinks::basic_file_sink_mt>(LOG_PATH.string(), true)};
+    if (!Log::init(config).has_value()) {
+        std::abort();
+    }
+}
+
+static void setup_sync(const benchmark::State&) {
+    init_logger(LogMode::Sync, LogOverflowPolicy::Block);
+}
+
+static void setup_async_block(const benchmark::State&) {
+    init_logger(LogMode::Async, LogOverflowPolicy::Block);
+}
+
+static void setup_async_drop(const benchmark::State&) {
+    init_logger(LogMode::Async, LogOverflowPolicy::Drop);
+}
+
+static void setup_binary(const benchmark::State&) {
+    LogConfig_t config;
+    config.m_Mode       = LogMode::Binary;
+    config.m_BinaryPath = LOG_PATH;
+    if (!Log::init(config).has_value()) {
+        std::abort();
+    }
+}
+
+static void teardown(const benchmark::State&) {
+    Log::shutdown();
+    std::filesystem::remove(LOG_PATH);
+}
+
+// Time spent by the calling thread per log call, the writer thread's work is not included.
+// bytes_per_record is the size of one record on disk.
+static void BM_LogCallerLatency(benchmark::State& state) {
+    int value = 0;
+    for (auto _ : state) {
+        PL_LOG_INFO("Frame {} took {:.3f} ms on thread {}", value, 16.6, state.thread_index());
+        value++;
+    }
+    state.SetItemsProcessed(state.iterations());
+    if (state.thread_index() == 0) {
+        Log::flush();
+        for (const auto& sink : Log::get_logger().sinks()) {
+            if (const auto async = std::dynamic_pointer_cast<AsyncSink>(sink)) {
+                state.counters["dropped"] = double(async->dropped_count());
+            }
+        }
+        if (BinaryLog::records_written() > 0) {
+            state.counters["bytes_per_record"] =
+                double(BinaryLog::bytes_written()) / double(BinaryLog::records_written());
+        }
+        else {
+            const double records = double(state.iterations()) * state.threads();
+            const double bytes   = double(std::filesystem::file_size(LOG_PATH));
+            state.counters["bytes_per_record"] = bytes / records;
+        }
+    }
+}
+
+// Front end overhead, the record goes to a null sink so only the call itself is measured
+static void setup_null(const benchmark::State&) {
+    LogConfig_t config;
+    config.m_Sinks = {std::make_shared<spdlog::sinks::null_sink_mt>()};
+    if (!Log::init(config).has_value()) {
+        std::abort();
+    }
+}
+
+static void teardown_null(const benchmark::State&) {
+    Log::shutdown();
+}
+
+static void BM_LogEnabled(benchmark::State& state) {
+    Log::set_level(LogCategory::Core, spdlog::level::info);
+    int value = 0;
+    for (auto _ : state) {
+        PL_LOG_CAT_INFO(Core, "value {}", value);
+        value++;
+    }
+    benchmark::DoNotOptimize(value);
+}
+
+static void BM_LogDisabledAtRuntime(benchmark::State& state) {
+    Log::set_level(LogCategory::Core, spdlog::level::warn);
+    int value = 0;
+    for (auto _ : state) {
+        PL_LOG_CAT_INFO(Core, "value {}", value);
+        value++;
+        benchmark::DoNotOptimize(value);
+    }
+}
+
+// Only compiled out when trace is below PULSAR_LOG_LEVEL_CORE (the default in release builds)
+static void BM_LogDisabledAtCompileTime(benchmark::State& state) {
+    int value = 0;
+    for (auto _ : state) {
+        PL_LOG_CAT_TRACE(Core, "value {}", value);
+        value++;
+        benchmark::DoNotOptimize(value);
+    }
+    state.counters["compiled_in"] =
+        Log::is_compiled_in(LogCategory::Core, spdlog::level::trace) ? 1 : 0;
+}
+
+// What every statement used to pay, a shared_ptr copy before the level check
+static void BM_LogSharedPtrAccessDisabled(benchmark::State& state) {
+    const auto owner = std::make_shared<spdlog::logger>(
+        "Shared", std::make_shared<spdlog::sinks::null_sink_mt>());
+    owner->set_level(spdlog::level::warn);
+    const auto get = [&owner] { return owner; };
+    int        value = 0;
+    for (auto _ : state) {
+        get()->info("value {}", value);
+        value++;
+        benchmark::DoNotOptimize(value);
+    }
+}
+
+static void setup_flight_recorder(const benchmark::State&) {
+    LogConfig_t config;
+    config.m_Sinks = {std::make_shared<spdlog::sinks::null_sink_mt>()};
+    config.m_Level = spdlog::level::info;
+    config.m_FlightRecorder.m_Enabled               = true;
+    config.m_FlightRecorder.m_InstallSignalHandlers = false;
+    if (!Log::init(config).has_value()) {
+        std::abort();
+    }
+}
+
+// A statement below the sink level that only the flight recorder keeps, compare with
+// BM_LogDisabledAtRuntime
+static void BM_FlightRecorderRecord(benchmark::State& state) {
+    int value = 0;
+    for (auto _ : state) {
+        PL_LOG_CAT_DEBUG(Core, "value {} {}", value, "text");
+        value++;
+        benchmark::DoNotOptimize(value);
+    }
+    state.counters["compiled_in"] = benchmark::Counter(
+        Log::is_compiled_in(LogCategory::Core, spdlog::level::debug) ? 1 : 0,
+        benchmark::Counter::kAvgThreads);
+}
+
+BENCHMARK(BM_LogEnabled)->Setup(setup_null)->Teardown(teardown_null)->ThreadRange(1, 4);
+BENCHMARK(BM_LogDisabledAtRuntime)->Setup(setup_null)->Teardown(teardown_null)->ThreadRange(1, 4);
+BENCHMARK(BM_LogDisabledAtCompileTime)->Setup(setup_null)->Teardown(teardown_null);
+BENCHMARK(BM_LogSharedPtrAccessDisabled)->ThreadRange(1, 4);
+BENCHMARK(BM_FlightRecorderRecord)
+    ->Setup(setup_flight_recorder)
+    ->Teardown(teardown_null)
+    ->ThreadRange(1, 4);
+
+BENCHMARK(BM_LogCallerLatency)
+    ->Name("BM_LogCallerLatency/Sync")
+    ->Setup(setup_sync)
+    ->Teardown(teardown)
+    ->ThreadRange(1, 16);
+BENCHMARK(BM_LogCallerLatency)
+    ->Name("BM_LogCallerLatency/AsyncBlock")
+    ->Setup(setup_async_block)
+    ->Teardown(teardown)
+    ->ThreadRange(1, 16);
+BENCHMARK(BM_LogCallerLatency)
+    ->Name("BM_LogCallerLatency/AsyncDrop")
+    ->Setup(setup_async_drop)
+    ->Teardown(teardown)
+    ->ThreadRange(1, 16);
+BENCHMARK(BM_LogCallerLatency)
+    ->Name("BM_LogCallerLatency/Binary")
+    ->Setup(setup_binary)
+    ->Teardown(teardown)
+    ->ThreadRange(1, 16);
+// NOLINTEND(*)
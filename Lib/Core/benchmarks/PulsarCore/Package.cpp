@@ -0,0 +1,190 @@
+// NOLINTBEGIN(*)
+#include "PulsarCore/BenchmarkPerfCounters.hpp"
+#include "PulsarCore/IO/Package.hpp"
+#include "PulsarCore/IO/PackageWriter.hpp"
+
+#include <benchmark/benchmark.h>
+#include <cstring>
+#include <fcntl.h>
+#include <filesystem>
+#include <fmt/format.h>
+#include <fstream>
+#include <map>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+using namespace Pulsar;
+
+namespace {
+    /// Every variant loads the same 16 MiB, split into assets of range(0) KiB
+    constexpr usize TOTAL_BYTES = usize {16} << 20;
+
+    /// The same assets as loose files and as one package, in the temp directory. Cold runs need
+    /// a disk-backed one (set `TMPDIR`): pages of a tmpfs cannot be evicted.
+    struct AssetSet_t {
+        std::filesystem::path              m_Directory;
+        std::filesystem::path              m_Package;
+        std::vector<std::string>           m_Names;
+        std::vector<std::filesystem::path> m_Files;
+    };
+
+    const AssetSet_t& asset_set(usize assetSize) {
+        static std::map<usize, AssetSet_t> sets;
+        auto [it, inserted] = sets.try_emplace(assetSize);
+        AssetSet_t& set     = it->second;
+        if (!inserted) {
+            return set;
+        }
+        set.m_Directory = std::filesystem::temp_directory_path()
+                        / fmt::format("pulsar_package_bench_{}", assetSize);
+        std::filesystem::create_directories(set.m_Directory);
+        set.m_Package = set.m_Directory / "assets.pak";
+
+        PackageWriter          writer;
+        std::vector<std::byte> data(assetSize);
+        for (usize i = 0; i < TOTAL_BYTES / assetSize; i++) {
+            for (usize j = 0; j < assetSize; j += 8) {
+                const u64 word = i * 0x9e3779b97f4a7c15 + j;
+                std::memcpy(data.data() + j, &word, std::min<usize>(8, assetSize - j));
+            }
+            set.m_Names.push_back(fmt::format("assets/asset_{:05}.bin", i));
+            set.m_Files.push_back(set.m_Directory / fmt::format("asset_{:05}.bin", i));
+            std::ofstream out(set.m_Files.back(), std::ios::binary);
+            out.write(reinterpret_cast<const char*>(data.data()), std::streamsize(data.size()));
+            writer.add(set.m_Names.back(), data);
+        }
+        if (!writer.write(set.m_Package).has_value()) {
+            std::abort();
+        }
+        return set;
+    }
+
+    /// Drops the file's pages from the page cache, so the next read has to go to the disk
+    void evict(const std::filesystem::path& path) {
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd >= 0) {
+            fdatasync(fd);
+            posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+            ::close(fd);
+        }
+    }
+
+    /// What a loader does with the bytes, the same for every variant: touch every cache line
+    u64 consume(std::span<const std::byte> data) {
+        u64 sum = 0;
+        for (usize i = 0; i + 8 <= data.size(); i += 64) {
+            u64 word = 0;
+            std::memcpy(&word, data.data() + i, sizeof(word));
+            sum += word;
+        }
+        return sum;
+    }
+
+    void set_counters(benchmark::State& state, const AssetSet_t& set, bool cold) {
+        state.SetBytesProcessed(i64(state.iterations() * TOTAL_BYTES));
+        state.SetItemsProcessed(i64(state.iterations() * set.m_Names.size()));
+        state.counters["cold"] = cold ? 1.0 : 0.0;
+    }
+} // namespace
+
+/// The baseline: every asset is its own file, read into its own buffer with `std::ifstream`
+static void BM_LoadLooseFiles(benchmark::State& state) {
+    const auto                  assetSize = usize(state.range(0)) << 10;
+    const bool                  cold      = state.range(1) != 0;
+    const AssetSet_t&           set       = asset_set(assetSize);
+    const BenchmarkPerfCounters perf(state);
+    for (auto _ : state) {
+        if (cold) {
+            state.PauseTiming();
+            for (const auto& file : set.m_Files) {
+                evict(file);
+            }
+            state.ResumeTiming();
+        }
+        u64 sum = 0;
+        for (const auto& file : set.m_Files) {
+            std::ifstream          input(file, std::ios::binary | std::ios::ate);
+            std::vector<std::byte> data(usize(input.tellg()));
+            input.seekg(0);
+            input.read(reinterpret_cast<char*>(data.data()), std::streamsize(data.size()));
+            sum += consume(data);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    set_counters(state, set, cold);
+}
+
+/// The package read with `std::ifstream`: one file, but still a copy per asset
+static void BM_LoadPackageRead(benchmark::State& state) {
+    const auto        assetSize = usize(state.range(0)) << 10;
+    const bool        cold      = state.range(1) != 0;
+    const AssetSet_t& set       = asset_set(assetSize);
+    // Only for the offsets, the loop does not touch the mapping
+    const auto                  package = Package::open(set.m_Package);
+    const BenchmarkPerfCounters perf(state);
+    for (auto _ : state) {
+        if (cold) {
+            state.PauseTiming();
+            evict(set.m_Package);
+            state.ResumeTiming();
+        }
+        std::ifstream input(set.m_Package, std::ios::binary);
+        u64           sum = 0;
+        for (const auto& name : set.m_Names) {
+            const PackageEntry_t*  entry = package->find(name);
+            std::vector<std::byte> data(entry->m_Size);
+            input.seekg(std::streamoff(entry->m_Offset));
+            input.read(reinterpret_cast<char*>(data.data()), std::streamsize(data.size()));
+            sum += consume(data);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    set_counters(state, set, cold);
+}
+
+/// The package mapped and used in place, range(2) prefetches every asset up front
+static void BM_LoadPackageMapped(benchmark::State& state) {
+    const auto                  assetSize = usize(state.range(0)) << 10;
+    const bool                  cold      = state.range(1) != 0;
+    const bool                  prefetch  = state.range(2) != 0;
+    const AssetSet_t&           set       = asset_set(assetSize);
+    const BenchmarkPerfCounters perf(state);
+    for (auto _ : state) {
+        if (cold) {
+            state.PauseTiming();
+            evict(set.m_Package);
+            state.ResumeTiming();
+        }
+        // Opened per iteration like the loose files, and so a cold run starts without mappings
+        const auto package = Package::open(set.m_Package);
+        if (prefetch) {
+            std::vector<const PackageEntry_t*> level;
+            for (const auto& name : set.m_Names) {
+                level.push_back(package->find(name));
+            }
+            package->prefetch(level);
+        }
+        u64 sum = 0;
+        for (const auto& name : set.m_Names) {
+            sum += consume(package->data(*package->find(name)));
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    set_counters(state, set, cold);
+    state.counters["prefetch"] = prefetch ? 1.0 : 0.0;
+}
+
+BENCHMARK(BM_LoadLooseFiles)
+    ->ArgsProduct({{4, 256}, {0, 1}})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_LoadPackageRead)
+    ->ArgsProduct({{4, 256}, {0, 1}})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_LoadPackageMapped)
+    ->ArgsProduct({{4, 256}, {0, 1}, {0, 1}})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+// NOLINTEND(*)
@@ -0,0 +1,222 @@
+// NOLINTBEGIN(*)
+#include "PulsarCore/Math/Packed.hpp"
+
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace Pulsar;
+
+// A typical lit, textured vertex at full precision
+struct FullVertex {
+    Vec3 m_position;
+    Vec3 m_normal;
+    Vec4 m_tangent;
+    Vec2 m_uv;
+};
+
+// The same vertex with every attribute quantized
+struct PackedVertex {
+    Vec3h         m_position;
+    OctNormal     m_normal;
+    Packed1010102 m_tangent;
+    Vec2h         m_uv;
+};
+
+static std::vector<Vec3> make_unit_vectors(usize count) {
+    std::mt19937                    rng(42);
+    std::normal_distribution<float> dist;
+    std::vector<Vec3>               vectors(count);
+    for (auto& v : vectors) {
+        v         = {dist(rng), dist(rng), dist(rng)};
+        float len = std::sqrt(v.x * v.x + v.y * v.y + v.z * v.z) + 1e-6F;
+        v         = {v.x / len, v.y / len, v.z / len};
+    }
+    return vectors;
+}
+
+template<typename Encoded>
+static void set_counters(benchmark::State& state, usize count, usize decodedSize) {
+    state.SetItemsProcessed(state.iterations() * count);
+    // Throughput is measured on the compact side, that is what has to come through memory
+    state.SetBytesProcessed(state.iterations() * count * sizeof(Encoded));
+    state.counters["bytes_per_element"] = double(sizeof(Encoded));
+    state.counters["compression"]       = double(decodedSize) / double(sizeof(Encoded));
+}
+
+static void BM_DecodeF32Copy(benchmark::State& state) {
+    const usize       N   = state.range(0);
+    std::vector<Vec3> src = make_unit_vectors(N);
+    std::vector<Vec3> dst(N);
+    for (auto _ : state) {
+        std::copy(src.begin(), src.end(), dst.begin());
+        benchmark::DoNotOptimize(dst.data());
+        benchmark::ClobberMemory();
+    }
+    set_counters<Vec3>(state, N, sizeof(Vec3));
+}
+
+static void BM_DecodeVec3h(benchmark::State& state) {
+    const usize        N = state.range(0);
+    std::vector<Vec3h> src(N);
+    Packed::encode_vec3h(make_unit_vectors(N), src);
+    std::vector<Vec3> dst(N);
+    for (auto _ : state) {
+        Packed::decode_vec3h(src, dst);
+        benchmark::DoNotOptimize(dst.data());
+        benchmark::ClobberMemory();
+    }
+    set_counters<Vec3h>(state, N, sizeof(Vec3));
+}
+
+static void BM_DecodeVec3hScalar(benchmark::State& state) {
+    const usize        N = state.range(0);
+    std::vector<Vec3h> src(N);
+    Packed::encode_vec3h(make_unit_vectors(N), src);
+    std::vector<Vec3> dst(N);
+    for (auto _ : state) {
+        for (usize i = 0; i < N; i++) {
+            dst[i] = decode_vec3h(src[i]);
+        }
+        benchmark::DoNotOptimize(dst.data());
+        benchmark::ClobberMemory();
+    }
+    set_counters<Vec3h>(state, N, sizeof(Vec3));
+}
+
+static void BM_EncodeVec3h(benchmark::State& state) {
+    const usize        N   = state.range(0);
+    std::vector<Vec3>  src = make_unit_vectors(N);
+    std::vector<Vec3h> dst(N);
+    for (auto _ : state) {
+        Packed::encode_vec3h(src, dst);
+        benchmark::DoNotOptimize(dst.data());
+        benchmark::ClobberMemory();
+    }
+    set_counters<Vec3h>(state, N, sizeof(Vec3));
+}
+
+static void BM_DecodeSNorm16(benchmark::State& state) {
+    const usize              N = state.range(0);
+    std::vector<SNorm16Vec3> src(N);
+    Packed::encode_snorm16(make_unit_vectors(N), src);
+    std::vector<Vec3> dst(N);
+    for (auto _ : state) {
+        Packed::decode_snorm16(src, dst);
+        benchmark::DoNotOptimize(dst.data());
+        benchmark::ClobberMemory();
+    }
+    set_counters<SNorm16Vec3>(state, N, sizeof(Vec3));
+}
+
+static void BM_DecodeUNorm8(benchmark::State& state) {
+    const usize             N = state.range(0);
+    std::vector<UNorm8Vec4> src(N, UNorm8Vec4 {12, 34, 56, 255});
+    std::vector<Vec4>       dst(N);
+    for (auto _ : state) {
+        Packed::decode_unorm8(src, dst);
+        benchmark::DoNotOptimize(dst.data());
+        benchmark::ClobberMemory();
+    }
+    set_counters<UNorm8Vec4>(state, N, sizeof(Vec4));
+}
+
+static void BM_DecodeOctahedral(benchmark::State& state) {
+    const usize            N = state.range(0);
+    std::vector<OctNormal> src(N);
+    Packed::encode_octahedral(make_unit_vectors(N), src);
+    std::vector<Vec3> dst(N);
+    for (auto _ : state) {
+        Packed::decode_octahedral(src, dst);
+        benchmark::DoNotOptimize(dst.data());
+        benchmark::ClobberMemory();
+    }
+    set_counters<OctNormal>(state, N, sizeof(Vec3));
+}
+
+static void BM_DecodeOctahedralScalar(benchmark::State& state) {
+    const usize            N = state.range(0);
+    std::vector<OctNormal> src(N);
+    Packed::encode_octahedral(make_unit_vectors(N), src);
+    std::vector<Vec3> dst(N);
+    for (auto _ : state) {
+        for (usize i = 0; i < N; i++) {
+            dst[i] = decode_octahedral(src[i]);
+        }
+        benchmark::DoNotOptimize(dst.data());
+        benchmark::ClobberMemory();
+    }
+    set_counters<OctNormal>(state, N, sizeof(Vec3));
+}
+
+static void BM_EncodeOctahedral(benchmark::State& state) {
+    const usize            N   = state.range(0);
+    std::vector<Vec3>      src = make_unit_vectors(N);
+    std::vector<OctNormal> dst(N);
+    for (auto _ : state) {
+        Packed::encode_octahedral(src, dst);
+        benchmark::DoNotOptimize(dst.data());
+        benchmark::ClobberMemory();
+    }
+    set_counters<OctNormal>(state, N, sizeof(Vec3));
+}
+
+static void BM_DecodeSNorm1010102(benchmark::State& state) {
+    const usize       N       = state.range(0);
+    const auto        normals = make_unit_vectors(N);
+    std::vector<Vec4> tangents(N);
+    for (usize i = 0; i < N; i++) {
+        tangents[i] = {normals[i].x, normals[i].y, normals[i].z, 1.0F};
+    }
+    std::vector<Packed1010102> src(N);
+    Packed::encode_snorm1010102(tangents, src);
+    std::vector<Vec4> dst(N);
+    for (auto _ : state) {
+        Packed::decode_snorm1010102(src, dst);
+        benchmark::DoNotOptimize(dst.data());
+        benchmark::ClobberMemory();
+    }
+    set_counters<Packed1010102>(state, N, sizeof(Vec4));
+}
+
+// Decodes a whole interleaved vertex stream, to show the per-vertex budget
+static void BM_DecodeVertexStream(benchmark::State& state) {
+    const usize               N       = state.range(0);
+    const auto                normals = make_unit_vectors(N);
+    std::vector<PackedVertex> src(N);
+    for (usize i = 0; i < N; i++) {
+        src[i].m_position = encode_vec3h({normals[i].x * 10.0F, normals[i].y, normals[i].z});
+        src[i].m_normal   = encode_octahedral(normals[i]);
+        src[i].m_tangent  = encode_snorm1010102({normals[i].y, normals[i].z, normals[i].x, -1.0F});
+        src[i].m_uv       = {f16(normals[i].x * 0.5F + 0.5F), f16(normals[i].y * 0.5F + 0.5F)};
+    }
+    std::vector<FullVertex> dst(N);
+    for (auto _ : state) {
+        for (usize i = 0; i < N; i++) {
+            dst[i].m_position = decode_vec3h(src[i].m_position);
+            dst[i].m_normal   = decode_octahedral(src[i].m_normal);
+            dst[i].m_tangent  = decode_snorm1010102(src[i].m_tangent);
+            dst[i].m_uv = {static_cast<f32>(src[i].m_uv.x), static_cast<f32>(src[i].m_uv.y)};
+        }
+        benchmark::DoNotOptimize(dst.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * N);
+    state.SetBytesProcessed(state.iterations() * N * sizeof(PackedVertex));
+    state.counters["bytes_per_vertex"]      = double(sizeof(PackedVertex));
+    state.counters["full_bytes_per_vertex"] = double(sizeof(FullVertex));
+}
+
+BENCHMARK(BM_DecodeF32Copy)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_DecodeVec3h)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_DecodeVec3hScalar)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_EncodeVec3h)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_DecodeSNorm16)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_DecodeUNorm8)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_DecodeOctahedral)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_DecodeOctahedralScalar)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_EncodeOctahedral)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_DecodeSNorm1010102)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_DecodeVertexStream)->Range(1 << 10, 1 << 20);
+// NOLINTEND(*)
@@ -0,0 +1,289 @@
+// NOLINTBEGIN(*)
+#include "PulsarCore/BenchmarkPerfCounters.hpp"
+#include "PulsarCore/GC/Allocators/Arena.hpp"
+#include "PulsarCore/GC/Pointer.hpp"
+
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <optional>
+#include <vector>
+
+using namespace Pulsar;
+
+// Every case runs against a Pulsar pointer and its std:: counterpart, registered next to each
+// other so the output reads as pairs
+
+namespace {
+    struct Payload_t {
+        u64 m_Values[4] = {1, 2, 3, 4};
+    };
+
+    constexpr usize BATCH = 1024;
+    // Room for a batch of objects and their control blocks, even std::allocate_shared's
+    constexpr usize ARENA_BYTES_PER_OBJECT = 128;
+
+    template<typename T> using Arena = GC::ArenaAllocator<T>;
+
+    struct NoContext_t {
+        explicit NoContext_t(usize) {
+        }
+    };
+
+    struct ArenaContext_t {
+        explicit ArenaContext_t(usize count) : m_Arena(count * ARENA_BYTES_PER_OBJECT) {
+        }
+
+        Arena<Payload_t> m_Arena;
+    };
+
+    struct ArenaDeleter_t {
+        Arena<Payload_t> m_Arena;
+
+        void operator()(Payload_t* ptr) {
+            std::allocator_traits<Arena<Payload_t>>::destroy(m_Arena, ptr);
+            std::allocator_traits<Arena<Payload_t>>::deallocate(m_Arena, ptr, 1);
+        }
+    };
+
+    struct Scoped {
+        using Ptr     = GC::Scoped<Payload_t>;
+        using Context = NoContext_t;
+        static Ptr make(Context&) {
+            return GC::make_scoped<Payload_t>();
+        }
+    };
+
+    struct UniquePtr {
+        using Ptr     = std::unique_ptr<Payload_t>;
+        using Context = NoContext_t;
+        static Ptr make(Context&) {
+            return std::make_unique<Payload_t>();
+        }
+    };
+
+    struct Ref {
+        using Ptr     = GC::Ref<Payload_t>;
+        using Weak    = GC::Weak<Payload_t>;
+        using Context = NoContext_t;
+        static Ptr make(Context&) {
+            return GC::make_ref<Payload_t>();
+        }
+    };
+
+    struct SharedPtr {
+        using Ptr     = std::shared_ptr<Payload_t>;
+        using Weak    = std::weak_ptr<Payload_t>;
+        using Context = NoContext_t;
+        static Ptr make(Context&) {
+            return std::make_shared<Payload_t>();
+        }
+    };
+
+    // Object and control block allocated separately, like Ref does
+    struct SharedPtrNew {
+        using Ptr     = std::shared_ptr<Payload_t>;
+        using Weak    = std::weak_ptr<Payload_t>;
+        using Context = NoContext_t;
+        static Ptr make(Context&) {
+            return std::shared_ptr<Payload_t>(new Payload_t());
+        }
+    };
+
+    struct ScopedArena {
+        using Ptr     = GC::Scoped<Payload_t, Arena<Payload_t>>;
+        using Context = ArenaContext_t;
+        static Ptr make(Context& context) {
+            return GC::make_scoped_with_allocator<Payload_t>(context.m_Arena);
+        }
+    };
+
+    struct UniquePtrArena {
+        using Ptr     = std::unique_ptr<Payload_t, ArenaDeleter_t>;
+        using Context = ArenaContext_t;
+        static Ptr make(Context& context) {
+            auto* ptr = std::allocator_traits<Arena<Payload_t>>::allocate(context.m_Arena, 1);
+            std::allocator_traits<Arena<Payload_t>>::construct(context.m_Arena, ptr);
+            return Ptr(ptr, ArenaDeleter_t {context.m_Arena});
+        }
+    };
+
+    struct RefArena {
+        using Ptr     = GC::Ref<Payload_t, Arena<Payload_t>>;
+        using Context = ArenaContext_t;
+        static Ptr make(Context& context) {
+            return GC::make_ref_with_allocator<Payload_t>(context.m_Arena);
+        }
+    };
+
+    struct SharedPtrArena {
+        using Ptr     = std::shared_ptr<Payload_t>;
+        using Context = ArenaContext_t;
+        static Ptr make(Context& context) {
+            return std::allocate_shared<Payload_t>(context.m_Arena);
+        }
+    };
+
+    bool lock(const GC::Weak<Payload_t>& weak) {
+        return weak.lock().has_value();
+    }
+
+    bool lock(const std::weak_ptr<Payload_t>& weak) {
+        return weak.lock() != nullptr;
+    }
+
+    // Shared by all threads of a benchmark, created once and never destroyed
+    template<typename P> typename P::Ptr& shared_pointer() {
+        static typename P::Context context(1);
+        static auto*               ptr = new typename P::Ptr(P::make(context));
+        return *ptr;
+    }
+} // namespace
+
+// Batches with a fresh arena each, since arena memory is only reclaimed with the arena
+template<typename P> static void BM_PointerCreate(benchmark::State& state) {
+    std::vector<typename P::Ptr>       pointers;
+    std::optional<typename P::Context> context;
+    pointers.reserve(BATCH);
+    const BenchmarkPerfCounters perf(state);
+    for (auto _ : state) {
+        state.PauseTiming();
+        pointers.clear();
+        context.emplace(BATCH);
+        state.ResumeTiming();
+        for (usize i = 0; i < BATCH; i++) {
+            pointers.push_back(P::make(*context));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * BATCH);
+}
+
+template<typename P> static void BM_PointerDestroy(benchmark::State& state) {
+    std::vector<typename P::Ptr>       pointers;
+    std::optional<typename P::Context> context;
+    pointers.reserve(BATCH);
+    const BenchmarkPerfCounters perf(state);
+    for (auto _ : state) {
+        state.PauseTiming();
+        context.emplace(BATCH);
+        for (usize i = 0; i < BATCH; i++) {
+            pointers.push_back(P::make(*context));
+        }
+        state.ResumeTiming();
+        pointers.clear();
+    }
+    state.SetItemsProcessed(state.iterations() * BATCH);
+}
+
+// A copy and the destruction of the copy: one increment and one decrement of the strong count.
+// libstdc++ skips the atomic instructions while the process has a single thread, so std:: only
+// pays for them once a threaded benchmark ran.
+template<typename P> static void BM_PointerCopy(benchmark::State& state) {
+    typename P::Context context(1);
+    typename P::Ptr     ptr = P::make(context);
+    const BenchmarkPerfCounters perf(state);
+    for (auto _ : state) {
+        typename P::Ptr copy = ptr;
+        benchmark::DoNotOptimize(copy);
+    }
+}
+
+template<typename P> static void BM_PointerMove(benchmark::State& state) {
+    typename P::Context context(1);
+    typename P::Ptr     first = P::make(context);
+    const BenchmarkPerfCounters perf(state);
+    for (auto _ : state) {
+        typename P::Ptr second = std::move(first);
+        benchmark::DoNotOptimize(second);
+        first = std::move(second);
+    }
+}
+
+// Every thread locks its own weak pointer to the same object, so they fight over one count
+template<typename P> static void BM_WeakLock(benchmark::State& state) {
+    typename P::Ptr&            target = shared_pointer<P>();
+    const typename P::Weak      weak(target);
+    const BenchmarkPerfCounters perf(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(lock(weak));
+    }
+}
+
+// Threads copying one pointer around, four increments and four decrements per iteration
+template<typename P> static void BM_CopyStorm(benchmark::State& state) {
+    const typename P::Ptr&      target = shared_pointer<P>();
+    const BenchmarkPerfCounters perf(state);
+    for (auto _ : state) {
+        typename P::Ptr a = target;
+        typename P::Ptr b = a;
+        typename P::Ptr c = b;
+        typename P::Ptr d = c;
+        benchmark::DoNotOptimize(d);
+    }
+    state.SetItemsProcessed(state.iterations() * 4);
+}
+
+// Following every pointer of a container, where the allocator decides how scattered they are
+template<typename P> static void BM_PointerIterate(benchmark::State& state) {
+    const auto                   count = static_cast<usize>(state.range(0));
+    typename P::Context          context(count);
+    std::vector<typename P::Ptr> pointers;
+    pointers.reserve(count);
+    for (usize i = 0; i < count; i++) {
+        pointers.push_back(P::make(context));
+    }
+    const BenchmarkPerfCounters perf(state);
+    for (auto _ : state) {
+        u64 sum = 0;
+        for (const auto& ptr : pointers) {
+            sum += ptr->m_Values[0];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<i64>(count));
+}
+
+BENCHMARK_TEMPLATE(BM_PointerCreate, Scoped);
+BENCHMARK_TEMPLATE(BM_PointerCreate, UniquePtr);
+BENCHMARK_TEMPLATE(BM_PointerCreate, Ref);
+BENCHMARK_TEMPLATE(BM_PointerCreate, SharedPtr);
+BENCHMARK_TEMPLATE(BM_PointerCreate, SharedPtrNew);
+BENCHMARK_TEMPLATE(BM_PointerCreate, ScopedArena);
+BENCHMARK_TEMPLATE(BM_PointerCreate, UniquePtrArena);
+BENCHMARK_TEMPLATE(BM_PointerCreate, RefArena);
+BENCHMARK_TEMPLATE(BM_PointerCreate, SharedPtrArena);
+
+BENCHMARK_TEMPLATE(BM_PointerDestroy, Scoped);
+BENCHMARK_TEMPLATE(BM_PointerDestroy, UniquePtr);
+BENCHMARK_TEMPLATE(BM_PointerDestroy, Ref);
+BENCHMARK_TEMPLATE(BM_PointerDestroy, SharedPtr);
+BENCHMARK_TEMPLATE(BM_PointerDestroy, SharedPtrNew);
+BENCHMARK_TEMPLATE(BM_PointerDestroy, ScopedArena);
+BENCHMARK_TEMPLATE(BM_PointerDestroy, UniquePtrArena);
+BENCHMARK_TEMPLATE(BM_PointerDestroy, RefArena);
+BENCHMARK_TEMPLATE(BM_PointerDestroy, SharedPtrArena);
+
+BENCHMARK_TEMPLATE(BM_PointerCopy, Ref);
+BENCHMARK_TEMPLATE(BM_PointerCopy, SharedPtr);
+BENCHMARK_TEMPLATE(BM_PointerCopy, RefArena);
+BENCHMARK_TEMPLATE(BM_PointerCopy, SharedPtrArena);
+
+BENCHMARK_TEMPLATE(BM_PointerMove, Scoped);
+BENCHMARK_TEMPLATE(BM_PointerMove, UniquePtr);
+BENCHMARK_TEMPLATE(BM_PointerMove, Ref);
+BENCHMARK_TEMPLATE(BM_PointerMove, SharedPtr);
+BENCHMARK_TEMPLATE(BM_PointerMove, RefArena);
+BENCHMARK_TEMPLATE(BM_PointerMove, SharedPtrArena);
+
+BENCHMARK_TEMPLATE(BM_WeakLock, Ref)->ThreadRange(1, 8);
+BENCHMARK_TEMPLATE(BM_WeakLock, SharedPtr)->ThreadRange(1, 8);
+
+BENCHMARK_TEMPLATE(BM_CopyStorm, Ref)->ThreadRange(1, 8);
+BENCHMARK_TEMPLATE(BM_CopyStorm, SharedPtr)->ThreadRange(1, 8);
+
+BENCHMARK_TEMPLATE(BM_PointerIterate, Scoped)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_PointerIterate, UniquePtr)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_PointerIterate, Ref)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_PointerIterate, SharedPtr)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_PointerIterate, RefArena)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_PointerIterate, SharedPtrArena)->Range(1 << 10, 1 << 20);
+// NOLINTEND(*)
@@ -0,0 +1,75 @@
+// NOLINTBEGIN(*)
+#include "PulsarCore/BenchmarkPerfCounters.hpp"
+#include "PulsarCore/Util/Profiler.hpp"
+
+#include <benchmark/benchmark.h>
+
+using namespace Pulsar;
+
+static constexpr int ZONES_PER_SESSION = 1000;
+
+// Every iteration is a fresh session, so the buffers are reused instead of growing with the
+// iteration count
+template<bool Started, bool Perf = false> static void BM_ProfileZone(benchmark::State& state) {
+    const BenchmarkPerfCounters perf(state);
+    for (auto _ : state) {
+        state.PauseTiming();
+        if constexpr (Started) {
+            Profiler::start({.m_PerfCounters = Perf});
+        }
+        state.ResumeTiming();
+        for (int i = 0; i < ZONES_PER_SESSION; i++) {
+            const ProfileScope scope("Zone");
+            benchmark::ClobberMemory();
+        }
+        state.PauseTiming();
+        Profiler::stop();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * ZONES_PER_SESSION);
+}
+
+// What PULSAR_PROFILE_SCOPE costs in this build, nothing unless PULSAR_PROFILE is defined
+static void BM_ProfileZoneMacro(benchmark::State& state) {
+    Profiler::start();
+    for (auto _ : state) {
+        for (int i = 0; i < ZONES_PER_SESSION; i++) {
+            PULSAR_PROFILE_SCOPE("Zone");
+            benchmark::ClobberMemory();
+        }
+        state.PauseTiming();
+        Profiler::start();
+        state.ResumeTiming();
+    }
+    Profiler::stop();
+    state.SetItemsProcessed(state.iterations() * ZONES_PER_SESSION);
+#ifdef PULSAR_PROFILE
+    state.counters["compiled_in"] = 1;
+#else
+    state.counters["compiled_in"] = 0;
+#endif
+}
+
+// The floor of a zone is two of these, virtual machines that trap RDTSC make it much slower
+static void BM_ReadTimestamp(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(read_timestamp());
+    }
+}
+
+// A zone with hardware counters attached reads them twice
+static void BM_ReadPerfCounters(benchmark::State& state) {
+    const PerfCounterGroup& group = PerfCounterGroup::for_current_thread();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(group.read());
+    }
+    state.counters["available"] = group.is_available() ? 1 : 0;
+}
+
+BENCHMARK(BM_ReadTimestamp);
+BENCHMARK(BM_ReadPerfCounters);
+BENCHMARK(BM_ProfileZone<true>)->Name("BM_ProfileZone/Recording")->ThreadRange(1, 4);
+BENCHMARK(BM_ProfileZone<true, true>)->Name("BM_ProfileZone/PerfCounters");
+BENCHMARK(BM_ProfileZone<false>)->Name("BM_ProfileZone/Stopped");
+BENCHMARK(BM_ProfileZoneMacro);
+// NOLINTEND(*)
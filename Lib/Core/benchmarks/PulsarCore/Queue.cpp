@@ -0,0 +1,203 @@
+// NOLINTBEGIN(*)
+#include "PulsarCore/Sync/BlockingQueue.hpp"
+#include "PulsarCore/Sync/MpmcQueue.hpp"
+#include "PulsarCore/Sync/MpscQueue.hpp"
+#include "PulsarCore/Sync/SpscQueue.hpp"
+
+#include <atomic>
+#include <benchmark/benchmark.h>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+using namespace Pulsar;
+
+namespace {
+    constexpr u64   ITEMS    = 200'000;
+    constexpr usize CAPACITY = 1024;
+
+    /// What people reach for without a queue library
+    template<typename T> class LockedQueue {
+    public:
+        using value_type = T;
+
+        explicit LockedQueue(usize capacity) : m_Capacity(capacity) {
+        }
+
+        bool try_push(T value) {
+            std::lock_guard lock(m_Mutex);
+            if (m_Queue.size() == m_Capacity) {
+                return false;
+            }
+            m_Queue.push_back(std::move(value));
+            return true;
+        }
+
+        bool try_pop(T& out) {
+            std::lock_guard lock(m_Mutex);
+            if (m_Queue.empty()) {
+                return false;
+            }
+            out = std::move(m_Queue.front());
+            m_Queue.pop_front();
+            return true;
+        }
+
+    private:
+        usize         m_Capacity;
+        std::mutex    m_Mutex;
+        std::deque<T> m_Queue;
+    };
+
+    struct Message_t : MpscNode_t {
+        u64 m_Value = 0;
+    };
+
+    /// Moves ITEMS values from range(0) producers to range(1) consumers per iteration
+    template<typename Q> void BM_QueueThroughput(benchmark::State& state) {
+        const auto producers = static_cast<u32>(state.range(0));
+        const auto consumers = static_cast<u32>(state.range(1));
+        for (auto _ : state) {
+            Q                        queue(CAPACITY);
+            std::atomic<u64>         popped {0};
+            std::vector<std::thread> threads;
+            for (u32 p = 0; p < producers; p++) {
+                threads.emplace_back([&, p] {
+                    const u64 share = ITEMS / producers + (p < ITEMS % producers ? 1 : 0);
+                    for (u64 i = 0; i < share; i++) {
+                        while (!queue.try_push(u64(i))) {
+                            std::this_thread::yield();
+                        }
+                    }
+                });
+            }
+            for (u32 c = 0; c < consumers; c++) {
+                threads.emplace_back([&] {
+                    u64 value = 0;
+                    while (popped.load(std::memory_order_relaxed) < ITEMS) {
+                        if (queue.try_pop(value)) {
+                            popped.fetch_add(1, std::memory_order_relaxed);
+                            benchmark::DoNotOptimize(value);
+                        }
+                        else {
+                            std::this_thread::yield();
+                        }
+                    }
+                });
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+        }
+        state.SetItemsProcessed(i64(state.iterations() * ITEMS));
+    }
+
+    void BM_SpscBatchThroughput(benchmark::State& state) {
+        const auto batchSize = static_cast<usize>(state.range(0));
+        for (auto _ : state) {
+            SpscQueue<u64> queue(CAPACITY);
+            std::thread    producer([&] {
+                std::vector<u64> batch(batchSize);
+                u64              sent = 0;
+                while (sent < ITEMS) {
+                    const usize size = std::min<u64>(batchSize, ITEMS - sent);
+                    for (usize i = 0; i < size; i++) {
+                        batch[i] = sent + i;
+                    }
+                    const usize pushed = queue.push_batch(std::span(batch).first(size));
+                    sent += pushed;
+                    if (pushed == 0) {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+            std::vector<u64> out(batchSize);
+            u64              received = 0;
+            while (received < ITEMS) {
+                const usize count = queue.pop_batch(out);
+                benchmark::DoNotOptimize(out.data());
+                received += count;
+                if (count == 0) {
+                    std::this_thread::yield();
+                }
+            }
+            producer.join();
+        }
+        state.SetItemsProcessed(i64(state.iterations() * ITEMS));
+    }
+
+    void BM_MpscThroughput(benchmark::State& state) {
+        const auto             producers = static_cast<u32>(state.range(0));
+        std::vector<Message_t> messages(ITEMS);
+        for (auto _ : state) {
+            MpscQueue<Message_t>     queue;
+            std::vector<std::thread> threads;
+            for (u32 p = 0; p < producers; p++) {
+                threads.emplace_back([&, p] {
+                    for (u64 i = p; i < ITEMS; i += producers) {
+                        queue.push(messages[i]);
+                    }
+                });
+            }
+            u64 received = 0;
+            while (received < ITEMS) {
+                Message_t* message = queue.pop();
+                if (message != nullptr) {
+                    benchmark::DoNotOptimize(message->m_Value);
+                    received++;
+                }
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+        }
+        state.SetItemsProcessed(i64(state.iterations() * ITEMS));
+    }
+
+    /// One value to a second thread and back per iteration, half the time is the one-way latency
+    template<typename W> void BM_SpscPingPong(benchmark::State& state) {
+        if (std::is_same_v<W, SpinWait> && std::thread::hardware_concurrency() < 2) {
+            state.SkipWithError("SpinWait needs a second core");
+            return;
+        }
+        BlockingQueue<SpscQueue<u64>, W> ping(16);
+        BlockingQueue<SpscQueue<u64>, W> pong(16);
+        std::thread                      echo([&] {
+            while (true) {
+                const u64 value = ping.pop();
+                pong.push(value);
+                if (value == 0) {
+                    return;
+                }
+            }
+        });
+        u64 value = 1;
+        for (auto _ : state) {
+            ping.push(value);
+            benchmark::DoNotOptimize(pong.pop());
+            value++;
+        }
+        ping.push(0);
+        (void)pong.pop();
+        echo.join();
+        state.counters["one_way"] = benchmark::Counter(double(state.iterations()) * 2,
+                                                       benchmark::Counter::kIsRate |
+                                                           benchmark::Counter::kInvert);
+    }
+} // namespace
+
+// {producers, consumers}
+#define PULSAR_QUEUE_SHAPES \
+    ->Args({1, 1})->Args({1, 4})->Args({4, 1})->Args({4, 4})->UseRealTime()
+
+BENCHMARK(BM_QueueThroughput<SpscQueue<u64>>)->Args({1, 1})->UseRealTime();
+BENCHMARK(BM_QueueThroughput<MpmcQueue<u64>>) PULSAR_QUEUE_SHAPES;
+BENCHMARK(BM_QueueThroughput<LockedQueue<u64>>) PULSAR_QUEUE_SHAPES;
+BENCHMARK(BM_SpscBatchThroughput)->Arg(1)->Arg(16)->Arg(128)->UseRealTime();
+BENCHMARK(BM_MpscThroughput)->Arg(1)->Arg(2)->Arg(4)->UseRealTime();
+BENCHMARK(BM_SpscPingPong<SpinWait>)->UseRealTime();
+BENCHMARK(BM_SpscPingPong<YieldWait>)->UseRealTime();
+BENCHMARK(BM_SpscPingPong<FutexWait>)->UseRealTime();
+// NOLINTEND(*)
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "PulsarCore/GC/Pointer.hpp"
+
+#include <atomic>
+#include <exception>
+#include <utility>
+
+namespace Pulsar {
+    /// Thrown by `CancellationToken::throw_if_cancelled`, and so out of the `co_await` that
+    /// noticed the cancellation
+    class TaskCancelled : public std::exception {
+    public:
+        [[nodiscard]] const char* what() const noexcept override {
+            return "Task cancelled";
+        }
+    };
+
+    namespace internal {
+        struct CancellationState_t {
+            std::atomic<bool> m_Cancelled {false};
+        };
+    } // namespace internal
+
+    /// Observes a `CancellationSource`, cheap to copy and pass down to coroutines
+    /// # Usage
+    /// Cancellation is cooperative: a coroutine polls `is_cancelled` between steps, or hands the
+    /// token to an executor's `schedule` so resuming throws `TaskCancelled`. A default constructed
+    /// token is never cancelled.
+    class CancellationToken {
+    public:
+        CancellationToken() = default;
+
+        [[nodiscard]] bool is_cancelled() const {
+            return m_State != nullptr && m_State->m_Cancelled.load(std::memory_order_acquire);
+        }
+
+        void throw_if_cancelled() const {
+            if (is_cancelled()) [[unlikely]] {
+                throw TaskCancelled();
+            }
+        }
+
+    private:
+        friend class CancellationSource;
+
+        explicit CancellationToken(GC::Ref<internal::CancellationState_t> state)
+            : m_State(std::move(state)) {
+        }
+
+        GC::Ref<internal::CancellationState_t> m_State;
+    };
+
+    /// Requests the cancellation of the work holding one of its tokens
+    class CancellationSource {
+    public:
+        CancellationSource() : m_State(GC::make_ref<internal::CancellationState_t>()) {
+        }
+
+        /// Returns whether this call cancelled, false if it was cancelled before
+        bool cancel() {
+            return !m_State->m_Cancelled.exchange(true, std::memory_order_acq_rel);
+        }
+
+        [[nodiscard]] bool is_cancelled() const {
+            return m_State->m_Cancelled.load(std::memory_order_acquire);
+        }
+
+        [[nodiscard]] CancellationToken token() const {
+            return CancellationToken(m_State);
+        }
+
+    private:
+        GC::Ref<internal::CancellationState_t> m_State;
+    };
+} // namespace Pulsar
@@ -0,0 +1,81 @@
+#include "Executor.hpp"
+
+#include "PulsarCore/Util/Profiler.hpp"
+
+#include <algorithm>
+
+namespace Pulsar {
+    ThreadPoolExecutor::ThreadPoolExecutor(u32 threadCount)
+        : m_ThreadCount(
+              threadCount != 0 ? threadCount : std::max(std::thread::hardware_concurrency(), 1U)) {
+        m_Threads.reserve(m_ThreadCount);
+        for (u32 i = 0; i < m_ThreadCount; i++) {
+            m_Threads.emplace_back([this] { worker_main(); });
+        }
+    }
+
+    ThreadPoolExecutor::~ThreadPoolExecutor() {
+        {
+            std::lock_guard lock(m_Mutex);
+            m_Stopping = true;
+        }
+        m_Ready.notify_all();
+        for (auto& thread : m_Threads) {
+            thread.join();
+        }
+    }
+
+    void ThreadPoolExecutor::post(std::coroutine_handle<> handle) {
+        {
+            std::lock_guard lock(m_Mutex);
+            m_Queue.push_back(handle);
+        }
+        m_Ready.notify_one();
+    }
+
+    void ThreadPoolExecutor::worker_main() {
+        PULSAR_PROFILE_THREAD_NAME("Coroutine worker");
+        std::vector<std::coroutine_handle<>> batch;
+        while (true) {
+            bool more = false;
+            {
+                std::unique_lock lock(m_Mutex);
+                m_Ready.wait(lock, [this] { return m_Stopping || !m_Queue.empty(); });
+                if (m_Queue.empty()) {
+                    return;
+                }
+                // A fair share, so the other workers get the rest
+                const auto share = static_cast<std::ptrdiff_t>(
+                    std::max<usize>(m_Queue.size() / m_ThreadCount, 1));
+                batch.assign(m_Queue.begin(), m_Queue.begin() + share);
+                m_Queue.erase(m_Queue.begin(), m_Queue.begin() + share);
+                more = !m_Queue.empty();
+            }
+            if (more) {
+                m_Ready.notify_one();
+            }
+            for (const std::coroutine_handle<> handle : batch) {
+                handle.resume();
+            }
+            batch.clear();
+        }
+    }
+
+    void MainThreadExecutor::post(std::coroutine_handle<> handle) {
+        std::lock_guard lock(m_Mutex);
+        m_Queue.push_back(handle);
+    }
+
+    usize MainThreadExecutor::run_pending() {
+        {
+            std::lock_guard lock(m_Mutex);
+            std::swap(m_Running, m_Queue);
+        }
+        const usize count = m_Running.size();
+        for (const std::coroutine_handle<> handle : m_Running) {
+            handle.resume();
+        }
+        m_Running.clear();
+        return count;
+    }
+} // namespace Pulsar
@@ -0,0 +1,127 @@
+#pragma once
+
+#include "PulsarCore/Async/Cancellation.hpp"
+#include "PulsarCore/Async/Task.hpp"
+#include "PulsarCore/Types.hpp"
+
+#include <concepts>
+#include <condition_variable>
+#include <coroutine>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Pulsar {
+    /// Something that resumes coroutines handed to it, on threads of its choosing
+    template<typename E>
+    concept Executor = requires(E& executor, std::coroutine_handle<> handle) {
+        { executor.post(handle) } -> std::same_as<void>;
+    };
+
+    /// Suspends the awaiting coroutine and continues it on an executor, see `schedule`
+    template<typename E> class ScheduleAwaiter {
+    public:
+        ScheduleAwaiter(E& executor, CancellationToken token)
+            : m_Executor(&executor), m_Token(std::move(token)) {
+        }
+
+        [[nodiscard]] bool await_ready() const noexcept {
+            return false;
+        }
+
+        void await_suspend(std::coroutine_handle<> awaiting) {
+            m_Executor->post(awaiting);
+        }
+
+        /// Throws `TaskCancelled` when the token was cancelled while waiting for the executor
+        void await_resume() const {
+            m_Token.throw_if_cancelled();
+        }
+
+    private:
+        E*                m_Executor;
+        CancellationToken m_Token;
+    };
+
+    /// Resumes coroutines on a fixed set of worker threads
+    /// # Usage
+    /// `co_await pool.schedule()` continues the coroutine on a worker. Coroutines still queued
+    /// when the executor is destroyed are resumed before its threads exit.
+    /// # Performance
+    /// A single FIFO queue under a lock: workers take their share of the queue at once and resume
+    /// it without the lock. Meant for coarse work like loading and decoding assets, not for
+    /// fine-grained parallelism.
+    class ThreadPoolExecutor {
+    public:
+        /// 0 threads uses one per core
+        explicit ThreadPoolExecutor(u32 threadCount = 0);
+        ~ThreadPoolExecutor();
+
+        ThreadPoolExecutor(const ThreadPoolExecutor&)            = delete;
+        ThreadPoolExecutor& operator=(const ThreadPoolExecutor&) = delete;
+        ThreadPoolExecutor(ThreadPoolExecutor&&)                 = delete;
+        ThreadPoolExecutor& operator=(ThreadPoolExecutor&&)      = delete;
+
+        void post(std::coroutine_handle<> handle);
+
+        [[nodiscard]] ScheduleAwaiter<ThreadPoolExecutor> schedule(CancellationToken token = {}) {
+            return {*this, std::move(token)};
+        }
+
+        [[nodiscard]] u32 thread_count() const {
+            return m_ThreadCount;
+        }
+
+    private:
+        void worker_main();
+
+        u32                                 m_ThreadCount;
+        std::mutex                          m_Mutex;
+        std::condition_variable             m_Ready;
+        std::deque<std::coroutine_handle<>> m_Queue;
+        bool                                m_Stopping = false;
+        std::vector<std::thread>            m_Threads;
+    };
+
+    /// Resumes coroutines on the thread that calls `run_pending`, usually once per frame from the
+    /// main loop, for work that has to happen on the main thread (windowing, GPU uploads)
+    class MainThreadExecutor {
+    public:
+        MainThreadExecutor() = default;
+
+        MainThreadExecutor(const MainThreadExecutor&)            = delete;
+        MainThreadExecutor& operator=(const MainThreadExecutor&) = delete;
+        MainThreadExecutor(MainThreadExecutor&&)                 = delete;
+        MainThreadExecutor& operator=(MainThreadExecutor&&)      = delete;
+
+        /// Can be called from any thread
+        void post(std::coroutine_handle<> handle);
+
+        [[nodiscard]] ScheduleAwaiter<MainThreadExecutor> schedule(CancellationToken token = {}) {
+            return {*this, std::move(token)};
+        }
+
+        /// Resumes the coroutines queued so far and returns how many. Coroutines they queue in
+        /// turn wait for the next call.
+        usize run_pending();
+
+    private:
+        std::mutex                           m_Mutex;
+        std::vector<std::coroutine_handle<>> m_Queue;
+        std::vector<std::coroutine_handle<>> m_Running;
+    };
+
+    namespace internal {
+        template<Executor E> DetachedTask_t run_detached(E& executor, Task<void> task) {
+            co_await executor.schedule();
+            co_await task.when_ready();
+        }
+    } // namespace internal
+
+    /// Starts `task` on `executor` without waiting for it. The task owns itself until it
+    /// finishes; an exception escaping it is lost, so catch inside.
+    template<Executor E> void spawn(E& executor, Task<void> task) {
+        internal::run_detached(executor, std::move(task));
+    }
+} // namespace Pulsar
@@ -0,0 +1,122 @@
+#include "FramePool.hpp"
+
+#include "PulsarCore/GC/Allocators/Pool.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <mutex>
+#include <new>
+#include <utility>
+
+namespace Pulsar::internal {
+    namespace {
+        constexpr usize SMALLEST_CLASS = 64;
+        constexpr usize CLASS_COUNT    = 7;
+        constexpr usize LARGEST_CLASS  = SMALLEST_CLASS << (CLASS_COUNT - 1);
+        /// Blocks moved between a thread cache and the shared pool at once
+        constexpr usize BATCH = 32;
+
+        struct FreeBlock_t {
+            FreeBlock_t* m_Next;
+        };
+
+        struct SharedClass_t {
+            explicit SharedClass_t(usize blockSize)
+                : m_Pool(blockSize, BATCH * 2, GC::MemoryTag::Core) {
+            }
+
+            std::mutex        m_Mutex;
+            GC::PoolAllocator m_Pool;
+        };
+
+        template<usize... Index>
+        std::array<SharedClass_t, CLASS_COUNT> make_classes(std::index_sequence<Index...>) {
+            return {SharedClass_t(SMALLEST_CLASS << Index)...};
+        }
+
+        struct SharedPools_t {
+            std::array<SharedClass_t, CLASS_COUNT> m_Classes =
+                make_classes(std::make_index_sequence<CLASS_COUNT> {});
+        };
+
+        SharedPools_t& shared_pools() {
+            // Never destroyed: thread caches return their blocks when their thread exits, which
+            // can be after static destructors ran
+            static auto* pools = new SharedPools_t();
+            return *pools;
+        }
+
+        usize size_class(usize size) {
+            return static_cast<usize>(std::countr_zero(std::bit_ceil(size) / SMALLEST_CLASS));
+        }
+
+        struct ThreadCache_t {
+            ThreadCache_t()                                = default;
+            ThreadCache_t(const ThreadCache_t&)            = delete;
+            ThreadCache_t& operator=(const ThreadCache_t&) = delete;
+            ThreadCache_t(ThreadCache_t&&)                 = delete;
+            ThreadCache_t& operator=(ThreadCache_t&&)      = delete;
+
+            ~ThreadCache_t() {
+                for (usize i = 0; i < CLASS_COUNT; i++) {
+                    spill(i, m_Counts[i]);
+                }
+            }
+
+            /// Returns `count` cached blocks of class `index` to the shared pool
+            void spill(usize index, usize count) {
+                SharedClass_t&  shared = shared_pools().m_Classes[index];
+                std::lock_guard lock(shared.m_Mutex);
+                for (usize i = 0; i < count; i++) {
+                    FreeBlock_t* block = m_Free[index];
+                    m_Free[index]      = block->m_Next;
+                    shared.m_Pool.deallocate(block);
+                }
+                m_Counts[index] -= count;
+            }
+
+            void refill(usize index) {
+                SharedClass_t&  shared = shared_pools().m_Classes[index];
+                std::lock_guard lock(shared.m_Mutex);
+                for (usize i = 0; i < BATCH; i++) {
+                    m_Free[index] = ::new (shared.m_Pool.allocate()) FreeBlock_t {m_Free[index]};
+                }
+                m_Counts[index] += BATCH;
+            }
+
+            std::array<FreeBlock_t*, CLASS_COUNT> m_Free {};
+            std::array<usize, CLASS_COUNT>        m_Counts {};
+        };
+
+        thread_local ThreadCache_t t_Cache;
+    } // namespace
+
+    void* allocate_coroutine_frame(usize size) {
+        if (size > LARGEST_CLASS) [[unlikely]] {
+            return ::operator new(size);
+        }
+        const usize    index = size_class(std::max(size, SMALLEST_CLASS));
+        ThreadCache_t& cache = t_Cache;
+        if (cache.m_Free[index] == nullptr) [[unlikely]] {
+            cache.refill(index);
+        }
+        FreeBlock_t* block  = cache.m_Free[index];
+        cache.m_Free[index] = block->m_Next;
+        cache.m_Counts[index]--;
+        return block;
+    }
+
+    void deallocate_coroutine_frame(void* ptr, usize size) {
+        if (size > LARGEST_CLASS) [[unlikely]] {
+            ::operator delete(ptr, size);
+            return;
+        }
+        const usize    index = size_class(std::max(size, SMALLEST_CLASS));
+        ThreadCache_t& cache = t_Cache;
+        cache.m_Free[index]  = ::new (ptr) FreeBlock_t {cache.m_Free[index]};
+        if (++cache.m_Counts[index] > BATCH * 2) [[unlikely]] {
+            cache.spill(index, BATCH);
+        }
+    }
+} // namespace Pulsar::internal
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "PulsarCore/Types.hpp"
+
+namespace Pulsar::internal {
+    /// Allocates coroutine frames from size-classed `GC::PoolAllocator`s shared by all threads
+    /// # Performance
+    /// Each thread caches free blocks per size class, so allocating and freeing usually touch
+    /// no lock: the cache refills from and spills to the shared pools in batches. Frames may be
+    /// freed on another thread than the one that allocated them. Frames above the largest size
+    /// class come from the heap.
+    [[nodiscard]] void* allocate_coroutine_frame(usize size);
+    void                deallocate_coroutine_frame(void* ptr, usize size);
+
+    /// Shared by the promise types, routes the frame allocation of their coroutines to the pool
+    struct PooledPromise_t {
+        [[nodiscard]] static void* operator new(usize size) {
+            return allocate_coroutine_frame(size);
+        }
+
+        static void operator delete(void* ptr, usize size) {
+            deallocate_coroutine_frame(ptr, size);
+        }
+    };
+} // namespace Pulsar::internal
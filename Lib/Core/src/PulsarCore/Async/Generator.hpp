@@ -0,0 +1,131 @@
+#pragma once
+
+#include "PulsarCore/Async/FramePool.hpp"
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+namespace Pulsar {
+    /// A coroutine producing a sequence of values with `co_yield`, consumed as an input range
+    /// # Usage
+    /// The body runs on the consuming thread, up to the next `co_yield`, each time the iterator is
+    /// advanced. Yielded values are referenced, not copied, and stay valid until the next
+    /// increment. An exception escaping the body is rethrown from the increment.
+    /// # Performance
+    /// Advancing is a resume and a suspend, no allocation after the frame, which comes from the
+    /// coroutine frame pool.
+    template<typename T> class [[nodiscard]] Generator {
+    public:
+        struct promise_type : internal::PooledPromise_t {
+            [[nodiscard]] Generator get_return_object() noexcept {
+                return Generator(std::coroutine_handle<promise_type>::from_promise(*this));
+            }
+
+            [[nodiscard]] std::suspend_always initial_suspend() const noexcept {
+                return {};
+            }
+
+            [[nodiscard]] std::suspend_always final_suspend() const noexcept {
+                return {};
+            }
+
+            std::suspend_always yield_value(const T& value) noexcept {
+                m_Value = std::addressof(value);
+                return {};
+            }
+
+            void return_void() const noexcept {
+            }
+
+            void unhandled_exception() noexcept {
+                m_Exception = std::current_exception();
+            }
+
+            const T*           m_Value = nullptr;
+            std::exception_ptr m_Exception;
+        };
+
+        using Handle = std::coroutine_handle<promise_type>;
+
+        class Iterator {
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using difference_type   = std::ptrdiff_t;
+            using value_type        = T;
+
+            Iterator() = default;
+
+            explicit Iterator(Handle handle) : m_Handle(handle) {
+            }
+
+            const T& operator*() const {
+                return *m_Handle.promise().m_Value;
+            }
+
+            Iterator& operator++() {
+                advance(m_Handle);
+                return *this;
+            }
+
+            void operator++(int) {
+                ++*this;
+            }
+
+            bool operator==(std::default_sentinel_t /*unused*/) const {
+                return !m_Handle || m_Handle.done();
+            }
+
+        private:
+            Handle m_Handle;
+        };
+
+        Generator() = default;
+
+        explicit Generator(Handle handle) : m_Handle(handle) {
+        }
+
+        ~Generator() {
+            if (m_Handle) {
+                m_Handle.destroy();
+            }
+        }
+
+        Generator(const Generator&)            = delete;
+        Generator& operator=(const Generator&) = delete;
+
+        Generator(Generator&& other) noexcept : m_Handle(std::exchange(other.m_Handle, {})) {
+        }
+
+        Generator& operator=(Generator&& other) noexcept {
+            std::swap(m_Handle, other.m_Handle);
+            return *this;
+        }
+
+        /// Runs the body up to the first `co_yield`, call once
+        [[nodiscard]] Iterator begin() {
+            advance(m_Handle);
+            return Iterator(m_Handle);
+        }
+
+        [[nodiscard]] std::default_sentinel_t end() const noexcept {
+            return {};
+        }
+
+    private:
+        static void advance(Handle handle) {
+            if (!handle || handle.done()) {
+                return;
+            }
+            handle.resume();
+            if (handle.done() && handle.promise().m_Exception) [[unlikely]] {
+                std::rethrow_exception(std::exchange(handle.promise().m_Exception, {}));
+            }
+        }
+
+        Handle m_Handle;
+    };
+} // namespace Pulsar
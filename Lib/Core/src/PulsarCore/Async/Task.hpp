@@ -0,0 +1,236 @@
+#pragma once
+
+#include "PulsarCore/Async/FramePool.hpp"
+
+#include <condition_variable>
+#include <coroutine>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace Pulsar {
+    template<typename T = void> class Task;
+
+    namespace internal {
+        struct TaskPromiseBase_t : PooledPromise_t {
+            /// Continues the awaiting coroutine without growing the stack (symmetric transfer)
+            struct FinalAwaiter_t {
+                [[nodiscard]] bool await_ready() const noexcept {
+                    return false;
+                }
+
+                template<typename P>
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<P> handle) noexcept {
+                    const std::coroutine_handle<> continuation = handle.promise().m_Continuation;
+                    return continuation ? continuation : std::noop_coroutine();
+                }
+
+                void await_resume() const noexcept {
+                }
+            };
+
+            [[nodiscard]] std::suspend_always initial_suspend() const noexcept {
+                return {};
+            }
+
+            [[nodiscard]] FinalAwaiter_t final_suspend() const noexcept {
+                return {};
+            }
+
+            void unhandled_exception() noexcept {
+                m_Exception = std::current_exception();
+            }
+
+            void rethrow_if_failed() const {
+                if (m_Exception) [[unlikely]] {
+                    std::rethrow_exception(m_Exception);
+                }
+            }
+
+            std::coroutine_handle<> m_Continuation;
+            std::exception_ptr      m_Exception;
+        };
+
+        template<typename T> struct TaskPromise_t : TaskPromiseBase_t {
+            [[nodiscard]] Task<T> get_return_object() noexcept;
+
+            template<typename U> void return_value(U&& value) {
+                m_Value.emplace(std::forward<U>(value));
+            }
+
+            T take() {
+                rethrow_if_failed();
+                return std::move(*m_Value);
+            }
+
+            std::optional<T> m_Value;
+        };
+
+        template<> struct TaskPromise_t<void> : TaskPromiseBase_t {
+            [[nodiscard]] Task<void> get_return_object() noexcept;
+
+            void return_void() const noexcept {
+            }
+
+            void take() const {
+                rethrow_if_failed();
+            }
+        };
+
+        /// A coroutine nobody awaits: it starts right away and frees its frame when it finishes.
+        /// The building block of `spawn`, `sync_wait` and the combinators.
+        struct DetachedTask_t {
+            struct promise_type : PooledPromise_t {
+                [[nodiscard]] DetachedTask_t get_return_object() const noexcept {
+                    return {};
+                }
+
+                [[nodiscard]] std::suspend_never initial_suspend() const noexcept {
+                    return {};
+                }
+
+                [[nodiscard]] std::suspend_never final_suspend() const noexcept {
+                    return {};
+                }
+
+                void return_void() const noexcept {
+                }
+
+                /// Detached coroutines only await `Task::when_ready`, which never throws
+                [[noreturn]] void unhandled_exception() const noexcept {
+                    std::terminate();
+                }
+            };
+        };
+    } // namespace internal
+
+    /// A lazily started coroutine producing a `T`
+    /// # Usage
+    /// A task starts once it is `co_await`ed and the awaiting coroutine continues when it finishes,
+    /// with its result or its exception. Tasks are move-only and awaited at most once; to wait
+    /// from regular code use `sync_wait`, to run one in the background use `spawn`. Where a task
+    /// runs is decided by what it awaits, see `ThreadPoolExecutor::schedule`.
+    /// # Performance
+    /// Starting and finishing switch coroutines directly, so awaiting a task that completes
+    /// synchronously costs about two indirect calls. Frames come from the coroutine frame pool
+    /// instead of the heap, see `internal::allocate_coroutine_frame`.
+    template<typename T> class [[nodiscard]] Task {
+    public:
+        using promise_type = internal::TaskPromise_t<T>;
+        using Handle       = std::coroutine_handle<promise_type>;
+
+        Task() = default;
+
+        explicit Task(Handle handle) : m_Handle(handle) {
+        }
+
+        ~Task() {
+            if (m_Handle) {
+                m_Handle.destroy();
+            }
+        }
+
+        Task(const Task&)            = delete;
+        Task& operator=(const Task&) = delete;
+
+        Task(Task&& other) noexcept : m_Handle(std::exchange(other.m_Handle, {})) {
+        }
+
+        Task& operator=(Task&& other) noexcept {
+            std::swap(m_Handle, other.m_Handle);
+            return *this;
+        }
+
+        /// Whether the task finished, a task that was never awaited is not
+        [[nodiscard]] bool is_ready() const {
+            return !m_Handle || m_Handle.done();
+        }
+
+        /// Runs the task and returns its result
+        auto operator co_await() && noexcept {
+            struct Awaiter_t : StartAwaiter_t {
+                T await_resume() {
+                    return this->m_Handle.promise().take();
+                }
+            };
+            return Awaiter_t {{m_Handle}};
+        }
+
+        /// Runs the task without taking its result, which stays in the task
+        [[nodiscard]] auto when_ready() noexcept {
+            struct Awaiter_t : StartAwaiter_t {
+                void await_resume() const noexcept {
+                }
+            };
+            return Awaiter_t {{m_Handle}};
+        }
+
+        /// The result of a finished task, rethrowing its exception
+        [[nodiscard]] T take_result() {
+            return m_Handle.promise().take();
+        }
+
+    private:
+        struct StartAwaiter_t {
+            [[nodiscard]] bool await_ready() const noexcept {
+                return !m_Handle || m_Handle.done();
+            }
+
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+                m_Handle.promise().m_Continuation = awaiting;
+                return m_Handle;
+            }
+
+            Handle m_Handle;
+        };
+
+        Handle m_Handle;
+    };
+
+    namespace internal {
+        template<typename T> Task<T> TaskPromise_t<T>::get_return_object() noexcept {
+            return Task<T>(std::coroutine_handle<TaskPromise_t>::from_promise(*this));
+        }
+
+        inline Task<void> TaskPromise_t<void>::get_return_object() noexcept {
+            return Task<void>(std::coroutine_handle<TaskPromise_t>::from_promise(*this));
+        }
+
+        struct SyncWaitEvent_t {
+            void set() {
+                // Notified under the lock, the waiter may destroy the event as soon as it sees
+                // the flag
+                std::lock_guard lock(m_Mutex);
+                m_Done = true;
+                m_Condition.notify_one();
+            }
+
+            void wait() {
+                std::unique_lock lock(m_Mutex);
+                m_Condition.wait(lock, [this] { return m_Done; });
+            }
+
+            std::mutex              m_Mutex;
+            std::condition_variable m_Condition;
+            bool                    m_Done = false;
+        };
+
+        template<typename T>
+        DetachedTask_t signal_when_ready(Task<T>& task, SyncWaitEvent_t& event) {
+            co_await task.when_ready();
+            event.set();
+        }
+    } // namespace internal
+
+    /// Runs `task` and blocks the calling thread until it finishes, for code outside coroutines.
+    /// Never call it from a thread the task needs to make progress, like the main thread for a
+    /// task that awaits the `MainThreadExecutor`.
+    template<typename T> T sync_wait(Task<T> task) {
+        internal::SyncWaitEvent_t event;
+        internal::signal_when_ready(task, event);
+        event.wait();
+        return task.take_result();
+    }
+} // namespace Pulsar
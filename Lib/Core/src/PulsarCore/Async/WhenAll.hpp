@@ -0,0 +1,200 @@
+#pragma once
+
+#include "PulsarCore/Async/Cancellation.hpp"
+#include "PulsarCore/Async/Task.hpp"
+#include "PulsarCore/GC/Pointer.hpp"
+#include "PulsarCore/Types.hpp"
+#include "PulsarCore/Util/Macros.hpp"
+
+#include <atomic>
+#include <coroutine>
+#include <tuple>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+namespace Pulsar {
+    namespace internal {
+        /// Counts the tasks of a `when_all` down, one higher than the task count so no task can
+        /// resume the awaiting coroutine before all of them were started
+        struct WhenAllLatch_t {
+            explicit WhenAllLatch_t(usize count) : m_Remaining(count + 1) {
+            }
+
+            /// Whether this was the last arrival
+            bool arrive() {
+                return m_Remaining.fetch_sub(1, std::memory_order_acq_rel) == 1;
+            }
+
+            std::atomic<usize>      m_Remaining;
+            std::coroutine_handle<> m_Awaiting;
+        };
+
+        template<typename T> DetachedTask_t when_all_child(Task<T>& task, WhenAllLatch_t& latch) {
+            co_await task.when_ready();
+            if (latch.arrive()) {
+                latch.m_Awaiting.resume();
+            }
+        }
+
+        /// Calls `m_Start` to start every task, then suspends until all of them finished
+        template<typename F> struct WhenAllAwaiter_t {
+            [[nodiscard]] bool await_ready() const noexcept {
+                return false;
+            }
+
+            bool await_suspend(std::coroutine_handle<> awaiting) {
+                m_Latch.m_Awaiting = awaiting;
+                m_Start();
+                return !m_Latch.arrive();
+            }
+
+            void await_resume() const noexcept {
+            }
+
+            WhenAllLatch_t& m_Latch;
+            F               m_Start;
+        };
+
+        template<typename T>
+        using WhenAllValue_t = std::conditional_t<std::is_void_v<T>, std::monostate, T>;
+
+        template<typename T> WhenAllValue_t<T> take_when_all_value(Task<T>& task) {
+            if constexpr (std::is_void_v<T>) {
+                task.take_result();
+                return {};
+            }
+            else {
+                return task.take_result();
+            }
+        }
+
+        template<typename T> struct WhenAnyState_t {
+            WhenAnyState_t(std::vector<Task<T>> tasks, CancellationSource cancel)
+                : m_Tasks(std::move(tasks)), m_Cancel(std::move(cancel)) {
+            }
+
+            std::vector<Task<T>> m_Tasks;
+            CancellationSource   m_Cancel;
+            std::atomic<bool>    m_Decided {false};
+            usize                m_Winner = 0;
+            /// The winner and the starting loop both pass it, whoever is last resumes
+            std::atomic<u32>        m_Gate {2};
+            std::coroutine_handle<> m_Awaiting;
+        };
+
+        // The state is shared, the losers keep running after the awaiting coroutine went on
+        template<typename T>
+        DetachedTask_t when_any_child(GC::Ref<WhenAnyState_t<T>> state, usize index) {
+            co_await state->m_Tasks[index].when_ready();
+            if (state->m_Decided.exchange(true, std::memory_order_acq_rel)) {
+                co_return;
+            }
+            state->m_Winner = index;
+            state->m_Cancel.cancel();
+            if (state->m_Gate.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                state->m_Awaiting.resume();
+            }
+        }
+
+        template<typename T> struct WhenAnyAwaiter_t {
+            [[nodiscard]] bool await_ready() const noexcept {
+                return false;
+            }
+
+            bool await_suspend(std::coroutine_handle<> awaiting) {
+                m_State->m_Awaiting = awaiting;
+                for (usize i = 0; i < m_State->m_Tasks.size(); i++) {
+                    if (m_State->m_Decided.load(std::memory_order_acquire)) {
+                        break;
+                    }
+                    when_any_child(m_State, i);
+                }
+                return m_State->m_Gate.fetch_sub(1, std::memory_order_acq_rel) != 1;
+            }
+
+            void await_resume() const noexcept {
+            }
+
+            GC::Ref<WhenAnyState_t<T>>& m_State;
+        };
+    } // namespace internal
+
+    /// Runs all tasks concurrently and returns their results in order. Tasks start on the calling
+    /// thread and run concurrently as far as they hop to executors; the awaiting coroutine
+    /// continues on the thread that finished the last one. If any failed, the first exception in
+    /// order is rethrown once all finished.
+    template<typename T>
+        requires(!std::is_void_v<T>)
+    Task<std::vector<T>> when_all(std::vector<Task<T>> tasks) {
+        internal::WhenAllLatch_t latch(tasks.size());
+        const auto start = [&tasks, &latch] {
+            for (Task<T>& task : tasks) {
+                internal::when_all_child(task, latch);
+            }
+        };
+        co_await internal::WhenAllAwaiter_t<decltype(start)> {latch, start};
+
+        std::vector<T> results;
+        results.reserve(tasks.size());
+        for (Task<T>& task : tasks) {
+            results.push_back(task.take_result());
+        }
+        co_return results;
+    }
+
+    inline Task<void> when_all(std::vector<Task<void>> tasks) {
+        internal::WhenAllLatch_t latch(tasks.size());
+        const auto start = [&tasks, &latch] {
+            for (Task<void>& task : tasks) {
+                internal::when_all_child(task, latch);
+            }
+        };
+        co_await internal::WhenAllAwaiter_t<decltype(start)> {latch, start};
+        for (Task<void>& task : tasks) {
+            task.take_result();
+        }
+    }
+
+    /// The same for tasks of different types, `void` results become `std::monostate`
+    template<typename... Ts>
+    Task<std::tuple<internal::WhenAllValue_t<Ts>...>> when_all(Task<Ts>... tasks) {
+        internal::WhenAllLatch_t latch(sizeof...(Ts));
+        const auto start = [&tasks..., &latch] { (internal::when_all_child(tasks, latch), ...); };
+        co_await internal::WhenAllAwaiter_t<decltype(start)> {latch, start};
+        // Braced initialization evaluates in order, so the first exception in order wins
+        co_return std::tuple<internal::WhenAllValue_t<Ts>...> {
+            internal::take_when_all_value(tasks)...};
+    }
+
+    template<typename T> struct WhenAnyResult_t {
+        usize m_Index;
+        T     m_Value;
+    };
+
+    /// Runs the tasks concurrently until the first finishes, and returns its index and result (or
+    /// rethrows its exception). `cancel` is cancelled then so the others can stop early: hand them
+    /// its token. The others keep running in the background until they notice or finish, tasks
+    /// not started yet when one finished synchronously never start.
+    template<typename T>
+        requires(!std::is_void_v<T>)
+    Task<WhenAnyResult_t<T>> when_any(std::vector<Task<T>> tasks, CancellationSource cancel = {}) {
+        PULSAR_ASSERT(!tasks.empty(), "when_any needs at least one task");
+        auto state =
+            GC::make_ref<internal::WhenAnyState_t<T>>(std::move(tasks), std::move(cancel));
+        co_await internal::WhenAnyAwaiter_t<T> {state};
+        const usize index = state->m_Winner;
+        co_return WhenAnyResult_t<T> {index, state->m_Tasks[index].take_result()};
+    }
+
+    /// The same for tasks without a result, returns the index of the first to finish
+    inline Task<usize> when_any(std::vector<Task<void>> tasks, CancellationSource cancel = {}) {
+        PULSAR_ASSERT(!tasks.empty(), "when_any needs at least one task");
+        auto state =
+            GC::make_ref<internal::WhenAnyState_t<void>>(std::move(tasks), std::move(cancel));
+        co_await internal::WhenAnyAwaiter_t<void> {state};
+        const usize index = state->m_Winner;
+        state->m_Tasks[index].take_result();
+        co_return index;
+    }
+} // namespace Pulsar
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "PulsarCore/GC/MemoryTracker.hpp"
 #include "PulsarCore/GC/Pointer.hpp"
 #include "PulsarCore/Types.hpp"
 #include "PulsarCore/Util/Macros.hpp"
@@ -9,12 +10,15 @@ namespace Pulsar::GC {
         std::byte* m_Begin;
         usize      m_Size;
         usize      m_Allocated = 0;
+        /// Subsystem the allocations are reported under, see `MemoryTracker`
+        MemoryTag m_Tag;
 #ifdef PULSAR_DEBUG
         // Used for debugging, to ensure that we don't reset the arena when we still have allocations
         usize m_AllocationCount = 0;
 #endif
 
-        explicit ArenaRegion_t(usize size) : m_Begin(new std::byte[size]), m_Size(size) {
+        explicit ArenaRegion_t(usize size, MemoryTag tag)
+            : m_Begin(new std::byte[size]), m_Size(size), m_Tag(tag) {
             // TODO: for debugging, we might want to fill the memory with a known value to easily detect
             //       uninitialized memory
         }
@@ -41,8 +45,9 @@ namespace Pulsar::GC {
         using propagate_on_container_move_assignment = std::false_type;
         using is_always_equal                        = std::false_type;
 
-        explicit ArenaAllocator(usize size = 1024UL * 1024UL)
-            : m_Region(make_ref<ArenaRegion_t>(size)) {
+        explicit ArenaAllocator(
+            usize size = 1024UL * 1024UL, MemoryTag tag = MemoryTracker::current_tag())
+            : m_Region(make_ref<ArenaRegion_t>(size, tag)) {
         }
 
         ~ArenaAllocator() {
@@ -72,6 +77,9 @@ namespace Pulsar::GC {
 #ifdef PULSAR_DEBUG
             m_Region->m_AllocationCount++;
 #endif
+            if constexpr (MemoryTracker::COMPILED_IN) {
+                MemoryTracker::on_allocate(MemorySource::Arena, m_Region->m_Tag, size);
+            }
             return ptr;
         }
 
@@ -83,6 +91,10 @@ namespace Pulsar::GC {
 #ifdef PULSAR_DEBUG
             m_Region->m_AllocationCount--;
 #endif
+            if constexpr (MemoryTracker::COMPILED_IN) {
+                MemoryTracker::on_deallocate(
+                    MemorySource::Arena, m_Region->m_Tag, size * sizeof(T));
+            }
         }
 
         [[nodiscard]] usize max_size() const {
@@ -0,0 +1,116 @@
+#pragma once
+
+#include "PulsarCore/GC/MemoryTracker.hpp"
+#include "PulsarCore/Types.hpp"
+#include "PulsarCore/Util/Macros.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace Pulsar::GC {
+    /// A bump allocator for memory that lives until the end of the frame
+    /// # Usage
+    /// Nothing is freed individually and no destructors run, `reset` rewinds everything at once.
+    /// Use it for trivially destructible data or call the destructors yourself.
+    /// # Performance
+    /// Allocating is an aligned pointer bump. Blocks are kept across `reset`, so after the first
+    /// frames no more heap allocations happen. Blocks are charged to the tag given at construction.
+    /// # Thread safety
+    /// None, give each thread its own.
+    class FrameAllocator {
+    public:
+        explicit FrameAllocator(
+            usize blockSize = usize {64} * 1024, MemoryTag tag = MemoryTracker::current_tag())
+            : m_BlockSize(blockSize), m_Tag(tag) {
+        }
+
+        [[nodiscard]] void* allocate(usize size, usize alignment = alignof(std::max_align_t)) {
+            PULSAR_ASSERT(std::has_single_bit(alignment), "Alignment must be a power of two");
+            if (m_Current < m_Blocks.size()) {
+                if (void* ptr = bump(m_Blocks[m_Current], size, alignment)) {
+                    return ptr;
+                }
+            }
+            // Padded so the allocation fits whatever the alignment of the block start
+            next_block(size + alignment);
+            m_Offset = 0;
+            return bump(m_Blocks[m_Current], size, alignment);
+        }
+
+        /// Constructs a `T` in frame memory, its destructor is never called
+        template<typename T, typename... Args> [[nodiscard]] T* create(Args&&... args) {
+            return new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+        }
+
+        /// Makes all memory available again, everything allocated before is invalid
+        void reset() {
+            m_Current = 0;
+            m_Offset  = 0;
+            m_Used    = 0;
+        }
+
+        /// Bytes handed out since the last `reset`
+        [[nodiscard]] usize used_size() const {
+            return m_Used;
+        }
+
+        /// Bytes owned, including unused blocks
+        [[nodiscard]] usize reserved_size() const {
+            usize size = 0;
+            for (const auto& block : m_Blocks) {
+                size += block.m_Size;
+            }
+            return size;
+        }
+
+    private:
+        struct Block_t {
+            std::unique_ptr<std::byte[]> m_Memory; // NOLINT(*-avoid-c-arrays)
+            usize                        m_Size;
+        };
+
+        void* bump(Block_t& block, usize size, usize alignment) {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+            const auto base    = reinterpret_cast<std::uintptr_t>(block.m_Memory.get());
+            const auto aligned = (base + m_Offset + alignment - 1) & ~(alignment - 1);
+            const auto offset  = static_cast<usize>(aligned - base);
+            if (offset + size > block.m_Size) {
+                return nullptr;
+            }
+            m_Offset = offset + size;
+            m_Used += size;
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            return block.m_Memory.get() + offset;
+        }
+
+        /// Moves on to the next block that fits `size`, allocating one if none is left
+        void next_block(usize size) {
+            const usize start = m_Current < m_Blocks.size() ? m_Current + 1 : m_Current;
+            for (usize i = start; i < m_Blocks.size(); i++) {
+                if (m_Blocks[i].m_Size >= size) {
+                    std::swap(m_Blocks[start], m_Blocks[i]);
+                    m_Current = start;
+                    return;
+                }
+            }
+            const MemoryTagScope scope(m_Tag);
+            const usize          blockSize = std::max(m_BlockSize, size);
+            // NOLINTNEXTLINE(*-avoid-c-arrays)
+            m_Blocks.insert(m_Blocks.begin() + static_cast<std::ptrdiff_t>(start),
+                Block_t {std::make_unique_for_overwrite<std::byte[]>(blockSize), blockSize});
+            m_Current = start;
+        }
+
+        std::vector<Block_t> m_Blocks;
+        usize                m_Current = 0;
+        usize                m_Offset  = 0;
+        usize                m_Used    = 0;
+        usize                m_BlockSize;
+        MemoryTag            m_Tag;
+    };
+} // namespace Pulsar::GC
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "PulsarCore/GC/MemoryTracker.hpp"
+#include "PulsarCore/Types.hpp"
+#include "PulsarCore/Util/Macros.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <vector>
+
+namespace Pulsar::GC {
+    /// Hands out blocks of one fixed size, for many short-lived objects of the same size class
+    /// # Usage
+    /// Every block is `block_size()` bytes, aligned like `std::max_align_t`. Blocks go back to the
+    /// pool with `deallocate` and are only returned to the heap when the pool is destroyed.
+    /// # Performance
+    /// Allocating and freeing pop and push an intrusive free list. Memory is reserved in chunks of
+    /// `blocksPerChunk` blocks which are carved up as they are used, so a new chunk is never
+    /// touched all at once. Chunks are charged to the tag given at construction.
+    /// # Thread safety
+    /// None, give each thread its own or guard it with a lock.
+    class PoolAllocator {
+    public:
+        explicit PoolAllocator(usize blockSize, usize blocksPerChunk = 64,
+            MemoryTag tag = MemoryTracker::current_tag())
+            : m_BlockSize(round_up(std::max(blockSize, sizeof(FreeBlock_t)))),
+              m_BlocksPerChunk(std::max<usize>(blocksPerChunk, 1)), m_Tag(tag) {
+        }
+
+        [[nodiscard]] void* allocate() {
+            if (m_Free != nullptr) {
+                FreeBlock_t* block = m_Free;
+                m_Free             = block->m_Next;
+                m_Used++;
+                return block;
+            }
+            if (m_CarveLeft == 0) {
+                next_chunk();
+            }
+            void* block = m_Carve;
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            m_Carve += m_BlockSize;
+            m_CarveLeft--;
+            m_Used++;
+            return block;
+        }
+
+        /// Returns a block from `allocate` of this pool
+        void deallocate(void* ptr) {
+            PULSAR_ASSERT(ptr != nullptr, "Deallocating a null block");
+            auto* block = ::new (ptr) FreeBlock_t {m_Free};
+            m_Free      = block;
+            m_Used--;
+        }
+
+        [[nodiscard]] usize block_size() const {
+            return m_BlockSize;
+        }
+
+        /// Blocks handed out and not yet returned
+        [[nodiscard]] usize used_count() const {
+            return m_Used;
+        }
+
+        /// Bytes owned by the pool, used or not
+        [[nodiscard]] usize reserved_size() const {
+            return m_Chunks.size() * m_BlocksPerChunk * m_BlockSize;
+        }
+
+    private:
+        struct FreeBlock_t {
+            FreeBlock_t* m_Next;
+        };
+
+        static constexpr usize round_up(usize size) {
+            constexpr usize ALIGNMENT = alignof(std::max_align_t);
+            return (size + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+        }
+
+        void next_chunk() {
+            const MemoryTagScope scope(m_Tag);
+            // NOLINTNEXTLINE(*-avoid-c-arrays)
+            m_Chunks.push_back(std::make_unique_for_overwrite<std::byte[]>(
+                m_BlocksPerChunk * m_BlockSize));
+            m_Carve     = m_Chunks.back().get();
+            m_CarveLeft = m_BlocksPerChunk;
+        }
+
+        std::vector<std::unique_ptr<std::byte[]>> m_Chunks; // NOLINT(*-avoid-c-arrays)
+        FreeBlock_t*                              m_Free      = nullptr;
+        /// The unused rest of the newest chunk
+        std::byte* m_Carve     = nullptr;
+        usize      m_CarveLeft = 0;
+        usize      m_Used      = 0;
+        usize      m_BlockSize;
+        usize      m_BlocksPerChunk;
+        MemoryTag  m_Tag;
+    };
+} // namespace Pulsar::GC
@@ -0,0 +1,670 @@
+#include "MemoryTracker.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstdlib>
+#include <fmt/format.h>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <new>
+#include <tuple>
+#include <utility>
+
+#if __has_include(<execinfo.h>)
+    #include <execinfo.h>
+    #define PULSAR_HAS_BACKTRACE
+#endif
+
+namespace Pulsar::GC {
+    namespace {
+        constexpr usize MAX_THREADS      = 128;
+        constexpr usize STACK_TABLE_SIZE = 1024;
+        constexpr usize MAX_STACK_DEPTH  = 16;
+        // sample_stack and record_allocate
+        constexpr usize SKIPPED_FRAMES = 2;
+
+        template<typename T>
+        using PerSourceTag_t = std::array<std::array<T, MEMORY_TAG_COUNT>, MEMORY_SOURCE_COUNT>;
+
+        struct Counters_t {
+            std::atomic<u64>                                       m_Allocations {0};
+            std::atomic<u64>                                       m_Frees {0};
+            std::atomic<u64>                                       m_AllocatedBytes {0};
+            std::atomic<u64>                                       m_FreedBytes {0};
+            std::array<std::atomic<u64>, MEMORY_HISTOGRAM_BUCKETS> m_SizeHistogram {};
+        };
+
+        /// Counters of one thread. Only the owner writes them, so plain loads and stores do and
+        /// the snapshot reads them with relaxed loads.
+        struct ThreadSlot_t {
+            std::atomic<bool>          m_InUse {false};
+            PerSourceTag_t<Counters_t> m_Counters;
+            /// Live bytes not yet published to the shared peak
+            PerSourceTag_t<i64> m_PendingBytes {};
+            i64                 m_BytesUntilSample = 0;
+        };
+
+        struct StackEntry_t {
+            /// 0 while the entry is empty
+            std::atomic<u64>                   m_Hash {0};
+            MemorySource                       m_Source = MemorySource::Heap;
+            MemoryTag                          m_Tag    = MemoryTag::General;
+            u32                                m_Depth  = 0;
+            std::array<void*, MAX_STACK_DEPTH> m_Frames {};
+            std::atomic<u64>                   m_Samples {0};
+            std::atomic<u64>                   m_AllocatedBytes {0};
+            std::atomic<i64>                   m_LiveBytes {0};
+        };
+
+        /// Constant initialized, the heap hook may run before any dynamic initializer
+        struct Tracker_t {
+            /// Guards slot claims, stack insertion, frames and snapshots. Never taken on the path
+            /// of a deallocation, which may happen while a snapshot holds it.
+            std::mutex                            m_Mutex;
+            std::array<ThreadSlot_t, MAX_THREADS> m_Slots;
+            /// Counters of exited threads and of threads that found no free slot
+            PerSourceTag_t<Counters_t>                 m_Retired;
+            PerSourceTag_t<std::atomic<i64>>           m_PublishedBytes {};
+            PerSourceTag_t<std::atomic<u64>>           m_PeakBytes {};
+            std::array<StackEntry_t, STACK_TABLE_SIZE> m_Stacks;
+            std::atomic<usize>                         m_SampleInterval {0};
+            u64                                        m_Frame                = 0;
+            u64                                        m_LastFrameAllocations = 0;
+            std::array<u64, MEMORY_HISTOGRAM_BUCKETS>  m_FrameAllocations {};
+        };
+
+        // NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+        constinit Tracker_t g_Tracker;
+
+        constinit thread_local ThreadSlot_t* t_Slot = nullptr;
+        /// Set once the thread gave its slot back, later reports go to the retired counters
+        constinit thread_local bool t_Detached = false;
+        /// Set while the tracker itself allocates, those allocations are not tracked
+        constinit thread_local bool t_InTracker = false;
+        // NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
+
+        struct InTrackerScope_t {
+            InTrackerScope_t() : m_Previous(std::exchange(t_InTracker, true)) {
+            }
+
+            ~InTrackerScope_t() {
+                t_InTracker = m_Previous;
+            }
+
+            InTrackerScope_t(const InTrackerScope_t&)            = delete;
+            InTrackerScope_t& operator=(const InTrackerScope_t&) = delete;
+            InTrackerScope_t(InTrackerScope_t&&)                 = delete;
+            InTrackerScope_t& operator=(InTrackerScope_t&&)      = delete;
+
+            bool m_Previous;
+        };
+
+        usize size_bucket(u64 value) {
+            return std::min<usize>(std::bit_width(value), MEMORY_HISTOGRAM_BUCKETS - 1);
+        }
+
+        /// Single writer increment, no read-modify-write needed
+        void bump(std::atomic<u64>& counter, u64 value) {
+            counter.store(counter.load(std::memory_order_relaxed) + value,
+                          std::memory_order_relaxed);
+        }
+
+        void add(std::atomic<u64>& counter, u64 value) {
+            counter.fetch_add(value, std::memory_order_relaxed);
+        }
+
+        void publish(usize source, usize tag, i64 bytes) {
+            const i64 live = g_Tracker.m_PublishedBytes[source][tag].fetch_add(bytes) + bytes;
+            auto&     peak = g_Tracker.m_PeakBytes[source][tag];
+            u64       seen = peak.load(std::memory_order_relaxed);
+            while (live > 0 && static_cast<u64>(live) > seen
+                   && !peak.compare_exchange_weak(seen, static_cast<u64>(live))) {
+            }
+        }
+
+        /// Moves the counters of an exiting thread to the retired ones
+        struct SlotOwner_t {
+            SlotOwner_t()                              = default;
+            SlotOwner_t(const SlotOwner_t&)            = delete;
+            SlotOwner_t& operator=(const SlotOwner_t&) = delete;
+            SlotOwner_t(SlotOwner_t&&)                 = delete;
+            SlotOwner_t& operator=(SlotOwner_t&&)      = delete;
+            ~SlotOwner_t() {
+                ThreadSlot_t* slot = std::exchange(t_Slot, nullptr);
+                t_Detached         = true;
+                if (slot == nullptr) {
+                    return;
+                }
+                for (usize s = 0; s < MEMORY_SOURCE_COUNT; s++) {
+                    for (usize t = 0; t < MEMORY_TAG_COUNT; t++) {
+                        Counters_t& from = slot->m_Counters[s][t];
+                        Counters_t& to   = g_Tracker.m_Retired[s][t];
+                        add(to.m_Allocations, from.m_Allocations.exchange(0));
+                        add(to.m_Frees, from.m_Frees.exchange(0));
+                        add(to.m_AllocatedBytes, from.m_AllocatedBytes.exchange(0));
+                        add(to.m_FreedBytes, from.m_FreedBytes.exchange(0));
+                        for (usize b = 0; b < MEMORY_HISTOGRAM_BUCKETS; b++) {
+                            add(to.m_SizeHistogram[b], from.m_SizeHistogram[b].exchange(0));
+                        }
+                        publish(s, t, std::exchange(slot->m_PendingBytes[s][t], 0));
+                    }
+                }
+                std::lock_guard lock(g_Tracker.m_Mutex);
+                slot->m_InUse.store(false, std::memory_order_release);
+            }
+        };
+
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+        thread_local SlotOwner_t g_SlotOwner;
+
+        ThreadSlot_t* claim_slot() {
+            const InTrackerScope_t inTracker;
+            std::lock_guard        lock(g_Tracker.m_Mutex);
+            for (auto& slot : g_Tracker.m_Slots) {
+                if (!slot.m_InUse.load(std::memory_order_relaxed)) {
+                    slot.m_InUse.store(true, std::memory_order_relaxed);
+                    slot.m_BytesUntilSample = static_cast<i64>(
+                        g_Tracker.m_SampleInterval.load(std::memory_order_relaxed));
+                    t_Slot = &slot;
+                    // Touching the owner registers its destructor for this thread
+                    PULSAR_UNUSED(&g_SlotOwner);
+                    return &slot;
+                }
+            }
+            return nullptr;
+        }
+
+        u32 sample_stack(MemorySource source, MemoryTag tag, usize size) {
+#ifdef PULSAR_HAS_BACKTRACE
+            const InTrackerScope_t                             inTracker;
+            std::array<void*, MAX_STACK_DEPTH + SKIPPED_FRAMES> frames {};
+            const int captured = backtrace(frames.data(), static_cast<int>(frames.size()));
+            const auto depth   = static_cast<u32>(std::max<int>(captured - SKIPPED_FRAMES, 0));
+            const auto first   = frames.begin() + SKIPPED_FRAMES;
+
+            // FNV-1a over the frames and the owner
+            u64 hash = 0xcbf29ce484222325ULL
+                     ^ (static_cast<u64>(source) << 8 | static_cast<u64>(tag));
+            for (u32 i = 0; i < depth; i++) {
+                hash = (hash ^ reinterpret_cast<usize>(first[i])) * 0x100000001b3ULL;
+            }
+            hash = hash == 0 ? 1 : hash;
+
+            std::lock_guard lock(g_Tracker.m_Mutex);
+            for (usize probe = 0; probe < STACK_TABLE_SIZE; probe++) {
+                const usize   index = (hash + probe) % STACK_TABLE_SIZE;
+                StackEntry_t& entry = g_Tracker.m_Stacks[index];
+                const u64     found = entry.m_Hash.load(std::memory_order_relaxed);
+                if (found == 0) {
+                    entry.m_Source = source;
+                    entry.m_Tag    = tag;
+                    entry.m_Depth  = depth;
+                    std::copy_n(first, depth, entry.m_Frames.begin());
+                    entry.m_Hash.store(hash, std::memory_order_release);
+                }
+                else if (found != hash || entry.m_Source != source || entry.m_Tag != tag
+                         || entry.m_Depth != depth
+                         || !std::equal(first, first + depth, entry.m_Frames.begin())) {
+                    continue;
+                }
+                add(entry.m_Samples, 1);
+                add(entry.m_AllocatedBytes, size);
+                entry.m_LiveBytes.fetch_add(static_cast<i64>(size), std::memory_order_relaxed);
+                return static_cast<u32>(index + 1);
+            }
+#else
+            PULSAR_UNUSED(source, tag, size);
+#endif
+            return 0;
+        }
+
+        void sum_counters(const Counters_t& counters, MemoryStats_t& stats) {
+            stats.m_Allocations += counters.m_Allocations.load(std::memory_order_relaxed);
+            stats.m_Frees += counters.m_Frees.load(std::memory_order_relaxed);
+            stats.m_AllocatedBytes += counters.m_AllocatedBytes.load(std::memory_order_relaxed);
+            stats.m_FreedBytes += counters.m_FreedBytes.load(std::memory_order_relaxed);
+            for (usize b = 0; b < MEMORY_HISTOGRAM_BUCKETS; b++) {
+                stats.m_SizeHistogram[b] +=
+                    counters.m_SizeHistogram[b].load(std::memory_order_relaxed);
+            }
+        }
+
+        /// Total allocations so far, the caller holds the mutex
+        u64 total_allocations() {
+            u64 total = 0;
+            for (usize s = 0; s < MEMORY_SOURCE_COUNT; s++) {
+                for (usize t = 0; t < MEMORY_TAG_COUNT; t++) {
+                    total += g_Tracker.m_Retired[s][t].m_Allocations.load();
+                    for (const auto& slot : g_Tracker.m_Slots) {
+                        total += slot.m_Counters[s][t].m_Allocations.load();
+                    }
+                }
+            }
+            return total;
+        }
+
+        void append_escaped(std::string& out, std::string_view text) {
+            for (const char character : text) {
+                if (character == '"' || character == '\\') {
+                    out += '\\';
+                    out += character;
+                }
+                else if (static_cast<unsigned char>(character) < 0x20) {
+                    fmt::format_to(std::back_inserter(out), "\\u{:04x}", character);
+                }
+                else {
+                    out += character;
+                }
+            }
+        }
+
+        void append_array(
+            std::string& out, const std::array<u64, MEMORY_HISTOGRAM_BUCKETS>& values) {
+            out += '[';
+            for (usize i = 0; i < values.size(); i++) {
+                fmt::format_to(std::back_inserter(out), "{}{}", i == 0 ? "" : ",", values[i]);
+            }
+            out += ']';
+        }
+    } // namespace
+
+    MemoryStats_t MemorySnapshot_t::total(MemorySource source) const {
+        MemoryStats_t total;
+        for (const MemoryStats_t& stats : m_Stats[static_cast<usize>(source)]) {
+            total.m_Allocations += stats.m_Allocations;
+            total.m_Frees += stats.m_Frees;
+            total.m_AllocatedBytes += stats.m_AllocatedBytes;
+            total.m_FreedBytes += stats.m_FreedBytes;
+            total.m_PeakBytes += stats.m_PeakBytes;
+            for (usize b = 0; b < MEMORY_HISTOGRAM_BUCKETS; b++) {
+                total.m_SizeHistogram[b] += stats.m_SizeHistogram[b];
+            }
+        }
+        return total;
+    }
+
+    MemorySnapshot_t diff(const MemorySnapshot_t& before, const MemorySnapshot_t& after) {
+        MemorySnapshot_t result;
+        result.m_Frame = after.m_Frame - before.m_Frame;
+        for (usize s = 0; s < MEMORY_SOURCE_COUNT; s++) {
+            for (usize t = 0; t < MEMORY_TAG_COUNT; t++) {
+                const MemoryStats_t& from  = before.m_Stats[s][t];
+                const MemoryStats_t& to    = after.m_Stats[s][t];
+                MemoryStats_t&       delta = result.m_Stats[s][t];
+                delta.m_Allocations        = to.m_Allocations - from.m_Allocations;
+                delta.m_Frees              = to.m_Frees - from.m_Frees;
+                delta.m_AllocatedBytes     = to.m_AllocatedBytes - from.m_AllocatedBytes;
+                delta.m_FreedBytes         = to.m_FreedBytes - from.m_FreedBytes;
+                delta.m_PeakBytes          = to.m_PeakBytes;
+                for (usize b = 0; b < MEMORY_HISTOGRAM_BUCKETS; b++) {
+                    delta.m_SizeHistogram[b] = to.m_SizeHistogram[b] - from.m_SizeHistogram[b];
+                }
+            }
+        }
+        for (usize b = 0; b < MEMORY_HISTOGRAM_BUCKETS; b++) {
+            result.m_FrameAllocations[b] =
+                after.m_FrameAllocations[b] - before.m_FrameAllocations[b];
+        }
+
+        using Key_t = std::tuple<MemorySource, MemoryTag, const std::vector<usize>&>;
+        std::map<Key_t, const MemoryStackStats_t*> previous;
+        for (const auto& stack : before.m_Stacks) {
+            previous.emplace(Key_t {stack.m_Source, stack.m_Tag, stack.m_Frames}, &stack);
+        }
+        for (const auto& stack : after.m_Stacks) {
+            MemoryStackStats_t delta = stack;
+            const auto found = previous.find(Key_t {stack.m_Source, stack.m_Tag, stack.m_Frames});
+            if (found != previous.end()) {
+                delta.m_Samples -= found->second->m_Samples;
+                delta.m_AllocatedBytes -= found->second->m_AllocatedBytes;
+                delta.m_LiveBytes -= found->second->m_LiveBytes;
+            }
+            if (delta.m_Samples != 0 || delta.m_LiveBytes != 0) {
+                result.m_Stacks.push_back(std::move(delta));
+            }
+        }
+        return result;
+    }
+
+    void MemoryTracker::enable(const MemoryTrackerConfig_t& config) {
+        g_Tracker.m_SampleInterval.store(config.m_SampleInterval, std::memory_order_relaxed);
+        s_Enabled.store(true, std::memory_order_relaxed);
+    }
+
+    void MemoryTracker::disable() {
+        s_Enabled.store(false, std::memory_order_relaxed);
+    }
+
+    u32 MemoryTracker::record_allocate(MemorySource source, MemoryTag tag, usize size) {
+        const auto    s    = static_cast<usize>(source);
+        const auto    t    = static_cast<usize>(tag);
+        ThreadSlot_t* slot = t_Slot;
+        if (slot == nullptr && !t_Detached) [[unlikely]] {
+            slot = claim_slot();
+        }
+        if (slot == nullptr) [[unlikely]] {
+            Counters_t& counters = g_Tracker.m_Retired[s][t];
+            add(counters.m_Allocations, 1);
+            add(counters.m_AllocatedBytes, size);
+            add(counters.m_SizeHistogram[size_bucket(size)], 1);
+            publish(s, t, static_cast<i64>(size));
+            return 0;
+        }
+
+        Counters_t& counters = slot->m_Counters[s][t];
+        bump(counters.m_Allocations, 1);
+        bump(counters.m_AllocatedBytes, size);
+        bump(counters.m_SizeHistogram[size_bucket(size)], 1);
+        i64& pending = slot->m_PendingBytes[s][t];
+        pending += static_cast<i64>(size);
+        if (pending >= static_cast<i64>(PEAK_GRANULARITY)) {
+            publish(s, t, std::exchange(pending, 0));
+        }
+
+        const usize interval = g_Tracker.m_SampleInterval.load(std::memory_order_relaxed);
+        if (interval != 0) {
+            // Clamped, so a shorter interval from a later `enable` takes effect right away
+            slot->m_BytesUntilSample =
+                std::min(slot->m_BytesUntilSample, static_cast<i64>(interval))
+                - static_cast<i64>(size);
+            if (slot->m_BytesUntilSample <= 0) [[unlikely]] {
+                slot->m_BytesUntilSample = static_cast<i64>(interval);
+                return sample_stack(source, tag, size);
+            }
+        }
+        return 0;
+    }
+
+    void MemoryTracker::record_deallocate(
+        MemorySource source, MemoryTag tag, usize size, u32 stackId) {
+        const auto s = static_cast<usize>(source);
+        const auto t = static_cast<usize>(tag);
+        if (stackId != 0) {
+            g_Tracker.m_Stacks[stackId - 1].m_LiveBytes.fetch_sub(
+                static_cast<i64>(size), std::memory_order_relaxed);
+        }
+        // Never claims a slot, see `Tracker_t::m_Mutex`
+        ThreadSlot_t* slot = t_Slot;
+        if (slot == nullptr) [[unlikely]] {
+            Counters_t& counters = g_Tracker.m_Retired[s][t];
+            add(counters.m_Frees, 1);
+            add(counters.m_FreedBytes, size);
+            publish(s, t, -static_cast<i64>(size));
+            return;
+        }
+
+        Counters_t& counters = slot->m_Counters[s][t];
+        bump(counters.m_Frees, 1);
+        bump(counters.m_FreedBytes, size);
+        i64& pending = slot->m_PendingBytes[s][t];
+        pending -= static_cast<i64>(size);
+        if (pending <= -static_cast<i64>(PEAK_GRANULARITY)) {
+            publish(s, t, std::exchange(pending, 0));
+        }
+    }
+
+    void MemoryTracker::end_frame() {
+        const InTrackerScope_t inTracker;
+        std::lock_guard        lock(g_Tracker.m_Mutex);
+        const u64              allocations = total_allocations();
+        g_Tracker.m_FrameAllocations[size_bucket(allocations - g_Tracker.m_LastFrameAllocations)]++;
+        g_Tracker.m_LastFrameAllocations = allocations;
+        g_Tracker.m_Frame++;
+    }
+
+    MemorySnapshot_t MemoryTracker::snapshot() {
+        const InTrackerScope_t inTracker;
+        MemorySnapshot_t       snapshot;
+        std::lock_guard        lock(g_Tracker.m_Mutex);
+        snapshot.m_Frame            = g_Tracker.m_Frame;
+        snapshot.m_FrameAllocations = g_Tracker.m_FrameAllocations;
+        for (usize s = 0; s < MEMORY_SOURCE_COUNT; s++) {
+            for (usize t = 0; t < MEMORY_TAG_COUNT; t++) {
+                MemoryStats_t& stats = snapshot.m_Stats[s][t];
+                sum_counters(g_Tracker.m_Retired[s][t], stats);
+                for (const auto& slot : g_Tracker.m_Slots) {
+                    sum_counters(slot.m_Counters[s][t], stats);
+                }
+                const i64 live    = stats.live_bytes();
+                const u64 peak    = g_Tracker.m_PeakBytes[s][t].load(std::memory_order_relaxed);
+                stats.m_PeakBytes = std::max(peak, live > 0 ? static_cast<u64>(live) : 0);
+            }
+        }
+        for (const auto& entry : g_Tracker.m_Stacks) {
+            if (entry.m_Hash.load(std::memory_order_acquire) == 0) {
+                continue;
+            }
+            MemoryStackStats_t& stack = snapshot.m_Stacks.emplace_back();
+            stack.m_Source            = entry.m_Source;
+            stack.m_Tag               = entry.m_Tag;
+            for (u32 i = 0; i < entry.m_Depth; i++) {
+                stack.m_Frames.push_back(reinterpret_cast<usize>(entry.m_Frames[i]));
+            }
+            stack.m_Samples        = entry.m_Samples.load(std::memory_order_relaxed);
+            stack.m_AllocatedBytes = entry.m_AllocatedBytes.load(std::memory_order_relaxed);
+            stack.m_LiveBytes      = entry.m_LiveBytes.load(std::memory_order_relaxed);
+        }
+        return snapshot;
+    }
+
+    std::string MemoryTracker::to_json(const MemorySnapshot_t& snapshot) {
+        const InTrackerScope_t inTracker;
+        std::string            out = fmt::format(R"({{"frame":{},"stats":[)", snapshot.m_Frame);
+        bool                   first = true;
+        for (usize s = 0; s < MEMORY_SOURCE_COUNT; s++) {
+            for (usize t = 0; t < MEMORY_TAG_COUNT; t++) {
+                const MemoryStats_t& stats = snapshot.m_Stats[s][t];
+                if (stats.m_Allocations == 0 && stats.m_Frees == 0) {
+                    continue;
+                }
+                fmt::format_to(std::back_inserter(out),
+                               R"({}{{"source":"{}","tag":"{}","allocations":{},"frees":{},)"
+                               R"("allocated_bytes":{},"freed_bytes":{},"live_bytes":{},)"
+                               R"("peak_bytes":{},"size_histogram":)",
+                               first ? "" : ",", to_string(static_cast<MemorySource>(s)),
+                               to_string(static_cast<MemoryTag>(t)), stats.m_Allocations,
+                               stats.m_Frees, stats.m_AllocatedBytes, stats.m_FreedBytes,
+                               stats.live_bytes(), stats.m_PeakBytes);
+                append_array(out, stats.m_SizeHistogram);
+                out += '}';
+                first = false;
+            }
+        }
+        out += R"(],"frame_allocations":)";
+        append_array(out, snapshot.m_FrameAllocations);
+        out += R"(,"stacks":[)";
+        for (usize i = 0; i < snapshot.m_Stacks.size(); i++) {
+            const MemoryStackStats_t& stack = snapshot.m_Stacks[i];
+            fmt::format_to(std::back_inserter(out),
+                           R"({}{{"source":"{}","tag":"{}","samples":{},"allocated_bytes":{},)"
+                           R"("live_bytes":{},"frames":[)",
+                           i == 0 ? "" : ",", to_string(stack.m_Source), to_string(stack.m_Tag),
+                           stack.m_Samples, stack.m_AllocatedBytes, stack.m_LiveBytes);
+#ifdef PULSAR_HAS_BACKTRACE
+            std::vector<void*> frames;
+            for (const usize frame : stack.m_Frames) {
+                frames.push_back(reinterpret_cast<void*>(frame));
+            }
+            char** symbols = backtrace_symbols(frames.data(), static_cast<int>(frames.size()));
+#endif
+            for (usize f = 0; f < stack.m_Frames.size(); f++) {
+                out += f == 0 ? "\"" : ",\"";
+#ifdef PULSAR_HAS_BACKTRACE
+                if (symbols != nullptr) {
+                    append_escaped(out, symbols[f]);
+                }
+                else
+#endif
+                {
+                    fmt::format_to(std::back_inserter(out), "{:#x}", stack.m_Frames[f]);
+                }
+                out += '"';
+            }
+#ifdef PULSAR_HAS_BACKTRACE
+            std::free(static_cast<void*>(symbols)); // NOLINT(*-no-malloc, *-owning-memory)
+#endif
+            out += "]}";
+        }
+        out += "]}\n";
+        return out;
+    }
+} // namespace Pulsar::GC
+
+#ifdef PULSAR_MEMORY_TRACKING
+// The replaceable global allocation functions. Every block carries a header with what is needed
+// to report its deallocation, and whether its allocation was reported at all: memory allocated
+// while the tracker was disabled, or by the tracker itself, is not.
+// NOLINTBEGIN(*-no-malloc, *-owning-memory, *-reinterpret-cast, *-pointer-arithmetic)
+namespace {
+    using namespace Pulsar;
+
+    struct alignas(16) AllocationHeader_t {
+        u64           m_Size;
+        u32           m_StackId;
+        /// log2 of the distance from the block to the user pointer, a power of two. A shift
+        /// instead of the distance so alignments of 64 KiB and more fit.
+        u8            m_OffsetShift;
+        GC::MemoryTag m_Tag;
+        bool          m_Tracked;
+    };
+    static_assert(sizeof(AllocationHeader_t) == 16);
+
+    void* tracked_new(usize size, usize alignment, bool noThrow) {
+        alignment          = std::max(alignment, alignof(AllocationHeader_t));
+        const usize offset = std::max(sizeof(AllocationHeader_t), alignment);
+        const usize total  = (size + offset + alignment - 1) & ~(alignment - 1);
+        void*       base   = nullptr;
+        while (true) {
+            base = alignment > alignof(std::max_align_t) ? std::aligned_alloc(alignment, total)
+                                                         : std::malloc(size + offset);
+            if (base != nullptr) {
+                break;
+            }
+            const std::new_handler handler = std::get_new_handler();
+            if (handler == nullptr) {
+                if (noThrow) {
+                    return nullptr;
+                }
+                throw std::bad_alloc();
+            }
+            handler();
+        }
+
+        auto* user   = static_cast<std::byte*>(base) + offset;
+        auto* header = reinterpret_cast<AllocationHeader_t*>(user) - 1;
+        header->m_Size        = size;
+        header->m_OffsetShift = static_cast<u8>(std::countr_zero(offset));
+        header->m_Tag         = GC::MemoryTracker::current_tag();
+        header->m_Tracked     = GC::MemoryTracker::is_enabled() && !GC::t_InTracker;
+        header->m_StackId     = header->m_Tracked ? GC::MemoryTracker::record_allocate(
+                                                        GC::MemorySource::Heap, header->m_Tag, size)
+                                                  : 0;
+        return user;
+    }
+
+    void tracked_delete(void* ptr) noexcept {
+        if (ptr == nullptr) {
+            return;
+        }
+        const auto* header = static_cast<const AllocationHeader_t*>(ptr) - 1;
+        if (header->m_Tracked) {
+            GC::MemoryTracker::record_deallocate(
+                GC::MemorySource::Heap, header->m_Tag, header->m_Size, header->m_StackId);
+        }
+        std::free(static_cast<std::byte*>(ptr) - (usize {1} << header->m_OffsetShift));
+    }
+} // namespace
+
+void* operator new(std::size_t size) {
+    return tracked_new(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__, false);
+}
+
+void* operator new[](std::size_t size) {
+    return tracked_new(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__, false);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    try {
+        return tracked_new(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__, true);
+    }
+    catch (...) {
+        return nullptr;
+    }
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t& tag) noexcept {
+    return operator new(size, tag);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    return tracked_new(size, static_cast<usize>(alignment), false);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    return tracked_new(size, static_cast<usize>(alignment), false);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    try {
+        return tracked_new(size, static_cast<usize>(alignment), true);
+    }
+    catch (...) {
+        return nullptr;
+    }
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment,
+                     const std::nothrow_t& tag) noexcept {
+    return operator new(size, alignment, tag);
+}
+
+void operator delete(void* ptr) noexcept {
+    tracked_delete(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    tracked_delete(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    tracked_delete(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept {
+    tracked_delete(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept {
+    tracked_delete(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t) noexcept {
+    tracked_delete(ptr);
+}
+
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept {
+    tracked_delete(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept {
+    tracked_delete(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+    tracked_delete(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+    tracked_delete(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept {
+    tracked_delete(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept {
+    tracked_delete(ptr);
+}
+// NOLINTEND(*-no-malloc, *-owning-memory, *-reinterpret-cast, *-pointer-arithmetic)
+#endif
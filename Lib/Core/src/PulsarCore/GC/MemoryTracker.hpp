@@ -0,0 +1,193 @@
+#pragma once
+
+#include "PulsarCore/Types.hpp"
+#include "PulsarCore/Util/Macros.hpp"
+
+#include <array>
+#include <atomic>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Pulsar::GC {
+    /// The subsystem an allocation is charged to
+    enum class MemoryTag : u8 {
+        General,
+        Core,
+        Log,
+        Engine,
+        Window,
+        Renderer,
+        Editor,
+        COUNT,
+    };
+
+    constexpr usize MEMORY_TAG_COUNT = static_cast<usize>(MemoryTag::COUNT);
+
+    [[nodiscard]] constexpr std::string_view to_string(MemoryTag tag) {
+        constexpr std::array<std::string_view, MEMORY_TAG_COUNT> NAMES = {
+            "General", "Core", "Log", "Engine", "Window", "Renderer", "Editor"};
+        return NAMES[static_cast<usize>(tag)];
+    }
+
+    /// Where the memory came from. Arena allocations live inside blocks that are themselves
+    /// heap allocations, so the two are reported separately.
+    enum class MemorySource : u8 {
+        /// The global `operator new`, which includes `Ref`, `Scoped` and the standard containers
+        Heap,
+        Arena,
+        COUNT,
+    };
+
+    constexpr usize MEMORY_SOURCE_COUNT = static_cast<usize>(MemorySource::COUNT);
+
+    [[nodiscard]] constexpr std::string_view to_string(MemorySource source) {
+        constexpr std::array<std::string_view, MEMORY_SOURCE_COUNT> NAMES = {"Heap", "Arena"};
+        return NAMES[static_cast<usize>(source)];
+    }
+
+    /// Allocation sizes are bucketed by their bit width, the last bucket takes everything larger
+    constexpr usize MEMORY_HISTOGRAM_BUCKETS = 24;
+
+    struct MemoryTrackerConfig_t {
+        /// A callstack is captured about once every this many allocated bytes, 0 disables them
+        usize m_SampleInterval = usize {512} * 1024;
+    };
+
+    struct MemoryStats_t {
+        u64 m_Allocations    = 0;
+        u64 m_Frees          = 0;
+        u64 m_AllocatedBytes = 0;
+        u64 m_FreedBytes     = 0;
+        /// Highest live byte count seen, accurate to `MemoryTracker::PEAK_GRANULARITY` per thread
+        u64 m_PeakBytes = 0;
+        /// Allocation count by size, bucket `i` holds sizes of bit width `i`
+        std::array<u64, MEMORY_HISTOGRAM_BUCKETS> m_SizeHistogram {};
+
+        [[nodiscard]] i64 live_bytes() const {
+            return static_cast<i64>(m_AllocatedBytes - m_FreedBytes);
+        }
+
+        [[nodiscard]] i64 live_count() const {
+            return static_cast<i64>(m_Allocations - m_Frees);
+        }
+    };
+
+    /// The allocations of one sampled callstack
+    struct MemoryStackStats_t {
+        MemorySource       m_Source = MemorySource::Heap;
+        MemoryTag          m_Tag    = MemoryTag::General;
+        std::vector<usize> m_Frames;
+        /// Sampled allocations, each one stands for about `m_SampleInterval` bytes
+        u64 m_Samples        = 0;
+        u64 m_AllocatedBytes = 0;
+        i64 m_LiveBytes      = 0;
+    };
+
+    struct MemorySnapshot_t {
+        /// Number of `MemoryTracker::end_frame` calls so far
+        u64 m_Frame = 0;
+        std::array<std::array<MemoryStats_t, MEMORY_TAG_COUNT>, MEMORY_SOURCE_COUNT> m_Stats {};
+        /// Frames by how many allocations they made, bucketed by bit width like the sizes
+        std::array<u64, MEMORY_HISTOGRAM_BUCKETS> m_FrameAllocations {};
+        std::vector<MemoryStackStats_t>           m_Stacks;
+
+        [[nodiscard]] const MemoryStats_t& get(MemorySource source, MemoryTag tag) const {
+            return m_Stats[static_cast<usize>(source)][static_cast<usize>(tag)];
+        }
+
+        /// Sum over every tag of a source
+        [[nodiscard]] MemoryStats_t total(MemorySource source) const;
+    };
+
+    /// What happened between two snapshots, peaks are taken from `after`
+    [[nodiscard]] MemorySnapshot_t diff(
+        const MemorySnapshot_t& before, const MemorySnapshot_t& after);
+
+    /// Collects allocation statistics per subsystem
+    /// # Opt-in
+    /// Only builds with `PULSAR_MEMORY_TRACKING` (the CMake option) report anything: the global
+    /// `operator new` is replaced, and Pulsar allocators report to the tracker. Reports are
+    /// ignored until `enable`. Without the option every hook compiles to nothing.
+    /// # Performance
+    /// Counters live in per-thread slots that only their thread writes, a snapshot adds them up.
+    /// Callstacks are only captured for sampled allocations, roughly one per
+    /// `m_SampleInterval` bytes. The heap hook adds a 16 byte header to every allocation.
+    class MemoryTracker {
+    public:
+#ifdef PULSAR_MEMORY_TRACKING
+        static constexpr bool COMPILED_IN = true;
+#else
+        static constexpr bool COMPILED_IN = false;
+#endif
+        /// Live bytes a thread accumulates before it updates the shared peak
+        static constexpr usize PEAK_GRANULARITY = usize {64} * 1024;
+
+        static void enable(const MemoryTrackerConfig_t& config = {});
+        static void disable();
+
+        [[nodiscard]] PULSAR_ALWAYS_INLINE static bool is_enabled() {
+            return s_Enabled.load(std::memory_order_relaxed);
+        }
+
+        /// Reports an allocation, returns the sampled callstack it belongs to (0 if none) for
+        /// `on_deallocate`
+        PULSAR_ALWAYS_INLINE static u32 on_allocate(
+            MemorySource source, MemoryTag tag, usize size) {
+            if (!is_enabled()) {
+                return 0;
+            }
+            return record_allocate(source, tag, size);
+        }
+
+        PULSAR_ALWAYS_INLINE static void on_deallocate(
+            MemorySource source, MemoryTag tag, usize size, u32 stackId = 0) {
+            if (!is_enabled()) {
+                return;
+            }
+            record_deallocate(source, tag, size, stackId);
+        }
+
+        /// Counts an allocation unconditionally, used by hooks that remember whether the memory
+        /// was tracked when it was allocated
+        static u32  record_allocate(MemorySource source, MemoryTag tag, usize size);
+        static void record_deallocate(MemorySource source, MemoryTag tag, usize size, u32 stackId);
+
+        /// Closes a frame for the per-frame allocation histogram
+        static void end_frame();
+        [[nodiscard]] static MemorySnapshot_t snapshot();
+        /// A snapshot as JSON, with the callstacks symbolized where possible
+        [[nodiscard]] static std::string to_json(const MemorySnapshot_t& snapshot);
+
+        /// The tag heap allocations of the calling thread are charged to, see `MemoryTagScope`
+        [[nodiscard]] static MemoryTag current_tag() {
+            return s_CurrentTag;
+        }
+
+    private:
+        friend class MemoryTagScope;
+
+        inline static std::atomic<bool>                s_Enabled {false};
+        constinit inline static thread_local MemoryTag s_CurrentTag = MemoryTag::General;
+    };
+
+    /// Charges the heap allocations of the calling thread to `tag` for its lifetime
+    class MemoryTagScope {
+    public:
+        explicit MemoryTagScope(MemoryTag tag) : m_Previous(MemoryTracker::s_CurrentTag) {
+            MemoryTracker::s_CurrentTag = tag;
+        }
+
+        ~MemoryTagScope() {
+            MemoryTracker::s_CurrentTag = m_Previous;
+        }
+
+        MemoryTagScope(const MemoryTagScope&)            = delete;
+        MemoryTagScope& operator=(const MemoryTagScope&) = delete;
+        MemoryTagScope(MemoryTagScope&&)                 = delete;
+        MemoryTagScope& operator=(MemoryTagScope&&)      = delete;
+
+    private:
+        MemoryTag m_Previous;
+    };
+} // namespace Pulsar::GC
@@ -22,17 +22,16 @@ namespace Pulsar::GC {
         /// # Ownership
         /// The pointer will be deleted when the Scoped object goes out of scope
         explicit Scoped(T* ptr, Allocator allocator = Allocator())
-            : m_Ptr(ptr), m_Allocator(allocator) {
+            : m_Ptr(ptr), m_Allocator(std::move(allocator)) {
         }
 
         // NOLINTNEXTLINE(google-explicit-constructor, hicpp-explicit-conversions)
         Scoped(std::nullptr_t = nullptr, Allocator allocator = Allocator())
-            : m_Ptr(nullptr), m_Allocator(allocator) {
+            : m_Ptr(nullptr), m_Allocator(std::move(allocator)) {
         }
 
         ~Scoped() {
-            AllocatorTraits::destroy(m_Allocator, m_Ptr);
-            AllocatorTraits::deallocate(m_Allocator, m_Ptr, 1);
+            release();
         }
 
         Scoped(const Scoped&)            = delete;
@@ -51,8 +50,7 @@ namespace Pulsar::GC {
         /// @param other The other object to move the pointer from
         Scoped& operator=(Scoped&& other) noexcept {
             [[likely]] if (this != &other) {
-                AllocatorTraits::destroy(m_Allocator, m_Ptr);
-                AllocatorTraits::deallocate(m_Allocator, m_Ptr, 1);
+                release();
                 m_Ptr       = other.m_Ptr;
                 m_Allocator = std::move(other.m_Allocator);
                 other.m_Ptr = nullptr;
@@ -90,10 +88,9 @@ namespace Pulsar::GC {
         /// @param ptr The new pointer
         /// @param allocator The new allocator
         void reset(T* ptr = nullptr, Allocator allocator = Allocator()) {
-            AllocatorTraits::destroy(m_Allocator, m_Ptr);
-            AllocatorTraits::deallocate(m_Allocator, m_Ptr, 1);
+            release();
             m_Ptr       = ptr;
-            m_Allocator = allocator;
+            m_Allocator = std::move(allocator);
         }
 
         bool operator==(const Scoped& other) const {
@@ -105,6 +102,15 @@ namespace Pulsar::GC {
         }
 
     private:
+        /// Destroys the object, if any. A moved-from allocator may not be usable anymore, so a
+        /// null pointer must not reach it.
+        void release() {
+            if (m_Ptr != nullptr) {
+                AllocatorTraits::destroy(m_Allocator, m_Ptr);
+                AllocatorTraits::deallocate(m_Allocator, m_Ptr, 1);
+            }
+        }
+
         T*        m_Ptr;
         Allocator m_Allocator;
     };
@@ -126,7 +132,7 @@ namespace Pulsar::GC {
         friend class Weak<T, Allocator>;
 
         explicit Ref(T* ptr, Allocator allocator = Allocator())
-            : m_Ptr(ptr), m_RefCount(nullptr), m_Allocator(allocator) {
+            : m_Ptr(ptr), m_RefCount(nullptr), m_Allocator(std::move(allocator)) {
             RcAllocator rcAlloc(m_Allocator);
             m_RefCount = RcAllocatorTraits::allocate(rcAlloc, 1);
             RcAllocatorTraits::construct(rcAlloc, m_RefCount);
@@ -134,25 +140,20 @@ namespace Pulsar::GC {
 
         // NOLINTNEXTLINE(google-explicit-constructor, hicpp-explicit-conversions)
         Ref(std::nullptr_t = nullptr, Allocator allocator = Allocator())
-            : m_Ptr(nullptr), m_RefCount(nullptr), m_Allocator(allocator) {
+            : m_Ptr(nullptr), m_RefCount(nullptr), m_Allocator(std::move(allocator)) {
         }
 
         ~Ref() {
             reset();
         }
 
-        Ref(const Ref& other) noexcept {
-            if (other.m_RefCount == nullptr) {
-                m_RefCount  = nullptr;
-                m_Ptr       = nullptr;
-                m_Allocator = other.m_Allocator;
-                return;
+        // The allocator is copied in the initializer list, default constructing one first can
+        // be expensive (ArenaAllocator creates a new region)
+        Ref(const Ref& other) noexcept
+            : m_Ptr(other.m_Ptr), m_RefCount(other.m_RefCount), m_Allocator(other.m_Allocator) {
+            if (m_RefCount != nullptr) {
+                m_RefCount->m_StrongCount += 1;
             }
-
-            other.m_RefCount->m_StrongCount += 1;
-            m_RefCount  = other.m_RefCount;
-            m_Ptr       = other.m_Ptr;
-            m_Allocator = other.m_Allocator;
         }
 
         Ref& operator=(const Ref& other) noexcept {
@@ -237,13 +238,15 @@ namespace Pulsar::GC {
             }
 
             if (--m_RefCount->m_StrongCount == 0) {
-                // We're the last strong reference, delete the object
+                // We're the last strong reference, delete the object. The object may drop weak
+                // references to itself while it is destroyed, so hold one until it is gone.
+                m_RefCount->m_WeakCount++;
                 AllocatorTraits::destroy(m_Allocator, m_Ptr);
                 AllocatorTraits::deallocate(m_Allocator, m_Ptr, 1);
                 m_Ptr = nullptr;
 
                 // Now handle the RefCount cleanup
-                if (m_RefCount->m_WeakCount == 0) {
+                if (--m_RefCount->m_WeakCount == 0) {
                     RcAllocator rcAlloc(m_Allocator);
                     RcAllocatorTraits::destroy(rcAlloc, m_RefCount);
                     RcAllocatorTraits::deallocate(rcAlloc, m_RefCount, 1);
@@ -254,7 +257,7 @@ namespace Pulsar::GC {
 
     private:
         Ref(T* ptr, RefCount_t* refCount, Allocator allocator) noexcept
-            : m_Ptr(ptr), m_RefCount(refCount), m_Allocator(allocator) {
+            : m_Ptr(ptr), m_RefCount(refCount), m_Allocator(std::move(allocator)) {
             if (m_RefCount != nullptr) {
                 m_RefCount->m_StrongCount++;
             }
@@ -383,7 +386,7 @@ namespace Pulsar::GC {
         Allocator alloc;
         auto*     ptr = AllocatorTraits::allocate(alloc, 1);
         AllocatorTraits::construct(alloc, ptr, std::forward<Args>(args)...);
-        return Scoped<T, Allocator>(ptr, alloc);
+        return Scoped<T, Allocator>(ptr, std::move(alloc));
     }
 
     template<typename T, typename Allocator = DefaultAllocator<T>, typename... Args>
@@ -391,7 +394,7 @@ namespace Pulsar::GC {
         using AllocatorTraits = std::allocator_traits<Allocator>;
         auto* ptr             = AllocatorTraits::allocate(alloc, 1);
         AllocatorTraits::construct(alloc, ptr, std::forward<Args>(args)...);
-        return Scoped<T, Allocator>(ptr, alloc);
+        return Scoped<T, Allocator>(ptr, std::move(alloc));
     }
 
     template<typename T, typename Allocator = DefaultAllocator<T>, typename... Args>
@@ -400,7 +403,7 @@ namespace Pulsar::GC {
         Allocator alloc;
         auto*     ptr = AllocatorTraits::allocate(alloc, 1);
         AllocatorTraits::construct(alloc, ptr, std::forward<Args>(args)...);
-        return Ref<T, Allocator>(ptr, alloc);
+        return Ref<T, Allocator>(ptr, std::move(alloc));
     }
 
     template<typename T, typename Allocator = DefaultAllocator<T>, typename... Args>
@@ -408,6 +411,6 @@ namespace Pulsar::GC {
         using AllocatorTraits = std::allocator_traits<Allocator>;
         auto* ptr             = AllocatorTraits::allocate(alloc, 1);
         AllocatorTraits::construct(alloc, ptr, std::forward<Args>(args)...);
-        return Ref<T, Allocator>(ptr, alloc);
+        return Ref<T, Allocator>(ptr, std::move(alloc));
     }
 } // namespace Pulsar::GC
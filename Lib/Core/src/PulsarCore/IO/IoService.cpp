@@ -0,0 +1,241 @@
+#include "IoService.hpp"
+
+#include "PulsarCore/IO/IoUring.hpp"
+#include "PulsarCore/Log.hpp"
+#include "PulsarCore/Util/Profiler.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <condition_variable>
+#include <cstring>
+#include <fmt/format.h>
+#include <thread>
+#include <unistd.h>
+
+namespace Pulsar {
+    namespace {
+        /// The fallback: a blocking `pread` per read, on one of `m_QueueDepth` threads
+        class ThreadPoolIoService final : public IoService {
+        public:
+            explicit ThreadPoolIoService(const IoServiceConfig_t& config) : IoService(config) {
+                const u32 threadCount = std::max<u32>(config.m_QueueDepth, 1);
+                m_Threads.reserve(threadCount);
+                for (u32 i = 0; i < threadCount; i++) {
+                    m_Threads.emplace_back([this] { worker_main(); });
+                }
+            }
+
+            ThreadPoolIoService(const ThreadPoolIoService&)            = delete;
+            ThreadPoolIoService(ThreadPoolIoService&&)                 = delete;
+            ThreadPoolIoService& operator=(const ThreadPoolIoService&) = delete;
+            ThreadPoolIoService& operator=(ThreadPoolIoService&&)      = delete;
+
+            ~ThreadPoolIoService() override {
+                {
+                    std::lock_guard lock(m_Mutex);
+                    m_Stopping = true;
+                }
+                m_Ready.notify_all();
+                for (auto& thread : m_Threads) {
+                    thread.join();
+                }
+                cancel_queued();
+            }
+
+            [[nodiscard]] IoBackend backend() const override {
+                return IoBackend::ThreadPool;
+            }
+
+            Result<std::vector<IoFile_t>, std::string> register_files(
+                std::span<const int> fds) override {
+                std::lock_guard lock(m_Mutex);
+                if (m_FilesRegistered) {
+                    return Err(std::string("Files are already registered"));
+                }
+                m_FilesRegistered = true;
+                std::vector<IoFile_t> files(fds.size());
+                for (usize i = 0; i < fds.size(); i++) {
+                    files[i] = {.m_Fd = fds[i], .m_Slot = static_cast<i32>(i)};
+                }
+                return files;
+            }
+
+            Result<bool, std::string> register_buffers(
+                [[maybe_unused]] std::span<const std::span<std::byte>> buffers) override {
+                std::lock_guard lock(m_Mutex);
+                if (m_BuffersRegistered) {
+                    return Err(std::string("Buffers are already registered"));
+                }
+                m_BuffersRegistered = true;
+                return true;
+            }
+
+        private:
+            void notify_locked() override {
+                m_Ready.notify_one();
+            }
+
+            void cancel_in_flight([[maybe_unused]] u64 id) override {
+                // A blocking pread cannot be interrupted
+            }
+
+            void worker_main() {
+                PULSAR_PROFILE_THREAD_NAME("I/O worker");
+                std::unique_lock lock(m_Mutex);
+                while (true) {
+                    m_Ready.wait(lock, [this] {
+                        return m_Stopping
+                            || std::ranges::any_of(m_Queues, [](const auto& queue) {
+                                   return !queue.empty();
+                               });
+                    });
+                    if (m_Stopping) {
+                        return;
+                    }
+                    Op_t op;
+                    if (!pop_locked(lock, op)) {
+                        continue;
+                    }
+                    lock.unlock();
+                    const IoRead_t& read   = op.m_Read;
+                    ssize_t         result = 0;
+                    do {
+                        result = pread(read.m_File.m_Fd, read.m_Buffer.data(), read.m_Buffer.size(),
+                            static_cast<off_t>(read.m_Offset));
+                    } while (result < 0 && errno == EINTR);
+                    complete(op, result < 0 ? -i64 {errno} : i64 {result});
+                    lock.lock();
+                    m_InFlight--;
+                }
+            }
+
+            std::condition_variable  m_Ready;
+            bool                     m_Stopping          = false;
+            bool                     m_FilesRegistered   = false;
+            bool                     m_BuffersRegistered = false;
+            std::vector<std::thread> m_Threads;
+        };
+    } // namespace
+
+    Result<std::unique_ptr<IoService>, std::string> IoService::create(
+        const IoServiceConfig_t& config) {
+        if (config.m_Backend != IoBackend::ThreadPool) {
+            auto service = internal::create_io_uring_service(config);
+            if (service.has_value() || config.m_Backend == IoBackend::IoUring) {
+                return service;
+            }
+            PL_LOG_INFO("io_uring is unavailable, reading files on a thread pool: {}",
+                service.error());
+        }
+        return std::make_unique<ThreadPoolIoService>(config);
+    }
+
+    IoService::~IoService() = default;
+
+    u64 IoService::submit(std::span<const IoRead_t> reads) {
+        std::lock_guard lock(m_Mutex);
+        const u64       first = m_NextId;
+        for (const IoRead_t& read : reads) {
+            m_Queues[static_cast<usize>(read.m_Priority)].push_back({read, m_NextId++});
+        }
+        if (!reads.empty()) {
+            notify_locked();
+        }
+        return first;
+    }
+
+    bool IoService::cancel(u64 id) {
+        Op_t op;
+        bool queued = false;
+        {
+            std::lock_guard lock(m_Mutex);
+            for (auto& queue : m_Queues) {
+                const auto it = std::ranges::find(queue, id, &Op_t::m_Id);
+                if (it != queue.end()) {
+                    op     = std::move(*it);
+                    queued = true;
+                    queue.erase(it);
+                    break;
+                }
+            }
+        }
+        if (queued) {
+            complete(op, -ECANCELED);
+            return true;
+        }
+        cancel_in_flight(id);
+        return false;
+    }
+
+    usize IoService::pending() const {
+        std::lock_guard lock(m_Mutex);
+        usize           count = m_InFlight;
+        for (const auto& queue : m_Queues) {
+            count += queue.size();
+        }
+        return count;
+    }
+
+    void IoService::complete(const Op_t& op, i64 result) {
+        if (op.m_Read.m_Callback != nullptr) {
+            op.m_Read.m_Callback(
+                {.m_Id = op.m_Id, .m_Result = result, .m_Context = op.m_Read.m_Context});
+        }
+    }
+
+    bool IoService::pop_locked(std::unique_lock<std::mutex>& lock, Op_t& out) {
+        while (true) {
+            const auto queue = std::ranges::find_if(
+                m_Queues, [](const auto& queue) { return !queue.empty(); });
+            if (queue == m_Queues.end()) {
+                return false;
+            }
+            out = std::move(queue->front());
+            queue->pop_front();
+            if (!out.m_Read.m_Token.is_cancelled()) {
+                m_InFlight++;
+                return true;
+            }
+            lock.unlock();
+            complete(out, -ECANCELED);
+            lock.lock();
+        }
+    }
+
+    void IoService::cancel_queued() {
+        std::unique_lock lock(m_Mutex);
+        for (auto& queue : m_Queues) {
+            while (!queue.empty()) {
+                const Op_t op = std::move(queue.front());
+                queue.pop_front();
+                lock.unlock();
+                complete(op, -ECANCELED);
+                lock.lock();
+            }
+        }
+    }
+
+    void IoReadAwaiter::await_suspend(std::coroutine_handle<> awaiting) {
+        m_Awaiting        = awaiting;
+        m_Read.m_Callback = &IoReadAwaiter::complete;
+        m_Read.m_Context  = this;
+        // May resume the coroutine on another thread before it returns, touch nothing after
+        m_Service->submit(m_Read);
+    }
+
+    Result<usize, std::string> IoReadAwaiter::await_resume() const {
+        if (m_Result == -ECANCELED) {
+            throw TaskCancelled();
+        }
+        if (m_Result < 0) {
+            return Err(fmt::format("Read failed: {}", std::strerror(static_cast<int>(-m_Result))));
+        }
+        return static_cast<usize>(m_Result);
+    }
+
+    void IoReadAwaiter::complete(const IoCompletion_t& completion) {
+        auto* self     = static_cast<IoReadAwaiter*>(completion.m_Context);
+        self->m_Result = completion.m_Result;
+        self->m_Awaiting.resume();
+    }
+} // namespace Pulsar
@@ -0,0 +1,192 @@
+#pragma once
+
+#include "PulsarCore/Async/Cancellation.hpp"
+#include "PulsarCore/Result.hpp"
+#include "PulsarCore/Types.hpp"
+
+#include <array>
+#include <coroutine>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace Pulsar {
+    enum class IoBackend : u8 {
+        /// io_uring where the kernel allows it, the thread pool otherwise
+        Auto,
+        IoUring,
+        ThreadPool,
+    };
+
+    /// Which queued reads go to the disk first
+    enum class IoPriority : u8 {
+        /// Needed this frame, e.g. a texture that is on screen at low resolution
+        High,
+        Normal,
+        /// Prefetching and streaming ahead
+        Low,
+    };
+    constexpr usize IO_PRIORITY_COUNT = 3;
+
+    /// A file to read from, see `IoService::register_files`
+    struct IoFile_t {
+        int m_Fd = -1;
+        /// Index in the registered file table, -1 if not registered
+        i32 m_Slot = -1;
+    };
+
+    struct IoCompletion_t {
+        /// What `IoService::submit` returned for the read
+        u64 m_Id;
+        /// Bytes read (fewer than asked at the end of the file), or a negated `errno`:
+        /// `-ECANCELED` for cancelled reads
+        i64   m_Result;
+        void* m_Context;
+    };
+
+    /// Called once per read, on an I/O thread, see `IoService`
+    using IoCallback = void (*)(const IoCompletion_t& completion);
+
+    struct IoRead_t {
+        IoFile_t             m_File;
+        u64                  m_Offset = 0;
+        std::span<std::byte> m_Buffer;
+        IoPriority           m_Priority = IoPriority::Normal;
+        /// Checked when the read leaves the queue, a cancelled read completes with `-ECANCELED`
+        CancellationToken m_Token {};
+        /// Index of a registered buffer that contains `m_Buffer`, -1 if none
+        i32        m_BufferIndex = -1;
+        IoCallback m_Callback    = nullptr;
+        void*      m_Context     = nullptr;
+    };
+
+    struct IoServiceConfig_t {
+        IoBackend m_Backend = IoBackend::Auto;
+        /// Reads in flight at once: the io_uring ring size, or the thread pool's thread count.
+        /// Queued reads wait in priority order until one finishes.
+        u32 m_QueueDepth = 64;
+    };
+
+    class IoService;
+
+    /// `co_await`s one read, see `IoService::read`
+    class IoReadAwaiter {
+    public:
+        IoReadAwaiter(IoService& service, const IoRead_t& read)
+            : m_Service(&service), m_Read(read) {
+        }
+
+        [[nodiscard]] bool await_ready() const noexcept {
+            return false;
+        }
+
+        void await_suspend(std::coroutine_handle<> awaiting);
+
+        /// The number of bytes read. Throws `TaskCancelled` when the read was cancelled.
+        Result<usize, std::string> await_resume() const;
+
+    private:
+        static void complete(const IoCompletion_t& completion);
+
+        IoService*              m_Service;
+        IoRead_t                m_Read;
+        i64                     m_Result = 0;
+        std::coroutine_handle<> m_Awaiting;
+    };
+
+    /// Asynchronous file reads without a blocked thread per read
+    /// # Usage
+    /// `submit` a batch of reads, each completes by calling its callback with the result, or
+    /// `co_await service.read(...)` in a coroutine. Callbacks and resumed coroutines run on an
+    /// I/O thread: keep them short, and `co_await` an executor's `schedule` before decoding what
+    /// was read. Buffers must stay valid until the read completes.
+    /// # Backends
+    /// On Linux the reads go through io_uring (raw syscalls, no liburing): one I/O thread fills
+    /// the submission ring and reaps completions, one `io_uring_enter` per batch. Registered files
+    /// and buffers save the kernel a file table lookup and the page pinning on every read. Where
+    /// io_uring is unavailable (old kernels, seccomp in containers) a thread pool runs `pread`,
+    /// registration is then only bookkeeping.
+    /// # Priorities and cancellation
+    /// At most `m_QueueDepth` reads are in flight, the rest wait in one queue per priority. A
+    /// high priority read overtakes every queued normal and low priority read, but not what the
+    /// disk already works on. `cancel` removes a queued read; reads in flight are cancelled on a
+    /// best effort basis, regular file reads usually finish anyway.
+    class IoService {
+    public:
+        /// Fails when io_uring was asked for explicitly and is not available
+        [[nodiscard]] static Result<std::unique_ptr<IoService>, std::string> create(
+            const IoServiceConfig_t& config = {});
+
+        IoService(const IoService&)            = delete;
+        IoService(IoService&&)                 = delete;
+        IoService& operator=(const IoService&) = delete;
+        IoService& operator=(IoService&&)      = delete;
+        /// Completes queued reads with `-ECANCELED`, waits for the ones in flight
+        virtual ~IoService();
+
+        [[nodiscard]] virtual IoBackend backend() const = 0;
+
+        /// Registers `fds` for the lifetime of the service, once, before the first read. Returns
+        /// the files to read them through, in the same order.
+        [[nodiscard]] virtual Result<std::vector<IoFile_t>, std::string> register_files(
+            std::span<const int> fds) = 0;
+
+        /// Registers `buffers` for the lifetime of the service, once, before the first read.
+        /// Reads into them pass their index as `m_BufferIndex`.
+        [[nodiscard]] virtual Result<bool, std::string> register_buffers(
+            std::span<const std::span<std::byte>> buffers) = 0;
+
+        /// Queues `reads`, which get consecutive ids. Returns the id of the first.
+        u64 submit(std::span<const IoRead_t> reads);
+
+        u64 submit(const IoRead_t& read) {
+            return submit(std::span(&read, 1));
+        }
+
+        /// Returns true when the read was still queued: it then completed with `-ECANCELED`
+        /// before this returns. A read in flight is cancelled best effort and false is returned.
+        bool cancel(u64 id);
+
+        [[nodiscard]] IoReadAwaiter read(IoFile_t file, u64 offset, std::span<std::byte> buffer,
+            IoPriority priority = IoPriority::Normal, CancellationToken token = {}) {
+            return {*this,
+                {.m_File = file, .m_Offset = offset, .m_Buffer = buffer, .m_Priority = priority,
+                    .m_Token = std::move(token)}};
+        }
+
+        /// Reads queued, in flight, or whose callback has not returned yet
+        [[nodiscard]] usize pending() const;
+
+    protected:
+        struct Op_t {
+            IoRead_t m_Read;
+            u64      m_Id = 0;
+        };
+
+        explicit IoService(const IoServiceConfig_t& config) : m_Config(config) {
+        }
+
+        static void complete(const Op_t& op, i64 result);
+
+        /// Takes the next read by priority with `m_Mutex` held, completes cancelled ones on the
+        /// way (with the lock released while their callbacks run). False if the queues are empty.
+        bool pop_locked(std::unique_lock<std::mutex>& lock, Op_t& out);
+
+        /// Completes everything still queued with `-ECANCELED`, for shutdown
+        void cancel_queued();
+
+        /// A read was queued, called with `m_Mutex` held
+        virtual void notify_locked() = 0;
+        /// `id` is not queued anymore, it may be in flight. Called without the lock.
+        virtual void cancel_in_flight(u64 id) = 0;
+
+        IoServiceConfig_t                               m_Config;
+        mutable std::mutex                              m_Mutex;
+        std::array<std::deque<Op_t>, IO_PRIORITY_COUNT> m_Queues;
+        u64                                             m_NextId   = 1;
+        usize                                           m_InFlight = 0;
+    };
+} // namespace Pulsar
@@ -0,0 +1,400 @@
+#include "IoUring.hpp"
+
+#include "PulsarCore/Log.hpp"
+#include "PulsarCore/Util/Profiler.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <fmt/format.h>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+    #include <linux/io_uring.h>
+    #include <poll.h>
+    #include <sys/eventfd.h>
+    #include <sys/mman.h>
+    #include <sys/syscall.h>
+    #include <sys/uio.h>
+    #include <unistd.h>
+#endif
+
+// NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast, cppcoreguidelines-pro-bounds-pointer-arithmetic)
+namespace Pulsar::internal {
+#ifdef __linux__
+    namespace {
+        /// `user_data` of the requests that are not reads, reads carry their slot index
+        constexpr u64 WAKE_TAG   = ~u64 {0};
+        constexpr u64 CANCEL_TAG = ~u64 {0} - 1;
+
+        /// The best effort I/O scheduling class, with a level per `IoPriority` (0 goes first).
+        /// Only schedulers like BFQ and mq-deadline look at it.
+        constexpr u16                                IOPRIO_BEST_EFFORT = 2 << 13;
+        constexpr std::array<u16, IO_PRIORITY_COUNT> IOPRIO_LEVELS      = {0, 4, 7};
+
+        /// Linux never reads more in one request, larger buffers get a short read
+        constexpr usize MAX_READ_BYTES = 0x7fff'f000;
+
+        int io_uring_setup(u32 entries, io_uring_params& params) {
+            return static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+        }
+
+        int io_uring_enter(int ring, u32 toSubmit, u32 minComplete, u32 flags) {
+            return static_cast<int>(
+                syscall(__NR_io_uring_enter, ring, toSubmit, minComplete, flags, nullptr, 0));
+        }
+
+        int io_uring_register(int ring, u32 opcode, const void* args, u32 count) {
+            return static_cast<int>(syscall(__NR_io_uring_register, ring, opcode, args, count));
+        }
+
+        u32 load_acquire(u32* value) {
+            return std::atomic_ref(*value).load(std::memory_order_acquire);
+        }
+
+        void store_release(u32* value, u32 newValue) {
+            std::atomic_ref(*value).store(newValue, std::memory_order_release);
+        }
+
+        class IoUringService final : public IoService {
+        public:
+            explicit IoUringService(const IoServiceConfig_t& config) : IoService(config) {
+            }
+
+            IoUringService(const IoUringService&)            = delete;
+            IoUringService(IoUringService&&)                 = delete;
+            IoUringService& operator=(const IoUringService&) = delete;
+            IoUringService& operator=(IoUringService&&)      = delete;
+
+            ~IoUringService() override {
+                {
+                    std::lock_guard lock(m_Mutex);
+                    m_Stopping = true;
+                    if (m_Waiting) {
+                        wake();
+                    }
+                }
+                if (m_Thread.joinable()) {
+                    m_Thread.join();
+                }
+                cancel_queued();
+                if (m_Sqes != MAP_FAILED) {
+                    munmap(m_Sqes, m_SqesSize);
+                }
+                if (m_RingMap != MAP_FAILED) {
+                    munmap(m_RingMap, m_RingMapSize);
+                }
+                if (m_Ring >= 0) {
+                    ::close(m_Ring);
+                }
+                if (m_WakeFd >= 0) {
+                    ::close(m_WakeFd);
+                }
+            }
+
+            Result<bool, std::string> init() {
+                const u32 depth = std::max<u32>(m_Config.m_QueueDepth, 1);
+                // Room for the reads, the wake-up poll and a few cancellations
+                io_uring_params params {};
+                m_Ring = io_uring_setup(depth + 16, params);
+                if (m_Ring < 0) {
+                    return Err(fmt::format("io_uring_setup failed: {}", std::strerror(errno)));
+                }
+                // Single mmap (5.4), no dropped completions (5.5), fast poll (5.7, IORING_OP_READ
+                // is 5.6)
+                constexpr u32 REQUIRED = IORING_FEAT_SINGLE_MMAP | IORING_FEAT_NODROP
+                                       | IORING_FEAT_FAST_POLL;
+                if ((params.features & REQUIRED) != REQUIRED) {
+                    return Err(std::string("The kernel's io_uring is too old"));
+                }
+
+                const usize sqSize = params.sq_off.array + params.sq_entries * sizeof(u32);
+                const usize cqSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+                m_RingMapSize      = std::max(sqSize, cqSize);
+                m_SqesSize         = params.sq_entries * sizeof(io_uring_sqe);
+
+                m_RingMap = mmap(nullptr, m_RingMapSize, PROT_READ | PROT_WRITE,
+                    MAP_SHARED | MAP_POPULATE, m_Ring, IORING_OFF_SQ_RING);
+                m_Sqes    = mmap(nullptr, m_SqesSize, PROT_READ | PROT_WRITE,
+                       MAP_SHARED | MAP_POPULATE, m_Ring, IORING_OFF_SQES);
+                if (m_RingMap == MAP_FAILED || m_Sqes == MAP_FAILED) {
+                    return Err(fmt::format("Failed to map the io_uring: {}", std::strerror(errno)));
+                }
+
+                auto* ring    = static_cast<u8*>(m_RingMap);
+                m_SqHead      = reinterpret_cast<u32*>(ring + params.sq_off.head);
+                m_SqTail      = reinterpret_cast<u32*>(ring + params.sq_off.tail);
+                m_SqMask      = *reinterpret_cast<u32*>(ring + params.sq_off.ring_mask);
+                m_SqEntries   = params.sq_entries;
+                m_CqHead      = reinterpret_cast<u32*>(ring + params.cq_off.head);
+                m_CqTail      = reinterpret_cast<u32*>(ring + params.cq_off.tail);
+                m_CqMask      = *reinterpret_cast<u32*>(ring + params.cq_off.ring_mask);
+                m_Cqes        = reinterpret_cast<io_uring_cqe*>(ring + params.cq_off.cqes);
+                m_SqLocalTail = *m_SqTail;
+                // SQE i always goes into ring slot i, the indirection array is set up once
+                auto* array = reinterpret_cast<u32*>(ring + params.sq_off.array);
+                for (u32 i = 0; i < params.sq_entries; i++) {
+                    array[i] = i;
+                }
+
+                m_WakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+                if (m_WakeFd < 0) {
+                    return Err(fmt::format("eventfd failed: {}", std::strerror(errno)));
+                }
+                m_Slots.resize(depth);
+                for (u32 slot = depth; slot > 0; slot--) {
+                    m_FreeSlots.push_back(slot - 1);
+                }
+                return true;
+            }
+
+            [[nodiscard]] IoBackend backend() const override {
+                return IoBackend::IoUring;
+            }
+
+            Result<std::vector<IoFile_t>, std::string> register_files(
+                std::span<const int> fds) override {
+                std::lock_guard lock(m_Mutex);
+                if (m_Started || m_FilesRegistered) {
+                    return Err(std::string("Files have to be registered once, before reading"));
+                }
+                if (io_uring_register(m_Ring, IORING_REGISTER_FILES, fds.data(),
+                        static_cast<u32>(fds.size()))
+                    < 0) {
+                    return Err(fmt::format("Failed to register files: {}", std::strerror(errno)));
+                }
+                m_FilesRegistered = true;
+                std::vector<IoFile_t> files(fds.size());
+                for (usize i = 0; i < fds.size(); i++) {
+                    files[i] = {.m_Fd = fds[i], .m_Slot = static_cast<i32>(i)};
+                }
+                return files;
+            }
+
+            Result<bool, std::string> register_buffers(
+                std::span<const std::span<std::byte>> buffers) override {
+                std::lock_guard lock(m_Mutex);
+                if (m_Started || m_BuffersRegistered) {
+                    return Err(std::string("Buffers have to be registered once, before reading"));
+                }
+                std::vector<iovec> iovecs(buffers.size());
+                for (usize i = 0; i < buffers.size(); i++) {
+                    iovecs[i] = {.iov_base = buffers[i].data(), .iov_len = buffers[i].size()};
+                }
+                if (io_uring_register(m_Ring, IORING_REGISTER_BUFFERS, iovecs.data(),
+                        static_cast<u32>(iovecs.size()))
+                    < 0) {
+                    return Err(
+                        fmt::format("Failed to register buffers: {}", std::strerror(errno)));
+                }
+                m_BuffersRegistered = true;
+                return true;
+            }
+
+        private:
+            void notify_locked() override {
+                // Started lazily, so registration never races with requests in the ring
+                if (!m_Started) {
+                    m_Started = true;
+                    m_Thread  = std::thread([this] { run(); });
+                }
+                else if (m_Waiting) {
+                    wake();
+                }
+            }
+
+            void cancel_in_flight(u64 id) override {
+                std::lock_guard lock(m_Mutex);
+                if (!m_Started) {
+                    return;
+                }
+                m_CancelRequests.push_back(id);
+                if (m_Waiting) {
+                    wake();
+                }
+            }
+
+            void wake() const {
+                const u64 one = 1;
+                // Only fails when the counter would overflow, it is readable then either way
+                [[maybe_unused]] const ssize_t written = ::write(m_WakeFd, &one, sizeof(one));
+            }
+
+            void run() {
+                PULSAR_PROFILE_THREAD_NAME("I/O ring");
+                usize completed = 0;
+                while (true) {
+                    {
+                        std::unique_lock lock(m_Mutex);
+                        m_InFlight -= completed;
+                        m_Waiting = false;
+                        if (!m_Stopping) {
+                            Op_t op;
+                            while (!m_FreeSlots.empty() && pop_locked(lock, op)) {
+                                const u32 slot = m_FreeSlots.back();
+                                m_FreeSlots.pop_back();
+                                m_Slots[slot] = std::move(op);
+                                prepare_read(slot);
+                            }
+                        }
+                        prepare_cancels();
+                        if (m_Stopping && m_FreeSlots.size() == m_Slots.size()) {
+                            return;
+                        }
+                        m_Waiting = true;
+                    }
+                    if (!m_WakeArmed) {
+                        io_uring_sqe* sqe  = next_sqe();
+                        sqe->opcode        = IORING_OP_POLL_ADD;
+                        sqe->fd            = m_WakeFd;
+                        sqe->poll32_events = POLLIN;
+                        sqe->user_data     = WAKE_TAG;
+                        m_WakeArmed        = true;
+                    }
+
+                    // Submits the batch and sleeps until something completes, in one syscall
+                    store_release(m_SqTail, m_SqLocalTail);
+                    const u32 toSubmit = m_SqLocalTail - load_acquire(m_SqHead);
+                    if (io_uring_enter(m_Ring, toSubmit, 1, IORING_ENTER_GETEVENTS) < 0
+                        && errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+                        PL_LOG_ERROR("io_uring_enter failed: {}", std::strerror(errno));
+                    }
+                    completed = reap();
+                }
+            }
+
+            /// The SQ always has room: it is larger than the reads in flight plus the poll
+            io_uring_sqe* next_sqe() {
+                io_uring_sqe* sqe = &static_cast<io_uring_sqe*>(m_Sqes)[m_SqLocalTail & m_SqMask];
+                m_SqLocalTail++;
+                *sqe = {};
+                return sqe;
+            }
+
+            [[nodiscard]] bool sq_full() const {
+                return m_SqLocalTail - load_acquire(m_SqHead) >= m_SqEntries;
+            }
+
+            void prepare_read(u32 slot) {
+                const IoRead_t& read = m_Slots[slot].m_Read;
+                io_uring_sqe*   sqe  = next_sqe();
+                sqe->opcode          = IORING_OP_READ;
+                sqe->fd              = read.m_File.m_Fd;
+                if (read.m_File.m_Slot >= 0) {
+                    sqe->fd    = read.m_File.m_Slot;
+                    sqe->flags = IOSQE_FIXED_FILE;
+                }
+                if (read.m_BufferIndex >= 0) {
+                    sqe->opcode    = IORING_OP_READ_FIXED;
+                    sqe->buf_index = static_cast<u16>(read.m_BufferIndex);
+                }
+                const auto level = static_cast<usize>(read.m_Priority);
+                sqe->addr        = reinterpret_cast<uintptr_t>(read.m_Buffer.data());
+                sqe->len         = static_cast<u32>(std::min(read.m_Buffer.size(), MAX_READ_BYTES));
+                sqe->off         = read.m_Offset;
+                sqe->ioprio      = IOPRIO_BEST_EFFORT | IOPRIO_LEVELS[level];
+                sqe->user_data   = slot;
+            }
+
+            /// Turns `m_CancelRequests` into cancel requests, with `m_Mutex` held
+            void prepare_cancels() {
+                usize handled = 0;
+                for (; handled < m_CancelRequests.size() && !sq_full(); handled++) {
+                    const u64 id = m_CancelRequests[handled];
+                    for (u32 slot = 0; slot < m_Slots.size(); slot++) {
+                        if (m_Slots[slot].m_Id == id) {
+                            io_uring_sqe* sqe = next_sqe();
+                            sqe->opcode       = IORING_OP_ASYNC_CANCEL;
+                            sqe->addr         = slot;
+                            sqe->user_data    = CANCEL_TAG;
+                            break;
+                        }
+                    }
+                }
+                m_CancelRequests.erase(m_CancelRequests.begin(),
+                    m_CancelRequests.begin() + static_cast<std::ptrdiff_t>(handled));
+            }
+
+            /// Completes the reads that finished, returns how many
+            usize reap() {
+                u32       head  = *m_CqHead;
+                const u32 tail  = load_acquire(m_CqTail);
+                usize     reads = 0;
+                for (; head != tail; head++) {
+                    const io_uring_cqe& cqe = m_Cqes[head & m_CqMask];
+                    if (cqe.user_data == WAKE_TAG) {
+                        m_WakeArmed = false;
+                        u64 count   = 0;
+                        // Resets the counter, the poll is armed again before the next wait
+                        [[maybe_unused]] const ssize_t size =
+                            ::read(m_WakeFd, &count, sizeof(count));
+                        continue;
+                    }
+                    if (cqe.user_data == CANCEL_TAG) {
+                        continue;
+                    }
+                    const auto slot    = static_cast<u32>(cqe.user_data);
+                    const Op_t op      = std::move(m_Slots[slot]);
+                    m_Slots[slot].m_Id = 0;
+                    m_FreeSlots.push_back(slot);
+                    complete(op, cqe.res);
+                    reads++;
+                }
+                store_release(m_CqHead, head);
+                return reads;
+            }
+
+            int   m_Ring        = -1;
+            int   m_WakeFd      = -1;
+            void* m_RingMap     = MAP_FAILED;
+            usize m_RingMapSize = 0;
+            void* m_Sqes        = MAP_FAILED;
+            usize m_SqesSize    = 0;
+
+            // The rings shared with the kernel
+            u32*          m_SqHead      = nullptr;
+            u32*          m_SqTail      = nullptr;
+            u32           m_SqMask      = 0;
+            u32           m_SqEntries   = 0;
+            u32           m_SqLocalTail = 0;
+            u32*          m_CqHead      = nullptr;
+            u32*          m_CqTail      = nullptr;
+            u32           m_CqMask      = 0;
+            io_uring_cqe* m_Cqes        = nullptr;
+
+            // Guarded by m_Mutex
+            bool             m_Started           = false;
+            bool             m_Stopping          = false;
+            bool             m_Waiting           = false;
+            bool             m_FilesRegistered   = false;
+            bool             m_BuffersRegistered = false;
+            std::vector<u64> m_CancelRequests;
+
+            // Only touched by the I/O thread
+            std::vector<Op_t> m_Slots;
+            std::vector<u32>  m_FreeSlots;
+            bool              m_WakeArmed = false;
+            std::thread       m_Thread;
+        };
+    } // namespace
+
+    Result<std::unique_ptr<IoService>, std::string> create_io_uring_service(
+        const IoServiceConfig_t& config) {
+        auto service = std::make_unique<IoUringService>(config);
+        auto ready   = service->init();
+        if (!ready.has_value()) {
+            return Err(std::move(ready.error()));
+        }
+        return service;
+    }
+#else
+    Result<std::unique_ptr<IoService>, std::string> create_io_uring_service(
+        [[maybe_unused]] const IoServiceConfig_t& config) {
+        return Err(std::string("io_uring is only available on Linux"));
+    }
+#endif
+} // namespace Pulsar::internal
+// NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast, cppcoreguidelines-pro-bounds-pointer-arithmetic)
@@ -0,0 +1,13 @@
+#pragma once
+
+#include "PulsarCore/IO/IoService.hpp"
+#include "PulsarCore/Result.hpp"
+
+#include <memory>
+#include <string>
+
+namespace Pulsar::internal {
+    /// The io_uring backend of `IoService`, fails when the kernel does not support or allow it
+    [[nodiscard]] Result<std::unique_ptr<IoService>, std::string> create_io_uring_service(
+        const IoServiceConfig_t& config);
+} // namespace Pulsar::internal
@@ -0,0 +1,245 @@
+#include "Package.hpp"
+
+#include "PulsarCore/Util/Hash.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <fmt/format.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+// NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast, cppcoreguidelines-pro-bounds-pointer-arithmetic)
+namespace Pulsar {
+    namespace {
+        /// Orders entries like the table of contents stores them
+        bool entry_less(u64 hash, std::string_view name, u64 otherHash, std::string_view other) {
+            return hash != otherHash ? hash < otherHash : name < other;
+        }
+
+        Result<bool, std::string> validate(const PackageHeader_t& header,
+            std::span<const PackageEntry_t> entries, std::string_view names) {
+            std::string_view previous;
+            u64              previousHash = 0;
+            for (usize i = 0; i < entries.size(); i++) {
+                const PackageEntry_t& entry = entries[i];
+                if (entry.m_NameOffset > names.size()
+                    || entry.m_NameSize > names.size() - entry.m_NameOffset) {
+                    return Err(fmt::format("Entry {} has its name out of bounds", i));
+                }
+                const std::string_view name = names.substr(entry.m_NameOffset, entry.m_NameSize);
+                if (entry.m_NameHash != fnv1a_64(name)) {
+                    return Err(fmt::format("Entry '{}' has the wrong name hash", name));
+                }
+                if (i > 0 && !entry_less(previousHash, previous, entry.m_NameHash, name)) {
+                    return Err(fmt::format("Entry '{}' is out of order or a duplicate", name));
+                }
+                previous     = name;
+                previousHash = entry.m_NameHash;
+
+                if (entry.m_Compression != PackageCompression::None) {
+                    return Err(fmt::format("Entry '{}' uses unknown compression {}", name,
+                        static_cast<u8>(entry.m_Compression)));
+                }
+                if (entry.m_RawSize != entry.m_Size) {
+                    return Err(fmt::format("Entry '{}' has mismatching sizes", name));
+                }
+                if (entry.m_AlignmentShift < 12 || entry.m_AlignmentShift > 30
+                    || entry.m_Offset % (u64 {1} << entry.m_AlignmentShift) != 0) {
+                    return Err(fmt::format("Entry '{}' is misaligned", name));
+                }
+                // Blobs live between the header page and the table of contents
+                if (entry.m_Offset < PACKAGE_PAGE_ALIGNMENT
+                    || entry.m_Offset > header.m_TocOffset
+                    || entry.m_Size > header.m_TocOffset - entry.m_Offset) {
+                    return Err(fmt::format("Entry '{}' is out of bounds", name));
+                }
+            }
+            return true;
+        }
+
+        constexpr usize align_up(usize value, usize alignment) {
+            return (value + alignment - 1) & ~(alignment - 1);
+        }
+
+        /// Maps `size` bytes of `fd` at an address aligned to `PACKAGE_LARGE_ALIGNMENT`, so blob
+        /// alignment in the file carries over to memory. `mmap` alone only aligns to a page.
+        void* map_aligned(int fd, usize size) {
+            const usize reserved    = size + PACKAGE_LARGE_ALIGNMENT;
+            void*       reservation = mmap(
+                nullptr, reserved, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (reservation == MAP_FAILED) {
+                return MAP_FAILED;
+            }
+            const auto  start   = reinterpret_cast<uintptr_t>(reservation);
+            const usize aligned = align_up(start, PACKAGE_LARGE_ALIGNMENT);
+            const usize end     = aligned + align_up(size, PACKAGE_PAGE_ALIGNMENT);
+            void*       map     = mmap(reinterpret_cast<void*>(aligned), size, PROT_READ,
+                          MAP_PRIVATE | MAP_FIXED, fd, 0);
+            if (map == MAP_FAILED) {
+                munmap(reservation, reserved);
+                return MAP_FAILED;
+            }
+            // Give back the unused ends of the reservation
+            if (aligned > start) {
+                munmap(reservation, aligned - start);
+            }
+            if (start + reserved > end) {
+                munmap(reinterpret_cast<void*>(end), start + reserved - end);
+            }
+            return map;
+        }
+    } // namespace
+
+    Result<Package, std::string> Package::open(const std::filesystem::path& path) {
+        const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            return Err(fmt::format("Failed to open {}: {}", path.string(), std::strerror(errno)));
+        }
+        struct stat info {};
+        if (fstat(fd, &info) != 0) {
+            const int error = errno;
+            ::close(fd);
+            return Err(fmt::format("Failed to stat {}: {}", path.string(), std::strerror(error)));
+        }
+        const auto size = static_cast<usize>(info.st_size);
+        if (size < sizeof(PackageHeader_t)) {
+            ::close(fd);
+            return Err(fmt::format("{} is too small to be a package", path.string()));
+        }
+        void*     map   = map_aligned(fd, size);
+        const int error = errno;
+        // The mapping keeps the file open
+        ::close(fd);
+        if (map == MAP_FAILED) {
+            return Err(fmt::format("Failed to map {}: {}", path.string(), std::strerror(error)));
+        }
+
+        Package         package(static_cast<const std::byte*>(map), size);
+        PackageHeader_t header {};
+        std::memcpy(&header, map, sizeof(header));
+        if (header.m_Magic != PACKAGE_MAGIC) {
+            return Err(fmt::format("{} is not a package", path.string()));
+        }
+        if (header.m_Version != PACKAGE_VERSION) {
+            return Err(fmt::format(
+                "{} has unsupported version {}", path.string(), header.m_Version));
+        }
+        const u64 entriesSize = u64 {header.m_EntryCount} * sizeof(PackageEntry_t);
+        if (header.m_FileSize != size || header.m_TocOffset % alignof(PackageEntry_t) != 0
+            || header.m_TocOffset > size || header.m_TocSize > size - header.m_TocOffset
+            || entriesSize > header.m_TocSize) {
+            return Err(fmt::format("{} is truncated or corrupt", path.string()));
+        }
+        const std::byte* toc = package.m_Map + header.m_TocOffset;
+        if (crc32c({toc, header.m_TocSize}) != header.m_TocChecksum) {
+            return Err(fmt::format("{} has a corrupt table of contents", path.string()));
+        }
+
+        // The table of contents is used in place, like the blobs
+        package.m_Entries   = {reinterpret_cast<const PackageEntry_t*>(toc), header.m_EntryCount};
+        package.m_Names     = reinterpret_cast<const char*>(toc + entriesSize);
+        package.m_NamesSize = header.m_TocSize - entriesSize;
+
+        auto valid = validate(header, package.m_Entries, {package.m_Names, package.m_NamesSize});
+        if (!valid.has_value()) {
+            return Err(fmt::format("{}: {}", path.string(), valid.error()));
+        }
+        return package;
+    }
+
+    Package::Package(const std::byte* map, usize size) : m_Map(map), m_Size(size) {
+    }
+
+    Package::Package(Package&& other) noexcept
+        : m_Map(std::exchange(other.m_Map, nullptr)), m_Size(std::exchange(other.m_Size, 0)),
+          m_Entries(std::exchange(other.m_Entries, {})),
+          m_Names(std::exchange(other.m_Names, nullptr)),
+          m_NamesSize(std::exchange(other.m_NamesSize, 0)) {
+    }
+
+    Package& Package::operator=(Package&& other) noexcept {
+        if (this != &other) {
+            if (m_Map != nullptr) {
+                munmap(const_cast<std::byte*>(m_Map), m_Size);
+            }
+            m_Map       = std::exchange(other.m_Map, nullptr);
+            m_Size      = std::exchange(other.m_Size, 0);
+            m_Entries   = std::exchange(other.m_Entries, {});
+            m_Names     = std::exchange(other.m_Names, nullptr);
+            m_NamesSize = std::exchange(other.m_NamesSize, 0);
+        }
+        return *this;
+    }
+
+    Package::~Package() {
+        if (m_Map != nullptr) {
+            munmap(const_cast<std::byte*>(m_Map), m_Size);
+        }
+    }
+
+    const PackageEntry_t* Package::find(std::string_view name) const {
+        const u64 hash = fnv1a_64(name);
+        auto      it   = std::ranges::lower_bound(
+            m_Entries, hash, {}, &PackageEntry_t::m_NameHash);
+        // Colliding hashes are adjacent and ordered by name
+        for (; it != m_Entries.end() && it->m_NameHash == hash; ++it) {
+            if (this->name(*it) == name) {
+                return &*it;
+            }
+        }
+        return nullptr;
+    }
+
+    std::string_view Package::name(const PackageEntry_t& entry) const {
+        return {m_Names + entry.m_NameOffset, entry.m_NameSize};
+    }
+
+    std::span<const std::byte> Package::data(const PackageEntry_t& entry) const {
+        return {m_Map + entry.m_Offset, entry.m_Size};
+    }
+
+    bool Package::verify(const PackageEntry_t& entry) const {
+        return crc32c(data(entry)) == entry.m_Checksum;
+    }
+
+    void Package::prefetch(const PackageEntry_t& entry) const {
+        advise(entry.m_Offset, entry.m_Size, MADV_WILLNEED);
+    }
+
+    void Package::prefetch(std::span<const PackageEntry_t* const> entries) const {
+        // Gaps up to this size are read along instead of splitting the request
+        constexpr u64 MAX_GAP = PACKAGE_LARGE_ALIGNMENT;
+
+        std::vector<const PackageEntry_t*> sorted(entries.begin(), entries.end());
+        std::ranges::sort(sorted, {}, &PackageEntry_t::m_Offset);
+        u64 start = 0;
+        u64 end   = 0;
+        for (const PackageEntry_t* entry : sorted) {
+            if (entry->m_Offset > end + MAX_GAP) {
+                advise(start, end - start, MADV_WILLNEED);
+                start = entry->m_Offset;
+            }
+            end = std::max(end, entry->m_Offset + entry->m_Size);
+        }
+        advise(start, end - start, MADV_WILLNEED);
+    }
+
+    void Package::release(const PackageEntry_t& entry) const {
+        advise(entry.m_Offset, entry.m_Size, MADV_DONTNEED);
+    }
+
+    void Package::advise(u64 offset, u64 size, int advice) const {
+        if (size == 0) {
+            return;
+        }
+        // Blobs start on a page, only the length needs rounding
+        madvise(const_cast<std::byte*>(m_Map + offset), align_up(size, PACKAGE_PAGE_ALIGNMENT),
+            advice);
+    }
+} // namespace Pulsar
+// NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast, cppcoreguidelines-pro-bounds-pointer-arithmetic)
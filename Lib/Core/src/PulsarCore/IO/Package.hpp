@@ -0,0 +1,143 @@
+#pragma once
+
+#include "PulsarCore/Result.hpp"
+#include "PulsarCore/Types.hpp"
+
+#include <array>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace Pulsar {
+    constexpr std::array<char, 8> PACKAGE_MAGIC   = {'P', 'L', 'S', 'R', 'P', 'A', 'K', '\0'};
+    constexpr u32                 PACKAGE_VERSION = 1;
+    /// Every blob starts on a page, so it can be mapped and used in place
+    constexpr u64 PACKAGE_PAGE_ALIGNMENT = 4096;
+    /// Blobs of at least `PACKAGE_LARGE_BLOB_SIZE` bytes start on a 64 KiB boundary, which is
+    /// the mapping granularity on Windows and a whole readahead window on Linux
+    constexpr u64 PACKAGE_LARGE_ALIGNMENT = 65536;
+    constexpr u64 PACKAGE_LARGE_BLOB_SIZE = u64 {1} << 20;
+
+    /// How a blob is stored
+    /// # Usage
+    /// Only `None` exists so far, and readers reject codecs they do not know. A codec can be
+    /// added without a new format version: old readers fail to open such packages instead of
+    /// returning compressed bytes.
+    enum class PackageCompression : u8 {
+        /// The stored bytes are the asset, used in place
+        None = 0,
+    };
+
+    /// Fixed header at the start of a `.pak` file
+    /// # File format
+    /// - The header, padded to `PACKAGE_PAGE_ALIGNMENT`.
+    /// - The blobs, each aligned to its entry's alignment, with zero padding in between.
+    /// - The table of contents at `m_TocOffset`: `m_EntryCount` entries sorted by name hash
+    ///   (then name), followed by the names (UTF-8, not terminated).
+    ///
+    /// All integers are little endian.
+    struct PackageHeader_t {
+        std::array<char, 8> m_Magic;
+        u32                 m_Version;
+        u32                 m_EntryCount;
+        u64                 m_TocOffset;
+        /// Entries and names
+        u64 m_TocSize;
+        u64 m_FileSize;
+        /// CRC-32C of the table of contents
+        u32                m_TocChecksum;
+        u32                m_Reserved0;
+        std::array<u64, 2> m_Reserved1;
+    };
+    static_assert(sizeof(PackageHeader_t) == 64);
+
+    /// One blob in the table of contents
+    struct PackageEntry_t {
+        /// `fnv1a_64` of the name
+        u64 m_NameHash;
+        /// Of the stored bytes, from the start of the file
+        u64 m_Offset;
+        u64 m_Size;
+        /// Size after decompression, equal to `m_Size` for `PackageCompression::None`
+        u64 m_RawSize;
+        /// Into the names after the entries
+        u32 m_NameOffset;
+        u32 m_NameSize;
+        /// CRC-32C of the stored bytes
+        u32                m_Checksum;
+        PackageCompression m_Compression;
+        /// log2 of the blob's alignment
+        u8  m_AlignmentShift;
+        u16 m_Reserved;
+    };
+    static_assert(sizeof(PackageEntry_t) == 48);
+
+    /// A read-only, memory-mapped `.pak` file
+    /// # Usage
+    /// `find` an asset by name and use its `data` directly: the span points into the mapping,
+    /// nothing is read or copied until the bytes are touched. `prefetch` the assets a level is
+    /// about to need so the kernel reads them in the background instead of faulting them in one
+    /// page at a time on first use.
+    /// # Performance
+    /// `open` validates the table of contents (bounds, order, checksum) once, lookups are then a
+    /// binary search over the sorted hashes. Blob checksums are only checked by `verify`, since
+    /// checking them on open would read the whole file. With the file in the page cache, using
+    /// blobs in place beats copying them out with `read`, most of all for small assets. From a
+    /// cold disk, faulting pages in is slower than one streaming read: `prefetch` well before the
+    /// data is used.
+    class Package {
+    public:
+        /// Maps `path` and validates its table of contents
+        [[nodiscard]] static Result<Package, std::string> open(const std::filesystem::path& path);
+
+        Package(const Package&) = delete;
+        Package(Package&& other) noexcept;
+        Package& operator=(const Package&) = delete;
+        Package& operator=(Package&& other) noexcept;
+        ~Package();
+
+        [[nodiscard]] std::span<const PackageEntry_t> entries() const {
+            return m_Entries;
+        }
+
+        /// The entry named `name`, or null
+        [[nodiscard]] const PackageEntry_t* find(std::string_view name) const;
+
+        [[nodiscard]] std::string_view name(const PackageEntry_t& entry) const;
+
+        /// The stored bytes of `entry`, valid as long as the package is
+        [[nodiscard]] std::span<const std::byte> data(const PackageEntry_t& entry) const;
+
+        /// Reads the whole blob and checks it against the stored checksum
+        [[nodiscard]] bool verify(const PackageEntry_t& entry) const;
+
+        /// Asks the kernel to start reading `entry` into the page cache, returns immediately
+        void prefetch(const PackageEntry_t& entry) const;
+
+        /// `prefetch` for a batch, e.g. everything a level loads. Blobs that are close in the file
+        /// are merged into one request, one `madvise` call per small asset costs more than it
+        /// saves.
+        void prefetch(std::span<const PackageEntry_t* const> entries) const;
+
+        /// Tells the kernel the mapped pages of `entry` are not needed anymore. The next access
+        /// faults them in again, from the page cache if they are still there.
+        void release(const PackageEntry_t& entry) const;
+
+        /// Size of the mapped file
+        [[nodiscard]] usize size_bytes() const {
+            return m_Size;
+        }
+
+    private:
+        Package(const std::byte* map, usize size);
+
+        void advise(u64 offset, u64 size, int advice) const;
+
+        const std::byte*                m_Map  = nullptr;
+        usize                           m_Size = 0;
+        std::span<const PackageEntry_t> m_Entries;
+        const char*                     m_Names     = nullptr;
+        usize                           m_NamesSize = 0;
+    };
+} // namespace Pulsar
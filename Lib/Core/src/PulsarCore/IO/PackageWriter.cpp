@@ -0,0 +1,187 @@
+#include "PackageWriter.hpp"
+
+#include "PulsarCore/Util/Hash.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <fmt/format.h>
+#include <fstream>
+#include <limits>
+#include <numeric>
+#include <system_error>
+#include <utility>
+
+// NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+namespace Pulsar {
+    namespace {
+        constexpr u64 align_up(u64 value, u64 alignment) {
+            return (value + alignment - 1) & ~(alignment - 1);
+        }
+
+        Result<bool, std::string> read_file(
+            const std::filesystem::path& path, std::vector<std::byte>& out) {
+            std::ifstream input(path, std::ios::binary | std::ios::ate);
+            if (!input) {
+                return Err(fmt::format("Failed to open {}", path.string()));
+            }
+            const std::streamsize size = input.tellg();
+            out.resize(static_cast<usize>(size));
+            input.seekg(0);
+            if (!input.read(reinterpret_cast<char*>(out.data()), size)) {
+                return Err(fmt::format("Failed to read {}", path.string()));
+            }
+            return true;
+        }
+
+        /// Removes the file when it goes out of scope, unless `m_Keep` was set
+        struct TemporaryFile_t {
+            std::filesystem::path m_Path;
+            bool                  m_Keep = false;
+
+            explicit TemporaryFile_t(std::filesystem::path path) : m_Path(std::move(path)) {
+            }
+
+            TemporaryFile_t(const TemporaryFile_t&)            = delete;
+            TemporaryFile_t(TemporaryFile_t&&)                 = delete;
+            TemporaryFile_t& operator=(const TemporaryFile_t&) = delete;
+            TemporaryFile_t& operator=(TemporaryFile_t&&)      = delete;
+
+            ~TemporaryFile_t() {
+                if (!m_Keep) {
+                    std::error_code error;
+                    std::filesystem::remove(m_Path, error);
+                }
+            }
+        };
+
+        void write_zeros(std::ofstream& out, u64 count) {
+            static constexpr std::array<char, 4096> ZEROS {};
+            while (count > 0) {
+                const u64 chunk = std::min<u64>(count, ZEROS.size());
+                out.write(ZEROS.data(), static_cast<std::streamsize>(chunk));
+                count -= chunk;
+            }
+        }
+
+        void write_bytes(std::ofstream& out, const void* data, usize size) {
+            out.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+        }
+    } // namespace
+
+    void PackageWriter::add(std::string name, std::span<const std::byte> data) {
+        m_Blobs.push_back({std::move(name), {data.begin(), data.end()}, {}});
+    }
+
+    void PackageWriter::add_file(std::string name, std::filesystem::path path) {
+        m_Blobs.push_back({std::move(name), {}, std::move(path)});
+    }
+
+    Result<u64, std::string> PackageWriter::write(const std::filesystem::path& path) const {
+        if (m_Blobs.size() > std::numeric_limits<u32>::max()) {
+            return Err(std::string("Too many entries for one package"));
+        }
+        std::vector<PackageEntry_t> entries(m_Blobs.size());
+        std::string                 names;
+        for (usize i = 0; i < m_Blobs.size(); i++) {
+            const std::string& name = m_Blobs[i].m_Name;
+            if (names.size() + name.size() > std::numeric_limits<u32>::max()) {
+                return Err(std::string("Too many names for one package"));
+            }
+            entries[i].m_NameHash   = fnv1a_64(name);
+            entries[i].m_NameOffset = static_cast<u32>(names.size());
+            entries[i].m_NameSize   = static_cast<u32>(name.size());
+            names += name;
+        }
+
+        // Table of contents order, blobs stay in the order they were added
+        std::vector<usize> order(m_Blobs.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::ranges::sort(order, [&](usize a, usize b) {
+            if (entries[a].m_NameHash != entries[b].m_NameHash) {
+                return entries[a].m_NameHash < entries[b].m_NameHash;
+            }
+            return m_Blobs[a].m_Name < m_Blobs[b].m_Name;
+        });
+        for (usize i = 1; i < order.size(); i++) {
+            if (m_Blobs[order[i - 1]].m_Name == m_Blobs[order[i]].m_Name) {
+                return Err(fmt::format("Duplicate entry '{}'", m_Blobs[order[i]].m_Name));
+            }
+        }
+
+        std::filesystem::path temporary = path;
+        temporary += ".tmp";
+        // Declared before the stream, so the file is closed by the time it is removed
+        TemporaryFile_t cleanup(temporary);
+        std::ofstream   out(temporary, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            return Err(fmt::format("Failed to create {}", temporary.string()));
+        }
+
+        // The header is written last, once the offsets are known
+        write_zeros(out, PACKAGE_PAGE_ALIGNMENT);
+        u64                    offset = PACKAGE_PAGE_ALIGNMENT;
+        std::vector<std::byte> fileData;
+        for (usize i = 0; i < m_Blobs.size(); i++) {
+            const Blob_t&              blob = m_Blobs[i];
+            std::span<const std::byte> data = blob.m_Data;
+            if (!blob.m_Path.empty()) {
+                auto read = read_file(blob.m_Path, fileData);
+                if (!read.has_value()) {
+                    return Err(std::move(read.error()));
+                }
+                data = fileData;
+            }
+            const u64 alignment = data.size() >= PACKAGE_LARGE_BLOB_SIZE ? PACKAGE_LARGE_ALIGNMENT
+                                                                         : PACKAGE_PAGE_ALIGNMENT;
+            const u64 start     = align_up(offset, alignment);
+            write_zeros(out, start - offset);
+
+            PackageEntry_t& entry  = entries[i];
+            entry.m_Offset         = start;
+            entry.m_Size           = data.size();
+            entry.m_RawSize        = data.size();
+            entry.m_Checksum       = crc32c(data);
+            entry.m_Compression    = PackageCompression::None;
+            entry.m_AlignmentShift = static_cast<u8>(std::countr_zero(alignment));
+            write_bytes(out, data.data(), data.size());
+            offset = start + data.size();
+        }
+
+        std::vector<std::byte> toc(entries.size() * sizeof(PackageEntry_t) + names.size());
+        for (usize i = 0; i < order.size(); i++) {
+            std::memcpy(toc.data() + i * sizeof(PackageEntry_t), &entries[order[i]],
+                sizeof(PackageEntry_t));
+        }
+        std::memcpy(toc.data() + entries.size() * sizeof(PackageEntry_t), names.data(),
+            names.size());
+
+        PackageHeader_t header {};
+        header.m_Magic       = PACKAGE_MAGIC;
+        header.m_Version     = PACKAGE_VERSION;
+        header.m_EntryCount  = static_cast<u32>(entries.size());
+        header.m_TocOffset   = align_up(offset, alignof(PackageEntry_t));
+        header.m_TocSize     = toc.size();
+        header.m_FileSize    = header.m_TocOffset + toc.size();
+        header.m_TocChecksum = crc32c(toc);
+        write_zeros(out, header.m_TocOffset - offset);
+        write_bytes(out, toc.data(), toc.size());
+        out.seekp(0);
+        write_bytes(out, &header, sizeof(header));
+        out.close();
+        if (!out) {
+            return Err(fmt::format("Failed to write {}", temporary.string()));
+        }
+
+        std::error_code error;
+        std::filesystem::rename(temporary, path, error);
+        if (error) {
+            return Err(fmt::format("Failed to move {} to {}: {}", temporary.string(), path.string(),
+                error.message()));
+        }
+        cleanup.m_Keep = true;
+        return header.m_FileSize;
+    }
+} // namespace Pulsar
+// NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
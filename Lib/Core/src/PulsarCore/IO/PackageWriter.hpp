@@ -0,0 +1,43 @@
+#pragma once
+
+#include "PulsarCore/IO/Package.hpp"
+#include "PulsarCore/Result.hpp"
+#include "PulsarCore/Types.hpp"
+
+#include <filesystem>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace Pulsar {
+    /// Builds a `.pak` file, see `Package` for the format
+    /// # Usage
+    /// `add` blobs in the order the game is expected to load them, they are laid out in that
+    /// order so loading a level reads the file mostly front to back. The table of contents is
+    /// sorted independently. Nothing is written before `write`.
+    class PackageWriter {
+    public:
+        /// Copies `data`
+        void add(std::string name, std::span<const std::byte> data);
+        /// Reads the file when the package is written
+        void add_file(std::string name, std::filesystem::path path);
+
+        [[nodiscard]] usize size() const {
+            return m_Blobs.size();
+        }
+
+        /// Writes the package to a temporary file next to `path` and renames it over `path` once
+        /// complete, returns the size of the package. Fails on duplicate names.
+        [[nodiscard]] Result<u64, std::string> write(const std::filesystem::path& path) const;
+
+    private:
+        struct Blob_t {
+            std::string            m_Name;
+            std::vector<std::byte> m_Data;
+            /// Empty for blobs added from memory
+            std::filesystem::path m_Path;
+        };
+
+        std::vector<Blob_t> m_Blobs;
+    };
+} // namespace Pulsar
@@ -1,22 +1,122 @@
 #include "Log.hpp"
 
+#include "PulsarCore/Log/AsyncSink.hpp"
+#include "PulsarCore/Sync/Mutex.hpp"
+
+#include <exception>
+#include <mutex>
 #include <spdlog/sinks/stdout_color_sinks.h>
 
 namespace Pulsar {
-    Result<bool, std::string> Log::init() {
-        s_Logger = spdlog::stdout_color_mt("Pulsar");
-        s_Logger->set_level(spdlog::level::trace);
-        s_Logger->set_pattern("[%Y-%m-%d %H:%M:%S.%e] [%^%l%$] %v");
+    namespace {
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+        std::terminate_handler g_PreviousTerminateHandler = nullptr;
+
+        /// Makes sure queued records reach the sinks before an uncaught exception kills us
+        void install_terminate_handler() {
+            PULSAR_RUN_ONCE {
+                g_PreviousTerminateHandler = std::set_terminate([] {
+                    Log::flush();
+                    if (g_PreviousTerminateHandler != nullptr) {
+                        g_PreviousTerminateHandler();
+                    }
+                    std::abort();
+                });
+            }
+        }
+    } // namespace
+
+    Result<bool, std::string> Log::init(const LogConfig_t& config) {
+        std::vector<spdlog::sink_ptr> sinks = config.m_Sinks;
+        if (sinks.empty()) {
+            sinks.push_back(std::make_shared<spdlog::sinks::stdout_color_sink_mt>());
+        }
+        // A previous binary log is closed before the new configuration takes over
+        s_Binary.store(false, std::memory_order_relaxed);
+        BinaryLog::close();
+        if (config.m_Mode == LogMode::Binary) {
+            auto opened = BinaryLog::open(config.m_BinaryPath, config.m_BinaryThreadBufferSize);
+            if (!opened.has_value()) {
+                return opened;
+            }
+        }
+        else if (config.m_Mode == LogMode::Async) {
+            // One writer thread shared by every category
+            sinks = {std::make_shared<AsyncSink>(
+                std::move(sinks), config.m_QueueCapacity, config.m_OverflowPolicy)};
+        }
+
+        auto recorder = FlightRecorder::enable(config.m_FlightRecorder);
+        if (!recorder.has_value()) {
+            return recorder;
+        }
+
+        std::array<std::shared_ptr<spdlog::logger>, LOG_CATEGORY_COUNT> loggers;
+        try {
+            for (usize i = 0; i < LOG_CATEGORY_COUNT; i++) {
+                const std::string name(to_string(static_cast<LogCategory>(i)));
+                loggers[i] = std::make_shared<spdlog::logger>(name, sinks.begin(), sinks.end());
+                // Filtering happens in front of the logger, see `Log::is_enabled`
+                loggers[i]->set_level(spdlog::level::trace);
+                loggers[i]->set_pattern("[%Y-%m-%d %H:%M:%S.%e] [%^%l%$] [%n] %v");
+            }
+        }
+        catch (const spdlog::spdlog_ex& ex) {
+            return Err<std::string>(fmt::format("Failed to initialize logger: {}", ex.what()));
+        }
 
-        if (s_Logger == nullptr) {
-            return Err<std::string>("Failed to initialize logger");
+        for (usize i = 0; i < LOG_CATEGORY_COUNT; i++) {
+            s_Loggers[i].store(loggers[i].get(), std::memory_order_release);
         }
+        // Drop the previous loggers only after the new ones are published
+        s_Owners = std::move(loggers);
+        set_level(config.m_Level);
+        s_Binary.store(config.m_Mode == LogMode::Binary, std::memory_order_relaxed);
+        install_terminate_handler();
+
         PL_LOG_DEBUG("Logger initialized");
         return Result<bool, std::string>(true);
     }
 
     void Log::shutdown() {
-        s_Logger = nullptr;
+        flush();
+        s_Binary.store(false, std::memory_order_relaxed);
+        BinaryLog::close();
+        FlightRecorder::disable();
+        for (usize i = 0; i < LOG_CATEGORY_COUNT; i++) {
+            update_gate(static_cast<LogCategory>(i));
+        }
+        for (auto& logger : s_Loggers) {
+            logger.store(nullptr, std::memory_order_release);
+        }
+        s_Owners = {};
         spdlog::shutdown();
     }
+
+    void Log::flush() {
+        BinaryLog::flush();
+        for (auto& logger : s_Loggers) {
+            if (spdlog::logger* current = logger.load(std::memory_order_acquire)) {
+                current->flush();
+            }
+        }
+    }
+
+    spdlog::logger& Log::get_fallback_logger(LogCategory category) {
+        static Mutex    mutex;
+        std::lock_guard lock(mutex);
+
+        auto& slot = s_Loggers[static_cast<usize>(category)];
+        if (slot.load(std::memory_order_acquire) == nullptr) {
+            if (init().has_value()) {
+                PL_LOG_WARN("Logger was not initialized, using default logger");
+            }
+            else {
+                fmt::print(stderr, "Logger was not initialized, and failed to initialize "
+                                   "Just-In-Time logger\n");
+                std::abort();
+            }
+        }
+        return *slot.load(std::memory_order_acquire);
+    }
 } // namespace Pulsar
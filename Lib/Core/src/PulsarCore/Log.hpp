@@ -1,45 +1,235 @@
 #pragma once
 
+#include "PulsarCore/Log/BinaryLog.hpp"
+#include "PulsarCore/Log/FlightRecorder.hpp"
+#include "PulsarCore/Result.hpp"
+#include "PulsarCore/Types.hpp"
 #include "PulsarCore/Util/Macros.hpp"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <filesystem>
 #include <memory>
+#include <spdlog/spdlog.h>
 #include <string>
+#include <string_view>
+#include <vector>
 
-#define SPDLOG_LOG_LEVEL 0
-#include "PulsarCore/Result.hpp"
+// Compile-time minimum levels, statements below them are not compiled in. `PULSAR_LOG_LEVEL` sets
+// the default for every category, `PULSAR_LOG_LEVEL_<CATEGORY>` overrides a single category. They
+// take spdlog's `SPDLOG_LEVEL_*` values and must be the same for the whole build.
+#ifndef PULSAR_LOG_LEVEL
+    #ifdef PULSAR_DEBUG
+        #define PULSAR_LOG_LEVEL SPDLOG_LEVEL_TRACE
+    #else
+        #define PULSAR_LOG_LEVEL SPDLOG_LEVEL_INFO
+    #endif
+#endif
+#ifndef PULSAR_LOG_LEVEL_GENERAL
+    #define PULSAR_LOG_LEVEL_GENERAL PULSAR_LOG_LEVEL
+#endif
+#ifndef PULSAR_LOG_LEVEL_CORE
+    #define PULSAR_LOG_LEVEL_CORE PULSAR_LOG_LEVEL
+#endif
+#ifndef PULSAR_LOG_LEVEL_ENGINE
+    #define PULSAR_LOG_LEVEL_ENGINE PULSAR_LOG_LEVEL
+#endif
+#ifndef PULSAR_LOG_LEVEL_WINDOW
+    #define PULSAR_LOG_LEVEL_WINDOW PULSAR_LOG_LEVEL
+#endif
+#ifndef PULSAR_LOG_LEVEL_EDITOR
+    #define PULSAR_LOG_LEVEL_EDITOR PULSAR_LOG_LEVEL
+#endif
 
-#include <spdlog/spdlog.h>
+/// Logs to a category, usage: `PL_LOG_CAT(Window, spdlog::level::info, "Resized to {}", size)`
+/// # Performance
+/// A statement below the category's compile-time level compiles to nothing (the arguments are
+/// still type-checked). Otherwise a disabled statement costs one relaxed load and a branch, the
+/// arguments are only evaluated when the statement is enabled. The format has to be a string
+/// literal, it is kept as static call site metadata for `LogMode::Binary`.
+#define PL_LOG_CAT(category, level, format, ...)                                                   \
+    do {                                                                                           \
+        if constexpr (::Pulsar::Log::is_compiled_in(::Pulsar::LogCategory::category, level)) {     \
+            if (::Pulsar::Log::is_enabled(::Pulsar::LogCategory::category, level)) [[unlikely]] {  \
+                static constinit ::Pulsar::BinaryLogSite_t plLogSite {                             \
+                    ::Pulsar::LogCategory::category, level, __FILE__, __LINE__, format};           \
+                ::Pulsar::Log::write(plLogSite, format __VA_OPT__(, ) __VA_ARGS__);                \
+            }                                                                                      \
+        }                                                                                          \
+    } while (false)
+
+#define PL_LOG_CAT_FATAL(category, ...) PL_LOG_CAT(category, spdlog::level::critical, __VA_ARGS__)
+#define PL_LOG_CAT_ERROR(category, ...) PL_LOG_CAT(category, spdlog::level::err, __VA_ARGS__)
+#define PL_LOG_CAT_WARN(category, ...) PL_LOG_CAT(category, spdlog::level::warn, __VA_ARGS__)
+#define PL_LOG_CAT_INFO(category, ...) PL_LOG_CAT(category, spdlog::level::info, __VA_ARGS__)
+#define PL_LOG_CAT_DEBUG(category, ...) PL_LOG_CAT(category, spdlog::level::debug, __VA_ARGS__)
+#define PL_LOG_CAT_TRACE(category, ...) PL_LOG_CAT(category, spdlog::level::trace, __VA_ARGS__)
 
-#define PL_LOG_FATAL(...) SPDLOG_LOGGER_CRITICAL(Pulsar::Log::get_logger(), __VA_ARGS__)
-#define PL_LOG_ERROR(...) SPDLOG_LOGGER_ERROR(Pulsar::Log::get_logger(), __VA_ARGS__)
-#define PL_LOG_WARN(...) SPDLOG_LOGGER_WARN(Pulsar::Log::get_logger(), __VA_ARGS__)
-#define PL_LOG_INFO(...) SPDLOG_LOGGER_INFO(Pulsar::Log::get_logger(), __VA_ARGS__)
-#define PL_LOG_DEBUG(...) SPDLOG_LOGGER_DEBUG(Pulsar::Log::get_logger(), __VA_ARGS__)
-#define PL_LOG_TRACE(...) SPDLOG_LOGGER_TRACE(Pulsar::Log::get_logger(), __VA_ARGS__)
+#define PL_LOG_FATAL(...) PL_LOG_CAT_FATAL(General, __VA_ARGS__)
+#define PL_LOG_ERROR(...) PL_LOG_CAT_ERROR(General, __VA_ARGS__)
+#define PL_LOG_WARN(...) PL_LOG_CAT_WARN(General, __VA_ARGS__)
+#define PL_LOG_INFO(...) PL_LOG_CAT_INFO(General, __VA_ARGS__)
+#define PL_LOG_DEBUG(...) PL_LOG_CAT_DEBUG(General, __VA_ARGS__)
+#define PL_LOG_TRACE(...) PL_LOG_CAT_TRACE(General, __VA_ARGS__)
 
 namespace Pulsar {
+    /// Log channels, each one has its own logger name, compile-time and runtime level
+    enum class LogCategory : u8 {
+        General,
+        Core,
+        Engine,
+        Window,
+        Editor,
+        COUNT,
+    };
+
+    constexpr usize LOG_CATEGORY_COUNT = static_cast<usize>(LogCategory::COUNT);
+
+    [[nodiscard]] constexpr std::string_view to_string(LogCategory category) {
+        constexpr std::array<std::string_view, LOG_CATEGORY_COUNT> NAMES = {
+            "General", "Core", "Engine", "Window", "Editor"};
+        return NAMES[static_cast<usize>(category)];
+    }
+
+    enum class LogMode : u8 {
+        /// Records are formatted and written on the calling thread
+        Sync,
+        /// Records are queued and written by a background thread, see `AsyncSink`
+        Async,
+        /// Records are written unformatted to `m_BinaryPath`, see `BinaryLog`. Use
+        /// `PulsarLogDecode` to read the file.
+        Binary,
+    };
+
+    /// What an async logger does when its queue is full
+    enum class LogOverflowPolicy : u8 {
+        /// The caller waits until the writer makes room, nothing is lost
+        Block,
+        /// The new record is discarded
+        Drop,
+        /// The oldest queued record is discarded to make room for the new one
+        OverwriteOldest,
+    };
+
+    struct LogConfig_t {
+        LogMode           m_Mode           = LogMode::Sync;
+        usize             m_QueueCapacity  = 8192;
+        LogOverflowPolicy m_OverflowPolicy = LogOverflowPolicy::Block;
+        /// Initial runtime level of every category
+        spdlog::level::level_enum m_Level = spdlog::level::trace;
+        /// The sinks to write to, defaults to a colored stdout sink. Unused in binary mode, except
+        /// by code that talks to `get_logger` directly.
+        std::vector<spdlog::sink_ptr> m_Sinks;
+        std::filesystem::path         m_BinaryPath = "Pulsar.plog";
+        /// Size of the per-thread ring in binary mode, rounded up to a power of two
+        usize m_BinaryThreadBufferSize = usize {1} << 20;
+        /// Keeps recent records in memory, see `FlightRecorder`. Its level applies on top of
+        /// `m_Level`: records it wants are evaluated even when no sink writes them.
+        FlightRecorderConfig_t m_FlightRecorder;
+    };
+
     class Log {
     public:
-        [[nodiscard]] static Result<bool, std::string> init();
-        static void                                    shutdown();
+        [[nodiscard]] static Result<bool, std::string> init(const LogConfig_t& config = {});
+        /// Flushes and tears down the loggers, queued records are written before this returns
+        static void shutdown();
+        /// Blocks until every record logged so far has been written
+        static void flush();
+
+        static void set_level(LogCategory category, spdlog::level::level_enum level) {
+            s_SinkLevels[static_cast<usize>(category)].store(level, std::memory_order_relaxed);
+            update_gate(category);
+        }
+
+        static void set_level(spdlog::level::level_enum level) {
+            for (usize i = 0; i < LOG_CATEGORY_COUNT; i++) {
+                set_level(static_cast<LogCategory>(i), level);
+            }
+        }
+
+        /// The level of the sinks, the flight recorder may still record below it
+        [[nodiscard]] static spdlog::level::level_enum get_level(LogCategory category) {
+            return static_cast<spdlog::level::level_enum>(
+                s_SinkLevels[static_cast<usize>(category)].load(std::memory_order_relaxed));
+        }
+
+        [[nodiscard]] static constexpr bool is_compiled_in(
+            LogCategory category, spdlog::level::level_enum level) {
+            return static_cast<int>(level) >= COMPILE_TIME_LEVELS[static_cast<usize>(category)];
+        }
 
-        // NOLINTNEXTLINE(misc-no-recursion)
-        [[nodiscard]] static std::shared_ptr<spdlog::logger> get_logger() {
-            PULSAR_DEBUG_RUN_ONCE {
-                if (s_Logger == nullptr) {
-                    if (init().has_value()) {
-                        PL_LOG_WARN("Logger was not initialized, using default logger");
-                    }
-                    else {
-                        fmt::println(
-                            "Logger was not initialized, and failed to initialize Just-In-Time logger");
-                    }
-                }
+        [[nodiscard]] PULSAR_ALWAYS_INLINE static bool is_enabled(
+            LogCategory category, spdlog::level::level_enum level) {
+            return static_cast<u8>(level)
+                >= s_Levels[static_cast<usize>(category)].load(std::memory_order_relaxed);
+        }
+
+        /// Backend of `PL_LOG_CAT`, hands an enabled statement to the flight recorder and to
+        /// spdlog or the binary log. A fatal statement also dumps the flight recorder.
+        template<typename... Args>
+        static void write(BinaryLogSite_t& site, spdlog::format_string_t<Args...> format,
+                          Args&&... args) {
+            const bool recording = FlightRecorder::is_enabled();
+            if (recording && site.m_Level >= FlightRecorder::get_level()) {
+                FlightRecorder::record(site, internal::binary_arg(args)...);
+            }
+            const auto sinkLevel =
+                s_SinkLevels[static_cast<usize>(site.m_Category)].load(std::memory_order_relaxed);
+            if (static_cast<u8>(site.m_Level) < sinkLevel) {
+                return;
+            }
+            if (s_Binary.load(std::memory_order_relaxed)) {
+                BinaryLog::write(site, internal::binary_arg(args)...);
+            }
+            else {
+                get_logger(site.m_Category)
+                    .log(spdlog::source_loc {site.m_File, static_cast<int>(site.m_Line), ""},
+                         site.m_Level, format, std::forward<Args>(args)...);
+            }
+            if (recording && site.m_Level == spdlog::level::critical) [[unlikely]] {
+                flush();
+                FlightRecorder::dump_crash();
             }
-            return s_Logger;
+        }
+
+        /// The logger of a category, initializes a default logger on first use if `init` was not
+        /// called. The reference stays valid until `shutdown` or the next `init`.
+        [[nodiscard]] PULSAR_ALWAYS_INLINE static spdlog::logger& get_logger(
+            LogCategory category = LogCategory::General) {
+            spdlog::logger* logger =
+                s_Loggers[static_cast<usize>(category)].load(std::memory_order_acquire);
+            if (logger == nullptr) [[unlikely]] {
+                return get_fallback_logger(category);
+            }
+            return *logger;
         }
 
     private:
-        inline static std::shared_ptr<spdlog::logger> s_Logger = nullptr;
+        static constexpr std::array<int, LOG_CATEGORY_COUNT> COMPILE_TIME_LEVELS = {
+            PULSAR_LOG_LEVEL_GENERAL, PULSAR_LOG_LEVEL_CORE,   PULSAR_LOG_LEVEL_ENGINE,
+            PULSAR_LOG_LEVEL_WINDOW,  PULSAR_LOG_LEVEL_EDITOR,
+        };
+
+        PULSAR_NO_INLINE static spdlog::logger& get_fallback_logger(LogCategory category);
+
+        /// The macros let a statement through if the sinks or the flight recorder want it
+        static void update_gate(LogCategory category) {
+            const auto index = static_cast<usize>(category);
+            auto       level = s_SinkLevels[index].load(std::memory_order_relaxed);
+            if (FlightRecorder::is_enabled()) {
+                level = std::min(level, static_cast<u8>(FlightRecorder::get_level()));
+            }
+            s_Levels[index].store(level, std::memory_order_relaxed);
+        }
+
+        // The owners keep the loggers alive, the macros only ever touch the raw pointers so no
+        // reference count is modified on the logging path
+        inline static std::array<std::shared_ptr<spdlog::logger>, LOG_CATEGORY_COUNT> s_Owners;
+        inline static std::array<std::atomic<spdlog::logger*>, LOG_CATEGORY_COUNT>    s_Loggers {};
+        inline static std::atomic<bool> s_Binary {false};
+        // Zero is spdlog::level::trace, so everything is enabled until `init` says otherwise
+        inline static std::array<std::atomic<u8>, LOG_CATEGORY_COUNT> s_Levels {};
+        inline static std::array<std::atomic<u8>, LOG_CATEGORY_COUNT> s_SinkLevels {};
     };
 } // namespace Pulsar
@@ -0,0 +1,200 @@
+#include "AsyncSink.hpp"
+
+#include <bit>
+
+namespace Pulsar {
+    AsyncSink::AsyncSink(
+        std::vector<spdlog::sink_ptr> sinks, usize capacity, LogOverflowPolicy policy)
+        : m_Sinks(std::move(sinks)), m_Capacity(std::bit_ceil(std::max<usize>(capacity, 2))),
+          m_Mask(m_Capacity - 1), m_Policy(policy) {
+        m_Slots = std::make_unique<Slot_t[]>(m_Capacity); // NOLINT(*-avoid-c-arrays)
+        for (usize i = 0; i < m_Capacity; i++) {
+            m_Slots[i].m_Sequence.store(i, std::memory_order_relaxed);
+        }
+        m_Writer = std::thread([this] { writer_main(); });
+    }
+
+    AsyncSink::~AsyncSink() {
+        stop();
+    }
+
+    void AsyncSink::log(const spdlog::details::log_msg& msg) {
+        // Counted before the stop check, so the writer cannot stop between the check and the
+        // enqueue: either this sees the stop, or the writer sees the count and waits for the
+        // record. Records that are not enqueued are retired right away.
+        m_Enqueued.fetch_add(1, std::memory_order_seq_cst);
+        if (m_Stopping.load(std::memory_order_seq_cst)) [[unlikely]] {
+            drop_record();
+            return;
+        }
+
+        while (!try_enqueue(msg)) {
+            switch (m_Policy) {
+            case LogOverflowPolicy::Block:
+                if (m_Stopping.load(std::memory_order_relaxed)) {
+                    // The writer is gone, nobody will make room anymore
+                    drop_record();
+                    return;
+                }
+                wake_writer();
+                std::this_thread::yield();
+                break;
+            case LogOverflowPolicy::Drop:
+                drop_record();
+                return;
+            case LogOverflowPolicy::OverwriteOldest:
+                // Evict the oldest record ourselves, then retry. Another producer may take the
+                // freed slot first, in which case we evict again.
+                if (spdlog::details::log_msg_buffer evicted; try_dequeue(evicted)) {
+                    drop_record();
+                }
+                break;
+            }
+        }
+        // Pairs with the sleep check in writer_main(), see there
+        if (m_WriterSleeping.load(std::memory_order_seq_cst)) {
+            wake_writer();
+        }
+    }
+
+    void AsyncSink::drop_record() {
+        m_Dropped.fetch_add(1, std::memory_order_relaxed);
+        m_Retired.fetch_add(1, std::memory_order_release);
+    }
+
+    void AsyncSink::flush() {
+        if (std::this_thread::get_id() != m_Writer.get_id()) {
+            const u64 target = m_Enqueued.load(std::memory_order_acquire);
+            while (m_Retired.load(std::memory_order_acquire) < target && m_Writer.joinable()) {
+                wake_writer();
+                std::this_thread::yield();
+            }
+        }
+        for (auto& sink : m_Sinks) {
+            sink->flush();
+        }
+    }
+
+    void AsyncSink::set_pattern(const std::string& pattern) {
+        for (auto& sink : m_Sinks) {
+            sink->set_pattern(pattern);
+        }
+    }
+
+    void AsyncSink::set_formatter(std::unique_ptr<spdlog::formatter> sinkFormatter) {
+        for (auto& sink : m_Sinks) {
+            sink->set_formatter(sinkFormatter->clone());
+        }
+    }
+
+    void AsyncSink::stop() {
+        if (m_Stopping.exchange(true)) {
+            return;
+        }
+        wake_writer();
+        if (m_Writer.joinable()) {
+            m_Writer.join();
+        }
+        for (auto& sink : m_Sinks) {
+            sink->flush();
+        }
+    }
+
+    bool AsyncSink::try_enqueue(const spdlog::details::log_msg& msg) {
+        usize   pos  = m_EnqueuePos.load(std::memory_order_relaxed);
+        Slot_t* slot = nullptr;
+        while (true) {
+            slot            = &m_Slots[pos & m_Mask];
+            const usize seq = slot->m_Sequence.load(std::memory_order_acquire);
+            const auto  dif = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+            if (dif == 0) {
+                if (m_EnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            }
+            else if (dif < 0) {
+                return false;
+            }
+            else {
+                pos = m_EnqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+        slot->m_Message = spdlog::details::log_msg_buffer(msg);
+        slot->m_Sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool AsyncSink::try_dequeue(spdlog::details::log_msg_buffer& out) {
+        usize   pos  = m_DequeuePos.load(std::memory_order_relaxed);
+        Slot_t* slot = nullptr;
+        while (true) {
+            slot            = &m_Slots[pos & m_Mask];
+            const usize seq = slot->m_Sequence.load(std::memory_order_acquire);
+            const auto  dif =
+                static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+            if (dif == 0) {
+                if (m_DequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            }
+            else if (dif < 0) {
+                return false;
+            }
+            else {
+                pos = m_DequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+        out = std::move(slot->m_Message);
+        slot->m_Sequence.store(pos + m_Mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    void AsyncSink::wake_writer() {
+        m_Signal.fetch_add(1, std::memory_order_seq_cst);
+        m_Signal.notify_one();
+    }
+
+    void AsyncSink::writer_main() {
+        spdlog::details::log_msg_buffer msg;
+        u32                             idleSpins = 0;
+        while (true) {
+            if (try_dequeue(msg)) {
+                for (auto& sink : m_Sinks) {
+                    if (sink->should_log(msg.level)) {
+                        sink->log(msg);
+                    }
+                }
+                m_Retired.fetch_add(1, std::memory_order_release);
+                idleSpins = 0;
+                continue;
+            }
+            if (m_Stopping.load(std::memory_order_acquire)) {
+                // Producers may still be finishing an enqueue that started before the stop.
+                // Sequentially consistent, pairs with the count and stop check in log().
+                if (m_Retired.load(std::memory_order_seq_cst)
+                    >= m_Enqueued.load(std::memory_order_seq_cst)) {
+                    break;
+                }
+                std::this_thread::yield();
+                continue;
+            }
+            if (++idleSpins < 64) {
+                std::this_thread::yield();
+                continue;
+            }
+
+            // Go to sleep, a producer that sees m_WriterSleeping will bump the signal. The queue
+            // is checked again after publishing the flag, so a record enqueued in between is not
+            // missed (both sides use sequentially consistent operations).
+            const u32 signal = m_Signal.load(std::memory_order_seq_cst);
+            m_WriterSleeping.store(true, std::memory_order_seq_cst);
+            const bool empty = m_Retired.load(std::memory_order_seq_cst)
+                            >= m_Enqueued.load(std::memory_order_seq_cst);
+            if (empty && !m_Stopping.load(std::memory_order_seq_cst)) {
+                m_Signal.wait(signal, std::memory_order_seq_cst);
+            }
+            m_WriterSleeping.store(false, std::memory_order_relaxed);
+            idleSpins = 0;
+        }
+    }
+} // namespace Pulsar
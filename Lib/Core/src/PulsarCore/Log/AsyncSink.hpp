@@ -0,0 +1,83 @@
+#pragma once
+
+#include "PulsarCore/Log.hpp"
+#include "PulsarCore/Types.hpp"
+
+#include <atomic>
+#include <memory>
+#include <spdlog/details/log_msg_buffer.h>
+#include <spdlog/sinks/sink.h>
+#include <thread>
+#include <vector>
+
+namespace Pulsar {
+    /// A sink that hands log records to a background writer thread
+    /// # Performance
+    /// The calling thread only copies the record into a bounded lock-free MPSC ring (a Vyukov
+    /// queue), formatting and I/O happen on the writer thread. When the ring is full, the
+    /// `LogOverflowPolicy` decides whether the caller waits, drops the record or evicts the oldest.
+    /// # Ordering
+    /// Records from one thread are written in order, records from different threads are written
+    /// in the order they were enqueued.
+    class AsyncSink final : public spdlog::sinks::sink {
+    public:
+        AsyncSink(std::vector<spdlog::sink_ptr> sinks, usize capacity, LogOverflowPolicy policy);
+        ~AsyncSink() override;
+
+        AsyncSink(const AsyncSink&)            = delete;
+        AsyncSink& operator=(const AsyncSink&) = delete;
+        AsyncSink(AsyncSink&&)                 = delete;
+        AsyncSink& operator=(AsyncSink&&)      = delete;
+
+        void log(const spdlog::details::log_msg& msg) override;
+        /// Blocks until every record enqueued before the call is written, then flushes the sinks
+        void flush() override;
+        void set_pattern(const std::string& pattern) override;
+        void set_formatter(std::unique_ptr<spdlog::formatter> sinkFormatter) override;
+
+        /// Drains the queue and stops the writer thread, records logged afterwards are dropped
+        void stop();
+
+        /// Number of records that were dropped or overwritten because the queue was full
+        [[nodiscard]] u64 dropped_count() const {
+            return m_Dropped.load(std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] usize capacity() const {
+            return m_Capacity;
+        }
+
+    private:
+        struct alignas(64) Slot_t {
+            std::atomic<usize>              m_Sequence;
+            spdlog::details::log_msg_buffer m_Message;
+        };
+
+        [[nodiscard]] bool try_enqueue(const spdlog::details::log_msg& msg);
+        /// Moves the oldest record out of the ring, so its slot is free while the record is written
+        [[nodiscard]] bool try_dequeue(spdlog::details::log_msg_buffer& out);
+
+        /// Counts a record that will never be written, as dropped and as retired
+        void drop_record();
+        void writer_main();
+        void wake_writer();
+
+        std::vector<spdlog::sink_ptr> m_Sinks;
+        std::unique_ptr<Slot_t[]>     m_Slots; // NOLINT(*-avoid-c-arrays)
+        usize                         m_Capacity;
+        usize                         m_Mask;
+        LogOverflowPolicy             m_Policy;
+
+        alignas(64) std::atomic<usize> m_EnqueuePos {0};
+        alignas(64) std::atomic<usize> m_DequeuePos {0};
+        /// Records that entered `log`, counted before they are in the ring
+        alignas(64) std::atomic<u64> m_Enqueued {0};
+        /// Records written or dropped, the ring is drained once it catches up with `m_Enqueued`
+        std::atomic<u64>             m_Retired {0};
+        std::atomic<u64>             m_Dropped {0};
+        std::atomic<u32>             m_Signal {0};
+        std::atomic<bool>            m_WriterSleeping {false};
+        std::atomic<bool>            m_Stopping {false};
+        std::thread                  m_Writer;
+    };
+} // namespace Pulsar
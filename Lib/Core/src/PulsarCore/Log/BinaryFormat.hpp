@@ -0,0 +1,85 @@
+#pragma once
+
+#include "PulsarCore/Log.hpp"
+#include "PulsarCore/Log/BinaryLog.hpp"
+#include "PulsarCore/Types.hpp"
+
+#include <array>
+#include <cstring>
+#include <string_view>
+
+// Encoding shared by `BinaryLog` files and `FlightRecorder` dumps. The writers only touch the
+// output buffer: they never allocate or lock, so a signal handler may use them.
+namespace Pulsar::internal {
+    constexpr std::array<char, 8> BINARY_LOG_MAGIC   = {'P', 'L', 'S', 'R', 'B', 'L', 'O', 'G'};
+    constexpr u32                 BINARY_LOG_VERSION = 1;
+    /// Upper bound of the varint header in front of a record's arguments
+    constexpr usize MAX_RECORD_OVERHEAD = 32;
+
+    /// Fixed header at the start of the file
+    /// # File format
+    /// The header is followed by a stream of entries, each starting with a varint tag:
+    /// - `0` ends the stream (the rest of the file is preallocated space).
+    /// - `id << 1` describes call site `id`: level, line, category, file, format and the
+    ///   argument types. It is written once per file, before the first record of the site.
+    /// - `id << 1 | 1` is a record of call site `id`: the thread index, the zigzag encoded
+    ///   timestamp delta to the previous record, then the raw arguments.
+    struct BinaryLogHeader_t {
+        std::array<char, 8> m_Magic;
+        u32                 m_Version;
+        u32                 m_Reserved;
+        /// `BinaryLog::read_timestamp` ticks per second, 0 while not calibrated yet
+        f64 m_TicksPerSecond;
+        /// A tick count and the wall clock time (ns since the Unix epoch) at the same instant
+        u64 m_BaseTicks;
+        i64 m_BaseTime;
+    };
+
+    inline u8* put_bytes(u8* out, const void* data, usize size) {
+        std::memcpy(out, data, size);
+        return out + size;
+    }
+
+    inline u8* put_varint(u8* out, u64 value) {
+        while (value >= 0x80) {
+            *out++ = static_cast<u8>(value | 0x80);
+            value >>= 7;
+        }
+        *out++ = static_cast<u8>(value);
+        return out;
+    }
+
+    inline u8* put_string(u8* out, std::string_view value) {
+        out = put_varint(out, value.size());
+        return put_bytes(out, value.data(), value.size());
+    }
+
+    /// Upper bound of `put_site_entry`'s output
+    [[nodiscard]] inline usize site_entry_size(const BinaryLogSite_t& site) {
+        return MAX_RECORD_OVERHEAD + std::string_view(site.m_File).size()
+             + std::string_view(site.m_Format).size() + to_string(site.m_Category).size()
+             + site.m_ArgCount;
+    }
+
+    inline u8* put_site_entry(u8* out, u32 id, const BinaryLogSite_t& site) {
+        out = put_varint(out, u64 {id} << 1);
+        out = put_varint(out, static_cast<u64>(site.m_Level));
+        out = put_varint(out, site.m_Line);
+        out = put_string(out, to_string(site.m_Category));
+        out = put_string(out, site.m_File);
+        out = put_string(out, site.m_Format);
+        out = put_varint(out, site.m_ArgCount);
+        return put_bytes(out, site.m_Types, site.m_ArgCount);
+    }
+
+    /// Writes a record, at most `MAX_RECORD_OVERHEAD + size` bytes
+    inline u8* put_record_entry(
+        u8* out, u32 id, u32 thread, i64 timestampDelta, const std::byte* args, usize size) {
+        const auto zigzag = (static_cast<u64>(timestampDelta) << 1)
+                          ^ static_cast<u64>(timestampDelta >> 63);
+        out = put_varint(out, (u64 {id} << 1) | 1);
+        out = put_varint(out, thread);
+        out = put_varint(out, zigzag);
+        return put_bytes(out, args, size);
+    }
+} // namespace Pulsar::internal
@@ -0,0 +1,633 @@
+#include "BinaryLog.hpp"
+
+#include "PulsarCore/Log.hpp"
+#include "PulsarCore/Log/BinaryFormat.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <ctime>
+#include <fcntl.h>
+#include <fmt/args.h>
+#include <fmt/chrono.h>
+#include <mutex>
+#include <optional>
+#include <sys/mman.h>
+#include <thread>
+#include <unistd.h>
+
+namespace Pulsar {
+    namespace {
+        constexpr usize INITIAL_FILE_SIZE = usize {16} << 20;
+
+        struct Writer_t {
+            Writer_t() = default;
+            Writer_t(const Writer_t&)            = delete;
+            Writer_t& operator=(const Writer_t&) = delete;
+            Writer_t(Writer_t&&)                 = delete;
+            Writer_t& operator=(Writer_t&&)      = delete;
+            ~Writer_t() {
+                // A log that is still open at exit is closed properly instead of losing its tail
+                BinaryLog::close();
+            }
+
+            std::mutex m_Mutex;
+            // Everything below is guarded by m_Mutex, the rings are only ever drained with the
+            // mutex held so any thread may act as the consumer
+            std::vector<const BinaryLogSite_t*>       m_Sites;
+            std::vector<internal::BinaryLogBuffer_t*> m_Buffers;
+            std::vector<bool>                         m_SiteWritten;
+            bool                                      m_Open             = false;
+            bool                                      m_Failed           = false;
+            usize                                     m_ThreadBufferSize = 0;
+            u32                                       m_NextThreadIndex  = 0;
+            u64                                       m_LastTimestamp    = 0;
+            std::chrono::steady_clock::time_point     m_BaseSteady;
+
+            int   m_Fd      = -1;
+            u8*   m_Map     = nullptr;
+            usize m_MapSize = 0;
+            usize m_Size    = 0;
+
+            std::thread       m_Thread;
+            std::atomic<bool> m_Stop {false};
+            std::atomic<u64>  m_BytesWritten {0};
+            std::atomic<u64>  m_Records {0};
+            std::atomic<u64>  m_Dropped {0};
+        };
+
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+        Writer_t g_Writer;
+
+        /// Set once the thread's ring is freed, statements logged afterwards (from other
+        /// thread-local destructors) are dropped
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+        constinit thread_local bool t_Detached = false;
+
+        // Output, all of these expect g_Writer.m_Mutex to be held
+
+        bool map_output(usize size) {
+            if (g_Writer.m_Map != nullptr) {
+                munmap(g_Writer.m_Map, g_Writer.m_MapSize);
+                g_Writer.m_Map = nullptr;
+            }
+            if (ftruncate(g_Writer.m_Fd, static_cast<off_t>(size)) != 0) {
+                return false;
+            }
+            void* map = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, g_Writer.m_Fd, 0);
+            if (map == MAP_FAILED) {
+                return false;
+            }
+            g_Writer.m_Map     = static_cast<u8*>(map);
+            g_Writer.m_MapSize = size;
+            return true;
+        }
+
+        /// Makes room for `size` more bytes, grows the file by doubling
+        bool reserve_output(usize size) {
+            if (g_Writer.m_Failed) {
+                return false;
+            }
+            if (g_Writer.m_Size + size <= g_Writer.m_MapSize) {
+                return true;
+            }
+            const usize grown = std::max(g_Writer.m_MapSize * 2, g_Writer.m_Size + size);
+            if (!map_output(grown)) {
+                g_Writer.m_Failed = true;
+                return false;
+            }
+            return true;
+        }
+
+        void write_site(u32 id) {
+            const BinaryLogSite_t& site = *g_Writer.m_Sites[id - 1];
+            if (!reserve_output(internal::site_entry_size(site))) {
+                return;
+            }
+            u8* end = internal::put_site_entry(g_Writer.m_Map + g_Writer.m_Size, id, site);
+            g_Writer.m_Size = end - g_Writer.m_Map;
+
+            if (g_Writer.m_SiteWritten.size() <= id) {
+                g_Writer.m_SiteWritten.resize(id + 1);
+            }
+            g_Writer.m_SiteWritten[id] = true;
+        }
+
+        void write_record(const internal::BinaryLogBuffer_t& buffer, const std::byte* record,
+                          usize size) {
+            u32 id        = 0;
+            u64 timestamp = 0;
+            std::memcpy(&id, record + 4, sizeof(id));
+            std::memcpy(&timestamp, record + 8, sizeof(timestamp));
+            if (id >= g_Writer.m_SiteWritten.size() || !g_Writer.m_SiteWritten[id]) {
+                write_site(id);
+            }
+
+            const usize payload = size - BinaryLog::RECORD_HEADER_SIZE;
+            if (!reserve_output(internal::MAX_RECORD_OVERHEAD + payload)) {
+                g_Writer.m_Dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            const auto delta = static_cast<i64>(timestamp - g_Writer.m_LastTimestamp);
+            g_Writer.m_LastTimestamp = timestamp;
+
+            u8* start = g_Writer.m_Map + g_Writer.m_Size;
+            u8* end   = internal::put_record_entry(start, id, buffer.m_ThreadIndex, delta,
+                                                   record + BinaryLog::RECORD_HEADER_SIZE, payload);
+            g_Writer.m_Size = end - g_Writer.m_Map;
+            g_Writer.m_BytesWritten.fetch_add(end - start, std::memory_order_relaxed);
+            g_Writer.m_Records.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        /// Consumes everything committed to `buffer` so far, returns whether there was anything
+        bool drain(internal::BinaryLogBuffer_t& buffer) {
+            u64       tail = buffer.m_Tail.load(std::memory_order_relaxed);
+            const u64 head = buffer.m_Head.load(std::memory_order_acquire);
+            if (tail == head) {
+                return false;
+            }
+            const usize mask = buffer.m_Capacity - 1;
+            while (tail < head) {
+                const usize offset = tail & mask;
+                u32         size   = 0;
+                std::memcpy(&size, buffer.m_Data.get() + offset, sizeof(size));
+                if (size == 0) {
+                    // Padding up to the end of the ring
+                    tail += buffer.m_Capacity - offset;
+                    continue;
+                }
+                write_record(buffer, buffer.m_Data.get() + offset, size);
+                tail += (size + 7) & ~usize {7};
+            }
+            buffer.m_Tail.store(tail, std::memory_order_release);
+            return true;
+        }
+
+        void update_header() {
+            const auto   elapsed = std::chrono::steady_clock::now() - g_Writer.m_BaseSteady;
+            const double seconds = std::chrono::duration<double>(elapsed).count();
+            if (seconds < 0.001) {
+                return;
+            }
+            internal::BinaryLogHeader_t header {};
+            std::memcpy(&header, g_Writer.m_Map, sizeof(header));
+            header.m_TicksPerSecond =
+                static_cast<f64>(BinaryLog::read_timestamp() - header.m_BaseTicks) / seconds;
+            std::memcpy(g_Writer.m_Map, &header, sizeof(header));
+        }
+
+        bool drain_all() {
+            bool wrote = false;
+            for (auto* buffer : g_Writer.m_Buffers) {
+                wrote |= drain(*buffer);
+            }
+            if (wrote) {
+                update_header();
+            }
+            return wrote;
+        }
+
+        void writer_main() {
+            while (!g_Writer.m_Stop.load(std::memory_order_acquire)) {
+                bool wrote = false;
+                {
+                    std::lock_guard lock(g_Writer.m_Mutex);
+                    wrote = drain_all();
+                }
+                if (!wrote) {
+                    std::this_thread::sleep_for(std::chrono::microseconds(200));
+                }
+            }
+        }
+    } // namespace
+
+    struct BinaryLog::ThreadBufferOwner_t {
+        ThreadBufferOwner_t()                                      = default;
+        ThreadBufferOwner_t(const ThreadBufferOwner_t&)            = delete;
+        ThreadBufferOwner_t& operator=(const ThreadBufferOwner_t&) = delete;
+        ThreadBufferOwner_t(ThreadBufferOwner_t&&)                 = delete;
+        ThreadBufferOwner_t& operator=(ThreadBufferOwner_t&&)      = delete;
+
+        ~ThreadBufferOwner_t() {
+            // The ring is freed below, nothing may reach it through the thread's pointer anymore
+            s_ThreadBuffer = nullptr;
+            t_Detached     = true;
+            if (m_Buffer == nullptr) {
+                return;
+            }
+            std::lock_guard lock(g_Writer.m_Mutex);
+            auto&           buffers = g_Writer.m_Buffers;
+            const auto      it      = std::find(buffers.begin(), buffers.end(), m_Buffer.get());
+            if (it != buffers.end()) {
+                drain(*m_Buffer);
+                buffers.erase(it);
+            }
+        }
+
+        std::unique_ptr<internal::BinaryLogBuffer_t> m_Buffer;
+    };
+
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    thread_local BinaryLog::ThreadBufferOwner_t BinaryLog::s_ThreadBufferOwner;
+
+    Result<bool, std::string> BinaryLog::open(
+        const std::filesystem::path& path, usize threadBufferSize) {
+        std::lock_guard lock(g_Writer.m_Mutex);
+        if (g_Writer.m_Open) {
+            return Err<std::string>("Binary log is already open");
+        }
+
+        g_Writer.m_Fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if (g_Writer.m_Fd < 0) {
+            return Err<std::string>(
+                fmt::format("Failed to open {}: {}", path.string(), std::strerror(errno)));
+        }
+        if (!map_output(INITIAL_FILE_SIZE)) {
+            const int error = errno;
+            ::close(g_Writer.m_Fd);
+            g_Writer.m_Fd = -1;
+            return Err<std::string>(
+                fmt::format("Failed to map {}: {}", path.string(), std::strerror(error)));
+        }
+
+        internal::BinaryLogHeader_t header {};
+        header.m_Magic     = internal::BINARY_LOG_MAGIC;
+        header.m_Version   = internal::BINARY_LOG_VERSION;
+        header.m_BaseTicks = read_timestamp();
+        header.m_BaseTime  = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                std::chrono::system_clock::now().time_since_epoch())
+                                .count();
+        g_Writer.m_BaseSteady = std::chrono::steady_clock::now();
+        g_Writer.m_Size       = 0;
+        std::memcpy(g_Writer.m_Map, &header, sizeof(header));
+        g_Writer.m_Size = sizeof(header);
+
+        g_Writer.m_Failed           = false;
+        g_Writer.m_ThreadBufferSize = std::bit_ceil(std::max<usize>(threadBufferSize, 4096));
+        g_Writer.m_NextThreadIndex  = 0;
+        g_Writer.m_LastTimestamp    = header.m_BaseTicks;
+        g_Writer.m_SiteWritten.clear();
+        g_Writer.m_Buffers.clear();
+        g_Writer.m_BytesWritten.store(sizeof(header), std::memory_order_relaxed);
+        g_Writer.m_Records.store(0, std::memory_order_relaxed);
+        g_Writer.m_Dropped.store(0, std::memory_order_relaxed);
+        g_Writer.m_Stop.store(false, std::memory_order_relaxed);
+        g_Writer.m_Open = true;
+        s_Generation.fetch_add(1, std::memory_order_release);
+
+        g_Writer.m_Thread = std::thread(writer_main);
+        return Result<bool, std::string>(true);
+    }
+
+    void BinaryLog::close() {
+        {
+            std::lock_guard lock(g_Writer.m_Mutex);
+            if (!g_Writer.m_Open) {
+                return;
+            }
+        }
+        g_Writer.m_Stop.store(true, std::memory_order_release);
+        g_Writer.m_Thread.join();
+
+        std::lock_guard lock(g_Writer.m_Mutex);
+        drain_all();
+        update_header();
+        munmap(g_Writer.m_Map, g_Writer.m_MapSize);
+        g_Writer.m_Map     = nullptr;
+        g_Writer.m_MapSize = 0;
+        // Cut off the preallocated tail
+        PULSAR_IGNORE_RESULT(ftruncate(g_Writer.m_Fd, static_cast<off_t>(g_Writer.m_Size)));
+        ::close(g_Writer.m_Fd);
+        g_Writer.m_Fd = -1;
+        g_Writer.m_Buffers.clear();
+        g_Writer.m_Open = false;
+        s_Generation.fetch_add(1, std::memory_order_release);
+    }
+
+    void BinaryLog::flush() {
+        std::lock_guard lock(g_Writer.m_Mutex);
+        if (g_Writer.m_Open) {
+            drain_all();
+        }
+    }
+
+    u64 BinaryLog::bytes_written() {
+        return g_Writer.m_BytesWritten.load(std::memory_order_relaxed);
+    }
+
+    u64 BinaryLog::records_written() {
+        return g_Writer.m_Records.load(std::memory_order_relaxed);
+    }
+
+    u64 BinaryLog::dropped_count() {
+        return g_Writer.m_Dropped.load(std::memory_order_relaxed);
+    }
+
+    u32 BinaryLog::register_site(BinaryLogSite_t& site, std::span<const BinaryArgType> types) {
+        std::lock_guard lock(g_Writer.m_Mutex);
+        u32             id = site.m_Id.load(std::memory_order_relaxed);
+        if (id == 0) {
+            site.m_Types    = types.data();
+            site.m_ArgCount = static_cast<u32>(types.size());
+            g_Writer.m_Sites.push_back(&site);
+            id = static_cast<u32>(g_Writer.m_Sites.size());
+            site.m_Id.store(id, std::memory_order_release);
+        }
+        return id;
+    }
+
+    internal::BinaryLogBuffer_t* BinaryLog::attach_thread() {
+        std::lock_guard lock(g_Writer.m_Mutex);
+        if (!g_Writer.m_Open) {
+            s_ThreadBuffer = nullptr;
+            return nullptr;
+        }
+        if (t_Detached) {
+            // The owner is destroyed, a new ring would never be freed
+            g_Writer.m_Dropped.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        auto& buffer = s_ThreadBufferOwner.m_Buffer;
+        if (buffer == nullptr || buffer->m_Capacity != g_Writer.m_ThreadBufferSize) {
+            auto& buffers = g_Writer.m_Buffers;
+            if (buffer != nullptr) {
+                std::erase(buffers, buffer.get());
+            }
+            buffer             = std::make_unique<internal::BinaryLogBuffer_t>();
+            buffer->m_Capacity = g_Writer.m_ThreadBufferSize;
+            // NOLINTNEXTLINE(*-avoid-c-arrays)
+            buffer->m_Data = std::make_unique_for_overwrite<std::byte[]>(buffer->m_Capacity);
+        }
+        if (std::find(g_Writer.m_Buffers.begin(), g_Writer.m_Buffers.end(), buffer.get())
+            == g_Writer.m_Buffers.end()) {
+            g_Writer.m_Buffers.push_back(buffer.get());
+        }
+        buffer->m_Head.store(0, std::memory_order_relaxed);
+        buffer->m_Tail.store(0, std::memory_order_relaxed);
+        buffer->m_CachedTail  = 0;
+        buffer->m_ThreadIndex = g_Writer.m_NextThreadIndex++;
+        buffer->m_Generation  = s_Generation.load(std::memory_order_relaxed);
+        s_ThreadBuffer        = buffer.get();
+        return buffer.get();
+    }
+
+    std::byte* BinaryLog::reserve_slow(internal::BinaryLogBuffer_t& buffer, usize size) {
+        const usize aligned = align_record(size);
+        if (aligned > buffer.m_Capacity / 2) {
+            g_Writer.m_Dropped.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        while (true) {
+            u64         head    = buffer.m_Head.load(std::memory_order_relaxed);
+            const usize offset  = head & (buffer.m_Capacity - 1);
+            const usize padding =
+                offset + aligned > buffer.m_Capacity ? buffer.m_Capacity - offset : 0;
+            if (head + padding + aligned - buffer.m_CachedTail <= buffer.m_Capacity) {
+                if (padding != 0) {
+                    // A zero size tells the consumer to skip to the start of the ring
+                    const u32 marker = 0;
+                    std::memcpy(buffer.m_Data.get() + offset, &marker, sizeof(marker));
+                    head += padding;
+                    buffer.m_Head.store(head, std::memory_order_release);
+                }
+                return buffer.m_Data.get() + (head & (buffer.m_Capacity - 1));
+            }
+
+            const u64 tail = buffer.m_Tail.load(std::memory_order_acquire);
+            if (tail == buffer.m_CachedTail) {
+                // The ring is full, wait for the writer thread to catch up
+                if (buffer.m_Generation != s_Generation.load(std::memory_order_relaxed)) {
+                    return nullptr;
+                }
+                std::this_thread::yield();
+            }
+            buffer.m_CachedTail = tail;
+        }
+    }
+
+    namespace {
+        struct DecodedSite_t {
+            spdlog::level::level_enum  m_Level = spdlog::level::info;
+            u64                        m_Line  = 0;
+            std::string_view           m_Category;
+            std::string_view           m_File;
+            std::string_view           m_Format;
+            std::vector<BinaryArgType> m_Types;
+        };
+
+        /// Bounds-checked cursor over the file, reads past the end yield nullopt
+        class Reader {
+        public:
+            explicit Reader(std::span<const u8> data) : m_Data(data) {
+            }
+
+            [[nodiscard]] bool at_end() const {
+                return m_Position >= m_Data.size();
+            }
+
+            std::optional<u64> varint() {
+                u64 value = 0;
+                for (u32 shift = 0; shift < 64 && m_Position < m_Data.size(); shift += 7) {
+                    const u8 byte = m_Data[m_Position++];
+                    value |= u64 {byte & 0x7FU} << shift;
+                    if ((byte & 0x80) == 0) {
+                        return value;
+                    }
+                }
+                return std::nullopt;
+            }
+
+            std::optional<std::string_view> bytes(usize size) {
+                if (m_Data.size() - m_Position < size) {
+                    return std::nullopt;
+                }
+                const auto* begin = reinterpret_cast<const char*>(m_Data.data() + m_Position);
+                m_Position += size;
+                return std::string_view(begin, size);
+            }
+
+            std::optional<std::string_view> string() {
+                const auto size = varint();
+                return size ? bytes(*size) : std::nullopt;
+            }
+
+            template<typename T> std::optional<T> value() {
+                const auto raw = bytes(sizeof(T));
+                if (!raw) {
+                    return std::nullopt;
+                }
+                T result;
+                std::memcpy(&result, raw->data(), sizeof(T));
+                return result;
+            }
+
+        private:
+            std::span<const u8> m_Data;
+            usize               m_Position = 0;
+        };
+
+        std::optional<DecodedSite_t> read_site(Reader& reader) {
+            DecodedSite_t site;
+            const auto    level    = reader.varint();
+            const auto    line     = reader.varint();
+            const auto    category = reader.string();
+            const auto    file     = reader.string();
+            const auto    format   = reader.string();
+            const auto    count    = reader.varint();
+            if (!level || !line || !category || !file || !format || !count) {
+                return std::nullopt;
+            }
+            const auto types = reader.bytes(*count);
+            if (!types) {
+                return std::nullopt;
+            }
+            site.m_Level    = static_cast<spdlog::level::level_enum>(*level);
+            site.m_Line     = *line;
+            site.m_Category = *category;
+            site.m_File     = *file;
+            site.m_Format   = *format;
+            for (const char type : *types) {
+                site.m_Types.push_back(static_cast<BinaryArgType>(type));
+            }
+            return site;
+        }
+
+        template<typename T>
+        bool push_arg(Reader& reader, fmt::dynamic_format_arg_store<fmt::format_context>& args) {
+            const auto value = reader.value<T>();
+            if (value) {
+                args.push_back(*value);
+            }
+            return value.has_value();
+        }
+
+        bool read_args(Reader& reader, const DecodedSite_t& site,
+                       fmt::dynamic_format_arg_store<fmt::format_context>& args) {
+            for (const BinaryArgType type : site.m_Types) {
+                bool ok = false;
+                switch (type) {
+                case BinaryArgType::Bool: ok = push_arg<bool>(reader, args); break;
+                case BinaryArgType::Char: ok = push_arg<char>(reader, args); break;
+                case BinaryArgType::I8: ok = push_arg<i8>(reader, args); break;
+                case BinaryArgType::I16: ok = push_arg<i16>(reader, args); break;
+                case BinaryArgType::I32: ok = push_arg<i32>(reader, args); break;
+                case BinaryArgType::I64: ok = push_arg<i64>(reader, args); break;
+                case BinaryArgType::U8: ok = push_arg<u8>(reader, args); break;
+                case BinaryArgType::U16: ok = push_arg<u16>(reader, args); break;
+                case BinaryArgType::U32: ok = push_arg<u32>(reader, args); break;
+                case BinaryArgType::U64: ok = push_arg<u64>(reader, args); break;
+                case BinaryArgType::F32: ok = push_arg<f32>(reader, args); break;
+                case BinaryArgType::F64: ok = push_arg<f64>(reader, args); break;
+                case BinaryArgType::Pointer: {
+                    const auto address = reader.value<u64>();
+                    if (address) {
+                        args.push_back(reinterpret_cast<const void*>(uintptr_t {*address}));
+                    }
+                    ok = address.has_value();
+                    break;
+                }
+                case BinaryArgType::String: {
+                    const auto length = reader.value<u32>();
+                    const auto value  = length ? reader.bytes(*length) : std::nullopt;
+                    if (value) {
+                        args.push_back(*value);
+                    }
+                    ok = value.has_value();
+                    break;
+                }
+                }
+                if (!ok) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        std::string format_time(const internal::BinaryLogHeader_t& header, u64 timestamp) {
+            i64 nanoseconds = header.m_BaseTime;
+            if (header.m_TicksPerSecond > 0) {
+                const auto   ticks   = static_cast<i64>(timestamp - header.m_BaseTicks);
+                const double seconds = static_cast<f64>(ticks) / header.m_TicksPerSecond;
+                nanoseconds += static_cast<i64>(seconds * 1e9);
+            }
+            const std::time_t seconds = nanoseconds / 1'000'000'000;
+            std::tm           local {};
+            localtime_r(&seconds, &local);
+            return fmt::format("{:%Y-%m-%d %H:%M:%S}.{:06}", local,
+                               (nanoseconds % 1'000'000'000) / 1000);
+        }
+    } // namespace
+
+    Result<u64, std::string> BinaryLog::decode(
+        std::span<const u8> data, const std::function<void(std::string_view)>& onLine) {
+        internal::BinaryLogHeader_t header {};
+        if (data.size() < sizeof(header)) {
+            return Err<std::string>("File is too small to be a binary log");
+        }
+        std::memcpy(&header, data.data(), sizeof(header));
+        if (header.m_Magic != internal::BINARY_LOG_MAGIC) {
+            return Err<std::string>("Not a binary log file");
+        }
+        if (header.m_Version != internal::BINARY_LOG_VERSION) {
+            return Err<std::string>(
+                fmt::format("Unsupported binary log version {}", header.m_Version));
+        }
+
+        Reader                     reader(data.subspan(sizeof(header)));
+        std::vector<std::optional<DecodedSite_t>> sites;
+        u64                        timestamp = header.m_BaseTicks;
+        u64                        records   = 0;
+        std::string                line;
+        // A crash leaves the stream cut off somewhere, everything up to there is still decoded
+        while (!reader.at_end()) {
+            const auto tag = reader.varint();
+            if (!tag || *tag == 0) {
+                break;
+            }
+            const u64 id = *tag >> 1;
+            if ((*tag & 1) == 0) {
+                auto site = read_site(reader);
+                if (!site) {
+                    break;
+                }
+                if (sites.size() <= id) {
+                    sites.resize(id + 1);
+                }
+                sites[id] = std::move(site);
+                continue;
+            }
+
+            const auto thread = reader.varint();
+            const auto delta  = reader.varint();
+            if (!thread || !delta) {
+                break;
+            }
+            if (id >= sites.size() || !sites[id]) {
+                return Err<std::string>(fmt::format("Record references unknown call site {}", id));
+            }
+            const DecodedSite_t& site = *sites[id];
+            timestamp += (*delta >> 1) ^ (~(*delta & 1) + 1);
+
+            fmt::dynamic_format_arg_store<fmt::format_context> args;
+            if (!read_args(reader, site, args)) {
+                break;
+            }
+
+            line.clear();
+            const auto level = spdlog::level::to_string_view(site.m_Level);
+            fmt::format_to(std::back_inserter(line), "[{}] [{}] [{}] [T{}] ",
+                           format_time(header, timestamp),
+                           std::string_view(level.data(), level.size()), site.m_Category, *thread);
+            try {
+                fmt::vformat_to(std::back_inserter(line), site.m_Format, args);
+            }
+            catch (const fmt::format_error& error) {
+                fmt::format_to(std::back_inserter(line), "<{}> {}", error.what(), site.m_Format);
+            }
+            onLine(line);
+            records++;
+        }
+        return Result<u64, std::string>(records);
+    }
+} // namespace Pulsar
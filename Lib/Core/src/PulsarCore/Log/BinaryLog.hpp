@@ -0,0 +1,270 @@
+#pragma once
+
+#include "PulsarCore/Result.hpp"
+#include "PulsarCore/Types.hpp"
+#include "PulsarCore/Util/Macros.hpp"
+#include "PulsarCore/Util/Timestamp.hpp"
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <span>
+#include <spdlog/common.h>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace Pulsar {
+    enum class LogCategory : u8;
+
+    /// How an argument is stored in a binary record
+    enum class BinaryArgType : u8 {
+        Bool,
+        Char,
+        I8,
+        I16,
+        I32,
+        I64,
+        U8,
+        U16,
+        U32,
+        U64,
+        F32,
+        F64,
+        Pointer,
+        /// A u32 length followed by the bytes, anything that is not a primitive is formatted
+        /// into a string on the calling thread
+        String,
+    };
+
+    /// Static metadata of one log statement, `PL_LOG_CAT` keeps one per call site
+    struct BinaryLogSite_t {
+        LogCategory               m_Category;
+        spdlog::level::level_enum m_Level;
+        const char*               m_File;
+        u32                       m_Line;
+        const char*               m_Format;
+        /// Filled in by the registration, before `m_Id` is published
+        const BinaryArgType* m_Types    = nullptr;
+        u32                  m_ArgCount = 0;
+        /// Assigned the first time the site is written in binary form, 0 until then
+        std::atomic<u32> m_Id {0};
+    };
+
+    namespace internal {
+        /// The single-producer byte ring of one thread, drained by the binary log writer
+        struct BinaryLogBuffer_t {
+            alignas(64) std::atomic<u64> m_Head {0};
+            u64 m_CachedTail = 0;
+            alignas(64) std::atomic<u64> m_Tail {0};
+            u64                          m_Generation  = 0;
+            u32                          m_ThreadIndex = 0;
+            usize                        m_Capacity    = 0;
+            std::unique_ptr<std::byte[]> m_Data; // NOLINT(*-avoid-c-arrays)
+        };
+
+        /// Converts an argument into one of the types a binary record can hold
+        template<typename T> auto binary_arg(const T& value) {
+            using U = std::remove_cvref_t<T>;
+            if constexpr (std::is_same_v<U, long double>) {
+                return static_cast<f64>(value);
+            }
+            else if constexpr (std::is_arithmetic_v<U>) {
+                return value;
+            }
+            else if constexpr (std::is_convertible_v<const U&, std::string_view>) {
+                return std::string_view(value);
+            }
+            else if constexpr (std::is_pointer_v<U> || std::is_null_pointer_v<U>) {
+                return static_cast<const void*>(value);
+            }
+            else {
+                return fmt::format("{}", value);
+            }
+        }
+
+        template<typename T> consteval BinaryArgType binary_arg_type() {
+            using U = std::remove_cvref_t<T>;
+            if constexpr (std::is_same_v<U, bool>) {
+                return BinaryArgType::Bool;
+            }
+            else if constexpr (std::is_same_v<U, char>) {
+                return BinaryArgType::Char;
+            }
+            else if constexpr (std::is_integral_v<U>) {
+                constexpr usize INDEX = std::bit_width(sizeof(U)) - 1;
+                constexpr std::array<BinaryArgType, 4> SIGNED = {
+                    BinaryArgType::I8, BinaryArgType::I16, BinaryArgType::I32, BinaryArgType::I64};
+                constexpr std::array<BinaryArgType, 4> UNSIGNED = {
+                    BinaryArgType::U8, BinaryArgType::U16, BinaryArgType::U32, BinaryArgType::U64};
+                return std::is_signed_v<U> ? SIGNED[INDEX] : UNSIGNED[INDEX];
+            }
+            else if constexpr (std::is_same_v<U, f32>) {
+                return BinaryArgType::F32;
+            }
+            else if constexpr (std::is_same_v<U, f64>) {
+                return BinaryArgType::F64;
+            }
+            else if constexpr (std::is_same_v<U, const void*>) {
+                return BinaryArgType::Pointer;
+            }
+            else {
+                static_assert(
+                    std::is_same_v<U, std::string_view> || std::is_same_v<U, std::string>);
+                return BinaryArgType::String;
+            }
+        }
+
+        template<typename T> PULSAR_ALWAYS_INLINE constexpr usize binary_arg_size(const T& value) {
+            using U = std::remove_cvref_t<T>;
+            if constexpr (std::is_same_v<U, std::string_view> || std::is_same_v<U, std::string>) {
+                return sizeof(u32) + value.size();
+            }
+            else if constexpr (std::is_same_v<U, const void*>) {
+                return sizeof(u64);
+            }
+            else {
+                return sizeof(U);
+            }
+        }
+
+        template<typename T> PULSAR_ALWAYS_INLINE std::byte* write_binary_arg(
+            std::byte* out, const T& value) {
+            using U = std::remove_cvref_t<T>;
+            if constexpr (std::is_same_v<U, std::string_view> || std::is_same_v<U, std::string>) {
+                const auto length = static_cast<u32>(value.size());
+                std::memcpy(out, &length, sizeof(length));
+                std::memcpy(out + sizeof(length), value.data(), length);
+                return out + sizeof(length) + length;
+            }
+            else if constexpr (std::is_same_v<U, const void*>) {
+                const auto address = static_cast<u64>(reinterpret_cast<uintptr_t>(value));
+                std::memcpy(out, &address, sizeof(address));
+                return out + sizeof(address);
+            }
+            else {
+                std::memcpy(out, &value, sizeof(U));
+                return out + sizeof(U);
+            }
+        }
+    } // namespace internal
+
+    /// NanoLog-style binary logging, the `LogMode::Binary` backend of `Log`
+    /// # Performance
+    /// The calling thread never formats anything: the format string and argument types are
+    /// registered once per call site, and every record only copies a timestamp and the raw
+    /// arguments into a per-thread ring. A background thread drains the rings and streams compact
+    /// records (varint headers, delta timestamps) into a memory-mapped file, which
+    /// `PulsarLogDecode` turns back into text.
+    /// # Lifetime
+    /// Threads must stop logging before `close`, like with every other `Log` mode.
+    class BinaryLog {
+    public:
+        static constexpr usize RECORD_HEADER_SIZE = 16;
+
+        [[nodiscard]] static Result<bool, std::string> open(
+            const std::filesystem::path& path, usize threadBufferSize);
+        /// Writes everything that is still queued and closes the file
+        static void close();
+        /// Writes every record logged so far to the file
+        static void flush();
+
+        template<typename... Args> static void write(BinaryLogSite_t& site, const Args&... args) {
+            const u32   id        = site_id<Args...>(site);
+            const u64   timestamp = read_timestamp();
+            const usize argsSize  = (internal::binary_arg_size(args) + ... + 0);
+            const usize size      = RECORD_HEADER_SIZE + argsSize;
+            std::byte*  out       = reserve(size);
+            if (out == nullptr) [[unlikely]] {
+                return;
+            }
+            const auto length = static_cast<u32>(size);
+            std::memcpy(out, &length, sizeof(length));
+            std::memcpy(out + 4, &id, sizeof(id));
+            std::memcpy(out + 8, &timestamp, sizeof(timestamp));
+            out += RECORD_HEADER_SIZE;
+            ((out = internal::write_binary_arg(out, args)), ...);
+            commit(size);
+        }
+
+        /// The id of a call site whose arguments are `Args` (after `internal::binary_arg`),
+        /// registers the site on first use
+        template<typename... Args> PULSAR_ALWAYS_INLINE static u32 site_id(BinaryLogSite_t& site) {
+            const u32 id = site.m_Id.load(std::memory_order_acquire);
+            if (id == 0) [[unlikely]] {
+                static constexpr std::array<BinaryArgType, sizeof...(Args)> TYPES = {
+                    internal::binary_arg_type<Args>()...};
+                return register_site(site, TYPES);
+            }
+            return id;
+        }
+
+        /// Turns a binary log file back into text, one call per line. Returns the record count.
+        [[nodiscard]] static Result<u64, std::string> decode(
+            std::span<const u8> data, const std::function<void(std::string_view)>& onLine);
+
+        /// Bytes written to the file so far, including metadata
+        [[nodiscard]] static u64 bytes_written();
+        [[nodiscard]] static u64 records_written();
+        /// Records that did not fit into a thread's ring at all, or were logged by a thread
+        /// after its ring was freed at exit
+        [[nodiscard]] static u64 dropped_count();
+
+        /// A cheap monotonic tick counter (the TSC on x86), converted to time by the decoder
+        PULSAR_ALWAYS_INLINE static u64 read_timestamp() {
+            return Pulsar::read_timestamp();
+        }
+
+    private:
+        PULSAR_NO_INLINE static u32 register_site(
+            BinaryLogSite_t& site, std::span<const BinaryArgType> types);
+        PULSAR_NO_INLINE static internal::BinaryLogBuffer_t* attach_thread();
+        PULSAR_NO_INLINE static std::byte* reserve_slow(
+            internal::BinaryLogBuffer_t& buffer, usize size);
+
+        /// Returns `size` contiguous bytes in the calling thread's ring, or null if the log is
+        /// closed or the record can never fit. Blocks while the ring is full.
+        PULSAR_ALWAYS_INLINE static std::byte* reserve(usize size) {
+            internal::BinaryLogBuffer_t* buffer = s_ThreadBuffer;
+            if (buffer == nullptr
+                || buffer->m_Generation != s_Generation.load(std::memory_order_relaxed))
+                [[unlikely]] {
+                buffer = attach_thread();
+                if (buffer == nullptr) {
+                    return nullptr;
+                }
+            }
+            const usize aligned = align_record(size);
+            const u64   head    = buffer->m_Head.load(std::memory_order_relaxed);
+            const usize offset  = head & (buffer->m_Capacity - 1);
+            if (offset + aligned > buffer->m_Capacity
+                || head + aligned - buffer->m_CachedTail > buffer->m_Capacity) [[unlikely]] {
+                return reserve_slow(*buffer, size);
+            }
+            return buffer->m_Data.get() + offset;
+        }
+
+        PULSAR_ALWAYS_INLINE static void commit(usize size) {
+            internal::BinaryLogBuffer_t* buffer = s_ThreadBuffer;
+            const u64 head = buffer->m_Head.load(std::memory_order_relaxed);
+            buffer->m_Head.store(head + align_record(size), std::memory_order_release);
+        }
+
+        static constexpr usize align_record(usize size) {
+            return (size + 7) & ~usize {7};
+        }
+
+        /// Owns the calling thread's ring, drains and frees it when the thread exits
+        struct ThreadBufferOwner_t;
+
+        constinit inline static thread_local internal::BinaryLogBuffer_t* s_ThreadBuffer = nullptr;
+        static thread_local ThreadBufferOwner_t                           s_ThreadBufferOwner;
+        /// Bumped by `open` and `close`, rings of an older generation are re-attached on next use
+        inline static std::atomic<u64> s_Generation {0};
+    };
+} // namespace Pulsar
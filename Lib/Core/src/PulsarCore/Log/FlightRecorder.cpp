@@ -0,0 +1,408 @@
+#include "FlightRecorder.hpp"
+
+#include "PulsarCore/Log.hpp"
+#include "PulsarCore/Log/BinaryFormat.hpp"
+
+#include <bit>
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <ctime>
+#include <fcntl.h>
+#include <mutex>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+namespace Pulsar {
+    namespace {
+        constexpr std::array<int, 5> CRASH_SIGNALS    = {SIGSEGV, SIGABRT, SIGBUS, SIGFPE, SIGILL};
+        constexpr usize              DUMP_BUFFER_SIZE = usize {64} * 1024;
+        constexpr usize              TRACKED_SITES    = usize {64} * 1024;
+        constexpr usize              ALT_STACK_SIZE   = usize {64} * 1024;
+
+        struct Recorder_t {
+            std::mutex m_Mutex;
+            // Lock-free view of the rings for the dump, writes are guarded by m_Mutex
+            std::array<std::atomic<internal::FlightRing_t*>, FlightRecorder::MAX_THREADS>
+                m_Rings {};
+            /// Rings are never freed, a thread may still be recording into a replaced one
+            std::vector<std::unique_ptr<internal::FlightRing_t>> m_Owned;
+            u32                                                  m_NextThreadIndex = 0;
+
+            // Written by enable() before the signal handlers can run
+            u64                                                m_BaseTicks     = 0;
+            i64                                                m_BaseMonotonic = 0;
+            i64                                                m_BaseRealtime  = 0;
+            std::array<char, 4096>                             m_CrashDumpPath {};
+            std::array<struct sigaction, CRASH_SIGNALS.size()> m_PreviousActions {};
+            bool                                               m_HandlersInstalled = false;
+
+            std::atomic_flag m_Dumping;
+        };
+
+        /// A copy of a slot taken by the dump
+        struct DumpRecord_t {
+            u64                                                m_Timestamp;
+            const BinaryLogSite_t*                             m_Site;
+            u32                                                m_Size;
+            std::array<std::byte, internal::FlightSlot_t::ARGS_SIZE> m_Args;
+        };
+
+        /// Only touched by the thread that set `m_Dumping`, static so a dump never allocates
+        struct DumpState_t {
+            std::array<u8, DUMP_BUFFER_SIZE>                      m_Buffer;
+            usize                                                 m_Size;
+            int                                                   m_Fd;
+            bool                                                  m_Failed;
+            std::array<u64, TRACKED_SITES / 64>                   m_SitesWritten;
+            std::array<DumpRecord_t, FlightRecorder::MAX_THREADS> m_Current;
+            std::array<bool, FlightRecorder::MAX_THREADS>         m_HasCurrent;
+            std::array<u64, FlightRecorder::MAX_THREADS>          m_Cursor;
+            std::array<u64, FlightRecorder::MAX_THREADS>          m_End;
+            u64                                                   m_LastTimestamp;
+        };
+
+        // NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+        Recorder_t                      g_Recorder;
+        DumpState_t                     g_Dump;
+        /// The record that ends a dump when statements were dropped, registered by `enable`
+        constinit BinaryLogSite_t g_DroppedSite {LogCategory::Core, spdlog::level::warn, __FILE__,
+            __LINE__, "Flight recorder dropped {} statements too large for a record"};
+        alignas(16) std::array<std::byte, ALT_STACK_SIZE> g_AltStack;
+
+        /// Marks the calling thread's ring as reusable when the thread exits
+        thread_local struct RingOwner_t {
+            RingOwner_t()                              = default;
+            RingOwner_t(const RingOwner_t&)            = delete;
+            RingOwner_t& operator=(const RingOwner_t&) = delete;
+            RingOwner_t(RingOwner_t&&)                 = delete;
+            RingOwner_t& operator=(RingOwner_t&&)      = delete;
+            ~RingOwner_t() {
+                if (m_Ring != nullptr) {
+                    m_Ring->m_InUse.store(false, std::memory_order_release);
+                }
+            }
+
+            internal::FlightRing_t* m_Ring = nullptr;
+        } g_RingOwner;
+        // NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
+
+        i64 clock_ns(clockid_t clock) {
+            timespec now {};
+            clock_gettime(clock, &now);
+            return (static_cast<i64>(now.tv_sec) * 1'000'000'000) + now.tv_nsec;
+        }
+
+        // Everything below runs inside signal handlers: no allocation, no locks, no stdio
+
+        void flush_dump() {
+            usize written = 0;
+            while (written < g_Dump.m_Size && !g_Dump.m_Failed) {
+                const ssize_t result =
+                    ::write(g_Dump.m_Fd, g_Dump.m_Buffer.data() + written, g_Dump.m_Size - written);
+                if (result < 0 && errno != EINTR) {
+                    g_Dump.m_Failed = true;
+                }
+                written += result > 0 ? static_cast<usize>(result) : 0;
+            }
+            g_Dump.m_Size = 0;
+        }
+
+        /// Room for `size` more bytes in the dump buffer, null if it can never fit
+        u8* dump_output(usize size) {
+            if (size > DUMP_BUFFER_SIZE) {
+                return nullptr;
+            }
+            if (g_Dump.m_Size + size > DUMP_BUFFER_SIZE) {
+                flush_dump();
+            }
+            return g_Dump.m_Buffer.data() + g_Dump.m_Size;
+        }
+
+        void advance_dump(const u8* end) {
+            g_Dump.m_Size = static_cast<usize>(end - g_Dump.m_Buffer.data());
+        }
+
+        /// Copies the next intact record of ring `index`, records overwritten in the meantime are
+        /// skipped
+        bool load_next(usize index, const internal::FlightRing_t& ring) {
+            while (g_Dump.m_Cursor[index] < g_Dump.m_End[index]) {
+                const u64 sequence = g_Dump.m_Cursor[index]++;
+                const auto& slot   = ring.m_Slots[sequence & (ring.m_Capacity - 1)];
+                if (slot.m_Sequence.load(std::memory_order_acquire) != sequence + 1) {
+                    continue;
+                }
+                DumpRecord_t& record = g_Dump.m_Current[index];
+                record.m_Timestamp   = slot.m_Timestamp;
+                record.m_Site        = slot.m_Site;
+                record.m_Size        = std::min<u32>(slot.m_Size, slot.m_Args.size());
+                std::memcpy(record.m_Args.data(), slot.m_Args.data(), record.m_Size);
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (slot.m_Sequence.load(std::memory_order_relaxed) == sequence + 1) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void write_dump_record(const DumpRecord_t& record, u32 thread) {
+            const BinaryLogSite_t& site = *record.m_Site;
+            const u32              id   = site.m_Id.load(std::memory_order_relaxed);
+            auto&                  bits = g_Dump.m_SitesWritten;
+            // Sites past the tracked range are described again in front of every record
+            if (id >= TRACKED_SITES || (bits[id / 64] & (u64 {1} << (id % 64))) == 0) {
+                u8* out = dump_output(internal::site_entry_size(site));
+                if (out == nullptr) {
+                    return;
+                }
+                advance_dump(internal::put_site_entry(out, id, site));
+                if (id < TRACKED_SITES) {
+                    bits[id / 64] |= u64 {1} << (id % 64);
+                }
+            }
+
+            u8* out = dump_output(internal::MAX_RECORD_OVERHEAD + record.m_Size);
+            const auto delta = static_cast<i64>(record.m_Timestamp - g_Dump.m_LastTimestamp);
+            g_Dump.m_LastTimestamp = record.m_Timestamp;
+            advance_dump(internal::put_record_entry(
+                out, id, thread, delta, record.m_Args.data(), record.m_Size));
+        }
+
+        bool write_dump(int fd, u32 generation) {
+            g_Dump.m_Fd     = fd;
+            g_Dump.m_Size   = 0;
+            g_Dump.m_Failed = false;
+            g_Dump.m_SitesWritten.fill(0);
+
+            internal::BinaryLogHeader_t header {};
+            header.m_Magic     = internal::BINARY_LOG_MAGIC;
+            header.m_Version   = internal::BINARY_LOG_VERSION;
+            header.m_BaseTicks = g_Recorder.m_BaseTicks;
+            header.m_BaseTime  = g_Recorder.m_BaseRealtime;
+            const i64 elapsed  = clock_ns(CLOCK_MONOTONIC) - g_Recorder.m_BaseMonotonic;
+            if (elapsed > 0) {
+                const auto ticks        = BinaryLog::read_timestamp() - g_Recorder.m_BaseTicks;
+                header.m_TicksPerSecond = static_cast<f64>(ticks) * 1e9 / static_cast<f64>(elapsed);
+            }
+            advance_dump(internal::put_bytes(dump_output(sizeof(header)), &header, sizeof(header)));
+            g_Dump.m_LastTimestamp = header.m_BaseTicks;
+
+            for (usize i = 0; i < FlightRecorder::MAX_THREADS; i++) {
+                const auto* ring      = g_Recorder.m_Rings[i].load(std::memory_order_acquire);
+                g_Dump.m_HasCurrent[i] = false;
+                if (ring == nullptr
+                    || ring->m_Generation.load(std::memory_order_acquire) != generation) {
+                    continue;
+                }
+                const u64 head     = ring->m_Head.load(std::memory_order_acquire);
+                g_Dump.m_End[i]    = head;
+                g_Dump.m_Cursor[i] = head > ring->m_Capacity ? head - ring->m_Capacity : 0;
+                g_Dump.m_HasCurrent[i] = load_next(i, *ring);
+            }
+
+            // Merge the rings by timestamp, so the dump reads as one timeline
+            while (true) {
+                usize oldest = FlightRecorder::MAX_THREADS;
+                for (usize i = 0; i < FlightRecorder::MAX_THREADS; i++) {
+                    if (g_Dump.m_HasCurrent[i]
+                        && (oldest == FlightRecorder::MAX_THREADS
+                            || g_Dump.m_Current[i].m_Timestamp
+                                   < g_Dump.m_Current[oldest].m_Timestamp)) {
+                        oldest = i;
+                    }
+                }
+                if (oldest == FlightRecorder::MAX_THREADS) {
+                    break;
+                }
+                const auto* ring = g_Recorder.m_Rings[oldest].load(std::memory_order_acquire);
+                write_dump_record(g_Dump.m_Current[oldest], ring->m_ThreadIndex);
+                g_Dump.m_HasCurrent[oldest] = load_next(oldest, *ring);
+            }
+
+            const u64 dropped = FlightRecorder::dropped_count();
+            if (dropped > 0 && g_DroppedSite.m_Id.load(std::memory_order_acquire) != 0) {
+                // Every ring is drained, so the first record buffer is free
+                DumpRecord_t& record = g_Dump.m_Current[0];
+                record.m_Timestamp   = g_Dump.m_LastTimestamp;
+                record.m_Site        = &g_DroppedSite;
+                const std::byte* end = internal::write_binary_arg(record.m_Args.data(), dropped);
+                record.m_Size        = static_cast<u32>(end - record.m_Args.data());
+                write_dump_record(record, 0);
+            }
+            flush_dump();
+            return !g_Dump.m_Failed;
+        }
+
+        bool dump_to_path(const char* path, u32 generation) {
+            if (g_Recorder.m_Dumping.test_and_set(std::memory_order_acquire)) {
+                return false;
+            }
+            bool      written = false;
+            const int fd      = ::open(path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+            if (fd >= 0) {
+                written = write_dump(fd, generation);
+                ::close(fd);
+            }
+            g_Recorder.m_Dumping.clear(std::memory_order_release);
+            return written;
+        }
+
+        void crash_handler(int signal) {
+            const int savedErrno = errno;
+            FlightRecorder::dump_crash();
+            // Hand the signal to whatever was installed before us, the default action by default
+            for (usize i = 0; i < CRASH_SIGNALS.size(); i++) {
+                if (CRASH_SIGNALS[i] == signal) {
+                    sigaction(signal, &g_Recorder.m_PreviousActions[i], nullptr);
+                }
+            }
+            errno = savedErrno;
+            raise(signal);
+        }
+
+        void install_signal_handlers() {
+            // A stack overflow can only be reported from an alternate stack
+            stack_t current {};
+            if (sigaltstack(nullptr, &current) == 0 && (current.ss_flags & SS_DISABLE) != 0) {
+                stack_t stack {};
+                stack.ss_sp   = g_AltStack.data();
+                stack.ss_size = g_AltStack.size();
+                sigaltstack(&stack, nullptr);
+            }
+
+            struct sigaction action {};
+            action.sa_handler = crash_handler;
+            action.sa_flags   = SA_ONSTACK;
+            sigemptyset(&action.sa_mask);
+            for (usize i = 0; i < CRASH_SIGNALS.size(); i++) {
+                sigaction(CRASH_SIGNALS[i], &action, &g_Recorder.m_PreviousActions[i]);
+            }
+            g_Recorder.m_HandlersInstalled = true;
+        }
+
+        void restore_signal_handlers() {
+            for (usize i = 0; i < CRASH_SIGNALS.size(); i++) {
+                sigaction(CRASH_SIGNALS[i], &g_Recorder.m_PreviousActions[i], nullptr);
+            }
+            g_Recorder.m_HandlersInstalled = false;
+        }
+    } // namespace
+
+    Result<bool, std::string> FlightRecorder::enable(const FlightRecorderConfig_t& config) {
+        if (!config.m_Enabled) {
+            disable();
+            return Result<bool, std::string>(true);
+        }
+
+        std::lock_guard   lock(g_Recorder.m_Mutex);
+        const std::string path = config.m_CrashDumpPath.string();
+        if (path.empty() || path.size() >= g_Recorder.m_CrashDumpPath.size()) {
+            return Err<std::string>(fmt::format("Invalid crash dump path '{}'", path));
+        }
+        // The handlers may read the path at any time, so it is never left half written
+        s_Enabled.store(false, std::memory_order_relaxed);
+        while (g_Recorder.m_Dumping.test_and_set(std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+        std::copy(path.begin(), path.end(), g_Recorder.m_CrashDumpPath.begin());
+        g_Recorder.m_CrashDumpPath[path.size()] = '\0';
+        g_Recorder.m_BaseTicks     = BinaryLog::read_timestamp();
+        g_Recorder.m_BaseMonotonic = clock_ns(CLOCK_MONOTONIC);
+        g_Recorder.m_BaseRealtime  = clock_ns(CLOCK_REALTIME);
+        g_Recorder.m_Dumping.clear(std::memory_order_release);
+
+        s_Capacity.store(std::bit_ceil(std::max<usize>(config.m_RecordsPerThread, 16)),
+                         std::memory_order_relaxed);
+        s_Level.store(config.m_Level, std::memory_order_relaxed);
+        s_Generation.fetch_add(1, std::memory_order_relaxed);
+        s_Dropped.store(0, std::memory_order_relaxed);
+        // Registering takes a lock, the crash dump must not
+        BinaryLog::site_id<u64>(g_DroppedSite);
+        if (config.m_InstallSignalHandlers && !g_Recorder.m_HandlersInstalled) {
+            install_signal_handlers();
+        }
+        else if (!config.m_InstallSignalHandlers && g_Recorder.m_HandlersInstalled) {
+            restore_signal_handlers();
+        }
+        s_Enabled.store(true, std::memory_order_relaxed);
+        return Result<bool, std::string>(true);
+    }
+
+    void FlightRecorder::disable() {
+        std::lock_guard lock(g_Recorder.m_Mutex);
+        s_Enabled.store(false, std::memory_order_relaxed);
+        if (g_Recorder.m_HandlersInstalled) {
+            restore_signal_handlers();
+        }
+    }
+
+    Result<bool, std::string> FlightRecorder::dump(const std::filesystem::path& path) {
+        if (!dump_to_path(path.c_str(), s_Generation.load(std::memory_order_relaxed))) {
+            return Err<std::string>(fmt::format("Failed to dump the flight recorder to {}: {}",
+                                                path.string(), std::strerror(errno)));
+        }
+        return Result<bool, std::string>(true);
+    }
+
+    bool FlightRecorder::dump_crash() {
+        if (g_Recorder.m_CrashDumpPath[0] == '\0') {
+            return false;
+        }
+        return dump_to_path(g_Recorder.m_CrashDumpPath.data(),
+                            s_Generation.load(std::memory_order_relaxed));
+    }
+
+    internal::FlightRing_t* FlightRecorder::attach_thread() {
+        std::lock_guard lock(g_Recorder.m_Mutex);
+        const usize     capacity = s_Capacity.load(std::memory_order_relaxed);
+        if (capacity == 0) {
+            return nullptr;
+        }
+
+        // A thread keeps its slot across reconfigurations, new threads take a free one
+        auto& rings = g_Recorder.m_Rings;
+        usize index = MAX_THREADS;
+        for (usize i = 0; i < MAX_THREADS && index == MAX_THREADS; i++) {
+            const auto* ring = rings[i].load(std::memory_order_relaxed);
+            index = (s_ThreadRing != nullptr ? ring == s_ThreadRing : ring == nullptr) ? i : index;
+        }
+        // Out of slots, the history of an exited thread makes room
+        for (usize i = 0; i < MAX_THREADS && index == MAX_THREADS; i++) {
+            const auto* ring = rings[i].load(std::memory_order_relaxed);
+            index            = ring->m_InUse.load(std::memory_order_acquire) ? index : i;
+        }
+        if (index == MAX_THREADS) {
+            return nullptr;
+        }
+
+        internal::FlightRing_t* ring = rings[index].load(std::memory_order_relaxed);
+        if (ring == nullptr || ring->m_Capacity != capacity) {
+            auto owned        = std::make_unique<internal::FlightRing_t>();
+            owned->m_Capacity = capacity;
+            // NOLINTNEXTLINE(*-avoid-c-arrays)
+            owned->m_Slots = std::make_unique<internal::FlightSlot_t[]>(capacity);
+            ring           = owned.get();
+            g_Recorder.m_Owned.push_back(std::move(owned));
+        }
+        else {
+            // Only the owner writes to a ring, so it can be emptied in place. A concurrent dump
+            // drops the slots that change under it.
+            for (usize i = 0; i < capacity; i++) {
+                ring->m_Slots[i].m_Sequence.store(0, std::memory_order_relaxed);
+            }
+            ring->m_Head.store(0, std::memory_order_relaxed);
+        }
+        if (ring != s_ThreadRing) {
+            ring->m_ThreadIndex = g_Recorder.m_NextThreadIndex++;
+        }
+        ring->m_InUse.store(true, std::memory_order_relaxed);
+        ring->m_Generation.store(s_Generation.load(std::memory_order_relaxed),
+                                 std::memory_order_release);
+        rings[index].store(ring, std::memory_order_release);
+
+        g_RingOwner.m_Ring = ring;
+        s_ThreadRing       = ring;
+        return ring;
+    }
+} // namespace Pulsar
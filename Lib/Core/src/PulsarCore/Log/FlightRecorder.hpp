@@ -0,0 +1,168 @@
+#pragma once
+
+#include "PulsarCore/Log/BinaryLog.hpp"
+#include "PulsarCore/Result.hpp"
+#include "PulsarCore/Types.hpp"
+#include "PulsarCore/Util/Macros.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <filesystem>
+#include <memory>
+#include <spdlog/common.h>
+#include <string>
+
+namespace Pulsar {
+    struct FlightRecorderConfig_t {
+        bool m_Enabled = false;
+        /// Statements at or above this level are recorded, whatever the log level is. They also
+        /// have to be compiled in, see `PULSAR_LOG_LEVEL`.
+        spdlog::level::level_enum m_Level = spdlog::level::trace;
+        /// Records kept per thread, rounded up to a power of two
+        usize m_RecordsPerThread = 4096;
+        /// Where fatal errors and crashes dump the history
+        std::filesystem::path m_CrashDumpPath = "Pulsar.crash.plog";
+        /// Dump on SIGSEGV, SIGABRT, SIGBUS, SIGFPE and SIGILL
+        bool m_InstallSignalHandlers = true;
+    };
+
+    namespace internal {
+        /// One record, written by the owning thread and validated by the dump through the sequence
+        struct alignas(64) FlightSlot_t {
+            static constexpr usize ARGS_SIZE = 100;
+
+            /// Index of the record plus one, 0 while it is being written
+            std::atomic<u64>                 m_Sequence {0};
+            u64                              m_Timestamp = 0;
+            const BinaryLogSite_t*           m_Site      = nullptr;
+            u32                              m_Size      = 0;
+            std::array<std::byte, ARGS_SIZE> m_Args;
+        };
+
+        struct FlightRing_t {
+            std::atomic<u64>                m_Head {0};
+            std::atomic<bool>               m_InUse {true};
+            /// `enable` call the records belong to, older rings are left out of dumps
+            std::atomic<u32>                m_Generation {0};
+            u32                             m_ThreadIndex = 0;
+            usize                           m_Capacity    = 0;
+            std::unique_ptr<FlightSlot_t[]> m_Slots; // NOLINT(*-avoid-c-arrays)
+        };
+
+        /// Like `write_binary_arg`, but strings are cut to the bytes left in `budget`
+        template<typename T> PULSAR_ALWAYS_INLINE std::byte* write_binary_arg_clamped(
+            std::byte* out, const T& value, usize& budget) {
+            using U = std::remove_cvref_t<T>;
+            if constexpr (std::is_same_v<U, std::string_view> || std::is_same_v<U, std::string>) {
+                const std::string_view clamped(value.data(), std::min(value.size(), budget));
+                budget -= clamped.size();
+                return write_binary_arg(out, clamped);
+            }
+            else {
+                return write_binary_arg(out, value);
+            }
+        }
+    } // namespace internal
+
+    /// Keeps the latest log records of every thread in memory, and only writes them out when
+    /// something goes wrong
+    /// # Performance
+    /// Recording copies the raw arguments into a fixed-size slot of the calling thread's ring,
+    /// nothing is formatted and no lock is taken. Old records are overwritten. Strings are cut
+    /// to fit the slot, statements that still do not fit are counted in `dropped_count`.
+    /// # Dumps
+    /// A fatal log statement, a crash signal or `dump` writes the rings as a binary log file
+    /// (decode it with `PulsarLogDecode`), merged by time. The crash dump path only uses
+    /// async-signal-safe calls and static buffers.
+    class FlightRecorder {
+    public:
+        static constexpr usize MAX_THREADS = 256;
+
+        [[nodiscard]] static Result<bool, std::string> enable(const FlightRecorderConfig_t& config);
+        /// Stops recording, the rings stay allocated so threads still inside `record` are safe
+        static void disable();
+
+        [[nodiscard]] static bool is_enabled() {
+            return s_Enabled.load(std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] static spdlog::level::level_enum get_level() {
+            return s_Level.load(std::memory_order_relaxed);
+        }
+
+        template<typename... Args> static void record(BinaryLogSite_t& site, const Args&... args) {
+            constexpr usize FIXED_SIZE = (fixed_size<Args>() + ... + 0);
+            if constexpr (FIXED_SIZE > internal::FlightSlot_t::ARGS_SIZE) {
+                // Only strings can be cut, such a statement never fits. Dumps report the count.
+                s_Dropped.fetch_add(1, std::memory_order_relaxed);
+            }
+            else {
+                BinaryLog::site_id<Args...>(site);
+                internal::FlightRing_t* ring = s_ThreadRing;
+                if (ring == nullptr || !is_current(*ring)) [[unlikely]] {
+                    ring = attach_thread();
+                    if (ring == nullptr) {
+                        return;
+                    }
+                }
+
+                const u64 sequence = ring->m_Head.load(std::memory_order_relaxed);
+                auto&     slot     = ring->m_Slots[sequence & (ring->m_Capacity - 1)];
+                slot.m_Sequence.store(0, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_release);
+
+                usize      budget = internal::FlightSlot_t::ARGS_SIZE - FIXED_SIZE;
+                std::byte* out    = slot.m_Args.data();
+                ((out = internal::write_binary_arg_clamped(out, args, budget)), ...);
+                slot.m_Timestamp = BinaryLog::read_timestamp();
+                slot.m_Site      = &site;
+                slot.m_Size      = static_cast<u32>(out - slot.m_Args.data());
+                slot.m_Sequence.store(sequence + 1, std::memory_order_release);
+                ring->m_Head.store(sequence + 1, std::memory_order_release);
+            }
+        }
+
+        /// Statements left out since the last `enable` because their arguments do not fit a slot
+        /// even with their strings cut. Dumps end with a record of the count.
+        [[nodiscard]] static u64 dropped_count() {
+            return s_Dropped.load(std::memory_order_relaxed);
+        }
+
+        /// Writes the recorded history to `path`
+        [[nodiscard]] static Result<bool, std::string> dump(const std::filesystem::path& path);
+        /// Writes the recorded history to the crash dump path. Async-signal-safe, returns false if
+        /// another dump is in progress or the file could not be written.
+        static bool dump_crash();
+
+    private:
+        /// Size of an argument, not counting the characters of strings
+        template<typename T> static consteval usize fixed_size() {
+            using U = std::remove_cvref_t<T>;
+            if constexpr (std::is_same_v<U, std::string_view> || std::is_same_v<U, std::string>) {
+                return sizeof(u32);
+            }
+            else if constexpr (std::is_same_v<U, const void*>) {
+                return sizeof(u64);
+            }
+            else {
+                return sizeof(U);
+            }
+        }
+
+        [[nodiscard]] static bool is_current(const internal::FlightRing_t& ring) {
+            return ring.m_Generation.load(std::memory_order_relaxed)
+                == s_Generation.load(std::memory_order_relaxed);
+        }
+
+        PULSAR_NO_INLINE static internal::FlightRing_t* attach_thread();
+
+        constinit inline static thread_local internal::FlightRing_t* s_ThreadRing = nullptr;
+        inline static std::atomic<bool>                              s_Enabled {false};
+        inline static std::atomic<spdlog::level::level_enum>         s_Level {spdlog::level::trace};
+        inline static std::atomic<usize>                             s_Capacity {0};
+        /// Bumped by every `enable`, a thread starts over with an empty ring when it sees it
+        inline static std::atomic<u32> s_Generation {0};
+        inline static std::atomic<u64> s_Dropped {0};
+    };
+} // namespace Pulsar
@@ -0,0 +1,148 @@
+#pragma once
+
+#include "PulsarCore/Types.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <span>
+
+namespace Pulsar {
+    // NOLINTBEGIN(readability-identifier-naming)
+
+    /// Axis-aligned bounding box, stored as min/max corners
+    struct AABB {
+        Vec3 min;
+        Vec3 max;
+
+        [[nodiscard]] static constexpr AABB from_center_extents(
+            const Vec3& center, const Vec3& extents) {
+            return {
+                {center.x - extents.x, center.y - extents.y, center.z - extents.z},
+                {center.x + extents.x, center.y + extents.y, center.z + extents.z}
+            };
+        }
+
+        [[nodiscard]] constexpr Vec3 center() const {
+            return {(min.x + max.x) * 0.5F, (min.y + max.y) * 0.5F, (min.z + max.z) * 0.5F};
+        }
+
+        /// Half the size of the box along each axis
+        [[nodiscard]] constexpr Vec3 extents() const {
+            return {(max.x - min.x) * 0.5F, (max.y - min.y) * 0.5F, (max.z - min.z) * 0.5F};
+        }
+
+        [[nodiscard]] constexpr bool contains(const Vec3& point) const {
+            return point.x >= min.x && point.x <= max.x && point.y >= min.y && point.y <= max.y
+                && point.z >= min.z && point.z <= max.z;
+        }
+
+        [[nodiscard]] constexpr bool intersects(const AABB& other) const {
+            return min.x <= other.max.x && max.x >= other.min.x && min.y <= other.max.y
+                && max.y >= other.min.y && min.z <= other.max.z && max.z >= other.min.z;
+        }
+
+        [[nodiscard]] constexpr AABB merged(const AABB& other) const {
+            const Vec3 lower = {std::min(min.x, other.min.x), std::min(min.y, other.min.y),
+                std::min(min.z, other.min.z)};
+            const Vec3 upper = {std::max(max.x, other.max.x), std::max(max.y, other.max.y),
+                std::max(max.z, other.max.z)};
+            return {lower, upper};
+        }
+    };
+
+    struct Sphere {
+        Vec3 center;
+        f32  radius;
+
+        [[nodiscard]] constexpr bool contains(const Vec3& point) const {
+            const f32 dx = point.x - center.x;
+            const f32 dy = point.y - center.y;
+            const f32 dz = point.z - center.z;
+            return dx * dx + dy * dy + dz * dz <= radius * radius;
+        }
+
+        [[nodiscard]] constexpr bool intersects(const Sphere& other) const {
+            const f32 dx     = other.center.x - center.x;
+            const f32 dy     = other.center.y - center.y;
+            const f32 dz     = other.center.z - center.z;
+            const f32 radius = this->radius + other.radius;
+            return dx * dx + dy * dy + dz * dz <= radius * radius;
+        }
+    };
+
+    /// Six inward facing planes, a point p is inside a plane if dot(plane.xyz, p) + plane.w >= 0
+    struct Frustum {
+        enum Side : u8 {
+            LEFT   = 0,
+            RIGHT  = 1,
+            BOTTOM = 2,
+            TOP    = 3,
+            NEAR   = 4,
+            FAR    = 5,
+        };
+
+        std::array<Vec4, 6> planes;
+
+        /// Extracts the planes from a column-major view-projection matrix (Gribb-Hartmann)
+        /// Expects a [0, 1] clip space depth range (Vulkan/D3D)
+        [[nodiscard]] static Frustum from_view_projection(std::span<const f32, 16> matrix) {
+            const auto row = [&](usize r) {
+                return Vec4 {matrix[r], matrix[4 + r], matrix[8 + r], matrix[12 + r]};
+            };
+            const auto add = [](const Vec4& a, const Vec4& b) {
+                return Vec4 {a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w};
+            };
+            const auto sub = [](const Vec4& a, const Vec4& b) {
+                return Vec4 {a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w};
+            };
+            const Vec4 r0 = row(0);
+            const Vec4 r1 = row(1);
+            const Vec4 r2 = row(2);
+            const Vec4 r3 = row(3);
+
+            Frustum frustum {};
+            frustum.planes[LEFT]   = add(r3, r0);
+            frustum.planes[RIGHT]  = sub(r3, r0);
+            frustum.planes[BOTTOM] = add(r3, r1);
+            frustum.planes[TOP]    = sub(r3, r1);
+            frustum.planes[NEAR]   = r2;
+            frustum.planes[FAR]    = sub(r3, r2);
+            frustum.normalize();
+            return frustum;
+        }
+
+        /// Normalizes the planes, so the plane distances are in world units (needed for spheres)
+        void normalize() {
+            for (auto& plane : planes) {
+                const f32 invLength =
+                    1.0F / std::sqrt(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+                plane = {plane.x * invLength, plane.y * invLength, plane.z * invLength,
+                    plane.w * invLength};
+            }
+        }
+
+        /// Conservative test, boxes crossing a plane count as visible
+        [[nodiscard]] bool intersects(const AABB& box) const {
+            const Vec3 center  = box.center();
+            const Vec3 extents = box.extents();
+            return std::ranges::all_of(planes, [&](const Vec4& plane) {
+                const f32 distance =
+                    plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w;
+                const f32 radius   = std::abs(plane.x) * extents.x + std::abs(plane.y) * extents.y
+                                 + std::abs(plane.z) * extents.z;
+                return distance + radius >= 0.0F;
+            });
+        }
+
+        [[nodiscard]] bool intersects(const Sphere& sphere) const {
+            return std::ranges::all_of(planes, [&](const Vec4& plane) {
+                const f32 distance = plane.x * sphere.center.x + plane.y * sphere.center.y
+                                   + plane.z * sphere.center.z + plane.w;
+                return distance + sphere.radius >= 0.0F;
+            });
+        }
+    };
+
+    // NOLINTEND(readability-identifier-naming)
+} // namespace Pulsar
@@ -0,0 +1,312 @@
+#include "Culling.hpp"
+
+#include "PulsarCore/Util/CpuFeatures.hpp"
+#include "PulsarCore/Util/Macros.hpp"
+
+#include <bit>
+
+#ifdef PULSAR_ARCH_X86
+    #include <immintrin.h>
+#endif
+
+// NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic, cppcoreguidelines-pro-bounds-constant-array-index)
+namespace Pulsar::Culling {
+    void AABBSoA::reserve(usize count) {
+        m_CenterX.reserve(count);
+        m_CenterY.reserve(count);
+        m_CenterZ.reserve(count);
+        m_ExtentsX.reserve(count);
+        m_ExtentsY.reserve(count);
+        m_ExtentsZ.reserve(count);
+    }
+
+    void AABBSoA::clear() {
+        m_CenterX.clear();
+        m_CenterY.clear();
+        m_CenterZ.clear();
+        m_ExtentsX.clear();
+        m_ExtentsY.clear();
+        m_ExtentsZ.clear();
+    }
+
+    void AABBSoA::push_back(const AABB& box) {
+        const Vec3 center  = box.center();
+        const Vec3 extents = box.extents();
+        m_CenterX.push_back(center.x);
+        m_CenterY.push_back(center.y);
+        m_CenterZ.push_back(center.z);
+        m_ExtentsX.push_back(extents.x);
+        m_ExtentsY.push_back(extents.y);
+        m_ExtentsZ.push_back(extents.z);
+    }
+
+    void AABBSoA::set(usize index, const AABB& box) {
+        const Vec3 center  = box.center();
+        const Vec3 extents = box.extents();
+        m_CenterX[index]   = center.x;
+        m_CenterY[index]   = center.y;
+        m_CenterZ[index]   = center.z;
+        m_ExtentsX[index]  = extents.x;
+        m_ExtentsY[index]  = extents.y;
+        m_ExtentsZ[index]  = extents.z;
+    }
+
+    AABB AABBSoA::get(usize index) const {
+        return AABB::from_center_extents({m_CenterX[index], m_CenterY[index], m_CenterZ[index]},
+            {m_ExtentsX[index], m_ExtentsY[index], m_ExtentsZ[index]});
+    }
+
+    void SphereSoA::reserve(usize count) {
+        m_CenterX.reserve(count);
+        m_CenterY.reserve(count);
+        m_CenterZ.reserve(count);
+        m_Radius.reserve(count);
+    }
+
+    void SphereSoA::clear() {
+        m_CenterX.clear();
+        m_CenterY.clear();
+        m_CenterZ.clear();
+        m_Radius.clear();
+    }
+
+    void SphereSoA::push_back(const Sphere& sphere) {
+        m_CenterX.push_back(sphere.center.x);
+        m_CenterY.push_back(sphere.center.y);
+        m_CenterZ.push_back(sphere.center.z);
+        m_Radius.push_back(sphere.radius);
+    }
+
+    void SphereSoA::set(usize index, const Sphere& sphere) {
+        m_CenterX[index] = sphere.center.x;
+        m_CenterY[index] = sphere.center.y;
+        m_CenterZ[index] = sphere.center.z;
+        m_Radius[index]  = sphere.radius;
+    }
+
+    Sphere SphereSoA::get(usize index) const {
+        return {
+            {m_CenterX[index], m_CenterY[index], m_CenterZ[index]},
+            m_Radius[index]
+        };
+    }
+
+    namespace {
+        bool visible_scalar(const Frustum& frustum, const AABBSoA& boxes, usize i) {
+            const f32 cx = boxes.center_x()[i];
+            const f32 cy = boxes.center_y()[i];
+            const f32 cz = boxes.center_z()[i];
+            const f32 ex = boxes.extents_x()[i];
+            const f32 ey = boxes.extents_y()[i];
+            const f32 ez = boxes.extents_z()[i];
+            for (const Vec4& plane : frustum.planes) {
+                const f32 distance = plane.x * cx + plane.y * cy + plane.z * cz + plane.w;
+                const f32 radius =
+                    std::abs(plane.x) * ex + std::abs(plane.y) * ey + std::abs(plane.z) * ez;
+                if (distance + radius < 0.0F) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        bool visible_scalar(const Frustum& frustum, const SphereSoA& spheres, usize i) {
+            const f32 cx = spheres.center_x()[i];
+            const f32 cy = spheres.center_y()[i];
+            const f32 cz = spheres.center_z()[i];
+            const f32 r  = spheres.radius()[i];
+            for (const Vec4& plane : frustum.planes) {
+                if (plane.x * cx + plane.y * cy + plane.z * cz + plane.w + r < 0.0F) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        template<typename Bounds>
+        void cull_scalar(const Frustum& frustum, const Bounds& bounds, std::span<u64> visibility,
+            usize first, usize count) {
+            const usize end = first + count;
+            for (usize base = first; base < end; base += OBJECTS_PER_WORD) {
+                const usize objects = std::min(OBJECTS_PER_WORD, end - base);
+                u64         bits    = 0;
+                for (usize j = 0; j < objects; j++) {
+                    bits |= static_cast<u64>(visible_scalar(frustum, bounds, base + j)) << j;
+                }
+                visibility[base / OBJECTS_PER_WORD] = bits;
+            }
+        }
+
+#ifdef PULSAR_ARCH_X86
+        struct PlanesAVX_t {
+            __m256 m_NormalX[6];
+            __m256 m_NormalY[6];
+            __m256 m_NormalZ[6];
+            __m256 m_Distance[6];
+            __m256 m_AbsNormalX[6];
+            __m256 m_AbsNormalY[6];
+            __m256 m_AbsNormalZ[6];
+        };
+
+        [[gnu::target("avx2,fma")]] inline PlanesAVX_t broadcast_planes(const Frustum& frustum) {
+            PlanesAVX_t planes {};
+            for (usize p = 0; p < 6; p++) {
+                const Vec4& plane      = frustum.planes[p];
+                planes.m_NormalX[p]    = _mm256_set1_ps(plane.x);
+                planes.m_NormalY[p]    = _mm256_set1_ps(plane.y);
+                planes.m_NormalZ[p]    = _mm256_set1_ps(plane.z);
+                planes.m_Distance[p]   = _mm256_set1_ps(plane.w);
+                planes.m_AbsNormalX[p] = _mm256_set1_ps(std::abs(plane.x));
+                planes.m_AbsNormalY[p] = _mm256_set1_ps(std::abs(plane.y));
+                planes.m_AbsNormalZ[p] = _mm256_set1_ps(std::abs(plane.z));
+            }
+            return planes;
+        }
+
+        [[gnu::target("avx2,fma")]] inline u32 test8_aabb(
+            const PlanesAVX_t& planes, const AABBSoA& boxes, usize i) {
+            const __m256 cx   = _mm256_loadu_ps(boxes.center_x() + i);
+            const __m256 cy   = _mm256_loadu_ps(boxes.center_y() + i);
+            const __m256 cz   = _mm256_loadu_ps(boxes.center_z() + i);
+            const __m256 ex   = _mm256_loadu_ps(boxes.extents_x() + i);
+            const __m256 ey   = _mm256_loadu_ps(boxes.extents_y() + i);
+            const __m256 ez   = _mm256_loadu_ps(boxes.extents_z() + i);
+            const __m256 zero = _mm256_setzero_ps();
+
+            __m256 visible = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+            for (usize p = 0; p < 6; p++) {
+                __m256 distance = _mm256_fmadd_ps(planes.m_NormalZ[p], cz, planes.m_Distance[p]);
+                distance        = _mm256_fmadd_ps(planes.m_NormalY[p], cy, distance);
+                distance        = _mm256_fmadd_ps(planes.m_NormalX[p], cx, distance);
+                __m256 radius   = _mm256_mul_ps(planes.m_AbsNormalZ[p], ez);
+                radius          = _mm256_fmadd_ps(planes.m_AbsNormalY[p], ey, radius);
+                radius          = _mm256_fmadd_ps(planes.m_AbsNormalX[p], ex, radius);
+                visible         = _mm256_and_ps(
+                    visible, _mm256_cmp_ps(_mm256_add_ps(distance, radius), zero, _CMP_GE_OQ));
+            }
+            return static_cast<u32>(_mm256_movemask_ps(visible));
+        }
+
+        [[gnu::target("avx2,fma")]] inline u32 test8_sphere(
+            const PlanesAVX_t& planes, const SphereSoA& spheres, usize i) {
+            const __m256 cx   = _mm256_loadu_ps(spheres.center_x() + i);
+            const __m256 cy   = _mm256_loadu_ps(spheres.center_y() + i);
+            const __m256 cz   = _mm256_loadu_ps(spheres.center_z() + i);
+            const __m256 r    = _mm256_loadu_ps(spheres.radius() + i);
+            const __m256 zero = _mm256_setzero_ps();
+
+            __m256 visible = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+            for (usize p = 0; p < 6; p++) {
+                __m256 distance = _mm256_add_ps(planes.m_Distance[p], r);
+                distance        = _mm256_fmadd_ps(planes.m_NormalZ[p], cz, distance);
+                distance        = _mm256_fmadd_ps(planes.m_NormalY[p], cy, distance);
+                distance        = _mm256_fmadd_ps(planes.m_NormalX[p], cx, distance);
+                visible = _mm256_and_ps(visible, _mm256_cmp_ps(distance, zero, _CMP_GE_OQ));
+            }
+            return static_cast<u32>(_mm256_movemask_ps(visible));
+        }
+
+        // The word loop is spelled out in each kernel, lambdas would not inherit the target
+        // attribute and the AVX2 helpers could not be inlined into them
+        [[gnu::target("avx2,fma")]] void cull_avx2(const Frustum& frustum, const AABBSoA& boxes,
+            std::span<u64> visibility, usize first, usize count) {
+            const PlanesAVX_t planes = broadcast_planes(frustum);
+            const usize       end    = first + count;
+            for (usize base = first; base < end; base += OBJECTS_PER_WORD) {
+                const usize objects = std::min(OBJECTS_PER_WORD, end - base);
+                u64         bits    = 0;
+                usize       j       = 0;
+                for (; j + 16 <= objects; j += 16) {
+                    const u32 low  = test8_aabb(planes, boxes, base + j);
+                    const u32 high = test8_aabb(planes, boxes, base + j + 8);
+                    bits |= static_cast<u64>(low | (high << 8U)) << j;
+                }
+                for (; j < objects; j++) {
+                    bits |= static_cast<u64>(visible_scalar(frustum, boxes, base + j)) << j;
+                }
+                visibility[base / OBJECTS_PER_WORD] = bits;
+            }
+        }
+
+        [[gnu::target("avx2,fma")]] void cull_avx2(const Frustum& frustum, const SphereSoA& spheres,
+            std::span<u64> visibility, usize first, usize count) {
+            const PlanesAVX_t planes = broadcast_planes(frustum);
+            const usize       end    = first + count;
+            for (usize base = first; base < end; base += OBJECTS_PER_WORD) {
+                const usize objects = std::min(OBJECTS_PER_WORD, end - base);
+                u64         bits    = 0;
+                usize       j       = 0;
+                for (; j + 16 <= objects; j += 16) {
+                    const u32 low  = test8_sphere(planes, spheres, base + j);
+                    const u32 high = test8_sphere(planes, spheres, base + j + 8);
+                    bits |= static_cast<u64>(low | (high << 8U)) << j;
+                }
+                for (; j < objects; j++) {
+                    bits |= static_cast<u64>(visible_scalar(frustum, spheres, base + j)) << j;
+                }
+                visibility[base / OBJECTS_PER_WORD] = bits;
+            }
+        }
+#endif
+
+    } // namespace
+
+    void cull(const Frustum& frustum, const AABBSoA& boxes, std::span<u64> visibility, usize first,
+        usize count) {
+        PULSAR_ASSERT(first % OBJECTS_PER_WORD == 0, "Culling ranges must start on a word");
+        PULSAR_ASSERT(first + count <= boxes.size(), "Culling range out of bounds");
+        PULSAR_ASSERT(visibility.size() >= mask_words(first + count), "Visibility mask too small");
+#ifdef PULSAR_ARCH_X86
+        if (cpu_features().m_AVX2 && cpu_features().m_FMA) {
+            cull_avx2(frustum, boxes, visibility, first, count);
+            return;
+        }
+#endif
+        cull_scalar(frustum, boxes, visibility, first, count);
+    }
+
+    void cull(const Frustum& frustum, const SphereSoA& spheres, std::span<u64> visibility,
+        usize first, usize count) {
+        PULSAR_ASSERT(first % OBJECTS_PER_WORD == 0, "Culling ranges must start on a word");
+        PULSAR_ASSERT(first + count <= spheres.size(), "Culling range out of bounds");
+        PULSAR_ASSERT(visibility.size() >= mask_words(first + count), "Visibility mask too small");
+#ifdef PULSAR_ARCH_X86
+        if (cpu_features().m_AVX2 && cpu_features().m_FMA) {
+            cull_avx2(frustum, spheres, visibility, first, count);
+            return;
+        }
+#endif
+        cull_scalar(frustum, spheres, visibility, first, count);
+    }
+
+    usize compact(std::span<const u64> visibility, usize count, std::vector<u32>& indices) {
+        const usize before = indices.size();
+        const usize words  = mask_words(count);
+        for (usize word = 0; word < words; word++) {
+            u64 bits = visibility[word];
+            if (word == words - 1 && count % OBJECTS_PER_WORD != 0) {
+                bits &= (u64 {1} << (count % OBJECTS_PER_WORD)) - 1;
+            }
+            while (bits != 0) {
+                const auto bit = static_cast<u32>(std::countr_zero(bits));
+                indices.push_back(static_cast<u32>(word * OBJECTS_PER_WORD) + bit);
+                bits &= bits - 1;
+            }
+        }
+        return indices.size() - before;
+    }
+
+    usize count_visible(std::span<const u64> visibility, usize count) {
+        usize       visible = 0;
+        const usize words   = mask_words(count);
+        for (usize word = 0; word < words; word++) {
+            u64 bits = visibility[word];
+            if (word == words - 1 && count % OBJECTS_PER_WORD != 0) {
+                bits &= (u64 {1} << (count % OBJECTS_PER_WORD)) - 1;
+            }
+            visible += static_cast<usize>(std::popcount(bits));
+        }
+        return visible;
+    }
+} // namespace Pulsar::Culling
+// NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic, cppcoreguidelines-pro-bounds-constant-array-index)
@@ -0,0 +1,140 @@
+#pragma once
+
+#include "PulsarCore/Math/Bounds.hpp"
+#include "PulsarCore/Types.hpp"
+
+#include <span>
+#include <vector>
+
+/// Batch visibility culling
+/// # Layout
+/// Bounds are stored as structure-of-arrays, so the SIMD kernels can load 8 objects per register.
+/// Boxes are kept as center/extents, which turns the box/plane test into two dot products.
+/// # Output
+/// Visibility is written as a bitmask, one bit per object and 64 objects per word. Callers that
+/// want an index list can compact the mask with `Culling::compact()`.
+namespace Pulsar::Culling {
+    /// Number of objects per visibility word
+    constexpr usize OBJECTS_PER_WORD = 64;
+
+    [[nodiscard]] constexpr usize mask_words(usize count) {
+        return (count + OBJECTS_PER_WORD - 1) / OBJECTS_PER_WORD;
+    }
+
+    class AABBSoA {
+    public:
+        AABBSoA() = default;
+
+        void reserve(usize count);
+        void clear();
+        void push_back(const AABB& box);
+        void set(usize index, const AABB& box);
+
+        [[nodiscard]] usize size() const {
+            return m_CenterX.size();
+        }
+
+        [[nodiscard]] AABB get(usize index) const;
+
+        [[nodiscard]] const f32* center_x() const {
+            return m_CenterX.data();
+        }
+        [[nodiscard]] const f32* center_y() const {
+            return m_CenterY.data();
+        }
+        [[nodiscard]] const f32* center_z() const {
+            return m_CenterZ.data();
+        }
+        [[nodiscard]] const f32* extents_x() const {
+            return m_ExtentsX.data();
+        }
+        [[nodiscard]] const f32* extents_y() const {
+            return m_ExtentsY.data();
+        }
+        [[nodiscard]] const f32* extents_z() const {
+            return m_ExtentsZ.data();
+        }
+
+    private:
+        std::vector<f32> m_CenterX;
+        std::vector<f32> m_CenterY;
+        std::vector<f32> m_CenterZ;
+        std::vector<f32> m_ExtentsX;
+        std::vector<f32> m_ExtentsY;
+        std::vector<f32> m_ExtentsZ;
+    };
+
+    class SphereSoA {
+    public:
+        SphereSoA() = default;
+
+        void reserve(usize count);
+        void clear();
+        void push_back(const Sphere& sphere);
+        void set(usize index, const Sphere& sphere);
+
+        [[nodiscard]] usize size() const {
+            return m_CenterX.size();
+        }
+
+        [[nodiscard]] Sphere get(usize index) const;
+
+        [[nodiscard]] const f32* center_x() const {
+            return m_CenterX.data();
+        }
+        [[nodiscard]] const f32* center_y() const {
+            return m_CenterY.data();
+        }
+        [[nodiscard]] const f32* center_z() const {
+            return m_CenterZ.data();
+        }
+        [[nodiscard]] const f32* radius() const {
+            return m_Radius.data();
+        }
+
+    private:
+        std::vector<f32> m_CenterX;
+        std::vector<f32> m_CenterY;
+        std::vector<f32> m_CenterZ;
+        std::vector<f32> m_Radius;
+    };
+
+    /// Culls `count` boxes starting at `first` and writes their visibility bits
+    /// # Requirements
+    /// `first` must be a multiple of OBJECTS_PER_WORD, so that disjoint ranges write disjoint words
+    /// and can run on different threads. `visibility` is indexed from object 0, not from `first`.
+    void cull(const Frustum& frustum, const AABBSoA& boxes, std::span<u64> visibility, usize first,
+        usize count);
+    void cull(const Frustum& frustum, const SphereSoA& spheres, std::span<u64> visibility,
+        usize first, usize count);
+
+    /// Culls every object in the container
+    template<typename Bounds>
+    void cull(const Frustum& frustum, const Bounds& bounds, std::span<u64> visibility) {
+        cull(frustum, bounds, visibility, 0, bounds.size());
+    }
+
+    /// Splits the culling into chunks and hands them to `parallelFor(chunkCount, body)`, which must
+    /// call `body(chunkIndex)` once for every chunk (on any thread) and return when all are done.
+    /// This keeps the kernels independent of whichever job system drives them.
+    template<typename Bounds, typename ParallelFor>
+    void cull_parallel(const Frustum& frustum, const Bounds& bounds, std::span<u64> visibility,
+        ParallelFor&& parallelFor, usize objectsPerChunk = 16 * 1024) {
+        // Chunks have to start on a word boundary
+        objectsPerChunk = std::max<usize>(
+            (objectsPerChunk + OBJECTS_PER_WORD - 1) / OBJECTS_PER_WORD * OBJECTS_PER_WORD,
+            OBJECTS_PER_WORD);
+        const usize count      = bounds.size();
+        const usize chunkCount = (count + objectsPerChunk - 1) / objectsPerChunk;
+        parallelFor(chunkCount, [&, objectsPerChunk, count](usize chunk) {
+            const usize first = chunk * objectsPerChunk;
+            cull(frustum, bounds, visibility, first, std::min(objectsPerChunk, count - first));
+        });
+    }
+
+    /// Appends the indices of the set bits to `indices`, returns the number of visible objects
+    usize compact(std::span<const u64> visibility, usize count, std::vector<u32>& indices);
+
+    /// Counts the number of visible objects
+    [[nodiscard]] usize count_visible(std::span<const u64> visibility, usize count);
+} // namespace Pulsar::Culling
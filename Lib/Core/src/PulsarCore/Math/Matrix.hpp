@@ -0,0 +1,100 @@
+#pragma once
+
+#include "PulsarCore/Math/Quat.hpp"
+#include "PulsarCore/Types.hpp"
+
+#include <array>
+
+namespace Pulsar {
+    // NOLINTBEGIN(readability-identifier-naming)
+
+    /// 4x4 matrix in column-major order, `m[column * 4 + row]`
+    /// # Usage
+    /// Vectors are columns, so `a * b` applies `b` first. The layout is what the graphics APIs
+    /// and `Frustum::from_view_projection` expect, and the alignment lets SIMD code load a
+    /// column with one aligned load.
+    struct alignas(16) Mat4 {
+        std::array<f32, 16> m;
+
+        [[nodiscard]] static constexpr Mat4 identity() {
+            Mat4 result {};
+            result.m[0]  = 1.0F;
+            result.m[5]  = 1.0F;
+            result.m[10] = 1.0F;
+            result.m[15] = 1.0F;
+            return result;
+        }
+
+        /// Scales, then rotates by the unit quaternion `rotation`, then translates
+        [[nodiscard]] static constexpr Mat4 from_trs(
+            const Vec3& translation, const Quat& rotation, const Vec3& scale) {
+            const f32 xx = rotation.x * rotation.x;
+            const f32 yy = rotation.y * rotation.y;
+            const f32 zz = rotation.z * rotation.z;
+            const f32 xy = rotation.x * rotation.y;
+            const f32 xz = rotation.x * rotation.z;
+            const f32 yz = rotation.y * rotation.z;
+            const f32 wx = rotation.w * rotation.x;
+            const f32 wy = rotation.w * rotation.y;
+            const f32 wz = rotation.w * rotation.z;
+            return {{
+                (1.0F - 2.0F * (yy + zz)) * scale.x,
+                2.0F * (xy + wz) * scale.x,
+                2.0F * (xz - wy) * scale.x,
+                0.0F,
+                2.0F * (xy - wz) * scale.y,
+                (1.0F - 2.0F * (xx + zz)) * scale.y,
+                2.0F * (yz + wx) * scale.y,
+                0.0F,
+                2.0F * (xz + wy) * scale.z,
+                2.0F * (yz - wx) * scale.z,
+                (1.0F - 2.0F * (xx + yy)) * scale.z,
+                0.0F,
+                translation.x,
+                translation.y,
+                translation.z,
+                1.0F,
+            }};
+        }
+
+        [[nodiscard]] constexpr f32 at(usize row, usize column) const {
+            return m[column * 4 + row];
+        }
+
+        [[nodiscard]] constexpr Vec4 column(usize index) const {
+            return {m[index * 4], m[index * 4 + 1], m[index * 4 + 2], m[index * 4 + 3]};
+        }
+
+        [[nodiscard]] constexpr Mat4 operator*(const Mat4& other) const {
+            Mat4 result {};
+            for (usize c = 0; c < 4; c++) {
+                for (usize r = 0; r < 4; r++) {
+                    result.m[c * 4 + r] = at(r, 0) * other.at(0, c) + at(r, 1) * other.at(1, c)
+                                        + at(r, 2) * other.at(2, c) + at(r, 3) * other.at(3, c);
+                }
+            }
+            return result;
+        }
+
+        [[nodiscard]] constexpr Vec3 transform_point(const Vec3& p) const {
+            return {
+                m[0] * p.x + m[4] * p.y + m[8] * p.z + m[12],
+                m[1] * p.x + m[5] * p.y + m[9] * p.z + m[13],
+                m[2] * p.x + m[6] * p.y + m[10] * p.z + m[14],
+            };
+        }
+
+        /// Ignores the translation, for directions
+        [[nodiscard]] constexpr Vec3 transform_vector(const Vec3& v) const {
+            return {
+                m[0] * v.x + m[4] * v.y + m[8] * v.z,
+                m[1] * v.x + m[5] * v.y + m[9] * v.z,
+                m[2] * v.x + m[6] * v.y + m[10] * v.z,
+            };
+        }
+
+        [[nodiscard]] constexpr bool operator==(const Mat4& other) const = default;
+    };
+
+    // NOLINTEND(readability-identifier-naming)
+} // namespace Pulsar
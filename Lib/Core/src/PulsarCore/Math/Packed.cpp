@@ -0,0 +1,241 @@
+#include "Packed.hpp"
+
+#include "PulsarCore/Util/CpuFeatures.hpp"
+#include "PulsarCore/Util/Macros.hpp"
+
+#ifdef PULSAR_ARCH_X86
+    #include <immintrin.h>
+#endif
+
+// NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast, cppcoreguidelines-pro-bounds-pointer-arithmetic)
+namespace Pulsar::Packed {
+    namespace {
+#ifdef PULSAR_ARCH_X86
+        [[gnu::target("avx,f16c")]] void encode_f16_f16c(const f32* src, u16* dst, usize count) {
+            usize i = 0;
+            for (; i + 8 <= count; i += 8) {
+                const __m256  value = _mm256_loadu_ps(src + i);
+                const __m128i half  = _mm256_cvtps_ph(value, _MM_FROUND_TO_NEAREST_INT);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), half);
+            }
+            for (; i < count; i++) {
+                dst[i] = f16::from_f32(src[i]);
+            }
+        }
+
+        [[gnu::target("avx,f16c")]] void decode_f16_f16c(const u16* src, f32* dst, usize count) {
+            usize i = 0;
+            for (; i + 8 <= count; i += 8) {
+                const __m128i half = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+                _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(half));
+            }
+            for (; i < count; i++) {
+                dst[i] = f16::to_f32(src[i]);
+            }
+        }
+
+        [[gnu::target("avx2")]] void decode_snorm16_avx2(const i16* src, f32* dst, usize count) {
+            const __m256 scale    = _mm256_set1_ps(1.0F / 32767.0F);
+            const __m256 minusOne = _mm256_set1_ps(-1.0F);
+            usize        i        = 0;
+            for (; i + 8 <= count; i += 8) {
+                const __m128i packed = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+                const __m256  value  = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(packed));
+                _mm256_storeu_ps(dst + i, _mm256_max_ps(_mm256_mul_ps(value, scale), minusOne));
+            }
+            for (; i < count; i++) {
+                dst[i] = Pulsar::decode_snorm16(src[i]);
+            }
+        }
+
+        [[gnu::target("avx2")]] void decode_unorm8_avx2(const u8* src, f32* dst, usize count) {
+            const __m256 scale = _mm256_set1_ps(1.0F / 255.0F);
+            usize        i     = 0;
+            for (; i + 8 <= count; i += 8) {
+                const __m128i packed = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i));
+                const __m256  value  = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(packed));
+                _mm256_storeu_ps(dst + i, _mm256_mul_ps(value, scale));
+            }
+            for (; i < count; i++) {
+                dst[i] = Pulsar::decode_unorm8(src[i]);
+            }
+        }
+
+        /// Decodes 8 normals per iteration in SoA form, then interleaves them back to Vec3
+        [[gnu::target("avx2,fma")]] void decode_octahedral_avx2(
+            const OctNormal* src, Vec3* dst, usize count) {
+            const __m256 scale    = _mm256_set1_ps(1.0F / 32767.0F);
+            const __m256 minusOne = _mm256_set1_ps(-1.0F);
+            const __m256 one      = _mm256_set1_ps(1.0F);
+            const __m256 signMask = _mm256_set1_ps(-0.0F);
+
+            usize i = 0;
+            for (; i + 8 <= count; i += 8) {
+                // Each 32 bit lane holds one normal, x in the low half and y in the high half
+                const __m256i packed =
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+                const __m256i xInt = _mm256_srai_epi32(_mm256_slli_epi32(packed, 16), 16);
+                const __m256i yInt = _mm256_srai_epi32(packed, 16);
+
+                __m256 x = _mm256_max_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(xInt), scale), minusOne);
+                __m256 y = _mm256_max_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(yInt), scale), minusOne);
+                const __m256 absX = _mm256_andnot_ps(signMask, x);
+                const __m256 absY = _mm256_andnot_ps(signMask, y);
+                const __m256 z    = _mm256_sub_ps(_mm256_sub_ps(one, absX), absY);
+
+                // x -= copysign(t, x), where t = max(-z, 0)
+                const __m256 zero = _mm256_setzero_ps();
+                const __m256 t    = _mm256_max_ps(_mm256_sub_ps(zero, z), zero);
+                x = _mm256_sub_ps(x, _mm256_or_ps(t, _mm256_and_ps(x, signMask)));
+                y = _mm256_sub_ps(y, _mm256_or_ps(t, _mm256_and_ps(y, signMask)));
+
+                const __m256 lengthSq =
+                    _mm256_fmadd_ps(x, x, _mm256_fmadd_ps(y, y, _mm256_mul_ps(z, z)));
+                const __m256 invLength = _mm256_div_ps(one, _mm256_sqrt_ps(lengthSq));
+
+                alignas(32) f32 xs[8];
+                alignas(32) f32 ys[8];
+                alignas(32) f32 zs[8];
+                _mm256_store_ps(xs, _mm256_mul_ps(x, invLength));
+                _mm256_store_ps(ys, _mm256_mul_ps(y, invLength));
+                _mm256_store_ps(zs, _mm256_mul_ps(z, invLength));
+                for (usize lane = 0; lane < 8; lane++) {
+                    dst[i + lane] = {xs[lane], ys[lane], zs[lane]};
+                }
+            }
+            for (; i < count; i++) {
+                dst[i] = Pulsar::decode_octahedral(src[i]);
+            }
+        }
+#endif
+    } // namespace
+
+    void encode_f16(std::span<const f32> src, std::span<f16> dst) {
+        PULSAR_ASSERT(dst.size() >= src.size(), "Destination is too small");
+#ifdef PULSAR_ARCH_X86
+        if (cpu_features().m_F16C) {
+            encode_f16_f16c(src.data(), reinterpret_cast<u16*>(dst.data()), src.size());
+            return;
+        }
+#endif
+        for (usize i = 0; i < src.size(); i++) {
+            dst[i] = f16(src[i]);
+        }
+    }
+
+    void decode_f16(std::span<const f16> src, std::span<f32> dst) {
+        PULSAR_ASSERT(dst.size() >= src.size(), "Destination is too small");
+#ifdef PULSAR_ARCH_X86
+        if (cpu_features().m_F16C) {
+            decode_f16_f16c(reinterpret_cast<const u16*>(src.data()), dst.data(), src.size());
+            return;
+        }
+#endif
+        for (usize i = 0; i < src.size(); i++) {
+            dst[i] = static_cast<f32>(src[i]);
+        }
+    }
+
+    void encode_vec3h(std::span<const Vec3> src, std::span<Vec3h> dst) {
+        PULSAR_ASSERT(dst.size() >= src.size(), "Destination is too small");
+        encode_f16({reinterpret_cast<const f32*>(src.data()), src.size() * 3},
+            {reinterpret_cast<f16*>(dst.data()), src.size() * 3});
+    }
+
+    void decode_vec3h(std::span<const Vec3h> src, std::span<Vec3> dst) {
+        PULSAR_ASSERT(dst.size() >= src.size(), "Destination is too small");
+        decode_f16({reinterpret_cast<const f16*>(src.data()), src.size() * 3},
+            {reinterpret_cast<f32*>(dst.data()), src.size() * 3});
+    }
+
+    void encode_snorm16(std::span<const Vec3> src, std::span<SNorm16Vec3> dst) {
+        PULSAR_ASSERT(dst.size() >= src.size(), "Destination is too small");
+        for (usize i = 0; i < src.size(); i++) {
+            dst[i] = Pulsar::encode_snorm16(src[i]);
+        }
+    }
+
+    void decode_snorm16(std::span<const SNorm16Vec3> src, std::span<Vec3> dst) {
+        PULSAR_ASSERT(dst.size() >= src.size(), "Destination is too small");
+#ifdef PULSAR_ARCH_X86
+        if (cpu_features().m_AVX2) {
+            decode_snorm16_avx2(reinterpret_cast<const i16*>(src.data()),
+                reinterpret_cast<f32*>(dst.data()), src.size() * 3);
+            return;
+        }
+#endif
+        for (usize i = 0; i < src.size(); i++) {
+            dst[i] = Pulsar::decode_snorm16(src[i]);
+        }
+    }
+
+    void encode_unorm8(std::span<const Vec4> src, std::span<UNorm8Vec4> dst) {
+        PULSAR_ASSERT(dst.size() >= src.size(), "Destination is too small");
+        for (usize i = 0; i < src.size(); i++) {
+            dst[i] = Pulsar::encode_unorm8(src[i]);
+        }
+    }
+
+    void decode_unorm8(std::span<const UNorm8Vec4> src, std::span<Vec4> dst) {
+        PULSAR_ASSERT(dst.size() >= src.size(), "Destination is too small");
+#ifdef PULSAR_ARCH_X86
+        if (cpu_features().m_AVX2) {
+            decode_unorm8_avx2(reinterpret_cast<const u8*>(src.data()),
+                reinterpret_cast<f32*>(dst.data()), src.size() * 4);
+            return;
+        }
+#endif
+        for (usize i = 0; i < src.size(); i++) {
+            dst[i] = Pulsar::decode_unorm8(src[i]);
+        }
+    }
+
+    void encode_octahedral(std::span<const Vec3> src, std::span<OctNormal> dst) {
+        PULSAR_ASSERT(dst.size() >= src.size(), "Destination is too small");
+        for (usize i = 0; i < src.size(); i++) {
+            dst[i] = Pulsar::encode_octahedral(src[i]);
+        }
+    }
+
+    void decode_octahedral(std::span<const OctNormal> src, std::span<Vec3> dst) {
+        PULSAR_ASSERT(dst.size() >= src.size(), "Destination is too small");
+#ifdef PULSAR_ARCH_X86
+        if (cpu_features().m_AVX2 && cpu_features().m_FMA) {
+            decode_octahedral_avx2(src.data(), dst.data(), src.size());
+            return;
+        }
+#endif
+        for (usize i = 0; i < src.size(); i++) {
+            dst[i] = Pulsar::decode_octahedral(src[i]);
+        }
+    }
+
+    void encode_unorm1010102(std::span<const Vec4> src, std::span<Packed1010102> dst) {
+        PULSAR_ASSERT(dst.size() >= src.size(), "Destination is too small");
+        for (usize i = 0; i < src.size(); i++) {
+            dst[i] = Pulsar::encode_unorm1010102(src[i]);
+        }
+    }
+
+    void decode_unorm1010102(std::span<const Packed1010102> src, std::span<Vec4> dst) {
+        PULSAR_ASSERT(dst.size() >= src.size(), "Destination is too small");
+        for (usize i = 0; i < src.size(); i++) {
+            dst[i] = Pulsar::decode_unorm1010102(src[i]);
+        }
+    }
+
+    void encode_snorm1010102(std::span<const Vec4> src, std::span<Packed1010102> dst) {
+        PULSAR_ASSERT(dst.size() >= src.size(), "Destination is too small");
+        for (usize i = 0; i < src.size(); i++) {
+            dst[i] = Pulsar::encode_snorm1010102(src[i]);
+        }
+    }
+
+    void decode_snorm1010102(std::span<const Packed1010102> src, std::span<Vec4> dst) {
+        PULSAR_ASSERT(dst.size() >= src.size(), "Destination is too small");
+        for (usize i = 0; i < src.size(); i++) {
+            dst[i] = Pulsar::decode_snorm1010102(src[i]);
+        }
+    }
+} // namespace Pulsar::Packed
+// NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast, cppcoreguidelines-pro-bounds-pointer-arithmetic)
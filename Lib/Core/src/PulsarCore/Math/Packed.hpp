@@ -0,0 +1,256 @@
+#pragma once
+
+#include "PulsarCore/Types.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <span>
+
+/// Compact vertex/animation formats
+/// # Performance
+/// The scalar conversions are inline so they can be used anywhere, but bulk data should go through
+/// the batch kernels at the bottom of this file, which use F16C/AVX2 when the CPU supports them.
+namespace Pulsar {
+    // NOLINTBEGIN(readability-identifier-naming)
+
+    /// IEEE 754 binary16 (half precision) float
+    /// Conversion from f32 rounds to nearest-even, and keeps infinities, NaNs and subnormals
+    struct f16 {
+        u16 bits = 0;
+
+        constexpr f16() = default;
+
+        constexpr explicit f16(f32 value) : bits(from_f32(value)) {
+        }
+
+        [[nodiscard]] constexpr explicit operator f32() const {
+            return to_f32(bits);
+        }
+
+        [[nodiscard]] static constexpr f16 from_bits(u16 bits) {
+            f16 half;
+            half.bits = bits;
+            return half;
+        }
+
+        [[nodiscard]] constexpr bool operator==(const f16& other) const = default;
+
+        [[nodiscard]] static constexpr u16 from_f32(f32 value) {
+            constexpr u32 F32_INFINITY = 255U << 23U;
+            constexpr u32 F16_OVERFLOW = (127U + 16U) << 23U;
+            constexpr u32 DENORM_MAGIC = ((127U - 15U) + (23U - 10U) + 1U) << 23U;
+
+            u32       input = std::bit_cast<u32>(value);
+            const u32 sign  = input & 0x8000'0000U;
+            input ^= sign;
+
+            u32 result = 0;
+            if (input >= F16_OVERFLOW) {
+                // Infinity stays infinity, NaN becomes a quiet NaN
+                result = input > F32_INFINITY ? 0x7E00U : 0x7C00U;
+            }
+            else if (input < (113U << 23U)) {
+                // Subnormal or zero, the FPU does the rounding for us when we align the mantissa
+                const f32 aligned = std::bit_cast<f32>(input) + std::bit_cast<f32>(DENORM_MAGIC);
+                result            = std::bit_cast<u32>(aligned) - DENORM_MAGIC;
+            }
+            else {
+                const u32 mantissaOdd = (input >> 13U) & 1U;
+                input += ((15U - 127U) << 23U) + 0xFFFU;
+                input += mantissaOdd;
+                result = input >> 13U;
+            }
+            return static_cast<u16>(result | (sign >> 16U));
+        }
+
+        [[nodiscard]] static constexpr f32 to_f32(u16 half) {
+            constexpr u32 SHIFTED_EXPONENT = 0x7C00U << 13U;
+            constexpr u32 MAGIC            = 113U << 23U;
+
+            u32       result   = (half & 0x7FFFU) << 13U;
+            const u32 exponent = SHIFTED_EXPONENT & result;
+            result += (127U - 15U) << 23U;
+            if (exponent == SHIFTED_EXPONENT) {
+                // Infinity or NaN
+                result += (128U - 16U) << 23U;
+            }
+            else if (exponent == 0) {
+                // Zero or subnormal, renormalize
+                result += 1U << 23U;
+                result = std::bit_cast<u32>(std::bit_cast<f32>(result) - std::bit_cast<f32>(MAGIC));
+            }
+            result |= static_cast<u32>(half & 0x8000U) << 16U;
+            return std::bit_cast<f32>(result);
+        }
+    };
+
+    using Vec2h = Vector2_t<f16>;
+    using Vec3h = Vector3_t<f16>;
+    using Vec4h = Vector4_t<f16>;
+
+    /// Signed normalized vectors, [-1, 1] mapped to [-32767, 32767]
+    using SNorm16Vec2 = Vector2_t<i16>;
+    using SNorm16Vec3 = Vector3_t<i16>;
+    using SNorm16Vec4 = Vector4_t<i16>;
+
+    /// Unsigned normalized vectors, [0, 1] mapped to [0, 255]
+    using UNorm8Vec4 = Vector4_t<u8>;
+
+    /// A unit vector stored as an octahedral projection in two snorm16 components (4 bytes)
+    /// # Precision
+    /// The maximum angular error is well below 0.01 degrees, enough for normals and tangents
+    using OctNormal = Vector2_t<i16>;
+
+    /// Four components packed into 32 bits, 10 bits for xyz and 2 bits for w
+    struct Packed1010102 {
+        u32 bits = 0;
+
+        [[nodiscard]] constexpr bool operator==(const Packed1010102& other) const = default;
+    };
+
+    // NOLINTEND(readability-identifier-naming)
+
+    static_assert(sizeof(f16) == 2);
+    static_assert(sizeof(Vec3h) == 6);
+    static_assert(sizeof(Vec4h) == 8);
+    static_assert(sizeof(SNorm16Vec3) == 6);
+    static_assert(sizeof(UNorm8Vec4) == 4);
+    static_assert(sizeof(OctNormal) == 4);
+    static_assert(sizeof(Packed1010102) == 4);
+    // The batch kernels reinterpret vector arrays as flat scalar arrays
+    static_assert(sizeof(Vec3) == 3 * sizeof(f32));
+    static_assert(sizeof(Vec4) == 4 * sizeof(f32));
+
+    [[nodiscard]] inline i16 encode_snorm16(f32 value) {
+        return static_cast<i16>(std::lround(std::clamp(value, -1.0F, 1.0F) * 32767.0F));
+    }
+
+    [[nodiscard]] constexpr f32 decode_snorm16(i16 value) {
+        return std::max(static_cast<f32>(value) * (1.0F / 32767.0F), -1.0F);
+    }
+
+    [[nodiscard]] inline u8 encode_unorm8(f32 value) {
+        return static_cast<u8>(std::lround(std::clamp(value, 0.0F, 1.0F) * 255.0F));
+    }
+
+    [[nodiscard]] constexpr f32 decode_unorm8(u8 value) {
+        return static_cast<f32>(value) * (1.0F / 255.0F);
+    }
+
+    [[nodiscard]] inline Vec3h encode_vec3h(const Vec3& value) {
+        return {f16(value.x), f16(value.y), f16(value.z)};
+    }
+
+    [[nodiscard]] constexpr Vec3 decode_vec3h(const Vec3h& value) {
+        return {static_cast<f32>(value.x), static_cast<f32>(value.y), static_cast<f32>(value.z)};
+    }
+
+    [[nodiscard]] inline SNorm16Vec3 encode_snorm16(const Vec3& value) {
+        return {encode_snorm16(value.x), encode_snorm16(value.y), encode_snorm16(value.z)};
+    }
+
+    [[nodiscard]] constexpr Vec3 decode_snorm16(const SNorm16Vec3& value) {
+        return {decode_snorm16(value.x), decode_snorm16(value.y), decode_snorm16(value.z)};
+    }
+
+    [[nodiscard]] inline UNorm8Vec4 encode_unorm8(const Vec4& value) {
+        return {encode_unorm8(value.x), encode_unorm8(value.y), encode_unorm8(value.z),
+            encode_unorm8(value.w)};
+    }
+
+    [[nodiscard]] constexpr Vec4 decode_unorm8(const UNorm8Vec4& value) {
+        return {decode_unorm8(value.x), decode_unorm8(value.y), decode_unorm8(value.z),
+            decode_unorm8(value.w)};
+    }
+
+    /// Encodes a unit vector, the input does not need to be exactly normalized
+    [[nodiscard]] inline OctNormal encode_octahedral(const Vec3& normal) {
+        const f32 invL1 = 1.0F / (std::abs(normal.x) + std::abs(normal.y) + std::abs(normal.z));
+        f32       x     = normal.x * invL1;
+        f32       y     = normal.y * invL1;
+        if (normal.z < 0.0F) {
+            // Fold the lower hemisphere over the diagonals
+            const f32 foldedX = (1.0F - std::abs(y)) * (x >= 0.0F ? 1.0F : -1.0F);
+            const f32 foldedY = (1.0F - std::abs(x)) * (y >= 0.0F ? 1.0F : -1.0F);
+            x                 = foldedX;
+            y                 = foldedY;
+        }
+        return {encode_snorm16(x), encode_snorm16(y)};
+    }
+
+    [[nodiscard]] inline Vec3 decode_octahedral(const OctNormal& encoded) {
+        f32       x = decode_snorm16(encoded.x);
+        f32       y = decode_snorm16(encoded.y);
+        const f32 z = 1.0F - std::abs(x) - std::abs(y);
+        const f32 t = std::max(-z, 0.0F);
+        x += x >= 0.0F ? -t : t;
+        y += y >= 0.0F ? -t : t;
+        const f32 invLength = 1.0F / std::sqrt(x * x + y * y + z * z);
+        return {x * invLength, y * invLength, z * invLength};
+    }
+
+    /// Packs xyz in [0, 1] into 10 bits each and w in [0, 1] into 2 bits
+    [[nodiscard]] inline Packed1010102 encode_unorm1010102(const Vec4& value) {
+        const auto quantize = [](f32 component, f32 scale) {
+            return static_cast<u32>(std::lround(std::clamp(component, 0.0F, 1.0F) * scale));
+        };
+        return {quantize(value.x, 1023.0F) | (quantize(value.y, 1023.0F) << 10U)
+                | (quantize(value.z, 1023.0F) << 20U) | (quantize(value.w, 3.0F) << 30U)};
+    }
+
+    [[nodiscard]] constexpr Vec4 decode_unorm1010102(const Packed1010102& packed) {
+        return {static_cast<f32>(packed.bits & 0x3FFU) / 1023.0F,
+            static_cast<f32>((packed.bits >> 10U) & 0x3FFU) / 1023.0F,
+            static_cast<f32>((packed.bits >> 20U) & 0x3FFU) / 1023.0F,
+            static_cast<f32>(packed.bits >> 30U) / 3.0F};
+    }
+
+    /// Packs xyz in [-1, 1] into 10 bits each and w in [-1, 1] into 2 bits
+    /// The 2 bit w can only represent -1, 0 and 1, which is what tangent handedness needs
+    [[nodiscard]] inline Packed1010102 encode_snorm1010102(const Vec4& value) {
+        const auto quantize = [](f32 component, f32 scale, u32 mask) {
+            const auto quantized = std::lround(std::clamp(component, -1.0F, 1.0F) * scale);
+            return static_cast<u32>(quantized) & mask;
+        };
+        return {quantize(value.x, 511.0F, 0x3FFU) | (quantize(value.y, 511.0F, 0x3FFU) << 10U)
+                | (quantize(value.z, 511.0F, 0x3FFU) << 20U)
+                | (quantize(value.w, 1.0F, 0x3U) << 30U)};
+    }
+
+    [[nodiscard]] constexpr Vec4 decode_snorm1010102(const Packed1010102& packed) {
+        // Shift the field to the top of the word and arithmetic shift it back to sign extend
+        const auto extract = [](u32 bits, u32 offset, u32 width, f32 scale) {
+            const auto value = static_cast<i32>(bits << (32U - offset - width)) >> (32U - width);
+            return std::max(static_cast<f32>(value) / scale, -1.0F);
+        };
+        return {extract(packed.bits, 0, 10, 511.0F), extract(packed.bits, 10, 10, 511.0F),
+            extract(packed.bits, 20, 10, 511.0F), extract(packed.bits, 30, 2, 1.0F)};
+    }
+
+    /// Batch kernels
+    /// # Requirements
+    /// The destination must be at least as large as the source, `src.size()` elements are written
+    namespace Packed {
+        void encode_f16(std::span<const f32> src, std::span<f16> dst);
+        void decode_f16(std::span<const f16> src, std::span<f32> dst);
+
+        void encode_vec3h(std::span<const Vec3> src, std::span<Vec3h> dst);
+        void decode_vec3h(std::span<const Vec3h> src, std::span<Vec3> dst);
+
+        void encode_snorm16(std::span<const Vec3> src, std::span<SNorm16Vec3> dst);
+        void decode_snorm16(std::span<const SNorm16Vec3> src, std::span<Vec3> dst);
+
+        void encode_unorm8(std::span<const Vec4> src, std::span<UNorm8Vec4> dst);
+        void decode_unorm8(std::span<const UNorm8Vec4> src, std::span<Vec4> dst);
+
+        void encode_octahedral(std::span<const Vec3> src, std::span<OctNormal> dst);
+        void decode_octahedral(std::span<const OctNormal> src, std::span<Vec3> dst);
+
+        void encode_unorm1010102(std::span<const Vec4> src, std::span<Packed1010102> dst);
+        void decode_unorm1010102(std::span<const Packed1010102> src, std::span<Vec4> dst);
+
+        void encode_snorm1010102(std::span<const Vec4> src, std::span<Packed1010102> dst);
+        void decode_snorm1010102(std::span<const Packed1010102> src, std::span<Vec4> dst);
+    } // namespace Packed
+} // namespace Pulsar
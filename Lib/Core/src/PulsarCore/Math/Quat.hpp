@@ -0,0 +1,67 @@
+#pragma once
+
+#include "PulsarCore/Types.hpp"
+
+#include <cmath>
+
+namespace Pulsar {
+    // NOLINTBEGIN(readability-identifier-naming)
+
+    /// Rotation quaternion, `w` is the scalar part
+    /// # Usage
+    /// Rotations compose right to left like matrices: `(a * b).rotate(v)` applies `b` first.
+    /// Only unit quaternions describe rotations, renormalize after accumulating many products.
+    struct Quat {
+        f32 x;
+        f32 y;
+        f32 z;
+        f32 w;
+
+        [[nodiscard]] static constexpr Quat identity() {
+            return {0.0F, 0.0F, 0.0F, 1.0F};
+        }
+
+        /// Rotation by `angle` radians around the unit vector `axis`
+        [[nodiscard]] static Quat from_axis_angle(const Vec3& axis, f32 angle) {
+            const f32 s = std::sin(angle * 0.5F);
+            return {axis.x * s, axis.y * s, axis.z * s, std::cos(angle * 0.5F)};
+        }
+
+        [[nodiscard]] constexpr Quat operator*(const Quat& other) const {
+            return {
+                w * other.x + x * other.w + y * other.z - z * other.y,
+                w * other.y - x * other.z + y * other.w + z * other.x,
+                w * other.z + x * other.y - y * other.x + z * other.w,
+                w * other.w - x * other.x - y * other.y - z * other.z,
+            };
+        }
+
+        /// The inverse rotation of a unit quaternion
+        [[nodiscard]] constexpr Quat conjugate() const {
+            return {-x, -y, -z, w};
+        }
+
+        [[nodiscard]] constexpr f32 length_squared() const {
+            return x * x + y * y + z * z + w * w;
+        }
+
+        [[nodiscard]] Quat normalized() const {
+            const f32 invLength = 1.0F / std::sqrt(length_squared());
+            return {x * invLength, y * invLength, z * invLength, w * invLength};
+        }
+
+        [[nodiscard]] constexpr Vec3 rotate(const Vec3& v) const {
+            // v + 2w(q x v) + 2q x (q x v), with t = 2(q x v)
+            const f32 tx = 2.0F * (y * v.z - z * v.y);
+            const f32 ty = 2.0F * (z * v.x - x * v.z);
+            const f32 tz = 2.0F * (x * v.y - y * v.x);
+            return {
+                v.x + w * tx + (y * tz - z * ty),
+                v.y + w * ty + (z * tx - x * tz),
+                v.z + w * tz + (x * ty - y * tx),
+            };
+        }
+    };
+
+    // NOLINTEND(readability-identifier-naming)
+} // namespace Pulsar
@@ -0,0 +1,118 @@
+#pragma once
+
+#include "PulsarCore/Sync/WaitStrategy.hpp"
+#include "PulsarCore/Types.hpp"
+
+#include <concepts>
+#include <span>
+#include <utility>
+
+namespace Pulsar {
+    /// A bounded queue `SpscQueue` or `MpmcQueue` can stand in for
+    template<typename Q>
+    concept BoundedQueue = requires(Q& queue, typename Q::value_type& value,
+                                    std::span<typename Q::value_type> values) {
+        { queue.try_push(std::move(value)) } -> std::same_as<bool>;
+        { queue.try_pop(value) } -> std::same_as<bool>;
+        { queue.push_batch(values) } -> std::same_as<usize>;
+        { queue.pop_batch(values) } -> std::same_as<usize>;
+    };
+
+    /// Adds blocking `push` and `pop` to a bounded queue, waiting with `W` while it is full or
+    /// empty
+    /// # Usage
+    /// `BlockingQueue<SpscQueue<Command>, FutexWait> queue(1024)` forwards the capacity to the
+    /// queue; the non-blocking functions stay available through `queue()`, but only the functions
+    /// of the adapter wake waiting threads.
+    /// # Performance
+    /// Each successful operation notifies the other side once, for a whole batch too. With
+    /// `FutexWait` that is a single atomic increment while nobody sleeps.
+    template<BoundedQueue Q, WaitStrategy W = FutexWait> class BlockingQueue {
+    public:
+        using value_type = typename Q::value_type;
+
+        explicit BlockingQueue(usize capacity) : m_Queue(capacity) {
+        }
+
+        void push(value_type value) {
+            for (u32 round = 0;; round++) {
+                const u32 token = m_NotFull.prepare();
+                if (m_Queue.try_push(std::move(value))) {
+                    break;
+                }
+                m_NotFull.wait(token, round);
+            }
+            m_NotEmpty.notify();
+        }
+
+        bool try_push(value_type value) {
+            if (!m_Queue.try_push(std::move(value))) {
+                return false;
+            }
+            m_NotEmpty.notify();
+            return true;
+        }
+
+        [[nodiscard]] value_type pop() {
+            value_type value {};
+            for (u32 round = 0;; round++) {
+                const u32 token = m_NotEmpty.prepare();
+                if (m_Queue.try_pop(value)) {
+                    break;
+                }
+                m_NotEmpty.wait(token, round);
+            }
+            m_NotFull.notify();
+            return value;
+        }
+
+        bool try_pop(value_type& out) {
+            if (!m_Queue.try_pop(out)) {
+                return false;
+            }
+            m_NotFull.notify();
+            return true;
+        }
+
+        /// Pushes all of `values`, waiting for room as often as needed
+        void push_batch(std::span<value_type> values) {
+            usize pushed = 0;
+            u32   round  = 0;
+            while (pushed < values.size()) {
+                const u32   token = m_NotFull.prepare();
+                const usize count = m_Queue.push_batch(values.subspan(pushed));
+                if (count != 0) {
+                    pushed += count;
+                    round   = 0;
+                    m_NotEmpty.notify();
+                }
+                else {
+                    m_NotFull.wait(token, round++);
+                }
+            }
+        }
+
+        /// Waits until at least one value is available, then fills the front of `out` with as
+        /// many as are and returns how many
+        usize pop_batch(std::span<value_type> out) {
+            for (u32 round = 0;; round++) {
+                const u32   token = m_NotEmpty.prepare();
+                const usize count = m_Queue.pop_batch(out);
+                if (count != 0 || out.empty()) {
+                    m_NotFull.notify();
+                    return count;
+                }
+                m_NotEmpty.wait(token, round);
+            }
+        }
+
+        [[nodiscard]] Q& queue() {
+            return m_Queue;
+        }
+
+    private:
+        Q m_Queue;
+        W m_NotFull;
+        W m_NotEmpty;
+    };
+} // namespace Pulsar
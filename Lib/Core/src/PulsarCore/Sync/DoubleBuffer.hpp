@@ -0,0 +1,103 @@
+#pragma once
+
+#include "PulsarCore/Types.hpp"
+#include "PulsarCore/Util/CpuFeatures.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <type_traits>
+
+namespace Pulsar {
+    /// The latest value of `T` published by one writer thread, readable by any number of threads
+    /// # Usage
+    /// The writer calls `publish` with every new value, readers call `read` for a consistent copy
+    /// of the latest one. Meant for small state snapshots (input state, stats) that are rewritten
+    /// as a whole.
+    /// # Performance
+    /// Two slots, each guarded by a sequence counter (a seqlock): the writer fills the slot
+    /// readers are not directed to, then flips the index. Neither side locks or writes to memory
+    /// the other side writes, and the writer never waits. A reader only retries when the writer
+    /// published twice while it was copying, which takes two whole `publish` calls.
+    /// The value is copied as relaxed atomic words, so concurrent copies are not data races.
+    template<typename T>
+        requires std::is_trivially_copyable_v<T>
+    class DoubleBuffer {
+    public:
+        explicit DoubleBuffer(const T& initial = {}) {
+            store(m_Slots[0], initial);
+            store(m_Slots[1], initial);
+        }
+
+        /// Writer only
+        void publish(const T& value) {
+            const u64 version = m_Version.load(std::memory_order_relaxed) + 1;
+            Slot_t&   slot    = m_Slots[version & 1];
+            const u64 seq     = slot.m_Sequence.load(std::memory_order_relaxed);
+            // Odd while the slot is being written
+            slot.m_Sequence.store(seq + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            store(slot, value);
+            slot.m_Version.store(version, std::memory_order_relaxed);
+            slot.m_Sequence.store(seq + 2, std::memory_order_release);
+            m_Version.store(version, std::memory_order_release);
+        }
+
+        /// Copies the latest value into `out` and returns its version, the number of `publish`
+        /// calls it reflects
+        u64 read(T& out) const {
+            while (true) {
+                const u64     version = m_Version.load(std::memory_order_acquire);
+                const Slot_t& slot    = m_Slots[version & 1];
+                const u64     before  = slot.m_Sequence.load(std::memory_order_acquire);
+                if ((before & 1) == 0) {
+                    std::array<u64, WORDS> words;
+                    for (usize i = 0; i < WORDS; i++) {
+                        words[i] = slot.m_Words[i].load(std::memory_order_relaxed);
+                    }
+                    // The slot may already hold a later value of the same parity
+                    const u64 copied = slot.m_Version.load(std::memory_order_relaxed);
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                    if (slot.m_Sequence.load(std::memory_order_relaxed) == before &&
+                        copied == version) {
+                        std::memcpy(static_cast<void*>(&out), words.data(), sizeof(T));
+                        return version;
+                    }
+                }
+                cpu_relax();
+            }
+        }
+
+        [[nodiscard]] T read() const {
+            T value {};
+            read(value);
+            return value;
+        }
+
+        /// Number of `publish` calls so far
+        [[nodiscard]] u64 version() const {
+            return m_Version.load(std::memory_order_acquire);
+        }
+
+    private:
+        static constexpr usize WORDS = (sizeof(T) + sizeof(u64) - 1) / sizeof(u64);
+
+        struct alignas(64) Slot_t {
+            std::atomic<u64>                    m_Sequence {0};
+            /// The `publish` call that wrote the slot, guarded by the sequence like the value
+            std::atomic<u64>                    m_Version {0};
+            std::array<std::atomic<u64>, WORDS> m_Words {};
+        };
+
+        static void store(Slot_t& slot, const T& value) {
+            std::array<u64, WORDS> words {};
+            std::memcpy(words.data(), &value, sizeof(T));
+            for (usize i = 0; i < WORDS; i++) {
+                slot.m_Words[i].store(words[i], std::memory_order_relaxed);
+            }
+        }
+
+        std::array<Slot_t, 2> m_Slots;
+        alignas(64) std::atomic<u64> m_Version {0};
+    };
+} // namespace Pulsar
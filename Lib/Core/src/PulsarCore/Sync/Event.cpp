@@ -0,0 +1,15 @@
+#include "Event.hpp"
+
+namespace Pulsar {
+    void Event::wait_slow() {
+        u32 state = m_State.load(std::memory_order_acquire);
+        while (state != SET) {
+            if (state == UNSET &&
+                !m_State.compare_exchange_weak(state, WAITING, std::memory_order_acquire)) {
+                continue;
+            }
+            m_State.wait(WAITING, std::memory_order_acquire);
+            state = m_State.load(std::memory_order_acquire);
+        }
+    }
+} // namespace Pulsar
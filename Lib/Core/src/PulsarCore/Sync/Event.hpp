@@ -0,0 +1,60 @@
+#pragma once
+
+#include "PulsarCore/Types.hpp"
+
+#include <atomic>
+
+namespace Pulsar {
+    /// A flag threads can wait for, like a manual-reset event on Windows
+    /// # Usage
+    /// `set` wakes every waiter and lets later `wait`s pass until `reset`. Meant for one-off
+    /// signals like "the asset is loaded" or "shut down now", without a mutex and a condition
+    /// variable around a `bool`. A `reset` right after a `set` can leave a waiter that did not
+    /// wake up yet waiting.
+    /// # Performance
+    /// 4 bytes. `set` and `wait` on a set event are one atomic instruction; only `set` with a
+    /// thread sleeping makes a system call.
+    class Event {
+    public:
+        constexpr Event() = default;
+
+        explicit constexpr Event(bool set) : m_State(set ? SET : UNSET) {
+        }
+
+        Event(const Event&)            = delete;
+        Event& operator=(const Event&) = delete;
+        Event(Event&&)                 = delete;
+        Event& operator=(Event&&)      = delete;
+
+        void set() {
+            if (m_State.exchange(SET, std::memory_order_release) == WAITING) {
+                m_State.notify_all();
+            }
+        }
+
+        void reset() {
+            u32 expected = SET;
+            m_State.compare_exchange_strong(expected, UNSET, std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] bool is_set() const {
+            return m_State.load(std::memory_order_acquire) == SET;
+        }
+
+        void wait() {
+            if (!is_set()) [[unlikely]] {
+                wait_slow();
+            }
+        }
+
+    private:
+        static constexpr u32 UNSET   = 0;
+        static constexpr u32 SET     = 1;
+        /// Not set and some thread sleeps on it
+        static constexpr u32 WAITING = 2;
+
+        void wait_slow();
+
+        std::atomic<u32> m_State {UNSET};
+    };
+} // namespace Pulsar
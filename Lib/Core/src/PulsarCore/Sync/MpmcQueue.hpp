@@ -0,0 +1,162 @@
+#pragma once
+
+#include "PulsarCore/Types.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace Pulsar {
+    /// A bounded multi producer, multi consumer queue (Dmitry Vyukov's design)
+    /// # Usage
+    /// Any thread may push and pop. Values pushed by one thread are popped in that thread's order,
+    /// there is no order between producers. The capacity is rounded up to a power of two. To block
+    /// instead of failing when full or empty, wrap it in a `BlockingQueue`.
+    /// # Performance
+    /// One compare-and-swap per operation on the shared position, and a sequence number per slot
+    /// so producers and consumers only meet on the slot they hand over. Slots are padded to a
+    /// cache line each. The batch functions are loops over the single ones that stop at the first
+    /// failure: every value still costs its own CAS, they only save the caller's loop.
+    template<typename T> class MpmcQueue {
+    public:
+        using value_type = T;
+
+        explicit MpmcQueue(usize capacity)
+            : m_Capacity(std::bit_ceil(std::max<usize>(capacity, 2))), m_Mask(m_Capacity - 1),
+              m_Slots(std::make_unique<Slot_t[]>(m_Capacity)) { // NOLINT(*-avoid-c-arrays)
+            for (usize i = 0; i < m_Capacity; i++) {
+                m_Slots[i].m_Sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        ~MpmcQueue() {
+            if constexpr (!std::is_trivially_destructible_v<T>) {
+                const usize tail = m_EnqueuePos.load(std::memory_order_relaxed);
+                for (usize pos = m_DequeuePos.load(std::memory_order_relaxed); pos != tail; pos++) {
+                    value(m_Slots[pos & m_Mask])->~T();
+                }
+            }
+        }
+
+        MpmcQueue(const MpmcQueue&)            = delete;
+        MpmcQueue& operator=(const MpmcQueue&) = delete;
+        MpmcQueue(MpmcQueue&&)                 = delete;
+        MpmcQueue& operator=(MpmcQueue&&)      = delete;
+
+        /// Returns false when the queue is full
+        template<typename... Args> bool try_emplace(Args&&... args) {
+            Slot_t* slot = nullptr;
+            usize   pos  = m_EnqueuePos.load(std::memory_order_relaxed);
+            while (true) {
+                slot                 = &m_Slots[pos & m_Mask];
+                const usize seq      = slot->m_Sequence.load(std::memory_order_acquire);
+                const auto  distance =
+                    static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+                if (distance == 0) {
+                    if (m_EnqueuePos.compare_exchange_weak(
+                            pos, pos + 1, std::memory_order_relaxed)) {
+                        break;
+                    }
+                }
+                else if (distance < 0) {
+                    return false;
+                }
+                else {
+                    pos = m_EnqueuePos.load(std::memory_order_relaxed);
+                }
+            }
+            ::new (static_cast<void*>(slot->m_Storage)) T(std::forward<Args>(args)...);
+            slot->m_Sequence.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        bool try_push(const T& value) {
+            return try_emplace(value);
+        }
+
+        bool try_push(T&& value) {
+            return try_emplace(std::move(value));
+        }
+
+        /// Returns false when the queue is empty
+        bool try_pop(T& out) {
+            Slot_t* slot = nullptr;
+            usize   pos  = m_DequeuePos.load(std::memory_order_relaxed);
+            while (true) {
+                slot                 = &m_Slots[pos & m_Mask];
+                const usize seq      = slot->m_Sequence.load(std::memory_order_acquire);
+                const auto  distance =
+                    static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+                if (distance == 0) {
+                    if (m_DequeuePos.compare_exchange_weak(
+                            pos, pos + 1, std::memory_order_relaxed)) {
+                        break;
+                    }
+                }
+                else if (distance < 0) {
+                    return false;
+                }
+                else {
+                    pos = m_DequeuePos.load(std::memory_order_relaxed);
+                }
+            }
+            T* stored = value(*slot);
+            out       = std::move(*stored);
+            stored->~T();
+            slot->m_Sequence.store(pos + m_Capacity, std::memory_order_release);
+            return true;
+        }
+
+        /// Moves leading values of `values` in until the queue is full and returns how many
+        usize push_batch(std::span<T> values) {
+            usize count = 0;
+            while (count < values.size() && try_emplace(std::move(values[count]))) {
+                count++;
+            }
+            return count;
+        }
+
+        /// Fills the front of `out` until the queue is empty and returns how many
+        usize pop_batch(std::span<T> out) {
+            usize count = 0;
+            while (count < out.size() && try_pop(out[count])) {
+                count++;
+            }
+            return count;
+        }
+
+        [[nodiscard]] usize capacity() const {
+            return m_Capacity;
+        }
+
+        /// A snapshot, only exact while no thread pushes or pops
+        [[nodiscard]] usize size_approx() const {
+            const usize head = m_DequeuePos.load(std::memory_order_acquire);
+            const usize tail = m_EnqueuePos.load(std::memory_order_acquire);
+            return tail > head ? tail - head : 0;
+        }
+
+    private:
+        struct alignas(64) Slot_t {
+            std::atomic<usize>   m_Sequence;
+            alignas(T) std::byte m_Storage[sizeof(T)]; // NOLINT(*-avoid-c-arrays)
+        };
+
+        [[nodiscard]] static T* value(Slot_t& slot) {
+            return std::launder(reinterpret_cast<T*>(slot.m_Storage));
+        }
+
+        const usize               m_Capacity;
+        const usize               m_Mask;
+        std::unique_ptr<Slot_t[]> m_Slots; // NOLINT(*-avoid-c-arrays)
+
+        alignas(64) std::atomic<usize> m_EnqueuePos {0};
+        alignas(64) std::atomic<usize> m_DequeuePos {0};
+    };
+} // namespace Pulsar
@@ -0,0 +1,120 @@
+#pragma once
+
+#include "PulsarCore/Types.hpp"
+
+#include <atomic>
+#include <concepts>
+#include <span>
+
+namespace Pulsar {
+    /// The link an element of an `MpscQueue` derives from
+    struct MpscNode_t {
+        std::atomic<MpscNode_t*> m_Next {nullptr};
+    };
+
+    /// An unbounded multi producer, single consumer intrusive queue (Dmitry Vyukov's design)
+    /// # Usage
+    /// Elements derive from `MpscNode_t` and are owned by the caller: the queue only links them,
+    /// so an element must stay alive and must not be pushed again until it was popped. Any thread
+    /// may push, only one thread pops. Values pushed by one thread are popped in that thread's
+    /// order.
+    /// # Performance
+    /// Pushing is a single atomic exchange and never fails or allocates, which suits producers
+    /// that must not block, like a log call or a completion callback. `push_batch` links a chain
+    /// with one exchange. The price is that `pop` can briefly see the queue as empty while a
+    /// producer is between its two steps, a consumer that needs every element polls again later.
+    template<typename T>
+        requires std::derived_from<T, MpscNode_t>
+    class MpscQueue {
+    public:
+        MpscQueue() = default;
+
+        MpscQueue(const MpscQueue&)            = delete;
+        MpscQueue& operator=(const MpscQueue&) = delete;
+        MpscQueue(MpscQueue&&)                 = delete;
+        MpscQueue& operator=(MpscQueue&&)      = delete;
+
+        void push(T& element) {
+            MpscNode_t& node = element;
+            node.m_Next.store(nullptr, std::memory_order_relaxed);
+            link(node, node);
+        }
+
+        /// Pushes the elements as one chain, they are popped in order and never interleaved
+        /// with the elements of other producers
+        void push_batch(std::span<T*> elements) {
+            if (elements.empty()) {
+                return;
+            }
+            for (usize i = 0; i + 1 < elements.size(); i++) {
+                static_cast<MpscNode_t*>(elements[i])
+                    ->m_Next.store(elements[i + 1], std::memory_order_relaxed);
+            }
+            MpscNode_t& last = *elements.back();
+            last.m_Next.store(nullptr, std::memory_order_relaxed);
+            link(*elements.front(), last);
+        }
+
+        /// Consumer only, returns the oldest element or nullptr if none is (fully) pushed yet
+        [[nodiscard]] T* pop() {
+            MpscNode_t* tail = m_Tail;
+            MpscNode_t* next = tail->m_Next.load(std::memory_order_acquire);
+            if (tail == &m_Stub) {
+                if (next == nullptr) {
+                    return nullptr;
+                }
+                m_Tail = next;
+                tail   = next;
+                next   = next->m_Next.load(std::memory_order_acquire);
+            }
+            if (next != nullptr) {
+                m_Tail = next;
+                return static_cast<T*>(tail);
+            }
+            // `tail` is the last element: it can only be handed out once something comes after
+            // it, so put the stub behind it, unless a producer is already appending
+            if (tail != m_Head.load(std::memory_order_acquire)) {
+                return nullptr;
+            }
+            m_Stub.m_Next.store(nullptr, std::memory_order_relaxed);
+            link(m_Stub, m_Stub);
+            next = tail->m_Next.load(std::memory_order_acquire);
+            if (next != nullptr) {
+                m_Tail = next;
+                return static_cast<T*>(tail);
+            }
+            return nullptr;
+        }
+
+        /// Consumer only, fills the front of `out` and returns how many elements were popped
+        usize pop_batch(std::span<T*> out) {
+            usize count = 0;
+            while (count < out.size()) {
+                T* element = pop();
+                if (element == nullptr) {
+                    break;
+                }
+                out[count++] = element;
+            }
+            return count;
+        }
+
+        /// Consumer only, may report empty while a push is in progress
+        [[nodiscard]] bool empty() const {
+            return m_Tail == &m_Stub && m_Stub.m_Next.load(std::memory_order_acquire) == nullptr;
+        }
+
+    private:
+        void link(MpscNode_t& first, MpscNode_t& last) {
+            MpscNode_t* prev = m_Head.exchange(&last, std::memory_order_acq_rel);
+            // Until this store the chain is cut, see `pop`
+            prev->m_Next.store(&first, std::memory_order_release);
+        }
+
+        MpscNode_t m_Stub;
+        /// Written by the producers
+        alignas(64) std::atomic<MpscNode_t*> m_Head {&m_Stub};
+        /// Written by the consumer
+        alignas(64) MpscNode_t* m_Tail = &m_Stub;
+    };
+} // namespace Pulsar
@@ -0,0 +1,41 @@
+#include "Mutex.hpp"
+
+#include <algorithm>
+
+namespace Pulsar {
+    namespace {
+        constexpr u32 MAX_SPINS = 100;
+
+        const bool g_Multicore = std::thread::hardware_concurrency() > 1;
+    } // namespace
+
+    void Mutex::lock_slow() {
+        if (g_Multicore) {
+            const u32 estimate = m_SpinEstimate.load(std::memory_order_relaxed);
+            const u32 maxSpins = std::min(MAX_SPINS, estimate * 2 + 10);
+            u32       spins    = 0;
+            bool      locked   = false;
+            for (; spins < maxSpins; spins++) {
+                u32 expected = UNLOCKED;
+                if (m_State.load(std::memory_order_relaxed) == UNLOCKED &&
+                    m_State.compare_exchange_weak(expected, LOCKED, std::memory_order_acquire)) {
+                    locked = true;
+                    break;
+                }
+                cpu_relax();
+            }
+            // Moves an eighth of the way towards what this lock needed
+            const auto delta = (static_cast<i32>(spins) - static_cast<i32>(estimate)) / 8;
+            m_SpinEstimate.store(static_cast<u16>(static_cast<i32>(estimate) + delta),
+                                 std::memory_order_relaxed);
+            if (locked) {
+                return;
+            }
+        }
+        // Marking it contended on every attempt is conservative: a thread that takes the lock
+        // here cannot know whether others still sleep
+        while (m_State.exchange(CONTENDED, std::memory_order_acquire) != UNLOCKED) {
+            m_State.wait(CONTENDED, std::memory_order_relaxed);
+        }
+    }
+} // namespace Pulsar
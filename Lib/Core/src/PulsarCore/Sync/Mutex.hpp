@@ -0,0 +1,119 @@
+#pragma once
+
+#include "PulsarCore/Types.hpp"
+#include "PulsarCore/Util/CpuFeatures.hpp"
+
+#include <atomic>
+#include <thread>
+
+namespace Pulsar {
+    /// A mutex that spins for a while before it sleeps in the kernel (a futex on Linux, through
+    /// `std::atomic::wait`)
+    /// # Usage
+    /// A drop-in for `std::mutex`, works with `std::lock_guard` and `std::unique_lock`. Not
+    /// recursive.
+    /// # Performance
+    /// Locking and unlocking without contention are one atomic instruction each, unlocking only
+    /// makes a system call if a thread sleeps. A contended `lock` spins first, for a number of
+    /// rounds that follows how long the lock was recently held (like glibc's adaptive mutex), so
+    /// short critical sections never put threads to sleep and long ones don't waste the CPU. It
+    /// never spins on a single core machine. 8 bytes (the lock word and the spin estimate), so it
+    /// can sit next to the data it guards.
+    class Mutex {
+    public:
+        constexpr Mutex() = default;
+
+        Mutex(const Mutex&)            = delete;
+        Mutex& operator=(const Mutex&) = delete;
+        Mutex(Mutex&&)                 = delete;
+        Mutex& operator=(Mutex&&)      = delete;
+
+        void lock() {
+            u32 expected = UNLOCKED;
+            if (!m_State.compare_exchange_strong(expected, LOCKED, std::memory_order_acquire))
+                [[unlikely]] {
+                lock_slow();
+            }
+        }
+
+        [[nodiscard]] bool try_lock() {
+            u32 expected = UNLOCKED;
+            return m_State.compare_exchange_strong(expected, LOCKED, std::memory_order_acquire);
+        }
+
+        void unlock() {
+            if (m_State.exchange(UNLOCKED, std::memory_order_release) == CONTENDED) [[unlikely]] {
+                m_State.notify_one();
+            }
+        }
+
+    private:
+        static constexpr u32 UNLOCKED  = 0;
+        static constexpr u32 LOCKED    = 1;
+        /// Locked and some thread may sleep on it, so `unlock` has to wake one
+        static constexpr u32 CONTENDED = 2;
+
+        void lock_slow();
+
+        std::atomic<u32> m_State {UNLOCKED};
+        /// Running average of the spins the last contended locks needed, shared by all threads
+        std::atomic<u16> m_SpinEstimate {0};
+    };
+    static_assert(sizeof(Mutex) == 8);
+
+    /// A fair spinlock: threads get the lock in the order they asked for it
+    /// # Usage
+    /// For very short critical sections between a few threads where starvation matters, like a
+    /// shared allocator's free list. Works with `std::lock_guard`.
+    /// # Performance
+    /// Each waiter backs off in proportion to its distance from the front of the line, and yields
+    /// its time slice after a while so an oversubscribed machine still makes progress. Unlike an
+    /// unfair lock, a preempted thread next in line holds up everyone behind it: prefer `Mutex`
+    /// when threads outnumber cores.
+    class TicketLock {
+    public:
+        constexpr TicketLock() = default;
+
+        TicketLock(const TicketLock&)            = delete;
+        TicketLock& operator=(const TicketLock&) = delete;
+        TicketLock(TicketLock&&)                 = delete;
+        TicketLock& operator=(TicketLock&&)      = delete;
+
+        void lock() {
+            const u32 ticket = m_Next.fetch_add(1, std::memory_order_relaxed);
+            u32       rounds = 0;
+            while (true) {
+                const u32 serving = m_Serving.load(std::memory_order_acquire);
+                if (serving == ticket) {
+                    return;
+                }
+                if (rounds++ < YIELD_AFTER) {
+                    for (u32 i = (ticket - serving) * BACKOFF; i != 0; i--) {
+                        cpu_relax();
+                    }
+                }
+                else {
+                    std::this_thread::yield();
+                }
+            }
+        }
+
+        [[nodiscard]] bool try_lock() {
+            u32 serving = m_Serving.load(std::memory_order_relaxed);
+            return m_Next.compare_exchange_strong(serving, serving + 1, std::memory_order_acquire);
+        }
+
+        void unlock() {
+            // Only the holder writes it
+            m_Serving.store(m_Serving.load(std::memory_order_relaxed) + 1,
+                            std::memory_order_release);
+        }
+
+    private:
+        static constexpr u32 BACKOFF     = 32;
+        static constexpr u32 YIELD_AFTER = 256;
+
+        std::atomic<u32> m_Next {0};
+        std::atomic<u32> m_Serving {0};
+    };
+} // namespace Pulsar
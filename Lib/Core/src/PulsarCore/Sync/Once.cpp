@@ -0,0 +1,36 @@
+#include "Once.hpp"
+
+namespace Pulsar {
+    void OnceFlag::finish() {
+        if (m_State.exchange(DONE, std::memory_order_release) == WAITING) {
+            m_State.notify_all();
+        }
+    }
+
+    void OnceFlag::abort() {
+        if (m_State.exchange(IDLE, std::memory_order_release) == WAITING) {
+            m_State.notify_all();
+        }
+    }
+
+    bool OnceFlag::begin_slow() {
+        u32 state = m_State.load(std::memory_order_acquire);
+        while (true) {
+            if (state == DONE) {
+                return false;
+            }
+            if (state == IDLE) {
+                if (m_State.compare_exchange_weak(state, RUNNING, std::memory_order_acquire)) {
+                    return true;
+                }
+                continue;
+            }
+            if (state == RUNNING &&
+                !m_State.compare_exchange_weak(state, WAITING, std::memory_order_acquire)) {
+                continue;
+            }
+            m_State.wait(WAITING, std::memory_order_acquire);
+            state = m_State.load(std::memory_order_acquire);
+        }
+    }
+} // namespace Pulsar
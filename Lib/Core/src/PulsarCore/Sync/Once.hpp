@@ -0,0 +1,104 @@
+#pragma once
+
+#include "PulsarCore/Types.hpp"
+
+#include <atomic>
+#include <exception>
+#include <utility>
+
+namespace Pulsar {
+    /// Runs something exactly once, whichever thread gets there first
+    /// # Usage
+    /// `call_once(flag, f)` or the `PULSAR_RUN_ONCE` macro. Threads that arrive while the first
+    /// one runs wait until it finished, so they can rely on its effects. If it throws, the flag
+    /// stays unset and the next caller runs it again, like `std::call_once`.
+    /// # Performance
+    /// Once done, checking the flag is a single acquire load, no read-modify-write, so it costs
+    /// the same as a plain `bool` on the hot path. Constant-initialized, so a `static` one needs
+    /// no guard variable either.
+    class OnceFlag {
+    public:
+        constexpr OnceFlag() = default;
+
+        OnceFlag(const OnceFlag&)            = delete;
+        OnceFlag& operator=(const OnceFlag&) = delete;
+        OnceFlag(OnceFlag&&)                 = delete;
+        OnceFlag& operator=(OnceFlag&&)      = delete;
+
+        [[nodiscard]] bool is_done() const {
+            return m_State.load(std::memory_order_acquire) == DONE;
+        }
+
+        /// Whether the caller has to run it: returns true to exactly one thread, which then
+        /// calls `finish` or `abort`. Waits while another thread runs it.
+        [[nodiscard]] bool begin() {
+            return !is_done() && begin_slow();
+        }
+
+        void finish();
+        /// Gives up after a failure, the next `begin` returns true again
+        void abort();
+
+    private:
+        static constexpr u32 IDLE    = 0;
+        static constexpr u32 RUNNING = 1;
+        /// Running and some thread sleeps until it finished
+        static constexpr u32 WAITING = 2;
+        static constexpr u32 DONE    = 3;
+
+        bool begin_slow();
+
+        std::atomic<u32> m_State {IDLE};
+    };
+
+    template<typename F> void call_once(OnceFlag& flag, F&& function) {
+        if (!flag.begin()) {
+            return;
+        }
+        try {
+            std::forward<F>(function)();
+        }
+        catch (...) {
+            flag.abort();
+            throw;
+        }
+        flag.finish();
+    }
+
+    namespace internal {
+        /// The statement of `PULSAR_RUN_ONCE`: finishes the flag when the block is left, or
+        /// aborts it when an exception leaves it
+        class OnceScope_t {
+        public:
+            explicit OnceScope_t(OnceFlag& flag)
+                : m_Flag(flag), m_Run(flag.begin()), m_Exceptions(std::uncaught_exceptions()) {
+            }
+
+            ~OnceScope_t() {
+                if (!m_Run) {
+                    return;
+                }
+                if (std::uncaught_exceptions() > m_Exceptions) {
+                    m_Flag.abort();
+                }
+                else {
+                    m_Flag.finish();
+                }
+            }
+
+            OnceScope_t(const OnceScope_t&)            = delete;
+            OnceScope_t& operator=(const OnceScope_t&) = delete;
+            OnceScope_t(OnceScope_t&&)                 = delete;
+            OnceScope_t& operator=(OnceScope_t&&)      = delete;
+
+            [[nodiscard]] bool should_run() const {
+                return m_Run;
+            }
+
+        private:
+            OnceFlag& m_Flag;
+            bool      m_Run;
+            int       m_Exceptions;
+        };
+    } // namespace internal
+} // namespace Pulsar
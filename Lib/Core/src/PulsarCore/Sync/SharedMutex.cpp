@@ -0,0 +1,86 @@
+#include "SharedMutex.hpp"
+
+namespace Pulsar {
+    namespace {
+        /// Spread threads over the slots in the order they first take a shared lock
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+        std::atomic<u32>       g_NextSlot {0};
+        thread_local const u32 t_Slot = g_NextSlot.fetch_add(1, std::memory_order_relaxed);
+    } // namespace
+
+    std::atomic<u32>& SharedMutex::reader_slot() {
+        return m_Slots[t_Slot % SLOT_COUNT].m_Readers;
+    }
+
+    void SharedMutex::lock_shared_slow(std::atomic<u32>& readers) {
+        while (true) {
+            // Step back so the writer can get in, and wait until it is done
+            if (readers.fetch_sub(1, std::memory_order_seq_cst) == 1) {
+                readers.notify_all();
+            }
+            m_SleepingReaders.fetch_add(1, std::memory_order_seq_cst);
+            m_Writer.wait(1, std::memory_order_seq_cst);
+            m_SleepingReaders.fetch_sub(1, std::memory_order_relaxed);
+
+            readers.fetch_add(1, std::memory_order_seq_cst);
+            if (m_Writer.load(std::memory_order_seq_cst) == 0) {
+                return;
+            }
+        }
+    }
+
+    bool SharedMutex::try_lock_shared() {
+        std::atomic<u32>& readers = reader_slot();
+        readers.fetch_add(1, std::memory_order_seq_cst);
+        if (m_Writer.load(std::memory_order_seq_cst) == 0) {
+            return true;
+        }
+        if (readers.fetch_sub(1, std::memory_order_seq_cst) == 1) {
+            readers.notify_all();
+        }
+        return false;
+    }
+
+    void SharedMutex::lock() {
+        m_WriterMutex.lock();
+        m_Writer.store(1, std::memory_order_seq_cst);
+        for (Slot_t& slot : m_Slots) {
+            u32 rounds = 0;
+            for (u32 count = slot.m_Readers.load(std::memory_order_seq_cst); count != 0;
+                 count     = slot.m_Readers.load(std::memory_order_seq_cst)) {
+                if (rounds++ < SPIN_ROUNDS) {
+                    cpu_relax();
+                }
+                else {
+                    slot.m_Readers.wait(count, std::memory_order_seq_cst);
+                }
+            }
+        }
+    }
+
+    bool SharedMutex::try_lock() {
+        if (!m_WriterMutex.try_lock()) {
+            return false;
+        }
+        m_Writer.store(1, std::memory_order_seq_cst);
+        for (Slot_t& slot : m_Slots) {
+            if (slot.m_Readers.load(std::memory_order_seq_cst) != 0) {
+                release_writer();
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void SharedMutex::unlock() {
+        release_writer();
+    }
+
+    void SharedMutex::release_writer() {
+        m_Writer.store(0, std::memory_order_seq_cst);
+        if (m_SleepingReaders.load(std::memory_order_seq_cst) != 0) {
+            m_Writer.notify_all();
+        }
+        m_WriterMutex.unlock();
+    }
+} // namespace Pulsar
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "PulsarCore/Sync/Mutex.hpp"
+#include "PulsarCore/Types.hpp"
+
+#include <array>
+#include <atomic>
+
+namespace Pulsar {
+    /// A reader-writer lock for data that is read far more often than written, like a registry
+    /// of asset handles or a configuration
+    /// # Usage
+    /// A drop-in for `std::shared_mutex`, works with `std::shared_lock` and `std::unique_lock`. A
+    /// thread must release a shared lock itself, and cannot upgrade it.
+    /// # Performance
+    /// Readers count themselves in one of several padded slots picked per thread, so readers on
+    /// different cores don't fight over a single cache line: a shared lock costs about as much as
+    /// an uncontended mutex no matter how many threads read. The price is on the writer, which
+    /// checks every slot, and the size (about 1 KiB). New readers wait while a writer is waiting,
+    /// so writers don't starve.
+    class SharedMutex {
+    public:
+        SharedMutex() = default;
+
+        SharedMutex(const SharedMutex&)            = delete;
+        SharedMutex& operator=(const SharedMutex&) = delete;
+        SharedMutex(SharedMutex&&)                 = delete;
+        SharedMutex& operator=(SharedMutex&&)      = delete;
+
+        void lock();
+        [[nodiscard]] bool try_lock();
+        void unlock();
+
+        void lock_shared() {
+            std::atomic<u32>& readers = reader_slot();
+            readers.fetch_add(1, std::memory_order_seq_cst);
+            if (m_Writer.load(std::memory_order_seq_cst) != 0) [[unlikely]] {
+                lock_shared_slow(readers);
+            }
+        }
+
+        [[nodiscard]] bool try_lock_shared();
+
+        void unlock_shared() {
+            std::atomic<u32>& readers = reader_slot();
+            if (readers.fetch_sub(1, std::memory_order_seq_cst) == 1 &&
+                m_Writer.load(std::memory_order_seq_cst) != 0) [[unlikely]] {
+                // The writer may sleep until this slot drains
+                readers.notify_all();
+            }
+        }
+
+    private:
+        static constexpr usize SLOT_COUNT  = 16;
+        static constexpr u32   SPIN_ROUNDS = 100;
+
+        struct alignas(64) Slot_t {
+            std::atomic<u32> m_Readers {0};
+        };
+
+        [[nodiscard]] std::atomic<u32>& reader_slot();
+        void lock_shared_slow(std::atomic<u32>& readers);
+        void release_writer();
+
+        std::array<Slot_t, SLOT_COUNT> m_Slots;
+        /// Serializes the writers
+        Mutex m_WriterMutex;
+        /// 1 while a writer waits for or holds the lock
+        alignas(64) std::atomic<u32> m_Writer {0};
+        std::atomic<u32> m_SleepingReaders {0};
+    };
+} // namespace Pulsar
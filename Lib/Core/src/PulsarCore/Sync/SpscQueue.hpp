@@ -0,0 +1,158 @@
+#pragma once
+
+#include "PulsarCore/Types.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace Pulsar {
+    /// A bounded single producer, single consumer ring buffer
+    /// # Usage
+    /// Exactly one thread pushes and exactly one thread pops, which may be different threads over
+    /// time as long as the hand-over synchronizes. The capacity is rounded up to a power of two.
+    /// To block instead of failing when full or empty, wrap it in a `BlockingQueue`.
+    /// # Performance
+    /// No read-modify-write instructions: each side owns one index on its own cache line and keeps
+    /// a cached copy of the other side's index, which it only reloads when the queue looks full or
+    /// empty. The batch functions publish a whole batch with a single store.
+    template<typename T> class SpscQueue {
+    public:
+        using value_type = T;
+
+        explicit SpscQueue(usize capacity)
+            : m_Capacity(std::bit_ceil(std::max<usize>(capacity, 2))), m_Mask(m_Capacity - 1),
+              m_Slots(std::make_unique<Slot_t[]>(m_Capacity)) { // NOLINT(*-avoid-c-arrays)
+        }
+
+        ~SpscQueue() {
+            if constexpr (!std::is_trivially_destructible_v<T>) {
+                const usize tail = m_Tail.load(std::memory_order_relaxed);
+                for (usize pos = m_Head.load(std::memory_order_relaxed); pos != tail; pos++) {
+                    slot(pos)->~T();
+                }
+            }
+        }
+
+        SpscQueue(const SpscQueue&)            = delete;
+        SpscQueue& operator=(const SpscQueue&) = delete;
+        SpscQueue(SpscQueue&&)                 = delete;
+        SpscQueue& operator=(SpscQueue&&)      = delete;
+
+        /// Producer only, returns false when the queue is full
+        template<typename... Args> bool try_emplace(Args&&... args) {
+            const usize tail = m_Tail.load(std::memory_order_relaxed);
+            if (tail - m_CachedHead == m_Capacity) {
+                m_CachedHead = m_Head.load(std::memory_order_acquire);
+                if (tail - m_CachedHead == m_Capacity) {
+                    return false;
+                }
+            }
+            ::new (static_cast<void*>(m_Slots[tail & m_Mask].m_Storage))
+                T(std::forward<Args>(args)...);
+            m_Tail.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        bool try_push(const T& value) {
+            return try_emplace(value);
+        }
+
+        bool try_push(T&& value) {
+            return try_emplace(std::move(value));
+        }
+
+        /// Consumer only, returns false when the queue is empty
+        bool try_pop(T& out) {
+            const usize head = m_Head.load(std::memory_order_relaxed);
+            if (head == m_CachedTail) {
+                m_CachedTail = m_Tail.load(std::memory_order_acquire);
+                if (head == m_CachedTail) {
+                    return false;
+                }
+            }
+            T* value = slot(head);
+            out      = std::move(*value);
+            value->~T();
+            m_Head.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        /// Producer only, moves as many leading values of `values` as fit and returns how many
+        usize push_batch(std::span<T> values) {
+            const usize tail = m_Tail.load(std::memory_order_relaxed);
+            usize       free = m_Capacity - (tail - m_CachedHead);
+            if (free < values.size()) {
+                m_CachedHead = m_Head.load(std::memory_order_acquire);
+                free         = m_Capacity - (tail - m_CachedHead);
+            }
+            const usize count = std::min(free, values.size());
+            for (usize i = 0; i < count; i++) {
+                ::new (static_cast<void*>(m_Slots[(tail + i) & m_Mask].m_Storage))
+                    T(std::move(values[i]));
+            }
+            if (count != 0) {
+                m_Tail.store(tail + count, std::memory_order_release);
+            }
+            return count;
+        }
+
+        /// Consumer only, fills the front of `out` with as many values as are available and
+        /// returns how many
+        usize pop_batch(std::span<T> out) {
+            const usize head      = m_Head.load(std::memory_order_relaxed);
+            usize       available = m_CachedTail - head;
+            if (available < out.size()) {
+                m_CachedTail = m_Tail.load(std::memory_order_acquire);
+                available    = m_CachedTail - head;
+            }
+            const usize count = std::min(available, out.size());
+            for (usize i = 0; i < count; i++) {
+                T* value = slot(head + i);
+                out[i]   = std::move(*value);
+                value->~T();
+            }
+            if (count != 0) {
+                m_Head.store(head + count, std::memory_order_release);
+            }
+            return count;
+        }
+
+        [[nodiscard]] usize capacity() const {
+            return m_Capacity;
+        }
+
+        /// Exact when called by either side while the other is idle, a snapshot otherwise
+        [[nodiscard]] usize size_approx() const {
+            const usize head = m_Head.load(std::memory_order_acquire);
+            const usize tail = m_Tail.load(std::memory_order_acquire);
+            return tail - head;
+        }
+
+    private:
+        struct Slot_t {
+            alignas(T) std::byte m_Storage[sizeof(T)]; // NOLINT(*-avoid-c-arrays)
+        };
+
+        [[nodiscard]] T* slot(usize pos) {
+            return std::launder(reinterpret_cast<T*>(m_Slots[pos & m_Mask].m_Storage));
+        }
+
+        const usize               m_Capacity;
+        const usize               m_Mask;
+        std::unique_ptr<Slot_t[]> m_Slots; // NOLINT(*-avoid-c-arrays)
+
+        /// Written by the consumer
+        alignas(64) std::atomic<usize> m_Head {0};
+        usize m_CachedTail = 0;
+        /// Written by the producer
+        alignas(64) std::atomic<usize> m_Tail {0};
+        usize m_CachedHead = 0;
+    };
+} // namespace Pulsar
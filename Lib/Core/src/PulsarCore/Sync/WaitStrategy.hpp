@@ -0,0 +1,107 @@
+#pragma once
+
+#include "PulsarCore/Types.hpp"
+#include "PulsarCore/Util/CpuFeatures.hpp"
+
+#include <atomic>
+#include <concepts>
+#include <thread>
+
+namespace Pulsar {
+    /// How a thread waits for a queue to change, one instance per condition (not empty, not full)
+    /// # Protocol
+    /// The waiter reads a token with `prepare`, retries the operation and, if it still fails,
+    /// calls `wait` with the token and the number of failed rounds so far. The other side calls
+    /// `notify` after every change. A `wait` may return early, callers always retry.
+    template<typename W>
+    concept WaitStrategy = requires(W& wait, u32 token, u32 round) {
+        { wait.prepare() } -> std::same_as<u32>;
+        wait.wait(token, round);
+        wait.notify();
+    };
+
+    /// Busy-waits with the CPU's spin hint: the lowest latency, but it burns a core while waiting
+    /// and starves the other side when threads outnumber cores
+    class SpinWait {
+    public:
+        [[nodiscard]] u32 prepare() const noexcept {
+            return 0;
+        }
+
+        void wait(u32 /*token*/, u32 /*round*/) const noexcept {
+            cpu_relax();
+        }
+
+        void notify() const noexcept {
+        }
+    };
+
+    /// Spins briefly, then yields the time slice on every round: cheap to notify and fair to
+    /// oversubscribed machines, but a waiting thread still never sleeps
+    class YieldWait {
+    public:
+        [[nodiscard]] u32 prepare() const noexcept {
+            return 0;
+        }
+
+        void wait(u32 /*token*/, u32 round) const noexcept {
+            if (round < SPIN_ROUNDS) {
+                cpu_relax();
+            }
+            else {
+                std::this_thread::yield();
+            }
+        }
+
+        void notify() const noexcept {
+        }
+
+    private:
+        static constexpr u32 SPIN_ROUNDS = 64;
+    };
+
+    /// Spins briefly, then sleeps in the kernel (a futex on Linux, through `std::atomic::wait`)
+    /// until notified
+    /// # Performance
+    /// Every `notify` increments a shared counter, the system call only happens while a thread
+    /// sleeps. Waking a sleeper takes microseconds, so this suits queues that go idle for long
+    /// stretches, like a render or audio command queue between frames.
+    class FutexWait {
+    public:
+        FutexWait() = default;
+
+        FutexWait(const FutexWait&)            = delete;
+        FutexWait& operator=(const FutexWait&) = delete;
+        FutexWait(FutexWait&&)                 = delete;
+        FutexWait& operator=(FutexWait&&)      = delete;
+
+        [[nodiscard]] u32 prepare() const noexcept {
+            return m_Epoch.load(std::memory_order_acquire);
+        }
+
+        void wait(u32 token, u32 round) noexcept {
+            if (round < SPIN_ROUNDS) {
+                cpu_relax();
+                return;
+            }
+            // The notifier bumps the epoch before it checks for sleepers, and this thread counts
+            // itself before it checks the epoch: one of the two always sees the other
+            m_Sleepers.fetch_add(1, std::memory_order_seq_cst);
+            m_Epoch.wait(token, std::memory_order_seq_cst);
+            m_Sleepers.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        void notify() noexcept {
+            m_Epoch.fetch_add(1, std::memory_order_seq_cst);
+            if (m_Sleepers.load(std::memory_order_seq_cst) != 0) {
+                m_Epoch.notify_all();
+            }
+        }
+
+    private:
+        static constexpr u32 SPIN_ROUNDS = 64;
+
+        alignas(64) std::atomic<u32> m_Epoch {0};
+        std::atomic<u32> m_Sleepers {0};
+    };
+} // namespace Pulsar
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "PulsarCore/Util/Macros.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+    #define PULSAR_ARCH_X86
+#elif defined(__aarch64__)
+    #define PULSAR_ARCH_ARM64
+#endif
+
+namespace Pulsar {
+    /// Instruction set extensions that are detected at runtime
+    /// # Usage
+    /// SIMD kernels are compiled with `[[gnu::target(...)]]` and selected based on these flags,
+    /// so the library itself can be built for the baseline ISA.
+    struct CpuFeatures_t {
+        bool m_SSE41 = false;
+        bool m_SSE42 = false;
+        bool m_AVX   = false;
+        bool m_AVX2  = false;
+        bool m_FMA   = false;
+        bool m_F16C  = false;
+    };
+
+    /// Returns the features of the CPU we are running on, detected on first use
+    [[nodiscard]] inline const CpuFeatures_t& cpu_features() {
+        static const CpuFeatures_t detected = [] {
+            CpuFeatures_t features;
+#ifdef PULSAR_ARCH_X86
+            __builtin_cpu_init();
+            features.m_SSE41 = __builtin_cpu_supports("sse4.1") != 0;
+            features.m_SSE42 = __builtin_cpu_supports("sse4.2") != 0;
+            features.m_AVX   = __builtin_cpu_supports("avx") != 0;
+            features.m_AVX2  = __builtin_cpu_supports("avx2") != 0;
+            features.m_FMA   = __builtin_cpu_supports("fma") != 0;
+            features.m_F16C  = features.m_AVX && __builtin_cpu_supports("f16c") != 0;
+#endif
+            return features;
+        }();
+        return detected;
+    }
+
+    /// Tells the CPU we are spinning, which frees resources for the other hyper-thread and
+    /// avoids the memory order violation penalty when the spin ends
+    PULSAR_ALWAYS_INLINE inline void cpu_relax() {
+#ifdef PULSAR_ARCH_X86
+        __builtin_ia32_pause();
+#elif defined(PULSAR_ARCH_ARM64)
+        asm volatile("yield" ::: "memory");
+#endif
+    }
+} // namespace Pulsar
@@ -0,0 +1,63 @@
+#include "Hash.hpp"
+
+#include "PulsarCore/Util/CpuFeatures.hpp"
+
+#include <array>
+#include <cstring>
+
+#ifdef PULSAR_ARCH_X86
+    #include <immintrin.h>
+#endif
+
+namespace Pulsar {
+    namespace {
+        /// The reflected Castagnoli polynomial
+        constexpr u32 CRC32C_POLYNOMIAL = 0x82f6'3b78;
+
+        constexpr std::array<u32, 256> CRC32C_TABLE = [] {
+            std::array<u32, 256> table {};
+            for (u32 i = 0; i < 256; i++) {
+                u32 crc = i;
+                for (int bit = 0; bit < 8; bit++) {
+                    crc = (crc >> 1) ^ ((crc & 1) != 0 ? CRC32C_POLYNOMIAL : 0);
+                }
+                table[i] = crc;
+            }
+            return table;
+        }();
+
+        u32 crc32c_table(const std::byte* data, usize size, u32 crc) {
+            for (usize i = 0; i < size; i++) {
+                crc = CRC32C_TABLE[(crc ^ static_cast<u8>(data[i])) & 0xff] ^ (crc >> 8);
+            }
+            return crc;
+        }
+
+#ifdef PULSAR_ARCH_X86
+        [[gnu::target("sse4.2")]] u32 crc32c_sse42(const std::byte* data, usize size, u32 crc) {
+            u64   crc64 = crc;
+            usize i     = 0;
+            for (; i + 8 <= size; i += 8) {
+                u64 word = 0;
+                std::memcpy(&word, data + i, sizeof(word));
+                crc64 = _mm_crc32_u64(crc64, word);
+            }
+            auto crc32 = static_cast<u32>(crc64);
+            for (; i < size; i++) {
+                crc32 = _mm_crc32_u8(crc32, static_cast<u8>(data[i]));
+            }
+            return crc32;
+        }
+#endif
+    } // namespace
+
+    u32 crc32c(std::span<const std::byte> data, u32 crc) {
+        crc = ~crc;
+#ifdef PULSAR_ARCH_X86
+        if (cpu_features().m_SSE42) {
+            return ~crc32c_sse42(data.data(), data.size(), crc);
+        }
+#endif
+        return ~crc32c_table(data.data(), data.size(), crc);
+    }
+} // namespace Pulsar
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "PulsarCore/Types.hpp"
+
+#include <span>
+#include <string_view>
+
+namespace Pulsar {
+    /// 64-bit FNV-1a, for short keys like asset names
+    /// # Usage
+    /// Stable across runs and platforms, so hashes may be stored in files, and `constexpr`, so
+    /// names known at compile time cost nothing to look up.
+    [[nodiscard]] constexpr u64 fnv1a_64(std::string_view text) {
+        u64 hash = 0xcbf2'9ce4'8422'2325;
+        for (const char c : text) {
+            hash ^= static_cast<u8>(c);
+            hash *= 0x0000'0100'0000'01b3;
+        }
+        return hash;
+    }
+
+    /// CRC-32C (Castagnoli) of `data`, continuing from the CRC of the bytes before it
+    /// # Performance
+    /// Uses the SSE4.2 `crc32` instruction where available (8 bytes per instruction, several
+    /// GB/s), and a table otherwise.
+    [[nodiscard]] u32 crc32c(std::span<const std::byte> data, u32 crc = 0);
+} // namespace Pulsar
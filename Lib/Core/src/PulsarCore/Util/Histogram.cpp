@@ -0,0 +1,58 @@
+#include "Histogram.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace Pulsar {
+    void LatencyHistogram::record(u64 value) {
+        m_Counts[bucket_of(value)]++;
+        m_Count++;
+        m_Min = std::min(m_Min, value);
+        m_Max = std::max(m_Max, value);
+        m_Sum += static_cast<f64>(value);
+    }
+
+    u64 LatencyHistogram::percentile(f64 quantile) const {
+        if (m_Count == 0) {
+            return 0;
+        }
+        // The rank of the sample asked for, counted from 1
+        const auto rank = std::max<u64>(
+            static_cast<u64>(std::ceil(std::clamp(quantile, 0.0, 1.0) * static_cast<f64>(m_Count))),
+            1);
+        if (rank == m_Count) {
+            return m_Max;
+        }
+        u64 seen = 0;
+        for (u32 bucket = 0; bucket < BUCKET_COUNT; bucket++) {
+            seen += m_Counts[bucket];
+            if (seen >= rank) {
+                return std::clamp(bucket_value(bucket), m_Min, m_Max);
+            }
+        }
+        return m_Max;
+    }
+
+    void LatencyHistogram::reset() {
+        *this = {};
+    }
+
+    u32 LatencyHistogram::bucket_of(u64 value) {
+        if (value < SUB_BUCKETS) {
+            return static_cast<u32>(value);
+        }
+        // The top SUB_BUCKET_BITS + 1 bits select the bucket, the leading one picks the range
+        const auto shift = static_cast<u32>(std::bit_width(value)) - SUB_BUCKET_BITS - 1;
+        return ((shift + 1) << SUB_BUCKET_BITS) + static_cast<u32>((value >> shift) - SUB_BUCKETS);
+    }
+
+    u64 LatencyHistogram::bucket_value(u32 bucket) {
+        if (bucket < SUB_BUCKETS) {
+            return bucket;
+        }
+        const u32 shift = (bucket >> SUB_BUCKET_BITS) - 1;
+        const u64 lower = u64 {SUB_BUCKETS + (bucket & (SUB_BUCKETS - 1))} << shift;
+        return lower + ((u64 {1} << shift) >> 1);
+    }
+} // namespace Pulsar
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "PulsarCore/Types.hpp"
+
+#include <array>
+#include <limits>
+
+namespace Pulsar {
+    /// Counts durations (or any u64) for percentiles, without storing the samples
+    /// # Usage
+    /// `record` every sample, then ask for `percentile(0.5)`, `percentile(0.99)`, `max`. Min, max
+    /// and mean are exact, percentiles are within 3% of the true sample.
+    /// # Layout
+    /// Log-linear buckets: values below 32 get a bucket each, every power of two above is split
+    /// into 32 equal buckets. 1920 counters cover the whole u64 range in 15 KiB, recording is a
+    /// `bit_width` and an increment.
+    class LatencyHistogram {
+    public:
+        void record(u64 value);
+
+        /// The value `quantile` (in [0, 1]) of the samples are at or below, 0 without samples
+        [[nodiscard]] u64 percentile(f64 quantile) const;
+
+        [[nodiscard]] u64 count() const {
+            return m_Count;
+        }
+
+        [[nodiscard]] u64 min() const {
+            return m_Count == 0 ? 0 : m_Min;
+        }
+
+        [[nodiscard]] u64 max() const {
+            return m_Max;
+        }
+
+        [[nodiscard]] f64 mean() const {
+            return m_Count == 0 ? 0.0 : m_Sum / static_cast<f64>(m_Count);
+        }
+
+        void reset();
+
+    private:
+        static constexpr u32 SUB_BUCKET_BITS = 5;
+        static constexpr u32 SUB_BUCKETS     = 1U << SUB_BUCKET_BITS;
+        static constexpr u32 BUCKET_COUNT    = (64 - SUB_BUCKET_BITS + 1) * SUB_BUCKETS;
+
+        [[nodiscard]] static u32 bucket_of(u64 value);
+        /// The middle of the values that land in `bucket`
+        [[nodiscard]] static u64 bucket_value(u32 bucket);
+
+        std::array<u64, BUCKET_COUNT> m_Counts {};
+        u64                           m_Count = 0;
+        u64                           m_Min   = std::numeric_limits<u64>::max();
+        u64                           m_Max   = 0;
+        f64                           m_Sum   = 0.0;
+    };
+} // namespace Pulsar
@@ -1,21 +1,6 @@
 #pragma once
 
-// Helper struct for RUN_ONCE
-namespace Pulsar::internal {
-    // NOLINTNEXTLINE(readability-identifier-naming)
-    struct _once_flag_t {
-        // TODO: Use std::atomic<bool> ior std::once_flag
-        bool m_Once = false;
-
-        bool test_and_set() {
-            if (m_Once) {
-                return true;
-            }
-            m_Once = true;
-            return false;
-        }
-    };
-}  // namespace Pulsar::internal
+#include "PulsarCore/Sync/Once.hpp"
 
 #if not defined(NDEBUG) or defined(PULSAR_FORCE_DEBUG)
     #define PULSAR_DEBUG
@@ -23,13 +8,19 @@ namespace Pulsar::internal {
     #define PULSAR_RELEASE
 #endif
 
-/// Macro to run a block of code only once, usage:
+#define PULSAR_CONCAT_IMPL(a, b) a##b
+#define PULSAR_CONCAT(a, b) PULSAR_CONCAT_IMPL(a, b)
+
+/// Macro to run a block of code only once, from whichever thread gets there first, usage:
 /// PULSAR_RUN_ONCE {
 ///     // code
 /// }
+/// Other threads wait until the block finished, see `Pulsar::OnceFlag`
 #define PULSAR_RUN_ONCE \
-    static ::Pulsar::internal::_once_flag_t __once_flag##__LINE__; \
-    if (!__once_flag##__LINE__.test_and_set())
+    static constinit ::Pulsar::OnceFlag PULSAR_CONCAT(pulsarOnceFlag, __LINE__); \
+    if (::Pulsar::internal::OnceScope_t PULSAR_CONCAT(pulsarOnceScope, __LINE__) { \
+            PULSAR_CONCAT(pulsarOnceFlag, __LINE__)}; \
+        PULSAR_CONCAT(pulsarOnceScope, __LINE__).should_run())
 
 #ifdef PULSAR_DEBUG
     #define PULSAR_DEBUG_RUN_ONCE PULSAR_RUN_ONCE
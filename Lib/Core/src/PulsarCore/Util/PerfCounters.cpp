@@ -0,0 +1,128 @@
+#include "PerfCounters.hpp"
+
+#include <fmt/format.h>
+
+#if defined(__linux__) && __has_include(<linux/perf_event.h>)
+    #include <cerrno>
+    #include <cstring>
+    #include <linux/perf_event.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+    #define PULSAR_HAS_PERF_EVENTS
+#endif
+
+namespace Pulsar {
+#ifdef PULSAR_HAS_PERF_EVENTS
+    namespace {
+        perf_event_attr make_attributes(PerfCounter counter) {
+            perf_event_attr attributes {};
+            attributes.size           = sizeof(attributes);
+            attributes.type           = PERF_TYPE_HARDWARE;
+            attributes.exclude_kernel = 1;
+            attributes.exclude_hv     = 1;
+            attributes.read_format =
+                PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+            switch (counter) {
+                case PerfCounter::Cycles:
+                    attributes.config = PERF_COUNT_HW_CPU_CYCLES;
+                    break;
+                case PerfCounter::Instructions:
+                    attributes.config = PERF_COUNT_HW_INSTRUCTIONS;
+                    break;
+                case PerfCounter::CacheMisses:
+                    attributes.config = PERF_COUNT_HW_CACHE_MISSES;
+                    break;
+                case PerfCounter::BranchMisses:
+                    attributes.config = PERF_COUNT_HW_BRANCH_MISSES;
+                    break;
+                case PerfCounter::DtlbMisses:
+                    attributes.type   = PERF_TYPE_HW_CACHE;
+                    attributes.config = PERF_COUNT_HW_CACHE_DTLB
+                                      | (PERF_COUNT_HW_CACHE_OP_READ << 8U)
+                                      | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16U);
+                    break;
+                case PerfCounter::COUNT: break;
+            }
+            return attributes;
+        }
+    } // namespace
+#endif
+
+    PerfCounterGroup::PerfCounterGroup() {
+        m_Fds.fill(-1);
+#ifdef PULSAR_HAS_PERF_EVENTS
+        for (usize i = 0; i < PERF_COUNTER_COUNT; i++) {
+            const auto      counter    = static_cast<PerfCounter>(i);
+            perf_event_attr attributes = make_attributes(counter);
+            const auto      fd         = static_cast<int>(
+                syscall(SYS_perf_event_open, &attributes, 0, -1, m_Leader, PERF_FLAG_FD_CLOEXEC));
+            if (fd < 0) {
+                if (m_Error.empty()) {
+                    m_Error = fmt::format(
+                        "perf_event_open({}) failed: {}", to_string(counter), std::strerror(errno));
+                }
+                continue;
+            }
+            m_Fds[i] = fd;
+            m_Available |= 1U << i;
+            if (m_Leader < 0) {
+                m_Leader = fd;
+            }
+        }
+#else
+        m_Error = "Hardware counters are not supported on this platform";
+#endif
+    }
+
+    PerfCounterGroup::~PerfCounterGroup() {
+#ifdef PULSAR_HAS_PERF_EVENTS
+        // Members before the leader, closing it first would orphan them
+        for (usize i = PERF_COUNTER_COUNT; i-- > 0;) {
+            if (m_Fds[i] >= 0 && m_Fds[i] != m_Leader) {
+                close(m_Fds[i]);
+            }
+        }
+        if (m_Leader >= 0) {
+            close(m_Leader);
+        }
+#endif
+    }
+
+    PerfCounterGroup& PerfCounterGroup::for_current_thread() {
+        thread_local PerfCounterGroup group;
+        return group;
+    }
+
+    PerfCounterValues_t PerfCounterGroup::read() const {
+        PerfCounterValues_t values;
+#ifdef PULSAR_HAS_PERF_EVENTS
+        if (m_Leader < 0) {
+            return values;
+        }
+        // nr, time enabled, time running, then one value per opened counter in opening order
+        std::array<u64, 3 + PERF_COUNTER_COUNT> buffer {};
+        const ssize_t size = ::read(m_Leader, buffer.data(), sizeof(buffer));
+        if (size < static_cast<ssize_t>(3 * sizeof(u64)) || buffer[2] == 0) {
+            // Not scheduled at all yet, nothing meaningful to report
+            return values;
+        }
+        const u64 count   = buffer[0];
+        const u64 enabled = buffer[1];
+        const u64 running = buffer[2];
+        usize     next    = 0;
+        for (usize i = 0; i < PERF_COUNTER_COUNT && next < count; i++) {
+            if (m_Fds[i] < 0) {
+                continue;
+            }
+            u64 value = buffer[3 + next++];
+            if (running < enabled) {
+                value = static_cast<u64>(static_cast<f64>(value) * static_cast<f64>(enabled)
+                                         / static_cast<f64>(running));
+            }
+            values.m_Values[i] = value;
+            values.m_Available |= 1U << i;
+        }
+#endif
+        return values;
+    }
+} // namespace Pulsar
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "PulsarCore/Types.hpp"
+
+#include <array>
+#include <string>
+
+namespace Pulsar {
+    enum class PerfCounter : u8 {
+        Cycles,
+        Instructions,
+        CacheMisses,
+        BranchMisses,
+        DtlbMisses,
+        COUNT,
+    };
+
+    constexpr usize PERF_COUNTER_COUNT = static_cast<usize>(PerfCounter::COUNT);
+
+    /// Names as reported in benchmark counters and profiler zones
+    [[nodiscard]] constexpr const char* to_string(PerfCounter counter) {
+        constexpr std::array<const char*, PERF_COUNTER_COUNT> NAMES = {
+            "cycles", "instructions", "cache_misses", "branch_misses", "dtlb_misses"};
+        return NAMES[static_cast<usize>(counter)];
+    }
+
+    /// Counter values at one point in time, or the difference between two
+    struct PerfCounterValues_t {
+        std::array<u64, PERF_COUNTER_COUNT> m_Values {};
+        /// Bit `i` is set if `m_Values[i]` holds a value
+        u32 m_Available = 0;
+
+        [[nodiscard]] bool has(PerfCounter counter) const {
+            return (m_Available & (1U << static_cast<u32>(counter))) != 0;
+        }
+
+        [[nodiscard]] u64 get(PerfCounter counter) const {
+            return m_Values[static_cast<usize>(counter)];
+        }
+
+        /// Counters available in both
+        [[nodiscard]] PerfCounterValues_t operator-(const PerfCounterValues_t& start) const {
+            PerfCounterValues_t delta;
+            delta.m_Available = m_Available & start.m_Available;
+            for (usize i = 0; i < PERF_COUNTER_COUNT; i++) {
+                delta.m_Values[i] = m_Values[i] - start.m_Values[i];
+            }
+            return delta;
+        }
+    };
+
+    /// Hardware counters of the calling thread, through Linux `perf_event_open`
+    /// # Availability
+    /// Containers, virtual machines without a virtual PMU and `perf_event_paranoid` settings all
+    /// take counters away, so each one is opened on its own and missing ones are simply not
+    /// reported: `read` marks what it could read in `m_Available`. Other platforms have none.
+    /// Kernel and hypervisor time is excluded, which `perf_event_paranoid` 2 still allows.
+    /// # Performance
+    /// The counters run from construction on, `read` is a single `read` system call for the
+    /// whole group (around a microsecond), so it fits around whole benchmark runs or coarse
+    /// zones, not tight loops.
+    class PerfCounterGroup {
+    public:
+        /// Opens the counters for the calling thread
+        PerfCounterGroup();
+        ~PerfCounterGroup();
+
+        PerfCounterGroup(const PerfCounterGroup&)            = delete;
+        PerfCounterGroup& operator=(const PerfCounterGroup&) = delete;
+        PerfCounterGroup(PerfCounterGroup&&)                 = delete;
+        PerfCounterGroup& operator=(PerfCounterGroup&&)      = delete;
+
+        /// The group of the calling thread, opened on first use
+        [[nodiscard]] static PerfCounterGroup& for_current_thread();
+
+        [[nodiscard]] bool is_available() const {
+            return m_Available != 0;
+        }
+
+        [[nodiscard]] bool has(PerfCounter counter) const {
+            return (m_Available & (1U << static_cast<u32>(counter))) != 0;
+        }
+
+        /// Why the first unavailable counter could not be opened, empty if all of them are
+        [[nodiscard]] const std::string& error() const {
+            return m_Error;
+        }
+
+        /// Current values, scaled up when the kernel had to multiplex the counters
+        [[nodiscard]] PerfCounterValues_t read() const;
+
+    private:
+        /// The first counter that opened, the others are read through it
+        int m_Leader = -1;
+        /// Descriptors by counter, -1 for unavailable ones
+        std::array<int, PERF_COUNTER_COUNT> m_Fds {};
+        u32                                 m_Available = 0;
+        std::string                         m_Error;
+    };
+} // namespace Pulsar
@@ -0,0 +1,290 @@
+#include "Profiler.hpp"
+
+#include <chrono>
+#include <fmt/format.h>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Pulsar {
+    namespace {
+        using Clock = std::chrono::steady_clock;
+
+        struct Registry_t {
+            std::mutex                                                    m_Mutex;
+            std::vector<std::unique_ptr<internal::ProfileThreadBuffer_t>> m_Buffers;
+            u32                                                           m_NextThreadId = 1;
+            u32                                                           m_NextSession  = 1;
+            /// The session `chrome_trace` exports
+            u32 m_LastSession = 0;
+            // Tick counter calibration, taken at `start` and `stop`
+            u64               m_StartTicks = 0;
+            Clock::time_point m_StartTime;
+            u64               m_StopTicks = 0;
+            Clock::time_point m_StopTime;
+        };
+
+        // NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+        Registry_t g_Registry;
+
+        /// Lets another thread take over the buffer once this one exits
+        thread_local struct BufferOwner_t {
+            BufferOwner_t()                                = default;
+            BufferOwner_t(const BufferOwner_t&)            = delete;
+            BufferOwner_t& operator=(const BufferOwner_t&) = delete;
+            BufferOwner_t(BufferOwner_t&&)                 = delete;
+            BufferOwner_t& operator=(BufferOwner_t&&)      = delete;
+            ~BufferOwner_t() {
+                if (m_Buffer != nullptr) {
+                    m_Buffer->m_InUse.store(false, std::memory_order_release);
+                }
+            }
+
+            internal::ProfileThreadBuffer_t* m_Buffer = nullptr;
+        } g_BufferOwner;
+        // NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
+
+        void append_escaped(std::string& out, std::string_view text) {
+            for (const char character : text) {
+                switch (character) {
+                    case '"': out += "\\\""; break;
+                    case '\\': out += "\\\\"; break;
+                    case '\n': out += "\\n"; break;
+                    case '\t': out += "\\t"; break;
+                    default:
+                        if (static_cast<unsigned char>(character) < 0x20) {
+                            fmt::format_to(std::back_inserter(out), "\\u{:04x}", character);
+                        }
+                        else {
+                            out += character;
+                        }
+                }
+            }
+        }
+
+        /// The calling thread's buffer, `current` if it already has one. The caller holds the
+        /// registry mutex.
+        internal::ProfileThreadBuffer_t* claim_buffer(internal::ProfileThreadBuffer_t* current) {
+            if (current != nullptr) {
+                return current;
+            }
+            internal::ProfileThreadBuffer_t* buffer = nullptr;
+            // Take over the buffer of an exited thread, unless its events are still exportable
+            for (const auto& candidate : g_Registry.m_Buffers) {
+                if (!candidate->m_InUse.load(std::memory_order_acquire)
+                    && candidate->m_Session.load(std::memory_order_relaxed)
+                           != g_Registry.m_LastSession) {
+                    buffer = candidate.get();
+                    buffer->m_InUse.store(true, std::memory_order_relaxed);
+                    buffer->m_Name.clear();
+                    break;
+                }
+            }
+            if (buffer == nullptr) {
+                auto owned     = std::make_unique<internal::ProfileThreadBuffer_t>();
+                owned->m_First = new internal::ProfileChunk_t(); // NOLINT(*-owning-memory)
+                owned->m_Current = owned->m_First;
+                buffer           = owned.get();
+                g_Registry.m_Buffers.push_back(std::move(owned));
+            }
+            buffer->m_ThreadId     = g_Registry.m_NextThreadId++;
+            g_BufferOwner.m_Buffer = buffer;
+            return buffer;
+        }
+
+        /// Buffers holding events of `session`, the caller holds the registry mutex
+        template<typename Function> void for_each_buffer(u32 session, Function&& function) {
+            for (const auto& buffer : g_Registry.m_Buffers) {
+                if (session != 0 && buffer->m_Session.load(std::memory_order_acquire) == session) {
+                    function(*buffer);
+                }
+            }
+        }
+
+        template<typename Function>
+        void for_each_event(const internal::ProfileThreadBuffer_t& buffer, Function&& function) {
+            for (const internal::ProfileChunk_t* chunk = buffer.m_First; chunk != nullptr;
+                 chunk = chunk->m_Next.load(std::memory_order_acquire)) {
+                const u32 count = chunk->m_Count.load(std::memory_order_acquire);
+                for (u32 i = 0; i < count; i++) {
+                    function(chunk->m_Events[i]);
+                }
+                if (count < internal::ProfileChunk_t::CAPACITY) {
+                    break;
+                }
+            }
+        }
+    } // namespace
+
+    void Profiler::start(const ProfilerConfig_t& config) {
+        std::lock_guard lock(g_Registry.m_Mutex);
+        u32             session = g_Registry.m_NextSession++;
+        if (session == 0) {
+            session = g_Registry.m_NextSession++;
+        }
+        g_Registry.m_LastSession = session;
+        g_Registry.m_StartTicks  = read_timestamp();
+        g_Registry.m_StartTime   = Clock::now();
+        g_Registry.m_StopTicks   = 0;
+        s_PerfCounters.store(config.m_PerfCounters, std::memory_order_relaxed);
+        s_Session.store(session, std::memory_order_release);
+    }
+
+    void Profiler::stop() {
+        std::lock_guard lock(g_Registry.m_Mutex);
+        s_PerfCounters.store(false, std::memory_order_relaxed);
+        if (s_Session.exchange(0, std::memory_order_relaxed) != 0) {
+            g_Registry.m_StopTicks = read_timestamp();
+            g_Registry.m_StopTime  = Clock::now();
+        }
+    }
+
+    void Profiler::record_perf_counters(const PerfCounterValues_t& start) {
+        const PerfCounterValues_t delta = read_perf_counters() - start;
+        for (usize i = 0; i < PERF_COUNTER_COUNT; i++) {
+            const auto counter = static_cast<PerfCounter>(i);
+            if (delta.has(counter)) {
+                record(ProfileEventType::PerfCounter, to_string(counter),
+                       static_cast<f64>(delta.get(counter)));
+            }
+        }
+    }
+
+    void Profiler::set_thread_name(std::string_view name) {
+        std::lock_guard lock(g_Registry.m_Mutex);
+        s_ThreadBuffer         = claim_buffer(s_ThreadBuffer);
+        s_ThreadBuffer->m_Name = name;
+    }
+
+    usize Profiler::event_count() {
+        std::lock_guard lock(g_Registry.m_Mutex);
+        usize           count = 0;
+        for_each_buffer(g_Registry.m_LastSession, [&count](const auto& buffer) {
+            for_each_event(buffer, [&count](const ProfileEvent_t&) { count++; });
+        });
+        return count;
+    }
+
+    std::string Profiler::chrome_trace() {
+        std::lock_guard lock(g_Registry.m_Mutex);
+        const bool      running = s_Session.load(std::memory_order_relaxed) != 0;
+        const u64       endTicks = running ? read_timestamp() : g_Registry.m_StopTicks;
+        const auto      endTime  = running ? Clock::now() : g_Registry.m_StopTime;
+        const auto      elapsed  = std::chrono::duration<f64>(endTime - g_Registry.m_StartTime);
+        // Microseconds per tick, the tick counter runs at about 1 GHz when it can't be calibrated
+        f64 scale = 1e-3;
+        if (elapsed.count() > 0.0 && endTicks > g_Registry.m_StartTicks) {
+            scale = elapsed.count() * 1e6 / static_cast<f64>(endTicks - g_Registry.m_StartTicks);
+        }
+        const auto to_us = [&](u64 ticks) {
+            return static_cast<f64>(static_cast<i64>(ticks - g_Registry.m_StartTicks)) * scale;
+        };
+
+        std::string out = R"({"displayTimeUnit":"ns","traceEvents":[)";
+        out += R"({"name":"process_name","ph":"M","pid":1,"tid":0,"args":{"name":"Pulsar"}})";
+        const auto begin_event = [&out](std::string_view name, char phase, u32 thread) {
+            out += R"(,{"name":")";
+            append_escaped(out, name);
+            fmt::format_to(std::back_inserter(out), R"(","ph":"{}","pid":1,"tid":{})", phase,
+                           thread);
+        };
+
+        const auto end_event = [&out, &to_us](u64 ticks) {
+            fmt::format_to(std::back_inserter(out), R"(,"ts":{:.3f}}})", to_us(ticks));
+        };
+
+        for_each_buffer(g_Registry.m_LastSession, [&](const auto& buffer) {
+            begin_event("thread_name", 'M', buffer.m_ThreadId);
+            out += R"(,"args":{"name":")";
+            append_escaped(out, buffer.m_Name.empty() ? fmt::format("Thread {}", buffer.m_ThreadId)
+                                                      : buffer.m_Name);
+            out += R"("}})";
+
+            // Zones cut by `start` or `stop` are dropped or closed, so the viewer sees balanced
+            // pairs
+            std::vector<const char*> open;
+            u64                      last = g_Registry.m_StartTicks;
+            // Hardware counters of the zone that ends next, as its end event's args
+            std::string perfArgs;
+            for_each_event(buffer, [&](const ProfileEvent_t& event) {
+                last = event.m_Timestamp;
+                switch (event.m_Type) {
+                    case ProfileEventType::ZoneBegin:
+                        open.push_back(event.m_Name);
+                        begin_event(event.m_Name, 'B', buffer.m_ThreadId);
+                        break;
+                    case ProfileEventType::ZoneEnd:
+                        if (open.empty()) {
+                            perfArgs.clear();
+                            return;
+                        }
+                        open.pop_back();
+                        begin_event(event.m_Name, 'E', buffer.m_ThreadId);
+                        if (!perfArgs.empty()) {
+                            fmt::format_to(std::back_inserter(out), R"(,"args":{{{}}})", perfArgs);
+                            perfArgs.clear();
+                        }
+                        break;
+                    case ProfileEventType::Frame:
+                        begin_event(event.m_Name, 'i', buffer.m_ThreadId);
+                        out += R"(,"s":"g")";
+                        break;
+                    case ProfileEventType::Counter:
+                        begin_event(event.m_Name, 'C', buffer.m_ThreadId);
+                        fmt::format_to(std::back_inserter(out), R"(,"args":{{"value":{}}})",
+                                       event.m_Value);
+                        break;
+                    case ProfileEventType::PerfCounter:
+                        fmt::format_to(std::back_inserter(perfArgs), R"({}"{}":{})",
+                                       perfArgs.empty() ? "" : ",", event.m_Name, event.m_Value);
+                        return;
+                }
+                end_event(event.m_Timestamp);
+            });
+            while (!open.empty()) {
+                begin_event(open.back(), 'E', buffer.m_ThreadId);
+                end_event(last);
+                open.pop_back();
+            }
+        });
+        out += "]}\n";
+        return out;
+    }
+
+    Result<bool, std::string> Profiler::export_chrome_trace(const std::filesystem::path& path) {
+        const std::string trace = chrome_trace();
+        std::ofstream     file(path, std::ios::binary | std::ios::trunc);
+        if (!file || !file.write(trace.data(), static_cast<std::streamsize>(trace.size()))) {
+            return Err<std::string>(fmt::format("Failed to write trace to {}", path.string()));
+        }
+        return Result<bool, std::string>(true);
+    }
+
+    internal::ProfileThreadBuffer_t* Profiler::attach_thread(u32 session) {
+        std::lock_guard                  lock(g_Registry.m_Mutex);
+        internal::ProfileThreadBuffer_t* buffer = claim_buffer(s_ThreadBuffer);
+
+        // Start the new session with an empty buffer, the chunks are kept for reuse
+        for (internal::ProfileChunk_t* chunk = buffer->m_First; chunk != nullptr;
+             chunk = chunk->m_Next.load(std::memory_order_relaxed)) {
+            chunk->m_Count.store(0, std::memory_order_relaxed);
+        }
+        buffer->m_Current = buffer->m_First;
+        buffer->m_Session.store(session, std::memory_order_release);
+
+        s_ThreadBuffer = buffer;
+        return buffer;
+    }
+
+    internal::ProfileChunk_t* Profiler::grow(internal::ProfileThreadBuffer_t& buffer) {
+        internal::ProfileChunk_t* next = buffer.m_Current->m_Next.load(std::memory_order_relaxed);
+        if (next == nullptr) {
+            next = new internal::ProfileChunk_t(); // NOLINT(*-owning-memory)
+            buffer.m_Current->m_Next.store(next, std::memory_order_release);
+        }
+        buffer.m_Current = next;
+        return next;
+    }
+} // namespace Pulsar
@@ -0,0 +1,210 @@
+#pragma once
+
+#include "PulsarCore/Result.hpp"
+#include "PulsarCore/Types.hpp"
+#include "PulsarCore/Util/Macros.hpp"
+#include "PulsarCore/Util/PerfCounters.hpp"
+#include "PulsarCore/Util/Timestamp.hpp"
+
+#include <array>
+#include <atomic>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <utility>
+
+// Instrumentation macros, they compile to nothing unless `PULSAR_PROFILE` is defined (the
+// `PULSAR_PROFILE` CMake option). Names have to be string literals, only the pointer is recorded.
+#ifdef PULSAR_PROFILE
+    #define PULSAR_PROFILE_CONCAT_IMPL(a, b) a##b
+    #define PULSAR_PROFILE_CONCAT(a, b) PULSAR_PROFILE_CONCAT_IMPL(a, b)
+    /// Records a zone from here to the end of the enclosing scope
+    #define PULSAR_PROFILE_SCOPE(name)                                                             \
+        const ::Pulsar::ProfileScope PULSAR_PROFILE_CONCAT(plProfileScope, __LINE__)(name)
+    #define PULSAR_PROFILE_FUNCTION() PULSAR_PROFILE_SCOPE(__func__)
+    /// Marks the end of a frame, shown as a global instant event
+    #define PULSAR_PROFILE_FRAME(name) ::Pulsar::Profiler::frame_mark(name)
+    #define PULSAR_PROFILE_COUNTER(name, value) ::Pulsar::Profiler::counter(name, value)
+    #define PULSAR_PROFILE_THREAD_NAME(name) ::Pulsar::Profiler::set_thread_name(name)
+#else
+    #define PULSAR_PROFILE_SCOPE(name) static_cast<void>(0)
+    #define PULSAR_PROFILE_FUNCTION() static_cast<void>(0)
+    #define PULSAR_PROFILE_FRAME(name) static_cast<void>(0)
+    #define PULSAR_PROFILE_COUNTER(name, value) static_cast<void>(0)
+    #define PULSAR_PROFILE_THREAD_NAME(name) static_cast<void>(0)
+#endif
+
+namespace Pulsar {
+    enum class ProfileEventType : u8 {
+        ZoneBegin,
+        ZoneEnd,
+        Frame,
+        Counter,
+        /// A hardware counter delta of the zone that ends next, see `ProfilerConfig_t`
+        PerfCounter,
+    };
+
+    struct ProfileEvent_t {
+        u64              m_Timestamp;
+        const char*      m_Name;
+        f64              m_Value;
+        ProfileEventType m_Type;
+    };
+
+    namespace internal {
+        /// A block of events, only appended to by its thread and published through `m_Count`
+        struct ProfileChunk_t {
+            static constexpr usize CAPACITY = 2048;
+
+            std::atomic<u32>                     m_Count {0};
+            std::atomic<ProfileChunk_t*>         m_Next {nullptr};
+            std::array<ProfileEvent_t, CAPACITY> m_Events;
+        };
+
+        /// The chunks of a thread, kept until the process exits so an export never races with
+        /// a thread going away
+        struct ProfileThreadBuffer_t {
+            ProfileThreadBuffer_t() = default;
+            ProfileThreadBuffer_t(const ProfileThreadBuffer_t&)            = delete;
+            ProfileThreadBuffer_t& operator=(const ProfileThreadBuffer_t&) = delete;
+            ProfileThreadBuffer_t(ProfileThreadBuffer_t&&)                 = delete;
+            ProfileThreadBuffer_t& operator=(ProfileThreadBuffer_t&&)      = delete;
+            ~ProfileThreadBuffer_t() {
+                while (m_First != nullptr) {
+                    delete std::exchange(m_First, m_First->m_Next.load(std::memory_order_relaxed));
+                }
+            }
+
+            /// Session the events belong to, see `Profiler::start`
+            std::atomic<u32>  m_Session {0};
+            std::atomic<bool> m_InUse {true};
+            u32               m_ThreadId = 0;
+            std::string       m_Name;
+            ProfileChunk_t*   m_First   = nullptr;
+            ProfileChunk_t*   m_Current = nullptr;
+        };
+    } // namespace internal
+
+    struct ProfilerConfig_t {
+        /// Attaches the hardware counter deltas of every zone (see `PerfCounterGroup`) to its end
+        /// event. Reading them costs about two system calls per zone.
+        bool m_PerfCounters = false;
+    };
+
+    /// Collects zones, frame marks and counters into per-thread buffers, and exports them as a
+    /// Chrome trace (chrome://tracing, https://ui.perfetto.dev)
+    /// # Performance
+    /// Recording an event reads the tick counter and appends to the calling thread's buffer: no
+    /// lock and no shared cache line is written. Buffers grow in chunks and keep everything until
+    /// the next `start`, so sessions are meant to cover a few seconds.
+    /// # Sessions
+    /// Nothing is recorded until `start`. `stop` ends the session, its events stay available for
+    /// export until the next `start`.
+    class Profiler {
+    public:
+        static void start(const ProfilerConfig_t& config = {});
+        static void stop();
+
+        [[nodiscard]] PULSAR_ALWAYS_INLINE static bool is_enabled() {
+            return s_Session.load(std::memory_order_relaxed) != 0;
+        }
+
+        /// Whether zones record hardware counters, only true while a session runs
+        [[nodiscard]] PULSAR_ALWAYS_INLINE static bool is_perf_enabled() {
+            return s_PerfCounters.load(std::memory_order_relaxed);
+        }
+
+        /// The calling thread's counters, for the start of a zone
+        [[nodiscard]] static PerfCounterValues_t read_perf_counters() {
+            return PerfCounterGroup::for_current_thread().read();
+        }
+
+        /// Records what the counters did since `start`, for the zone that ends next
+        PULSAR_NO_INLINE static void record_perf_counters(const PerfCounterValues_t& start);
+
+        PULSAR_ALWAYS_INLINE static void begin_zone(const char* name) {
+            record(ProfileEventType::ZoneBegin, name, 0.0);
+        }
+
+        PULSAR_ALWAYS_INLINE static void end_zone(const char* name) {
+            record(ProfileEventType::ZoneEnd, name, 0.0);
+        }
+
+        static void frame_mark(const char* name = "Frame") {
+            record(ProfileEventType::Frame, name, 0.0);
+        }
+
+        static void counter(const char* name, f64 value) {
+            record(ProfileEventType::Counter, name, value);
+        }
+
+        /// Names the calling thread in the trace, the name is kept across sessions
+        static void set_thread_name(std::string_view name);
+
+        /// Events of the current or last session
+        [[nodiscard]] static usize event_count();
+        /// The last session as Chrome trace event JSON
+        [[nodiscard]] static std::string chrome_trace();
+        [[nodiscard]] static Result<bool, std::string> export_chrome_trace(
+            const std::filesystem::path& path);
+
+        PULSAR_ALWAYS_INLINE static void record(
+            ProfileEventType type, const char* name, f64 value) {
+            const u32 session = s_Session.load(std::memory_order_relaxed);
+            if (session == 0) {
+                return;
+            }
+            internal::ProfileThreadBuffer_t* buffer = s_ThreadBuffer;
+            if (buffer == nullptr || buffer->m_Session.load(std::memory_order_relaxed) != session)
+                [[unlikely]] {
+                buffer = attach_thread(session);
+            }
+            internal::ProfileChunk_t* chunk = buffer->m_Current;
+            u32                       count = chunk->m_Count.load(std::memory_order_relaxed);
+            if (count == internal::ProfileChunk_t::CAPACITY) [[unlikely]] {
+                chunk = grow(*buffer);
+                count = 0;
+            }
+            chunk->m_Events[count] = {read_timestamp(), name, value, type};
+            chunk->m_Count.store(count + 1, std::memory_order_release);
+        }
+
+    private:
+        PULSAR_NO_INLINE static internal::ProfileThreadBuffer_t* attach_thread(u32 session);
+        PULSAR_NO_INLINE static internal::ProfileChunk_t* grow(
+            internal::ProfileThreadBuffer_t& buffer);
+
+        constinit inline static thread_local internal::ProfileThreadBuffer_t* s_ThreadBuffer =
+            nullptr;
+        /// Id of the running session, 0 while stopped
+        inline static std::atomic<u32>  s_Session {0};
+        inline static std::atomic<bool> s_PerfCounters {false};
+    };
+
+    /// Records a zone for its lifetime, see `PULSAR_PROFILE_SCOPE`
+    class ProfileScope {
+    public:
+        PULSAR_ALWAYS_INLINE explicit ProfileScope(const char* name) : m_Name(name) {
+            Profiler::begin_zone(name);
+            if (Profiler::is_perf_enabled()) [[unlikely]] {
+                m_PerfStart = Profiler::read_perf_counters();
+            }
+        }
+
+        PULSAR_ALWAYS_INLINE ~ProfileScope() {
+            if (m_PerfStart.m_Available != 0) [[unlikely]] {
+                Profiler::record_perf_counters(m_PerfStart);
+            }
+            Profiler::end_zone(m_Name);
+        }
+
+        ProfileScope(const ProfileScope&)            = delete;
+        ProfileScope& operator=(const ProfileScope&) = delete;
+        ProfileScope(ProfileScope&&)                 = delete;
+        ProfileScope& operator=(ProfileScope&&)      = delete;
+
+    private:
+        const char*         m_Name;
+        PerfCounterValues_t m_PerfStart;
+    };
+} // namespace Pulsar
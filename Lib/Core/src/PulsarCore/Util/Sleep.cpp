@@ -0,0 +1,35 @@
+#include "Sleep.hpp"
+
+#include "PulsarCore/Util/CpuFeatures.hpp"
+#include "PulsarCore/Util/Timestamp.hpp"
+
+#ifdef __linux__
+    #include <cerrno>
+    #include <ctime>
+#else
+    #include <chrono>
+    #include <thread>
+#endif
+
+namespace Pulsar {
+    void sleep_until_ns(u64 deadlineNs, u64 spinNs) {
+        const u64 wakeNs = deadlineNs > spinNs ? deadlineNs - spinNs : 0;
+        // One read, the wake time may pass between two
+        const u64 now = monotonic_ns();
+        if (now < wakeNs) {
+#ifdef __linux__
+            // steady_clock is CLOCK_MONOTONIC on Linux, so the deadlines are on the same clock
+            timespec wake {};
+            wake.tv_sec  = static_cast<time_t>(wakeNs / 1'000'000'000);
+            wake.tv_nsec = static_cast<long>(wakeNs % 1'000'000'000);
+            while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wake, nullptr) == EINTR) {
+            }
+#else
+            std::this_thread::sleep_for(std::chrono::nanoseconds(wakeNs - now));
+#endif
+        }
+        while (monotonic_ns() < deadlineNs) {
+            cpu_relax();
+        }
+    }
+} // namespace Pulsar
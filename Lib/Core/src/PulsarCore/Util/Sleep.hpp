@@ -0,0 +1,13 @@
+#pragma once
+
+#include "PulsarCore/Types.hpp"
+
+namespace Pulsar {
+    /// Blocks until `monotonic_ns()` reaches `deadlineNs`
+    /// # Performance
+    /// Sleeps in the kernel on an absolute deadline (`clock_nanosleep` with `TIMER_ABSTIME` on
+    /// Linux), so the error does not pile up over repeated periods. Wake-ups are late by the
+    /// timer slack and scheduler latency, typically 50 µs to a millisecond; with `spinNs` the
+    /// sleep ends that much early and the rest is spun out, trading CPU time for accuracy.
+    void sleep_until_ns(u64 deadlineNs, u64 spinNs = 0);
+} // namespace Pulsar
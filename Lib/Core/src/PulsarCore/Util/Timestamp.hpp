@@ -0,0 +1,36 @@
+#pragma once
+
+#include "PulsarCore/Types.hpp"
+#include "PulsarCore/Util/CpuFeatures.hpp"
+#include "PulsarCore/Util/Macros.hpp"
+
+#include <chrono>
+
+#ifdef PULSAR_ARCH_X86
+    #include <x86intrin.h>
+#endif
+
+namespace Pulsar {
+    /// A cheap monotonic tick counter: the TSC on x86, the virtual counter on AArch64 and
+    /// steady_clock nanoseconds elsewhere. The tick rate is unspecified, callers calibrate it
+    /// against a clock over a long enough interval.
+    PULSAR_ALWAYS_INLINE inline u64 read_timestamp() {
+#if defined(PULSAR_ARCH_X86)
+        return __rdtsc();
+#elif defined(PULSAR_ARCH_ARM64)
+        u64 ticks = 0;
+        asm volatile("mrs %0, cntvct_el0" : "=r"(ticks));
+        return ticks;
+#else
+        return static_cast<u64>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+    }
+
+    /// Nanoseconds on the monotonic clock (`CLOCK_MONOTONIC` on Linux), comparable across threads
+    /// and with the timestamps of window events
+    inline u64 monotonic_ns() {
+        return static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+                .count());
+    }
+} // namespace Pulsar
@@ -0,0 +1,250 @@
+// NOLINTBEGIN(*)
+#include "PulsarCore/Async/Executor.hpp"
+#include "PulsarCore/Async/Generator.hpp"
+#include "PulsarCore/Async/Task.hpp"
+#include "PulsarCore/Async/WhenAll.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Pulsar;
+
+namespace {
+    Task<int> value(int result) {
+        co_return result;
+    }
+
+    Task<int> add(int a, int b) {
+        const int first  = co_await value(a);
+        const int second = co_await value(b);
+        co_return first + second;
+    }
+
+    Task<int> fail() {
+        throw std::runtime_error("failed");
+        co_return 0;
+    }
+
+    Task<int> on_pool(ThreadPoolExecutor& pool, int result, std::thread::id& ranOn) {
+        co_await pool.schedule();
+        ranOn = std::this_thread::get_id();
+        co_return result;
+    }
+
+    Generator<int> count_to(int last) {
+        for (int i = 1; i <= last; i++) {
+            co_yield i;
+        }
+    }
+} // namespace
+
+TEST(Task, StartsLazilyAndChains) {
+    bool started = false;
+    // Captures live in the lambda, which has to outlive the task
+    auto body = [&started]() -> Task<int> {
+        started = true;
+        co_return co_await add(2, 3);
+    };
+    auto task = body();
+    EXPECT_FALSE(started);
+    EXPECT_EQ(sync_wait(std::move(task)), 5);
+    EXPECT_TRUE(started);
+}
+
+TEST(Task, PropagatesExceptions) {
+    auto outer = []() -> Task<std::string> {
+        try {
+            co_await fail();
+        }
+        catch (const std::runtime_error& error) {
+            co_return error.what();
+        }
+        co_return "no exception";
+    };
+    EXPECT_EQ(sync_wait(outer()), "failed");
+    EXPECT_THROW(sync_wait(fail()), std::runtime_error);
+}
+
+TEST(Task, DeepSynchronousChainsDontGrowTheStack) {
+    struct Recurse_t {
+        static Task<int> depth(int n) {
+            if (n == 0) {
+                co_return 0;
+            }
+            co_return co_await depth(n - 1) + 1;
+        }
+    };
+    EXPECT_EQ(sync_wait(Recurse_t::depth(100000)), 100000);
+}
+
+TEST(Executor, ThreadPoolResumesOnWorkers) {
+    ThreadPoolExecutor pool(2);
+    std::thread::id    ranOn;
+    EXPECT_EQ(sync_wait(on_pool(pool, 7, ranOn)), 7);
+    EXPECT_NE(ranOn, std::this_thread::get_id());
+    EXPECT_EQ(pool.thread_count(), 2u);
+}
+
+TEST(Executor, MainThreadRunsOnlyWhenPumped) {
+    MainThreadExecutor main;
+    std::atomic<int>   step {0};
+    auto               task = [&]() -> Task<void> {
+        step = 1;
+        co_await main.schedule();
+        step = 2;
+    };
+    spawn(main, task());
+    EXPECT_EQ(step.load(), 0);
+    // The first pump starts the task, which queues itself again
+    EXPECT_EQ(main.run_pending(), 1u);
+    EXPECT_EQ(step.load(), 1);
+    EXPECT_EQ(main.run_pending(), 1u);
+    EXPECT_EQ(step.load(), 2);
+    EXPECT_EQ(main.run_pending(), 0u);
+}
+
+TEST(Executor, ScheduleThrowsOnceCancelled) {
+    MainThreadExecutor main;
+    CancellationSource source;
+    bool               cancelled = false;
+    auto               task      = [&]() -> Task<void> {
+        try {
+            co_await main.schedule(source.token());
+        }
+        catch (const TaskCancelled&) {
+            cancelled = true;
+        }
+    };
+    spawn(main, task());
+    main.run_pending();
+    EXPECT_TRUE(source.cancel());
+    EXPECT_FALSE(source.cancel());
+    main.run_pending();
+    EXPECT_TRUE(cancelled);
+}
+
+TEST(WhenAll, CollectsResultsInOrder) {
+    ThreadPoolExecutor           pool(4);
+    std::vector<std::thread::id> threads(16);
+    std::vector<Task<int>>       tasks;
+    for (int i = 0; i < 16; i++) {
+        tasks.push_back(on_pool(pool, i * i, threads[i]));
+    }
+    const auto results = sync_wait(when_all(std::move(tasks)));
+    ASSERT_EQ(results.size(), 16u);
+    for (int i = 0; i < 16; i++) {
+        EXPECT_EQ(results[i], i * i);
+    }
+    EXPECT_EQ(sync_wait(when_all(std::vector<Task<int>> {})).size(), 0u);
+}
+
+TEST(WhenAll, MixesTypes) {
+    std::atomic<int> sideEffect {0};
+    auto             effect = [&]() -> Task<void> {
+        sideEffect = 1;
+        co_return;
+    };
+    auto [number, text, nothing] = sync_wait(when_all(
+        value(3), []() -> Task<std::string> { co_return "text"; }(), effect()));
+    EXPECT_EQ(number, 3);
+    EXPECT_EQ(text, "text");
+    EXPECT_EQ(sideEffect.load(), 1);
+    static_cast<void>(nothing);
+}
+
+TEST(WhenAll, RethrowsAfterAllFinished) {
+    std::vector<Task<int>> tasks;
+    tasks.push_back(value(1));
+    tasks.push_back(fail());
+    tasks.push_back(value(3));
+    EXPECT_THROW(sync_wait(when_all(std::move(tasks))), std::runtime_error);
+}
+
+TEST(WhenAny, ReturnsTheFirstAndCancelsTheRest) {
+    ThreadPoolExecutor pool(2);
+    CancellationSource source;
+    std::atomic<int>   started {0};
+    std::atomic<int>   stopped {0};
+    auto               slow = [&](CancellationToken token) -> Task<int> {
+        started++;
+        co_await pool.schedule();
+        while (!token.is_cancelled()) {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+        stopped++;
+        co_return -1;
+    };
+    auto fast = [&]() -> Task<int> {
+        co_await pool.schedule();
+        co_return 42;
+    };
+    std::vector<Task<int>> tasks;
+    tasks.push_back(slow(source.token()));
+    tasks.push_back(fast());
+    tasks.push_back(slow(source.token()));
+    const auto result = sync_wait(when_any(std::move(tasks), source));
+    EXPECT_EQ(result.m_Index, 1u);
+    EXPECT_EQ(result.m_Value, 42);
+    EXPECT_TRUE(source.is_cancelled());
+    // The losers that started finish in the background, the last one may not have started
+    while (stopped.load() != started.load()) {
+        std::this_thread::yield();
+    }
+}
+
+TEST(WhenAny, SynchronousWinnerSkipsTheRest) {
+    bool started = false;
+    auto never   = [&]() -> Task<void> {
+        started = true;
+        co_return;
+    };
+    std::vector<Task<void>> tasks;
+    tasks.push_back([]() -> Task<void> { co_return; }());
+    tasks.push_back(never());
+    EXPECT_EQ(sync_wait(when_any(std::move(tasks))), 0u);
+    EXPECT_FALSE(started);
+}
+
+TEST(Generator, YieldsInOrder) {
+    std::vector<int> values;
+    for (const int value : count_to(5)) {
+        values.push_back(value);
+    }
+    EXPECT_EQ(values, (std::vector<int> {1, 2, 3, 4, 5}));
+
+    int sum = 0;
+    for (const int value : count_to(0)) {
+        sum += value;
+    }
+    EXPECT_EQ(sum, 0);
+}
+
+TEST(Generator, RethrowsFromTheIncrement) {
+    auto generator = []() -> Generator<int> {
+        co_yield 1;
+        throw std::runtime_error("generator failed");
+    }();
+    auto it = generator.begin();
+    EXPECT_EQ(*it, 1);
+    EXPECT_THROW(++it, std::runtime_error);
+}
+
+TEST(FramePool, ReusesFramesAcrossThreads) {
+    // Frames created on the pool's threads and freed on this one, and the other way round
+    ThreadPoolExecutor pool(2);
+    for (int round = 0; round < 100; round++) {
+        std::vector<std::thread::id> threads(8);
+        std::vector<Task<int>>       tasks;
+        for (int i = 0; i < 8; i++) {
+            tasks.push_back(on_pool(pool, i, threads[i]));
+        }
+        const auto results = sync_wait(when_all(std::move(tasks)));
+        EXPECT_EQ(results.back(), 7);
+    }
+}
+// NOLINTEND(*)
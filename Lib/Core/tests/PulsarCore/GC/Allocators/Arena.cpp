@@ -78,6 +78,27 @@ TEST_F(ArenaAllocatorTest, ScopedPointerWithArena) {
     EXPECT_EQ(TestObject_t::s_Destructions, 1);
 }
 
+// A moved-from Scoped no longer has a usable arena, it must not touch it
+TEST_F(ArenaAllocatorTest, MovedFromScopedWithArena) {
+    {
+        auto first  = make_scoped<TestObject_t, ArenaAllocator<TestObject_t>>(42);
+        auto second = std::move(first);
+        EXPECT_EQ(second->m_value, 42);
+    }
+    EXPECT_EQ(TestObject_t::s_Constructions, 1);
+    EXPECT_EQ(TestObject_t::s_Destructions, 1);
+}
+
+// Copying a Ref shares the arena instead of creating a new one
+TEST_F(ArenaAllocatorTest, CopiedRefSharesArena) {
+    ArenaAllocator<TestObject_t> alloc(1024);
+    auto ref  = make_ref_with_allocator<TestObject_t>(alloc, 42);
+    auto copy = ref;
+    EXPECT_EQ(copy->m_value, 42);
+    EXPECT_EQ(ref.strong_ref_count(), 2);
+    EXPECT_EQ(alloc.used_size(), sizeof(TestObject_t) + sizeof(RefCount_t));
+}
+
 // Test Ref pointer with ArenaAllocator
 TEST_F(ArenaAllocatorTest, RefPointerWithArena) {
     Weak<TestObject_t, ArenaAllocator<TestObject_t>> weak;
@@ -0,0 +1,58 @@
+// NOLINTBEGIN(*)
+#include "PulsarCore/GC/Allocators/Frame.hpp"
+
+#include <cstdint>
+#include <gtest/gtest.h>
+
+using namespace Pulsar;
+using namespace Pulsar::GC;
+
+TEST(FrameAllocator, BumpsWithinABlock) {
+    FrameAllocator frame(1024);
+    auto*          first  = static_cast<std::byte*>(frame.allocate(16, 8));
+    auto*          second = static_cast<std::byte*>(frame.allocate(16, 8));
+    EXPECT_EQ(second, first + 16);
+    EXPECT_EQ(frame.used_size(), 32u);
+    EXPECT_EQ(frame.reserved_size(), 1024u);
+}
+
+TEST(FrameAllocator, RespectsAlignment) {
+    FrameAllocator frame(1024);
+    PULSAR_IGNORE_RESULT(frame.allocate(1, 1));
+    for (usize alignment : {2, 8, 64, 256}) {
+        void* ptr = frame.allocate(3, alignment);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % alignment, 0u) << alignment;
+    }
+}
+
+TEST(FrameAllocator, GrowsAndReusesBlocksAfterReset) {
+    FrameAllocator frame(256);
+    for (int i = 0; i < 10; i++) {
+        PULSAR_IGNORE_RESULT(frame.allocate(100));
+    }
+    // Larger than a block, gets one of its own
+    PULSAR_IGNORE_RESULT(frame.allocate(1000));
+    const usize reserved = frame.reserved_size();
+    EXPECT_GE(reserved, 1000u + 5 * 256u);
+
+    frame.reset();
+    EXPECT_EQ(frame.used_size(), 0u);
+    for (int i = 0; i < 10; i++) {
+        PULSAR_IGNORE_RESULT(frame.allocate(100));
+    }
+    PULSAR_IGNORE_RESULT(frame.allocate(1000));
+    EXPECT_EQ(frame.reserved_size(), reserved);
+}
+
+TEST(FrameAllocator, CreatesObjects) {
+    struct Pair_t {
+        alignas(32) int m_First;
+        int m_Second;
+    };
+    FrameAllocator frame;
+    Pair_t*        pair = frame.create<Pair_t>(1, 2);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(pair) % 32, 0u);
+    EXPECT_EQ(pair->m_First, 1);
+    EXPECT_EQ(pair->m_Second, 2);
+}
+// NOLINTEND(*)
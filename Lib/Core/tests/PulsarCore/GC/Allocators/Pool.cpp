@@ -0,0 +1,50 @@
+// NOLINTBEGIN(*)
+#include "PulsarCore/GC/Allocators/Pool.hpp"
+
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <set>
+#include <vector>
+
+using namespace Pulsar;
+using namespace Pulsar::GC;
+
+TEST(PoolAllocator, RoundsBlocksUpToTheAlignment) {
+    PoolAllocator pool(20);
+    EXPECT_EQ(pool.block_size() % alignof(std::max_align_t), 0u);
+    EXPECT_GE(pool.block_size(), 20u);
+    for (int i = 0; i < 10; i++) {
+        void* ptr = pool.allocate();
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % alignof(std::max_align_t), 0u);
+    }
+}
+
+TEST(PoolAllocator, HandsOutDistinctBlocksAcrossChunks) {
+    PoolAllocator      pool(64, 8);
+    std::set<void*>    seen;
+    std::vector<void*> blocks;
+    for (int i = 0; i < 100; i++) {
+        blocks.push_back(pool.allocate());
+        EXPECT_TRUE(seen.insert(blocks.back()).second);
+    }
+    EXPECT_EQ(pool.used_count(), 100u);
+    EXPECT_EQ(pool.reserved_size(), 13u * 8u * 64u);
+}
+
+TEST(PoolAllocator, ReusesFreedBlocks) {
+    PoolAllocator pool(32, 4);
+    void*         first  = pool.allocate();
+    void*         second = pool.allocate();
+    pool.deallocate(first);
+    pool.deallocate(second);
+    EXPECT_EQ(pool.used_count(), 0u);
+    // Last freed comes back first
+    EXPECT_EQ(pool.allocate(), second);
+    EXPECT_EQ(pool.allocate(), first);
+    const usize reserved = pool.reserved_size();
+    for (int i = 0; i < 2; i++) {
+        PULSAR_IGNORE_RESULT(pool.allocate());
+    }
+    EXPECT_EQ(pool.reserved_size(), reserved);
+}
+// NOLINTEND(*)
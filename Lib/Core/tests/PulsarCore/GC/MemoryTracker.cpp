@@ -0,0 +1,203 @@
+// NOLINTBEGIN(*)
+#include "PulsarCore/GC/MemoryTracker.hpp"
+
+#include "PulsarCore/GC/Allocators/Arena.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <memory>
+#include <new>
+#include <thread>
+
+using namespace Pulsar;
+using namespace Pulsar::GC;
+
+TEST(MemoryTracker, IgnoresReportsWhileDisabled) {
+    MemoryTracker::disable();
+    const auto before = MemoryTracker::snapshot();
+    EXPECT_EQ(MemoryTracker::on_allocate(MemorySource::Arena, MemoryTag::Window, 64), 0u);
+    MemoryTracker::on_deallocate(MemorySource::Arena, MemoryTag::Window, 64);
+    const auto delta = diff(before, MemoryTracker::snapshot());
+    EXPECT_EQ(delta.get(MemorySource::Arena, MemoryTag::Window).m_Allocations, 0u);
+    EXPECT_EQ(delta.get(MemorySource::Arena, MemoryTag::Window).m_Frees, 0u);
+}
+
+TEST(MemoryTracker, CountsPerSourceAndTag) {
+    MemoryTracker::enable();
+    const auto before = MemoryTracker::snapshot();
+    for (int i = 0; i < 3; i++) {
+        MemoryTracker::on_allocate(MemorySource::Arena, MemoryTag::Window, 100);
+    }
+    MemoryTracker::on_allocate(MemorySource::Arena, MemoryTag::Renderer, 5000);
+    MemoryTracker::on_deallocate(MemorySource::Arena, MemoryTag::Window, 100);
+    const auto delta = diff(before, MemoryTracker::snapshot());
+    MemoryTracker::on_deallocate(MemorySource::Arena, MemoryTag::Window, 200);
+    MemoryTracker::on_deallocate(MemorySource::Arena, MemoryTag::Renderer, 5000);
+    MemoryTracker::disable();
+
+    const MemoryStats_t& window = delta.get(MemorySource::Arena, MemoryTag::Window);
+    EXPECT_EQ(window.m_Allocations, 3u);
+    EXPECT_EQ(window.m_Frees, 1u);
+    EXPECT_EQ(window.m_AllocatedBytes, 300u);
+    EXPECT_EQ(window.live_bytes(), 200);
+    EXPECT_EQ(window.live_count(), 2);
+    // 100 has a bit width of 7
+    EXPECT_EQ(window.m_SizeHistogram[7], 3u);
+
+    const MemoryStats_t& renderer = delta.get(MemorySource::Arena, MemoryTag::Renderer);
+    EXPECT_EQ(renderer.m_Allocations, 1u);
+    EXPECT_EQ(renderer.m_SizeHistogram[13], 1u);
+    EXPECT_EQ(delta.total(MemorySource::Arena).m_AllocatedBytes, 5300u);
+}
+
+TEST(MemoryTracker, KeepsThePeak) {
+    MemoryTracker::enable({.m_SampleInterval = 0});
+    constexpr usize SIZE = MemoryTracker::PEAK_GRANULARITY;
+    for (int i = 0; i < 4; i++) {
+        MemoryTracker::on_allocate(MemorySource::Arena, MemoryTag::Editor, SIZE);
+    }
+    for (int i = 0; i < 4; i++) {
+        MemoryTracker::on_deallocate(MemorySource::Arena, MemoryTag::Editor, SIZE);
+    }
+    const auto snapshot = MemoryTracker::snapshot();
+    MemoryTracker::disable();
+
+    const MemoryStats_t& editor = snapshot.get(MemorySource::Arena, MemoryTag::Editor);
+    EXPECT_EQ(editor.live_bytes(), 0);
+    EXPECT_GE(editor.m_PeakBytes, 4 * SIZE);
+}
+
+TEST(MemoryTracker, CountsExitedThreads) {
+    MemoryTracker::enable();
+    const auto before = MemoryTracker::snapshot();
+    std::thread([] {
+        for (int i = 0; i < 10; i++) {
+            MemoryTracker::on_allocate(MemorySource::Arena, MemoryTag::Core, 16);
+        }
+    }).join();
+    const auto delta = diff(before, MemoryTracker::snapshot());
+    MemoryTracker::disable();
+
+    EXPECT_EQ(delta.get(MemorySource::Arena, MemoryTag::Core).m_Allocations, 10u);
+    EXPECT_EQ(delta.get(MemorySource::Arena, MemoryTag::Core).m_AllocatedBytes, 160u);
+}
+
+#if __has_include(<execinfo.h>)
+TEST(MemoryTracker, SamplesCallstacks) {
+    MemoryTracker::enable({.m_SampleInterval = 1});
+    const u32 stack = MemoryTracker::on_allocate(MemorySource::Arena, MemoryTag::Log, 48);
+    ASSERT_NE(stack, 0u);
+    const auto allocated = MemoryTracker::snapshot();
+    MemoryTracker::on_deallocate(MemorySource::Arena, MemoryTag::Log, 48, stack);
+    const auto freed = MemoryTracker::snapshot();
+    MemoryTracker::disable();
+
+    const auto is_log = [](const MemoryStackStats_t& entry) {
+        return entry.m_Source == MemorySource::Arena && entry.m_Tag == MemoryTag::Log;
+    };
+    const auto found = std::find_if(allocated.m_Stacks.begin(), allocated.m_Stacks.end(), is_log);
+    ASSERT_NE(found, allocated.m_Stacks.end());
+    EXPECT_FALSE(found->m_Frames.empty());
+    EXPECT_GE(found->m_Samples, 1u);
+    EXPECT_GE(found->m_LiveBytes, 48);
+
+    const auto delta   = diff(allocated, freed);
+    const auto changed = std::find_if(delta.m_Stacks.begin(), delta.m_Stacks.end(), is_log);
+    ASSERT_NE(changed, delta.m_Stacks.end());
+    EXPECT_EQ(changed->m_Samples, 0u);
+    EXPECT_EQ(changed->m_LiveBytes, -48);
+
+    const std::string json = MemoryTracker::to_json(allocated);
+    EXPECT_NE(json.find(R"("source":"Arena","tag":"Log","samples":)"), std::string::npos);
+}
+#endif
+
+TEST(MemoryTracker, FrameHistogram) {
+    MemoryTracker::enable();
+    const auto before = MemoryTracker::snapshot();
+    MemoryTracker::end_frame();
+    for (int i = 0; i < 100; i++) {
+        MemoryTracker::on_allocate(MemorySource::Arena, MemoryTag::Engine, 8);
+    }
+    MemoryTracker::end_frame();
+    const auto delta = diff(before, MemoryTracker::snapshot());
+    MemoryTracker::disable();
+
+    EXPECT_EQ(delta.m_Frame, 2u);
+    u64 frames = 0;
+    u64 large  = 0;
+    for (usize i = 0; i < MEMORY_HISTOGRAM_BUCKETS; i++) {
+        frames += delta.m_FrameAllocations[i];
+        // At least the 100 allocations, which have a bit width of 7
+        large += i >= 7 ? delta.m_FrameAllocations[i] : 0;
+    }
+    EXPECT_EQ(frames, 2u);
+    EXPECT_EQ(large, 1u);
+}
+
+TEST(MemoryTracker, ExportsJson) {
+    MemoryTracker::enable();
+    MemoryTracker::on_allocate(MemorySource::Arena, MemoryTag::Window, 1);
+    const std::string json = MemoryTracker::to_json(MemoryTracker::snapshot());
+    MemoryTracker::on_deallocate(MemorySource::Arena, MemoryTag::Window, 1);
+    MemoryTracker::disable();
+
+    EXPECT_EQ(json.front(), '{');
+    EXPECT_NE(json.find(R"({"source":"Arena","tag":"Window","allocations":)"), std::string::npos);
+    EXPECT_NE(json.find(R"("frame_allocations":[)"), std::string::npos);
+}
+
+TEST(MemoryTracker, ArenaReportsItsTag) {
+    if constexpr (!MemoryTracker::COMPILED_IN) {
+        GTEST_SKIP() << "Built without PULSAR_MEMORY_TRACKING";
+    }
+    ArenaAllocator<int> arena(1024, MemoryTag::Renderer);
+    MemoryTracker::enable();
+    const auto before = MemoryTracker::snapshot();
+    int*       values = arena.allocate(4);
+    arena.deallocate(values, 4);
+    const auto delta = diff(before, MemoryTracker::snapshot());
+    MemoryTracker::disable();
+
+    EXPECT_EQ(delta.get(MemorySource::Arena, MemoryTag::Renderer).m_AllocatedBytes, 16u);
+    EXPECT_EQ(delta.get(MemorySource::Arena, MemoryTag::Renderer).m_FreedBytes, 16u);
+}
+
+#ifdef PULSAR_MEMORY_TRACKING
+TEST(MemoryTracker, HeapAllocationsUseTheScopeTag) {
+    MemoryTracker::enable();
+    const auto before = MemoryTracker::snapshot();
+    {
+        const MemoryTagScope scope(MemoryTag::Engine);
+        auto                 buffer = std::make_unique<std::array<char, 1000>>();
+        EXPECT_NE(buffer, nullptr);
+    }
+    const auto delta = diff(before, MemoryTracker::snapshot());
+    MemoryTracker::disable();
+
+    const MemoryStats_t& engine = delta.get(MemorySource::Heap, MemoryTag::Engine);
+    EXPECT_GE(engine.m_Allocations, 1u);
+    EXPECT_GE(engine.m_AllocatedBytes, 1000u);
+    EXPECT_EQ(engine.live_bytes(), 0);
+    EXPECT_EQ(MemoryTracker::current_tag(), MemoryTag::General);
+}
+
+TEST(MemoryTracker, HeapAllocationsWithLargeAlignments) {
+    constexpr usize ALIGNMENT = usize {128} * 1024;
+    MemoryTracker::enable();
+    const auto before = MemoryTracker::snapshot();
+    {
+        const MemoryTagScope scope(MemoryTag::Engine);
+        void*                block = ::operator new(100, std::align_val_t {ALIGNMENT});
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(block) % ALIGNMENT, 0u);
+        ::operator delete(block, std::align_val_t {ALIGNMENT});
+    }
+    const auto delta = diff(before, MemoryTracker::snapshot());
+    MemoryTracker::disable();
+
+    EXPECT_EQ(delta.get(MemorySource::Heap, MemoryTag::Engine).live_bytes(), 0);
+}
+#endif
+// NOLINTEND(*)
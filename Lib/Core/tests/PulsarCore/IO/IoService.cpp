@@ -0,0 +1,276 @@
+// NOLINTBEGIN(*)
+#include "PulsarCore/Async/Task.hpp"
+#include "PulsarCore/IO/IoService.hpp"
+
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <latch>
+#include <memory>
+#include <mutex>
+#include <unistd.h>
+#include <vector>
+
+using namespace Pulsar;
+
+namespace {
+    constexpr usize FILE_SIZE = 256 * 1024;
+
+    std::byte expected_byte(u64 offset) {
+        return std::byte(u8(offset * 7 + offset / 251));
+    }
+
+    /// A temp file with a known pattern, opened for reading
+    struct TempFile_t {
+        std::filesystem::path m_Path;
+        int                   m_Fd = -1;
+
+        explicit TempFile_t(const char* name)
+            : m_Path(std::filesystem::temp_directory_path() / name) {
+            std::vector<std::byte> data(FILE_SIZE);
+            for (usize i = 0; i < FILE_SIZE; i++) {
+                data[i] = expected_byte(i);
+            }
+            {
+                std::ofstream out(m_Path, std::ios::binary);
+                out.write(reinterpret_cast<const char*>(data.data()), std::streamsize(data.size()));
+            }
+            m_Fd = ::open(m_Path.c_str(), O_RDONLY);
+        }
+
+        ~TempFile_t() {
+            ::close(m_Fd);
+            std::filesystem::remove(m_Path);
+        }
+    };
+
+    bool matches(std::span<const std::byte> data, u64 offset) {
+        for (usize i = 0; i < data.size(); i++) {
+            if (data[i] != expected_byte(offset + i)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// One service per backend that works here, io_uring may be missing in containers
+    std::vector<std::unique_ptr<IoService>> services(u32 queueDepth) {
+        std::vector<std::unique_ptr<IoService>> result;
+        for (const IoBackend backend : {IoBackend::IoUring, IoBackend::ThreadPool}) {
+            auto service = IoService::create({.m_Backend = backend, .m_QueueDepth = queueDepth});
+            if (service.has_value()) {
+                result.push_back(std::move(*service));
+            }
+        }
+        return result;
+    }
+
+    const char* backend_name(const IoService& service) {
+        return service.backend() == IoBackend::IoUring ? "io_uring" : "thread pool";
+    }
+
+    /// Records completions in order, counts down `m_Done` for each
+    struct Recorder_t {
+        std::mutex                  m_Mutex;
+        std::vector<IoCompletion_t> m_Completions;
+        std::latch                  m_Done;
+
+        explicit Recorder_t(std::ptrdiff_t count) : m_Done(count) {
+        }
+
+        static void record(const IoCompletion_t& completion) {
+            auto* self = static_cast<Recorder_t*>(completion.m_Context);
+            {
+                std::lock_guard lock(self->m_Mutex);
+                self->m_Completions.push_back(completion);
+            }
+            self->m_Done.count_down();
+        }
+    };
+
+    Task<usize> read_async(
+        IoService& service, IoFile_t file, u64 offset, std::span<std::byte> buffer,
+        CancellationToken token = {}) {
+        auto result = co_await service.read(file, offset, buffer, IoPriority::Normal, token);
+        co_return result.value_or(0);
+    }
+} // namespace
+
+TEST(IoService, BatchedReads) {
+    const TempFile_t file("pulsar_io_batched.bin");
+    for (const auto& service : services(8)) {
+        SCOPED_TRACE(backend_name(*service));
+        constexpr usize                     COUNT = 64;
+        std::vector<std::vector<std::byte>> buffers(COUNT, std::vector<std::byte>(1000));
+        std::vector<IoRead_t>               reads;
+        Recorder_t                          recorder(COUNT + 1);
+        for (usize i = 0; i < COUNT; i++) {
+            reads.push_back({.m_File = {.m_Fd = file.m_Fd}, .m_Offset = i * 3001,
+                .m_Buffer = buffers[i], .m_Callback = &Recorder_t::record,
+                .m_Context = &recorder});
+        }
+        // Past the end of the file: a short read
+        std::vector<std::byte> tail(100);
+        reads.push_back({.m_File = {.m_Fd = file.m_Fd}, .m_Offset = FILE_SIZE - 10,
+            .m_Buffer = tail, .m_Callback = &Recorder_t::record, .m_Context = &recorder});
+
+        const u64 first = service->submit(reads);
+        recorder.m_Done.wait();
+        ASSERT_EQ(recorder.m_Completions.size(), COUNT + 1);
+        for (const IoCompletion_t& completion : recorder.m_Completions) {
+            const u64 index = completion.m_Id - first;
+            if (index == COUNT) {
+                EXPECT_EQ(completion.m_Result, 10);
+                EXPECT_TRUE(matches(std::span(tail).first(10), FILE_SIZE - 10));
+                continue;
+            }
+            ASSERT_LT(index, COUNT);
+            EXPECT_EQ(completion.m_Result, 1000);
+            EXPECT_TRUE(matches(buffers[index], index * 3001));
+        }
+    }
+}
+
+TEST(IoService, Awaitable) {
+    const TempFile_t file("pulsar_io_awaitable.bin");
+    for (const auto& service : services(4)) {
+        SCOPED_TRACE(backend_name(*service));
+        std::vector<std::byte> buffer(4096);
+        EXPECT_EQ(sync_wait(read_async(*service, {.m_Fd = file.m_Fd}, 8192, buffer)), 4096u);
+        EXPECT_TRUE(matches(buffer, 8192));
+
+        // A bad descriptor fails the read instead of throwing
+        EXPECT_EQ(sync_wait(read_async(*service, {.m_Fd = -1}, 0, buffer)), 0u);
+    }
+}
+
+TEST(IoService, RegisteredFilesAndBuffers) {
+    const TempFile_t file("pulsar_io_registered.bin");
+    for (const auto& service : services(4)) {
+        SCOPED_TRACE(backend_name(*service));
+        const int  fds[] = {file.m_Fd};
+        const auto files = service->register_files(fds);
+        ASSERT_TRUE(files.has_value()) << files.error();
+        ASSERT_EQ(files->size(), 1u);
+        EXPECT_FALSE(service->register_files(fds).has_value());
+
+        // One registered arena, reads go into slices of it
+        std::vector<std::byte>     arena(64 * 1024);
+        const std::span<std::byte> registered[] = {arena};
+        const auto                 ok           = service->register_buffers(registered);
+        ASSERT_TRUE(ok.has_value()) << ok.error();
+
+        Recorder_t            recorder(16);
+        std::vector<IoRead_t> reads;
+        for (usize i = 0; i < 16; i++) {
+            reads.push_back({.m_File = (*files)[0], .m_Offset = i * 4096 + 17,
+                .m_Buffer = std::span(arena).subspan(i * 4096, 4096), .m_BufferIndex = 0,
+                .m_Callback = &Recorder_t::record, .m_Context = &recorder});
+        }
+        service->submit(reads);
+        recorder.m_Done.wait();
+        for (const IoCompletion_t& completion : recorder.m_Completions) {
+            EXPECT_EQ(completion.m_Result, 4096);
+        }
+        for (usize i = 0; i < 16; i++) {
+            EXPECT_TRUE(matches(std::span(arena).subspan(i * 4096, 4096), i * 4096 + 17));
+        }
+    }
+}
+
+TEST(IoService, PriorityOrder) {
+    const TempFile_t file("pulsar_io_priority.bin");
+    for (const auto& service : services(1)) {
+        SCOPED_TRACE(backend_name(*service));
+        std::vector<std::byte> buffer(512);
+        Recorder_t             recorder(6);
+        std::vector<IoRead_t>  reads;
+        for (const IoPriority priority : {IoPriority::Low, IoPriority::Normal, IoPriority::High,
+                 IoPriority::Low, IoPriority::High, IoPriority::Normal}) {
+            reads.push_back({.m_File = {.m_Fd = file.m_Fd}, .m_Buffer = buffer,
+                .m_Priority = priority, .m_Callback = &Recorder_t::record,
+                .m_Context = &recorder});
+        }
+        // One batch: everything is queued before the first read starts
+        const u64 first = service->submit(reads);
+        recorder.m_Done.wait();
+        std::vector<u64> order;
+        for (const IoCompletion_t& completion : recorder.m_Completions) {
+            order.push_back(completion.m_Id - first);
+        }
+        EXPECT_EQ(order, (std::vector<u64> {2, 4, 1, 5, 0, 3}));
+    }
+}
+
+TEST(IoService, Cancellation) {
+    const TempFile_t file("pulsar_io_cancel.bin");
+    for (const auto& service : services(1)) {
+        SCOPED_TRACE(backend_name(*service));
+        // The first callback holds the only I/O slot until released, so the rest stay queued
+        struct Blocker_t {
+            std::atomic<bool> m_Release = false;
+            std::latch        m_Started {1};
+
+            static void block(const IoCompletion_t& completion) {
+                auto* self = static_cast<Blocker_t*>(completion.m_Context);
+                self->m_Started.count_down();
+                self->m_Release.wait(false);
+            }
+        } blocker;
+        std::vector<std::byte> buffer(512);
+        Recorder_t             recorder(2);
+        const IoRead_t         blocking = {.m_File = {.m_Fd = file.m_Fd}, .m_Buffer = buffer,
+                    .m_Callback = &Blocker_t::block, .m_Context = &blocker};
+        const IoRead_t         recorded = {.m_File = {.m_Fd = file.m_Fd}, .m_Buffer = buffer,
+                    .m_Callback = &Recorder_t::record, .m_Context = &recorder};
+        service->submit(blocking);
+        blocker.m_Started.wait();
+        const u64 cancelled = service->submit(recorded);
+        const u64 finished  = service->submit(recorded);
+
+        EXPECT_TRUE(service->cancel(cancelled));
+        EXPECT_FALSE(service->cancel(cancelled));
+        blocker.m_Release = true;
+        blocker.m_Release.notify_all();
+        recorder.m_Done.wait();
+        ASSERT_EQ(recorder.m_Completions.size(), 2u);
+        EXPECT_EQ(recorder.m_Completions[0].m_Id, cancelled);
+        EXPECT_EQ(recorder.m_Completions[0].m_Result, -ECANCELED);
+        EXPECT_EQ(recorder.m_Completions[1].m_Id, finished);
+        EXPECT_EQ(recorder.m_Completions[1].m_Result, 512);
+
+        // A cancelled token fails the awaiting task
+        CancellationSource source;
+        source.cancel();
+        EXPECT_THROW(sync_wait(read_async(*service, {.m_Fd = file.m_Fd}, 0, buffer,
+                         source.token())),
+            TaskCancelled);
+    }
+}
+
+TEST(IoService, DestroyWithQueuedReads) {
+    const TempFile_t file("pulsar_io_destroy.bin");
+    for (auto& service : services(2)) {
+        SCOPED_TRACE(backend_name(*service));
+        std::vector<std::vector<std::byte>> buffers(256, std::vector<std::byte>(4096));
+        std::vector<IoRead_t>               reads;
+        Recorder_t                          recorder(256);
+        for (usize i = 0; i < 256; i++) {
+            reads.push_back({.m_File = {.m_Fd = file.m_Fd}, .m_Offset = (i * 4096) % FILE_SIZE,
+                .m_Buffer = buffers[i], .m_Callback = &Recorder_t::record,
+                .m_Context = &recorder});
+        }
+        service->submit(reads);
+        // Every read completes, finished or cancelled, before the service is gone
+        service.reset();
+        EXPECT_TRUE(recorder.m_Done.try_wait());
+        for (const IoCompletion_t& completion : recorder.m_Completions) {
+            EXPECT_TRUE(completion.m_Result == 4096 || completion.m_Result == -ECANCELED);
+        }
+    }
+}
+// NOLINTEND(*)
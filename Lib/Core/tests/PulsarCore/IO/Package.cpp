@@ -0,0 +1,146 @@
+// NOLINTBEGIN(*)
+#include "PulsarCore/IO/Package.hpp"
+#include "PulsarCore/IO/PackageWriter.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+using namespace Pulsar;
+
+namespace {
+    std::filesystem::path temp_package(const char* name) {
+        return std::filesystem::temp_directory_path() / name;
+    }
+
+    std::vector<std::byte> pattern(usize size, u8 seed) {
+        std::vector<std::byte> data(size);
+        for (usize i = 0; i < size; i++) {
+            data[i] = std::byte(u8(i * 13 + seed));
+        }
+        return data;
+    }
+
+    void corrupt(const std::filesystem::path& path, u64 offset) {
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekg(std::streamoff(offset));
+        char c = 0;
+        file.read(&c, 1);
+        c ^= 0x5a;
+        file.seekp(std::streamoff(offset));
+        file.write(&c, 1);
+    }
+} // namespace
+
+TEST(Package, RoundTrip) {
+    const auto path  = temp_package("pulsar_package_roundtrip.pak");
+    const auto small = pattern(100, 1);
+    const auto large = pattern(PACKAGE_LARGE_BLOB_SIZE + 3, 2);
+    const auto loose = temp_package("pulsar_package_loose.bin");
+    {
+        std::ofstream out(loose, std::ios::binary);
+        out.write(reinterpret_cast<const char*>(small.data()), 50);
+    }
+
+    PackageWriter writer;
+    writer.add("textures/small.bin", small);
+    writer.add("meshes/large.bin", large);
+    writer.add("empty", {});
+    writer.add_file("loose", loose);
+    const auto written = writer.write(path);
+    ASSERT_TRUE(written.has_value()) << written.error();
+    EXPECT_EQ(*written, std::filesystem::file_size(path));
+
+    auto package = Package::open(path);
+    ASSERT_TRUE(package.has_value()) << package.error();
+    EXPECT_EQ(package->entries().size(), 4u);
+    EXPECT_EQ(package->find("missing"), nullptr);
+
+    const PackageEntry_t* smallEntry = package->find("textures/small.bin");
+    ASSERT_NE(smallEntry, nullptr);
+    EXPECT_EQ(package->name(*smallEntry), "textures/small.bin");
+    const auto smallData = package->data(*smallEntry);
+    EXPECT_TRUE(std::ranges::equal(smallData, small));
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(smallData.data()) % PACKAGE_PAGE_ALIGNMENT, 0u);
+    EXPECT_TRUE(package->verify(*smallEntry));
+
+    const PackageEntry_t* largeEntry = package->find("meshes/large.bin");
+    ASSERT_NE(largeEntry, nullptr);
+    const auto largeData = package->data(*largeEntry);
+    EXPECT_TRUE(std::ranges::equal(largeData, large));
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(largeData.data()) % PACKAGE_LARGE_ALIGNMENT, 0u);
+    package->prefetch(*largeEntry);
+    package->release(*largeEntry);
+    // Released pages come back from the file
+    EXPECT_TRUE(package->verify(*largeEntry));
+
+    ASSERT_NE(package->find("empty"), nullptr);
+    EXPECT_TRUE(package->data(*package->find("empty")).empty());
+    ASSERT_NE(package->find("loose"), nullptr);
+    EXPECT_TRUE(std::ranges::equal(
+        package->data(*package->find("loose")), std::span(small).first(50)));
+
+    // The mapping moves with the package
+    Package moved = std::move(*package);
+    EXPECT_TRUE(moved.verify(*moved.find("textures/small.bin")));
+
+    std::filesystem::remove(path);
+    std::filesystem::remove(loose);
+}
+
+TEST(Package, DetectsCorruption) {
+    const auto    path = temp_package("pulsar_package_corrupt.pak");
+    PackageWriter writer;
+    writer.add("a", pattern(5000, 3));
+    writer.add("b", pattern(10, 4));
+    ASSERT_TRUE(writer.write(path).has_value());
+
+    u64 offset    = 0;
+    u64 tocOffset = 0;
+    {
+        auto package = Package::open(path);
+        ASSERT_TRUE(package.has_value());
+        offset    = package->find("a")->m_Offset;
+        tocOffset = package->size_bytes() - 1;
+    }
+    // A damaged blob still opens, `verify` catches it
+    corrupt(path, offset + 4999);
+    {
+        auto package = Package::open(path);
+        ASSERT_TRUE(package.has_value());
+        EXPECT_FALSE(package->verify(*package->find("a")));
+        EXPECT_TRUE(package->verify(*package->find("b")));
+    }
+    // A damaged table of contents does not open at all
+    corrupt(path, tocOffset);
+    EXPECT_FALSE(Package::open(path).has_value());
+    corrupt(path, 0);
+    EXPECT_FALSE(Package::open(path).has_value());
+    std::filesystem::remove(path);
+}
+
+TEST(Package, RejectsDuplicateNames) {
+    const auto    path = temp_package("pulsar_package_duplicate.pak");
+    PackageWriter writer;
+    writer.add("same", pattern(1, 0));
+    writer.add("other", pattern(1, 0));
+    writer.add("same", pattern(2, 0));
+    const auto written = writer.write(path);
+    ASSERT_FALSE(written.has_value());
+    EXPECT_NE(written.error().find("same"), std::string::npos);
+    EXPECT_FALSE(std::filesystem::exists(path));
+}
+
+TEST(Package, RemovesTheTemporaryFileOnFailure) {
+    const auto    path = temp_package("pulsar_package_missing.pak");
+    PackageWriter writer;
+    writer.add("first", pattern(10, 0));
+    writer.add_file("missing", temp_package("pulsar_package_does_not_exist.bin"));
+    const auto written = writer.write(path);
+    ASSERT_FALSE(written.has_value());
+    EXPECT_FALSE(std::filesystem::exists(path));
+    EXPECT_FALSE(std::filesystem::exists(temp_package("pulsar_package_missing.pak.tmp")));
+}
+// NOLINTEND(*)
@@ -0,0 +1,195 @@
+// NOLINTBEGIN(*)
+#include "PulsarCore/Log/AsyncSink.hpp"
+
+#include <atomic>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <spdlog/sinks/base_sink.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Pulsar;
+
+// Collects payloads, and can hold the writer thread inside sink_it_ to fill up the queue
+class CollectingSink : public spdlog::sinks::base_sink<std::mutex> {
+public:
+    std::vector<std::string> messages() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return m_Messages;
+    }
+
+    void close_gate() {
+        m_GateOpen = false;
+    }
+
+    void open_gate() {
+        m_GateOpen = true;
+    }
+
+    void wait_until_writing() {
+        while (!m_Writing) {
+            std::this_thread::yield();
+        }
+    }
+
+protected:
+    void sink_it_(const spdlog::details::log_msg& msg) override {
+        m_Writing = true;
+        while (!m_GateOpen) {
+            std::this_thread::yield();
+        }
+        m_Messages.emplace_back(msg.payload.data(), msg.payload.size());
+    }
+
+    void flush_() override {
+    }
+
+private:
+    std::vector<std::string> m_Messages;
+    std::atomic<bool>        m_GateOpen {true};
+    std::atomic<bool>        m_Writing {false};
+};
+
+TEST(AsyncSink, DeliversEverythingInPerThreadOrder) {
+    auto collector = std::make_shared<CollectingSink>();
+    auto sink      = std::make_shared<AsyncSink>(
+        std::vector<spdlog::sink_ptr> {collector}, 16, LogOverflowPolicy::Block);
+    spdlog::logger logger("test", sink);
+
+    constexpr int            kThreads  = 4;
+    constexpr int            kMessages = 2000;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; t++) {
+        threads.emplace_back([&logger, t] {
+            for (int i = 0; i < kMessages; i++) {
+                logger.info("{} {}", t, i);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    logger.flush();
+
+    const auto messages = collector->messages();
+    ASSERT_EQ(messages.size(), size_t(kThreads * kMessages));
+    EXPECT_EQ(sink->dropped_count(), 0U);
+
+    std::vector<int> next(kThreads, 0);
+    for (const auto& message : messages) {
+        int t = 0;
+        int i = 0;
+        ASSERT_EQ(std::sscanf(message.c_str(), "%d %d", &t, &i), 2);
+        EXPECT_EQ(i, next[t]) << "thread " << t << " out of order";
+        next[t] = i + 1;
+    }
+}
+
+TEST(AsyncSink, DropPolicyDiscardsNewRecords) {
+    auto collector = std::make_shared<CollectingSink>();
+    auto sink      = std::make_shared<AsyncSink>(
+        std::vector<spdlog::sink_ptr> {collector}, 4, LogOverflowPolicy::Drop);
+    spdlog::logger logger("test", sink);
+
+    collector->close_gate();
+    logger.info("0");
+    collector->wait_until_writing();
+    for (int i = 1; i < 20; i++) {
+        logger.info("{}", i);
+    }
+    // The writer holds record 0, the queue holds 1..4, everything after that is dropped
+    EXPECT_EQ(sink->dropped_count(), 15U);
+    collector->open_gate();
+    logger.flush();
+
+    const std::vector<std::string> expected = {"0", "1", "2", "3", "4"};
+    EXPECT_EQ(collector->messages(), expected);
+}
+
+TEST(AsyncSink, OverwritePolicyKeepsNewestRecords) {
+    auto collector = std::make_shared<CollectingSink>();
+    auto sink      = std::make_shared<AsyncSink>(
+        std::vector<spdlog::sink_ptr> {collector}, 4, LogOverflowPolicy::OverwriteOldest);
+    spdlog::logger logger("test", sink);
+
+    collector->close_gate();
+    logger.info("0");
+    collector->wait_until_writing();
+    for (int i = 1; i < 20; i++) {
+        logger.info("{}", i);
+    }
+    EXPECT_EQ(sink->dropped_count(), 15U);
+    collector->open_gate();
+    logger.flush();
+
+    const std::vector<std::string> expected = {"0", "16", "17", "18", "19"};
+    EXPECT_EQ(collector->messages(), expected);
+}
+
+TEST(AsyncSink, StopDrainsTheQueue) {
+    auto collector = std::make_shared<CollectingSink>();
+    {
+        auto sink = std::make_shared<AsyncSink>(
+            std::vector<spdlog::sink_ptr> {collector}, 1024, LogOverflowPolicy::Block);
+        spdlog::logger logger("test", sink);
+        for (int i = 0; i < 500; i++) {
+            logger.info("{}", i);
+        }
+        sink->stop();
+        logger.info("after stop");
+        EXPECT_EQ(sink->dropped_count(), 1U);
+    }
+    EXPECT_EQ(collector->messages().size(), 500U);
+}
+
+TEST(AsyncSink, StopWhileLoggingLosesNothingUncounted) {
+    constexpr int kThreads  = 8;
+    constexpr int kMessages = 5000;
+    for (const auto policy : {LogOverflowPolicy::Block, LogOverflowPolicy::Drop,
+                              LogOverflowPolicy::OverwriteOldest}) {
+        auto collector = std::make_shared<CollectingSink>();
+        auto sink      = std::make_shared<AsyncSink>(
+            std::vector<spdlog::sink_ptr> {collector}, 64, policy);
+        spdlog::logger logger("test", sink);
+
+        std::atomic<int>         started {0};
+        std::vector<std::thread> threads;
+        for (int t = 0; t < kThreads; t++) {
+            threads.emplace_back([&logger, &started] {
+                started.fetch_add(1);
+                for (int i = 0; i < kMessages; i++) {
+                    logger.info("{}", i);
+                }
+            });
+        }
+        while (started.load() < kThreads) {
+            std::this_thread::yield();
+        }
+        // Stops while the producers are in the middle of logging
+        sink->stop();
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        EXPECT_EQ(collector->messages().size() + sink->dropped_count(),
+                  size_t(kThreads * kMessages))
+            << "policy " << static_cast<int>(policy);
+    }
+}
+
+TEST(AsyncSink, LogInitAsync) {
+    auto       collector = std::make_shared<CollectingSink>();
+    LogConfig_t config;
+    config.m_Mode  = LogMode::Async;
+    config.m_Sinks = {collector};
+    ASSERT_TRUE(Log::init(config).has_value());
+
+    PL_LOG_INFO("hello {}", 42);
+    Log::shutdown();
+
+    const auto messages = collector->messages();
+    ASSERT_FALSE(messages.empty());
+    EXPECT_EQ(messages.back(), "hello 42");
+}
+// NOLINTEND(*)
@@ -0,0 +1,178 @@
+// NOLINTBEGIN(*)
+#include "PulsarCore/Log.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Pulsar;
+
+namespace {
+    struct Point {
+        int x;
+        int y;
+    };
+
+    std::filesystem::path temp_log(const char* name) {
+        return std::filesystem::temp_directory_path() / name;
+    }
+
+    void init_binary(const std::filesystem::path& path, usize bufferSize = usize {1} << 20) {
+        LogConfig_t config;
+        config.m_Mode                   = LogMode::Binary;
+        config.m_BinaryPath             = path;
+        config.m_BinaryThreadBufferSize = bufferSize;
+        ASSERT_TRUE(Log::init(config).has_value());
+    }
+
+    std::vector<std::string> decode(const std::filesystem::path& path) {
+        std::ifstream         input(path, std::ios::binary);
+        const std::vector<u8> data(
+            (std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+        std::vector<std::string> lines;
+        const auto               records = BinaryLog::decode(
+            data, [&lines](std::string_view line) { lines.emplace_back(line); });
+        EXPECT_TRUE(records.has_value());
+        EXPECT_EQ(records.value_or(0), lines.size());
+        // Log::init logs this itself
+        std::erase_if(lines, [](const std::string& line) {
+            return line.ends_with("Logger initialized");
+        });
+        return lines;
+    }
+
+    /// Logs from a thread-local destructor that runs after the log freed the thread's ring
+    struct LogsOnExit_t {
+        ~LogsOnExit_t() {
+            PL_LOG_INFO("from a destructor {}", 1);
+        }
+    };
+
+    // Strips "[time] [level] [category] [thread] "
+    std::string message(const std::string& line) {
+        usize position = 0;
+        for (int i = 0; i < 4; i++) {
+            position = line.find("] ", position) + 2;
+        }
+        return line.substr(position);
+    }
+} // namespace
+
+template<> struct fmt::formatter<Point> : fmt::formatter<std::string_view> {
+    auto format(const Point& point, fmt::format_context& context) const {
+        return fmt::format_to(context.out(), "({}, {})", point.x, point.y);
+    }
+};
+
+TEST(BinaryLog, RoundTripsArgumentTypes) {
+    const auto path = temp_log("pulsar_binary_log_types.plog");
+    init_binary(path);
+
+    const std::string name     = "player";
+    const char*       cString  = "c-string";
+    const u64         big      = 0xFFFF'FFFF'FFFF'FFFFULL;
+    const i8          small    = -5;
+    PL_LOG_INFO("no arguments");
+    PL_LOG_INFO("{} {} {} {}", 42, -7LL, big, small);
+    PL_LOG_CAT_WARN(Window, "{:.3f} {:.1f} {}", 3.14159, 2.5F, true);
+    PL_LOG_CAT_ERROR(Engine, "{}={} '{}' {}", name, cString, 'x', std::string_view("view"));
+    PL_LOG_DEBUG("{:>6}|{:#x}", 12, 255U);
+    PL_LOG_INFO("custom {}", Point {1, 2});
+    Log::shutdown();
+
+    const auto lines = decode(path);
+    ASSERT_EQ(lines.size(), 6U);
+    EXPECT_EQ(message(lines[0]), "no arguments");
+    EXPECT_EQ(message(lines[1]), fmt::format("42 -7 {} -5", big));
+    EXPECT_EQ(message(lines[2]), "3.142 2.5 true");
+    EXPECT_EQ(message(lines[3]), "player=c-string 'x' view");
+    EXPECT_EQ(message(lines[4]), "    12|0xff");
+    EXPECT_EQ(message(lines[5]), "custom (1, 2)");
+    EXPECT_NE(lines[2].find("[warning] [Window]"), std::string::npos);
+    EXPECT_NE(lines[3].find("[error] [Engine]"), std::string::npos);
+    std::filesystem::remove(path);
+}
+
+TEST(BinaryLog, ManyThreadsWithWrapAround) {
+    const auto path = temp_log("pulsar_binary_log_threads.plog");
+    // A small ring, so the producers wrap around and wait for the writer many times
+    init_binary(path, 4096);
+
+    constexpr int            kThreads  = 4;
+    constexpr int            kMessages = 20000;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; t++) {
+        threads.emplace_back([t] {
+            for (int i = 0; i < kMessages; i++) {
+                PL_LOG_CAT_TRACE(Core, "{} {} {}", t, i, std::string(i % 13, 'a'));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    Log::flush();
+    EXPECT_EQ(BinaryLog::records_written(), u64(kThreads * kMessages) + 1);
+    EXPECT_EQ(BinaryLog::dropped_count(), 0U);
+    Log::shutdown();
+
+    const auto lines = decode(path);
+    ASSERT_EQ(lines.size(), size_t(kThreads * kMessages));
+    std::vector<int> next(kThreads, 0);
+    for (const auto& line : lines) {
+        int t = 0;
+        int i = 0;
+        ASSERT_EQ(std::sscanf(message(line).c_str(), "%d %d", &t, &i), 2);
+        ASSERT_EQ(i, next[t]) << "thread " << t << " out of order";
+        next[t] = i + 1;
+    }
+    std::filesystem::remove(path);
+}
+
+TEST(BinaryLog, ReopenAfterShutdown) {
+    const auto first  = temp_log("pulsar_binary_log_first.plog");
+    const auto second = temp_log("pulsar_binary_log_second.plog");
+    init_binary(first);
+    PL_LOG_INFO("first {}", 1);
+    Log::shutdown();
+    init_binary(second);
+    PL_LOG_INFO("second {}", 2);
+    Log::shutdown();
+
+    const auto firstLines  = decode(first);
+    const auto secondLines = decode(second);
+    ASSERT_EQ(firstLines.size(), 1U);
+    ASSERT_EQ(secondLines.size(), 1U);
+    EXPECT_EQ(message(firstLines[0]), "first 1");
+    EXPECT_EQ(message(secondLines[0]), "second 2");
+    std::filesystem::remove(first);
+    std::filesystem::remove(second);
+}
+
+TEST(BinaryLog, DropsStatementsAfterTheThreadRingIsFreed) {
+    const auto path = temp_log("pulsar_binary_log_exit.plog");
+    init_binary(path);
+    std::thread([] {
+        // Constructed before the ring's owner, so destroyed after it
+        thread_local LogsOnExit_t logsOnExit;
+        static_cast<void>(&logsOnExit);
+        PL_LOG_INFO("before exit {}", 0);
+    }).join();
+    EXPECT_EQ(BinaryLog::dropped_count(), 1U);
+    Log::shutdown();
+
+    const auto lines = decode(path);
+    ASSERT_EQ(lines.size(), 1U);
+    EXPECT_EQ(message(lines[0]), "before exit 0");
+    std::filesystem::remove(path);
+}
+
+TEST(BinaryLog, RejectsGarbage) {
+    const std::vector<u8> garbage(128, 0xAB);
+    EXPECT_FALSE(BinaryLog::decode(garbage, [](std::string_view) {}).has_value());
+}
+// NOLINTEND(*)
@@ -0,0 +1,156 @@
+// NOLINTBEGIN(*)
+#include "PulsarCore/Log.hpp"
+
+#include <csignal>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <iterator>
+#include <spdlog/sinks/null_sink.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Pulsar;
+
+namespace {
+    std::filesystem::path temp_dump(const char* name) {
+        return std::filesystem::temp_directory_path() / name;
+    }
+
+    /// Sinks only see info and above, the recorder keeps everything
+    void init_recorder(const std::filesystem::path& crashPath, usize records = 4096) {
+        LogConfig_t config;
+        config.m_Sinks = {std::make_shared<spdlog::sinks::null_sink_mt>()};
+        config.m_Level = spdlog::level::info;
+        config.m_FlightRecorder.m_Enabled          = true;
+        config.m_FlightRecorder.m_RecordsPerThread = records;
+        config.m_FlightRecorder.m_CrashDumpPath    = crashPath;
+        ASSERT_TRUE(Log::init(config).has_value());
+    }
+
+    // Decodes a dump to the messages, without the "[time] [level] [category] [thread] " prefix
+    std::vector<std::string> decode(const std::filesystem::path& path) {
+        std::ifstream         input(path, std::ios::binary);
+        const std::vector<u8> data(
+            (std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+        std::vector<std::string> messages;
+        const auto records = BinaryLog::decode(data, [&messages](std::string_view line) {
+            usize position = 0;
+            for (int i = 0; i < 4; i++) {
+                position = line.find("] ", position) + 2;
+            }
+            messages.emplace_back(line.substr(position));
+        });
+        EXPECT_TRUE(records.has_value());
+        std::erase_if(messages, [](const std::string& message) {
+            return message == "Logger initialized";
+        });
+        return messages;
+    }
+
+    void log_and_crash(const std::filesystem::path& path, volatile int* address) {
+        init_recorder(path);
+        PL_LOG_TRACE("about to crash {}", 1);
+        *address = 42;
+    }
+
+    void log_fatal_and_abort(const std::filesystem::path& path) {
+        init_recorder(path);
+        PL_LOG_DEBUG("context {}", "kept");
+        PL_LOG_FATAL("giving up");
+        std::abort();
+    }
+} // namespace
+
+TEST(FlightRecorder, TraceBelowTheSinkLevelIsRecorded) {
+    const auto path = temp_dump("pulsar_flight_explicit.plog");
+    init_recorder(temp_dump("pulsar_flight_unused.plog"));
+    EXPECT_EQ(Log::get_level(LogCategory::General), spdlog::level::info);
+    EXPECT_TRUE(Log::is_enabled(LogCategory::General, spdlog::level::trace));
+
+    for (int i = 0; i < 3; i++) {
+        PL_LOG_CAT_TRACE(Core, "step {} of {}", i, "setup");
+    }
+    std::thread([] { PL_LOG_CAT_INFO(Engine, "from another thread {:.1f}", 2.5); }).join();
+    ASSERT_TRUE(FlightRecorder::dump(path).has_value());
+    Log::shutdown();
+
+    const std::vector<std::string> expected = {
+        "step 0 of setup", "step 1 of setup", "step 2 of setup", "from another thread 2.5"};
+    EXPECT_EQ(decode(path), expected);
+    EXPECT_FALSE(FlightRecorder::is_enabled());
+    std::filesystem::remove(path);
+}
+
+TEST(FlightRecorder, KeepsTheLatestRecords) {
+    const auto path = temp_dump("pulsar_flight_wrap.plog");
+    init_recorder(temp_dump("pulsar_flight_unused.plog"), 16);
+    for (int i = 0; i < 100; i++) {
+        PL_LOG_TRACE("record {}", i);
+    }
+    ASSERT_TRUE(FlightRecorder::dump(path).has_value());
+    Log::shutdown();
+
+    const auto messages = decode(path);
+    ASSERT_EQ(messages.size(), 16u);
+    for (int i = 0; i < 16; i++) {
+        EXPECT_EQ(messages[i], fmt::format("record {}", 84 + i));
+    }
+    std::filesystem::remove(path);
+}
+
+TEST(FlightRecorder, TruncatesLongStrings) {
+    const auto path = temp_dump("pulsar_flight_truncate.plog");
+    init_recorder(temp_dump("pulsar_flight_unused.plog"));
+    const std::string longText(500, 'x');
+    PL_LOG_TRACE("{} {}", 7, longText);
+    ASSERT_TRUE(FlightRecorder::dump(path).has_value());
+    Log::shutdown();
+
+    const auto messages = decode(path);
+    ASSERT_EQ(messages.size(), 1u);
+    EXPECT_TRUE(messages[0].starts_with("7 xxxx"));
+    EXPECT_LT(messages[0].size(), longText.size());
+    std::filesystem::remove(path);
+}
+
+TEST(FlightRecorder, CountsStatementsTooLargeForARecord) {
+    const auto path = temp_dump("pulsar_flight_dropped.plog");
+    init_recorder(temp_dump("pulsar_flight_unused.plog"));
+    PL_LOG_TRACE("kept {}", 1);
+    for (int i = 0; i < 2; i++) {
+        // 13 doubles are 104 bytes, more than a record holds
+        const double v = i;
+        PL_LOG_TRACE(
+            "{} {} {} {} {} {} {} {} {} {} {} {} {}", v, v, v, v, v, v, v, v, v, v, v, v, v);
+    }
+    EXPECT_EQ(FlightRecorder::dropped_count(), 2u);
+    ASSERT_TRUE(FlightRecorder::dump(path).has_value());
+    Log::shutdown();
+
+    const std::vector<std::string> expected = {
+        "kept 1", "Flight recorder dropped 2 statements too large for a record"};
+    EXPECT_EQ(decode(path), expected);
+    std::filesystem::remove(path);
+}
+
+TEST(FlightRecorderDeathTest, DumpsOnCrash) {
+    GTEST_FLAG_SET(death_test_style, "threadsafe");
+    const auto path = temp_dump("pulsar_flight_segv.plog");
+    std::filesystem::remove(path);
+    EXPECT_EXIT(log_and_crash(path, nullptr), testing::KilledBySignal(SIGSEGV), "");
+    EXPECT_EQ(decode(path), std::vector<std::string> {"about to crash 1"});
+    std::filesystem::remove(path);
+}
+
+TEST(FlightRecorderDeathTest, DumpsOnFatalAndAbort) {
+    GTEST_FLAG_SET(death_test_style, "threadsafe");
+    const auto path = temp_dump("pulsar_flight_abort.plog");
+    std::filesystem::remove(path);
+    EXPECT_EXIT(log_fatal_and_abort(path), testing::KilledBySignal(SIGABRT), "");
+    // The fatal statement dumped first, the abort dumped again with the same history
+    EXPECT_EQ(decode(path), (std::vector<std::string> {"context kept", "giving up"}));
+    std::filesystem::remove(path);
+}
+// NOLINTEND(*)
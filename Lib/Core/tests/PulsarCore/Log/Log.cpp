@@ -0,0 +1,81 @@
+// NOLINTBEGIN(*)
+#include "PulsarCore/Log.hpp"
+
+#include <gtest/gtest.h>
+#include <mutex>
+#include <spdlog/sinks/base_sink.h>
+#include <string>
+#include <vector>
+
+using namespace Pulsar;
+
+namespace {
+    // Records "<logger name>: <payload>"
+    class RecordingSink : public spdlog::sinks::base_sink<std::mutex> {
+    public:
+        std::vector<std::string> m_Records;
+
+    protected:
+        void sink_it_(const spdlog::details::log_msg& msg) override {
+            m_Records.push_back(fmt::format("{}: {}", msg.logger_name, msg.payload));
+        }
+
+        void flush_() override {
+        }
+    };
+
+    std::shared_ptr<RecordingSink> init_recording(spdlog::level::level_enum level) {
+        auto        sink = std::make_shared<RecordingSink>();
+        LogConfig_t config;
+        config.m_Sinks = {sink};
+        config.m_Level = level;
+        EXPECT_TRUE(Log::init(config).has_value());
+        sink->m_Records.clear();
+        return sink;
+    }
+} // namespace
+
+TEST(Log, CategoriesUseTheirOwnLogger) {
+    const auto sink = init_recording(spdlog::level::trace);
+    PL_LOG_CAT_INFO(Window, "resized to {}x{}", 800, 600);
+    PL_LOG_WARN("general");
+    Log::shutdown();
+
+    const std::vector<std::string> expected = {"Window: resized to 800x600", "General: general"};
+    EXPECT_EQ(sink->m_Records, expected);
+}
+
+TEST(Log, RuntimeLevelPerCategory) {
+    const auto sink = init_recording(spdlog::level::info);
+    Log::set_level(LogCategory::Engine, spdlog::level::err);
+    EXPECT_EQ(Log::get_level(LogCategory::Engine), spdlog::level::err);
+    EXPECT_EQ(Log::get_level(LogCategory::Core), spdlog::level::info);
+
+    int evaluated = 0;
+    const auto count = [&evaluated] { return ++evaluated; };
+    PL_LOG_CAT_WARN(Engine, "filtered {}", count());
+    PL_LOG_CAT_ERROR(Engine, "kept {}", count());
+    PL_LOG_CAT_WARN(Core, "kept {}", count());
+    PL_LOG_CAT_DEBUG(Core, "filtered {}", count());
+    Log::shutdown();
+
+    // Arguments of filtered statements are never evaluated
+    EXPECT_EQ(evaluated, 2);
+    const std::vector<std::string> expected = {"Engine: kept 1", "Core: kept 2"};
+    EXPECT_EQ(sink->m_Records, expected);
+}
+
+TEST(Log, CompileTimeLevels) {
+    static_assert(Log::is_compiled_in(LogCategory::General, spdlog::level::critical));
+    EXPECT_EQ(Log::is_compiled_in(LogCategory::Core, spdlog::level::trace),
+              PULSAR_LOG_LEVEL_CORE <= SPDLOG_LEVEL_TRACE);
+    EXPECT_EQ(to_string(LogCategory::Editor), "Editor");
+}
+
+TEST(Log, FallbackLoggerAfterShutdown) {
+    Log::shutdown();
+    // Logging without a logger initializes a default one instead of crashing
+    EXPECT_EQ(Log::get_logger(LogCategory::Core).name(), "Core");
+    Log::shutdown();
+}
+// NOLINTEND(*)
@@ -0,0 +1,172 @@
+// NOLINTBEGIN(*)
+#include "PulsarCore/Math/Culling.hpp"
+
+#include <array>
+#include <gtest/gtest.h>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace Pulsar;
+
+namespace {
+    // Column-major perspective * look-at(origin, -Z), 90 degree fov, near 1, far 100, depth [0, 1]
+    Frustum make_frustum() {
+        const float                 near = 1.0F;
+        const float                 far  = 100.0F;
+        const std::array<float, 16> matrix {
+            1.0F, 0.0F, 0.0F,                         0.0F,
+            0.0F, 1.0F, 0.0F,                         0.0F,
+            0.0F, 0.0F, far / (near - far),           -1.0F,
+            0.0F, 0.0F, (near * far) / (near - far),  0.0F,
+        };
+        return Frustum::from_view_projection(matrix);
+    }
+
+    Culling::AABBSoA random_boxes(usize count, unsigned seed) {
+        std::mt19937                          rng(seed);
+        std::uniform_real_distribution<float> position(-150.0F, 150.0F);
+        std::uniform_real_distribution<float> size(0.1F, 5.0F);
+        Culling::AABBSoA                      boxes;
+        boxes.reserve(count);
+        for (usize i = 0; i < count; i++) {
+            boxes.push_back(AABB::from_center_extents(
+                {position(rng), position(rng), position(rng)}, {size(rng), size(rng), size(rng)}));
+        }
+        return boxes;
+    }
+} // namespace
+
+TEST(Bounds, AABB) {
+    const AABB box = {
+        {-1, -1, -1},
+        { 1,  2,  3}
+    };
+    EXPECT_TRUE(box.contains({0, 0, 0}));
+    EXPECT_FALSE(box.contains({0, 3, 0}));
+    EXPECT_EQ(box.extents().z, 2.0F);
+    EXPECT_EQ(box.center().y, 0.5F);
+
+    const AABB other = {
+        {0.5F, 1.5F, 2.5F},
+        {5, 5, 5}
+    };
+    EXPECT_TRUE(box.intersects(other));
+    const AABB merged = box.merged(other);
+    EXPECT_EQ(merged.min.x, -1.0F);
+    EXPECT_EQ(merged.max.x, 5.0F);
+}
+
+TEST(Bounds, Sphere) {
+    const Sphere a = {
+        {0, 0, 0},
+        1
+    };
+    const Sphere b = {
+        {1.5F, 0, 0},
+        1
+    };
+    EXPECT_TRUE(a.intersects(b));
+    EXPECT_TRUE(a.contains({0.5F, 0.5F, 0.5F}));
+    EXPECT_FALSE(a.contains({1, 1, 1}));
+}
+
+TEST(Bounds, FrustumPlanes) {
+    const Frustum frustum = make_frustum();
+    const auto    inside  = [&](Vec3 point) {
+        return frustum.intersects(AABB {point, point});
+    };
+    EXPECT_TRUE(inside({0, 0, -10}));
+    EXPECT_FALSE(inside({0, 0, 10}));     // behind the camera
+    EXPECT_FALSE(inside({0, 0, -0.5F}));  // in front of the near plane
+    EXPECT_FALSE(inside({0, 0, -150}));   // beyond the far plane
+    EXPECT_FALSE(inside({20, 0, -10}));   // outside the 90 degree fov
+    EXPECT_TRUE(inside({9.5F, 0, -10}));
+
+    // Plane distances are in world units after normalization
+    EXPECT_NEAR(frustum.planes[Frustum::NEAR].w, -1.0F, 1e-5F);
+    EXPECT_NEAR(frustum.planes[Frustum::FAR].w, 100.0F, 1e-3F);
+
+    EXPECT_TRUE(frustum.intersects(Sphere {
+        {20, 0, -10},
+        11
+    }));
+    EXPECT_FALSE(frustum.intersects(Sphere {
+        {20, 0, -10},
+        6
+    }));
+}
+
+TEST(Culling, AABBMatchesScalar) {
+    const Frustum frustum = make_frustum();
+    // Not a multiple of 16 or 64, so every tail path runs
+    const usize count = 10000 + 37;
+    const auto  boxes = random_boxes(count, 1);
+
+    std::vector<u64> visibility(Culling::mask_words(count), ~u64 {0});
+    Culling::cull(frustum, boxes, visibility);
+
+    usize expected = 0;
+    for (usize i = 0; i < count; i++) {
+        const bool visible = frustum.intersects(boxes.get(i));
+        expected += visible ? 1 : 0;
+        EXPECT_EQ((visibility[i / 64] >> (i % 64)) & 1, visible ? 1U : 0U) << "box " << i;
+    }
+    EXPECT_GT(expected, 0U);
+    EXPECT_LT(expected, count);
+    EXPECT_EQ(Culling::count_visible(visibility, count), expected);
+
+    std::vector<u32> indices;
+    EXPECT_EQ(Culling::compact(visibility, count, indices), expected);
+    for (u32 index : indices) {
+        EXPECT_TRUE(frustum.intersects(boxes.get(index)));
+    }
+    EXPECT_TRUE(std::is_sorted(indices.begin(), indices.end()));
+}
+
+TEST(Culling, SphereMatchesScalar) {
+    const Frustum                         frustum = make_frustum();
+    std::mt19937                          rng(2);
+    std::uniform_real_distribution<float> position(-150.0F, 150.0F);
+    std::uniform_real_distribution<float> radius(0.1F, 5.0F);
+    Culling::SphereSoA                    spheres;
+    const usize                           count = 5000 + 13;
+    for (usize i = 0; i < count; i++) {
+        spheres.push_back({
+            {position(rng), position(rng), position(rng)},
+            radius(rng)
+        });
+    }
+
+    std::vector<u64> visibility(Culling::mask_words(count));
+    Culling::cull(frustum, spheres, visibility);
+    for (usize i = 0; i < count; i++) {
+        const bool visible = frustum.intersects(spheres.get(i));
+        EXPECT_EQ((visibility[i / 64] >> (i % 64)) & 1, visible ? 1U : 0U) << "sphere " << i;
+    }
+}
+
+TEST(Culling, ParallelMatchesSerial) {
+    const Frustum frustum = make_frustum();
+    const usize   count   = 100000 + 5;
+    const auto    boxes   = random_boxes(count, 3);
+
+    std::vector<u64> serial(Culling::mask_words(count));
+    Culling::cull(frustum, boxes, serial);
+
+    std::vector<u64> parallel(Culling::mask_words(count));
+    Culling::cull_parallel(
+        frustum, boxes, parallel,
+        [](usize chunkCount, const auto& body) {
+            std::vector<std::thread> threads;
+            for (usize chunk = 0; chunk < chunkCount; chunk++) {
+                threads.emplace_back([&body, chunk] { body(chunk); });
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+        },
+        1000);
+    EXPECT_EQ(serial, parallel);
+}
+// NOLINTEND(*)
@@ -0,0 +1,71 @@
+// NOLINTBEGIN(*)
+#include "PulsarCore/Math/Matrix.hpp"
+#include "PulsarCore/Math/Quat.hpp"
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <numbers>
+
+using namespace Pulsar;
+
+namespace {
+    constexpr float EPSILON = 1e-5F;
+
+    void expect_near(const Vec3& actual, const Vec3& expected) {
+        EXPECT_NEAR(actual.x, expected.x, EPSILON);
+        EXPECT_NEAR(actual.y, expected.y, EPSILON);
+        EXPECT_NEAR(actual.z, expected.z, EPSILON);
+    }
+} // namespace
+
+TEST(Quat, Rotate) {
+    const Quat quarter = Quat::from_axis_angle({0, 0, 1}, std::numbers::pi_v<float> / 2);
+    expect_near(quarter.rotate({1, 0, 0}), {0, 1, 0});
+    expect_near(quarter.conjugate().rotate({0, 1, 0}), {1, 0, 0});
+    expect_near(Quat::identity().rotate({1, 2, 3}), {1, 2, 3});
+    EXPECT_NEAR(quarter.length_squared(), 1.0F, EPSILON);
+}
+
+TEST(Quat, Compose) {
+    const Quat aroundZ = Quat::from_axis_angle({0, 0, 1}, std::numbers::pi_v<float> / 2);
+    const Quat aroundX = Quat::from_axis_angle({1, 0, 0}, std::numbers::pi_v<float> / 2);
+    // aroundX first: +Y goes to +Z, which aroundZ leaves alone
+    expect_near((aroundZ * aroundX).rotate({0, 1, 0}), {0, 0, 1});
+    // aroundZ first: +Y goes to -X, which aroundX leaves alone
+    expect_near((aroundX * aroundZ).rotate({0, 1, 0}), {-1, 0, 0});
+
+    const Quat scaled = {0, 0, 2, 2};
+    EXPECT_NEAR(scaled.normalized().length_squared(), 1.0F, EPSILON);
+}
+
+TEST(Mat4, Identity) {
+    static_assert(Mat4::identity() * Mat4::identity() == Mat4::identity());
+    static_assert(Mat4::identity().at(2, 2) == 1.0F && Mat4::identity().at(0, 3) == 0.0F);
+    const Mat4 identity = Mat4::from_trs({0, 0, 0}, Quat::identity(), {1, 1, 1});
+    EXPECT_EQ(identity, Mat4::identity());
+}
+
+TEST(Mat4, FromTrsMatchesQuat) {
+    // Normalized (1, 2, 3)
+    const Quat rotation    = Quat::from_axis_angle({0.267261F, 0.534522F, 0.801784F}, 0.7F);
+    const Vec3 translation = {4, -5, 6};
+    const Vec3 scale       = {2, 3, 0.5F};
+    const Mat4 matrix      = Mat4::from_trs(translation, rotation, scale);
+
+    const Vec3 point    = {1, -2, 3};
+    const Vec3 scaled   = {point.x * scale.x, point.y * scale.y, point.z * scale.z};
+    const Vec3 rotated  = rotation.rotate(scaled);
+    const Vec3 expected = {
+        rotated.x + translation.x, rotated.y + translation.y, rotated.z + translation.z};
+    expect_near(matrix.transform_point(point), expected);
+    expect_near(matrix.transform_vector(point), rotated);
+    EXPECT_EQ(matrix.column(3).w, 1.0F);
+}
+
+TEST(Mat4, MultiplyAppliesRightFirst) {
+    const Mat4 translate = Mat4::from_trs({10, 0, 0}, Quat::identity(), {1, 1, 1});
+    const Mat4 scale     = Mat4::from_trs({0, 0, 0}, Quat::identity(), {2, 2, 2});
+    expect_near((translate * scale).transform_point({1, 1, 1}), {12, 2, 2});
+    expect_near((scale * translate).transform_point({1, 1, 1}), {22, 2, 2});
+}
+// NOLINTEND(*)
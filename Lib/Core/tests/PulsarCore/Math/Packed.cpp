@@ -0,0 +1,245 @@
+// NOLINTBEGIN(*)
+#include "PulsarCore/Math/Packed.hpp"
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace Pulsar;
+
+namespace {
+    std::vector<Vec3> random_unit_vectors(usize count) {
+        std::mt19937                    rng(1234);
+        std::normal_distribution<float> dist;
+        std::vector<Vec3>               vectors;
+        vectors.reserve(count + 6);
+        // Include the axes, those are the edge cases of the octahedral folding
+        vectors.push_back({1, 0, 0});
+        vectors.push_back({-1, 0, 0});
+        vectors.push_back({0, 1, 0});
+        vectors.push_back({0, -1, 0});
+        vectors.push_back({0, 0, 1});
+        vectors.push_back({0, 0, -1});
+        while (vectors.size() < count + 6) {
+            Vec3  v   = {dist(rng), dist(rng), dist(rng)};
+            float len = std::sqrt(v.x * v.x + v.y * v.y + v.z * v.z);
+            if (len < 1e-4F) {
+                continue;
+            }
+            vectors.push_back({v.x / len, v.y / len, v.z / len});
+        }
+        return vectors;
+    }
+
+    // atan2 of the cross and dot products stays accurate for tiny angles, acos does not
+    double angle_degrees(const Vec3& a, const Vec3& b) {
+        const double cx  = double(a.y) * b.z - double(a.z) * b.y;
+        const double cy  = double(a.z) * b.x - double(a.x) * b.z;
+        const double cz  = double(a.x) * b.y - double(a.y) * b.x;
+        const double dot = double(a.x) * b.x + double(a.y) * b.y + double(a.z) * b.z;
+        const double sin = std::sqrt(cx * cx + cy * cy + cz * cz);
+        return std::atan2(sin, dot) * 180.0 / 3.14159265358979323846;
+    }
+} // namespace
+
+TEST(Packed, HalfRoundTripIsExact) {
+    // Every non-NaN half must survive a trip through f32
+    for (u32 bits = 0; bits <= 0xFFFF; bits++) {
+        const u16 half = static_cast<u16>(bits);
+        const f32 value = f16::to_f32(half);
+        if (std::isnan(value)) {
+            continue;
+        }
+        EXPECT_EQ(f16::from_f32(value), half) << "bits " << bits;
+    }
+}
+
+TEST(Packed, HalfSpecialValues) {
+    EXPECT_EQ(f16(0.0F).bits, 0x0000);
+    EXPECT_EQ(f16(-0.0F).bits, 0x8000);
+    EXPECT_EQ(f16(1.0F).bits, 0x3C00);
+    EXPECT_EQ(f16(65504.0F).bits, 0x7BFF);
+    EXPECT_EQ(f16(65536.0F).bits, 0x7C00);
+    EXPECT_EQ(f16(std::numeric_limits<f32>::infinity()).bits, 0x7C00);
+    EXPECT_EQ(f16(-std::numeric_limits<f32>::infinity()).bits, 0xFC00);
+    EXPECT_TRUE(std::isnan(static_cast<f32>(f16(std::numeric_limits<f32>::quiet_NaN()))));
+    // Smallest subnormal
+    EXPECT_EQ(f16(5.9604645e-8F).bits, 0x0001);
+    // Ties round to even
+    EXPECT_EQ(f16(1.0F + 1.0F / 2048.0F).bits, 0x3C00);
+    EXPECT_EQ(f16(1.0F + 3.0F / 2048.0F).bits, 0x3C02);
+}
+
+TEST(Packed, HalfRelativeErrorBound) {
+    std::mt19937                          rng(42);
+    std::uniform_real_distribution<float> dist(-60000.0F, 60000.0F);
+    for (int i = 0; i < 100000; i++) {
+        const f32 value = dist(rng);
+        if (std::abs(value) < 6.1035156e-5F) {
+            continue;
+        }
+        const f32 decoded = static_cast<f32>(f16(value));
+        // Half has 11 significant bits, rounding to nearest gives at most half an ulp of error
+        EXPECT_LE(std::abs(decoded - value), std::abs(value) * (1.0F / 2048.0F));
+    }
+}
+
+TEST(Packed, HalfBatchMatchesScalar) {
+    std::mt19937                          rng(7);
+    std::uniform_real_distribution<float> dist(-1000.0F, 1000.0F);
+    // Not a multiple of the SIMD width, so the scalar tail is exercised too
+    std::vector<f32> values(1027);
+    for (auto& value : values) {
+        value = dist(rng);
+    }
+    values[3] = 1e-7F;
+    values[4] = 1e9F;
+
+    std::vector<f16> encoded(values.size());
+    Packed::encode_f16(values, encoded);
+    std::vector<f32> decoded(values.size());
+    Packed::decode_f16(encoded, decoded);
+
+    for (usize i = 0; i < values.size(); i++) {
+        EXPECT_EQ(encoded[i], f16(values[i])) << "index " << i;
+        EXPECT_EQ(decoded[i], static_cast<f32>(encoded[i])) << "index " << i;
+    }
+}
+
+TEST(Packed, Vec3hBatch) {
+    std::vector<Vec3> src = {
+        {1.0F, -2.0F, 0.5F},
+        {100.0F, 0.001F, -0.25F},
+        {3.0F, 4.0F, 5.0F}
+    };
+    std::vector<Vec3h> encoded(src.size());
+    Packed::encode_vec3h(src, encoded);
+    std::vector<Vec3> decoded(src.size());
+    Packed::decode_vec3h(encoded, decoded);
+    for (usize i = 0; i < src.size(); i++) {
+        EXPECT_NEAR(decoded[i].x, src[i].x, std::abs(src[i].x) / 2048.0F);
+        EXPECT_NEAR(decoded[i].y, src[i].y, std::abs(src[i].y) / 2048.0F);
+        EXPECT_NEAR(decoded[i].z, src[i].z, std::abs(src[i].z) / 2048.0F);
+    }
+}
+
+TEST(Packed, SNorm16ErrorBound) {
+    EXPECT_EQ(encode_snorm16(1.0F), 32767);
+    EXPECT_EQ(encode_snorm16(-1.0F), -32767);
+    EXPECT_EQ(encode_snorm16(2.0F), 32767);
+    EXPECT_EQ(decode_snorm16(i16(-32768)), -1.0F);
+
+    std::vector<Vec3> src;
+    for (int i = 0; i <= 2000; i++) {
+        const float v = -1.0F + float(i) / 1000.0F;
+        src.push_back({v, -v, v * 0.5F});
+    }
+    std::vector<SNorm16Vec3> encoded(src.size());
+    Packed::encode_snorm16(src, encoded);
+    std::vector<Vec3> decoded(src.size());
+    Packed::decode_snorm16(encoded, decoded);
+
+    const float bound = 0.5F / 32767.0F + 1e-7F;
+    for (usize i = 0; i < src.size(); i++) {
+        EXPECT_NEAR(decoded[i].x, src[i].x, bound);
+        EXPECT_NEAR(decoded[i].y, src[i].y, bound);
+        EXPECT_NEAR(decoded[i].z, src[i].z, bound);
+    }
+}
+
+TEST(Packed, UNorm8ErrorBound) {
+    std::vector<Vec4> src;
+    for (int i = 0; i <= 1000; i++) {
+        const float v = float(i) / 1000.0F;
+        src.push_back({v, 1.0F - v, v * 0.25F, 1.0F});
+    }
+    std::vector<UNorm8Vec4> encoded(src.size());
+    Packed::encode_unorm8(src, encoded);
+    std::vector<Vec4> decoded(src.size());
+    Packed::decode_unorm8(encoded, decoded);
+
+    const float bound = 0.5F / 255.0F + 1e-6F;
+    for (usize i = 0; i < src.size(); i++) {
+        EXPECT_NEAR(decoded[i].x, src[i].x, bound);
+        EXPECT_NEAR(decoded[i].y, src[i].y, bound);
+        EXPECT_NEAR(decoded[i].z, src[i].z, bound);
+        EXPECT_EQ(decoded[i].w, 1.0F);
+    }
+}
+
+TEST(Packed, OctahedralErrorBound) {
+    const auto src = random_unit_vectors(100000);
+    std::vector<OctNormal> encoded(src.size());
+    Packed::encode_octahedral(src, encoded);
+    std::vector<Vec3> decoded(src.size());
+    Packed::decode_octahedral(encoded, decoded);
+
+    double maxError = 0.0;
+    for (usize i = 0; i < src.size(); i++) {
+        const Vec3& n = decoded[i];
+        EXPECT_NEAR(n.x * n.x + n.y * n.y + n.z * n.z, 1.0F, 1e-5F);
+        maxError = std::max(maxError, angle_degrees(src[i], n));
+
+        // The SIMD path has to agree with the scalar reference
+        const Vec3 scalar = decode_octahedral(encoded[i]);
+        EXPECT_NEAR(n.x, scalar.x, 1e-6F);
+        EXPECT_NEAR(n.y, scalar.y, 1e-6F);
+        EXPECT_NEAR(n.z, scalar.z, 1e-6F);
+    }
+    EXPECT_LT(maxError, 0.01);
+}
+
+TEST(Packed, UNorm1010102ErrorBound) {
+    const Vec4 value = {0.25F, 0.5F, 1.0F, 1.0F};
+    const Vec4 decoded = decode_unorm1010102(encode_unorm1010102(value));
+    EXPECT_NEAR(decoded.x, value.x, 0.5F / 1023.0F);
+    EXPECT_NEAR(decoded.y, value.y, 0.5F / 1023.0F);
+    EXPECT_EQ(decoded.z, 1.0F);
+    EXPECT_EQ(decoded.w, 1.0F);
+    EXPECT_EQ(encode_unorm1010102({0, 0, 0, 0}).bits, 0U);
+    EXPECT_EQ(encode_unorm1010102({1, 1, 1, 1}).bits, 0xFFFFFFFFU);
+}
+
+TEST(Packed, UNorm1010102BatchRoundTrip) {
+    std::vector<Vec4> src;
+    for (int i = 0; i <= 1000; i++) {
+        const f32 t = static_cast<f32>(i) / 1000.0F;
+        src.push_back({t, 1.0F - t, t * t, static_cast<f32>(i % 4) / 3.0F});
+    }
+    std::vector<Packed1010102> encoded(src.size());
+    Packed::encode_unorm1010102(src, encoded);
+    std::vector<Vec4> decoded(src.size());
+    Packed::decode_unorm1010102(encoded, decoded);
+
+    const float bound = 0.5F / 1023.0F + 1e-6F;
+    for (usize i = 0; i < src.size(); i++) {
+        EXPECT_EQ(encoded[i], encode_unorm1010102(src[i]));
+        EXPECT_NEAR(decoded[i].x, src[i].x, bound);
+        EXPECT_NEAR(decoded[i].y, src[i].y, bound);
+        EXPECT_NEAR(decoded[i].z, src[i].z, bound);
+        EXPECT_NEAR(decoded[i].w, src[i].w, 1e-6F);
+    }
+}
+
+TEST(Packed, SNorm1010102ErrorBound) {
+    const auto normals = random_unit_vectors(10000);
+    std::vector<Vec4> src;
+    for (usize i = 0; i < normals.size(); i++) {
+        src.push_back({normals[i].x, normals[i].y, normals[i].z, i % 2 == 0 ? 1.0F : -1.0F});
+    }
+    std::vector<Packed1010102> encoded(src.size());
+    Packed::encode_snorm1010102(src, encoded);
+    std::vector<Vec4> decoded(src.size());
+    Packed::decode_snorm1010102(encoded, decoded);
+
+    const float bound = 0.5F / 511.0F + 1e-6F;
+    for (usize i = 0; i < src.size(); i++) {
+        EXPECT_NEAR(decoded[i].x, src[i].x, bound);
+        EXPECT_NEAR(decoded[i].y, src[i].y, bound);
+        EXPECT_NEAR(decoded[i].z, src[i].z, bound);
+        EXPECT_EQ(decoded[i].w, src[i].w);
+    }
+}
+// NOLINTEND(*)
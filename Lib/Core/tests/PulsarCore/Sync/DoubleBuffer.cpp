@@ -0,0 +1,64 @@
+// NOLINTBEGIN(*)
+#include "PulsarCore/Sync/DoubleBuffer.hpp"
+
+#include <array>
+#include <atomic>
+#include <gtest/gtest.h>
+#include <thread>
+
+using namespace Pulsar;
+
+namespace {
+    /// Every word holds the same value, a torn copy would mix two of them
+    struct Snapshot_t {
+        std::array<u64, 12> m_Words;
+    };
+
+    Snapshot_t make_snapshot(u64 value) {
+        Snapshot_t snapshot;
+        snapshot.m_Words.fill(value);
+        return snapshot;
+    }
+} // namespace
+
+TEST(DoubleBuffer, ReadsLatestPublished) {
+    DoubleBuffer<Snapshot_t> buffer(make_snapshot(7));
+    EXPECT_EQ(buffer.version(), 0U);
+    EXPECT_EQ(buffer.read().m_Words[11], 7U);
+
+    buffer.publish(make_snapshot(1));
+    buffer.publish(make_snapshot(2));
+    buffer.publish(make_snapshot(3));
+    Snapshot_t out;
+    EXPECT_EQ(buffer.read(out), 3U);
+    EXPECT_EQ(out.m_Words[0], 3U);
+    EXPECT_EQ(out.m_Words[11], 3U);
+}
+
+TEST(DoubleBuffer, ReadersNeverSeeTornValues) {
+    constexpr u64            PUBLISHES = 200'000;
+    DoubleBuffer<Snapshot_t> buffer(make_snapshot(0));
+    std::atomic<bool>        done {false};
+    std::thread              writer([&] {
+        for (u64 i = 1; i <= PUBLISHES; i++) {
+            buffer.publish(make_snapshot(i));
+        }
+        done.store(true, std::memory_order_release);
+    });
+
+    u64 last = 0;
+    while (!done.load(std::memory_order_acquire)) {
+        Snapshot_t out;
+        const u64  version = buffer.read(out);
+        for (u64 word : out.m_Words) {
+            ASSERT_EQ(word, version);
+        }
+        // Versions only move forward
+        ASSERT_GE(version, last);
+        last = version;
+        std::this_thread::yield();
+    }
+    writer.join();
+    EXPECT_EQ(buffer.read().m_Words[5], PUBLISHES);
+}
+// NOLINTEND(*)
@@ -0,0 +1,178 @@
+// NOLINTBEGIN(*)
+#include "PulsarCore/Sync/Event.hpp"
+#include "PulsarCore/Sync/Mutex.hpp"
+#include "PulsarCore/Sync/SharedMutex.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+using namespace Pulsar;
+
+namespace {
+    constexpr u32 THREADS    = 4;
+    constexpr u32 INCREMENTS = 20'000;
+
+    /// Every thread increments a plain counter under the lock, any lost update shows a hole in
+    /// mutual exclusion
+    template<typename L> void run_counter_stress(L& lock) {
+        u64                      counter = 0;
+        std::vector<std::thread> threads;
+        for (u32 t = 0; t < THREADS; t++) {
+            threads.emplace_back([&] {
+                for (u32 i = 0; i < INCREMENTS; i++) {
+                    std::lock_guard guard(lock);
+                    counter++;
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        EXPECT_EQ(counter, u64(THREADS) * INCREMENTS);
+    }
+} // namespace
+
+TEST(Mutex, TryLockFailsWhileHeld) {
+    Mutex mutex;
+    EXPECT_TRUE(mutex.try_lock());
+    EXPECT_FALSE(mutex.try_lock());
+    mutex.unlock();
+    EXPECT_TRUE(mutex.try_lock());
+    mutex.unlock();
+}
+
+TEST(Mutex, ExcludesUnderContention) {
+    Mutex mutex;
+    run_counter_stress(mutex);
+}
+
+TEST(Mutex, WakesSleepingWaiter) {
+    Mutex            mutex;
+    std::atomic<int> stage {0};
+    mutex.lock();
+    std::thread waiter([&] {
+        stage = 1;
+        std::lock_guard guard(mutex);
+        stage = 2;
+    });
+    while (stage.load() != 1) {
+        std::this_thread::yield();
+    }
+    // Long enough for the waiter to give up spinning
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(stage.load(), 1);
+    mutex.unlock();
+    waiter.join();
+    EXPECT_EQ(stage.load(), 2);
+}
+
+TEST(TicketLock, ExcludesUnderContention) {
+    TicketLock lock;
+    run_counter_stress(lock);
+}
+
+TEST(TicketLock, TryLockFailsWhileHeld) {
+    TicketLock lock;
+    EXPECT_TRUE(lock.try_lock());
+    EXPECT_FALSE(lock.try_lock());
+    lock.unlock();
+    EXPECT_TRUE(lock.try_lock());
+    lock.unlock();
+}
+
+TEST(SharedMutex, ExcludesWritersFromEachOther) {
+    SharedMutex mutex;
+    run_counter_stress(mutex);
+}
+
+TEST(SharedMutex, ReadersShareAndExcludeWriters) {
+    SharedMutex mutex;
+    {
+        std::shared_lock first(mutex);
+        std::thread      reader([&] {
+            std::shared_lock second(mutex);
+            EXPECT_FALSE(mutex.try_lock());
+        });
+        reader.join();
+        EXPECT_FALSE(mutex.try_lock());
+    }
+    EXPECT_TRUE(mutex.try_lock());
+    std::thread reader([&] { EXPECT_FALSE(mutex.try_lock_shared()); });
+    reader.join();
+    mutex.unlock();
+    EXPECT_TRUE(mutex.try_lock_shared());
+    mutex.unlock_shared();
+}
+
+TEST(SharedMutex, ReadersSeeConsistentWrites) {
+    // Writers keep both halves equal, readers must never see them differ
+    SharedMutex              mutex;
+    u64                      first  = 0;
+    u64                      second = 0;
+    std::atomic<bool>        torn {false};
+    std::atomic<bool>        stop {false};
+    std::vector<std::thread> threads;
+    for (u32 t = 0; t < THREADS; t++) {
+        threads.emplace_back([&] {
+            while (!stop.load(std::memory_order_relaxed)) {
+                std::shared_lock lock(mutex);
+                if (first != second) {
+                    torn = true;
+                }
+            }
+        });
+    }
+    for (u32 t = 0; t < 2; t++) {
+        threads.emplace_back([&] {
+            for (u32 i = 0; i < 2'000; i++) {
+                std::lock_guard lock(mutex);
+                first++;
+                second++;
+            }
+        });
+    }
+    threads[THREADS].join();
+    threads[THREADS + 1].join();
+    stop = true;
+    for (u32 t = 0; t < THREADS; t++) {
+        threads[t].join();
+    }
+    EXPECT_FALSE(torn);
+    EXPECT_EQ(first, 4'000U);
+}
+
+TEST(Event, WakesAllWaitersAndStaysSet) {
+    Event                    event;
+    std::atomic<u32>         woken {0};
+    std::vector<std::thread> threads;
+    for (u32 t = 0; t < THREADS; t++) {
+        threads.emplace_back([&] {
+            event.wait();
+            woken++;
+        });
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_EQ(woken.load(), 0U);
+    EXPECT_FALSE(event.is_set());
+    event.set();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(woken.load(), THREADS);
+    EXPECT_TRUE(event.is_set());
+    event.wait();
+    event.reset();
+    EXPECT_FALSE(event.is_set());
+}
+
+TEST(Event, StartsSetWhenAsked) {
+    Event event(true);
+    EXPECT_TRUE(event.is_set());
+    event.wait();
+}
+// NOLINTEND(*)
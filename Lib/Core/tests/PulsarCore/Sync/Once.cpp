@@ -0,0 +1,101 @@
+// NOLINTBEGIN(*)
+#include "PulsarCore/Sync/Event.hpp"
+#include "PulsarCore/Sync/Once.hpp"
+#include "PulsarCore/Util/Macros.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace Pulsar;
+
+namespace {
+    int g_FirstRuns  = 0;
+    int g_SecondRuns = 0;
+
+    void run_twice_in_one_scope() {
+        for (int i = 0; i < 3; i++) {
+            PULSAR_RUN_ONCE {
+                g_FirstRuns++;
+            }
+            PULSAR_RUN_ONCE {
+                g_SecondRuns++;
+            }
+        }
+    }
+} // namespace
+
+TEST(OnceFlag, RunsOnceAcrossThreadsAndLateCallersWait) {
+    OnceFlag                 flag;
+    std::atomic<int>         runs {0};
+    std::atomic<int>         sawResult {0};
+    int                      result = 0;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; t++) {
+        threads.emplace_back([&] {
+            call_once(flag, [&] {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                result = 42;
+                runs++;
+            });
+            // Everyone returns after the winner finished
+            if (result == 42) {
+                sawResult++;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(runs.load(), 1);
+    EXPECT_EQ(sawResult.load(), 8);
+    EXPECT_TRUE(flag.is_done());
+}
+
+TEST(OnceFlag, RetriesAfterAnException) {
+    OnceFlag flag;
+    int      attempts = 0;
+    EXPECT_THROW(call_once(flag,
+                           [&] {
+                               attempts++;
+                               throw std::runtime_error("failed");
+                           }),
+                 std::runtime_error);
+    EXPECT_FALSE(flag.is_done());
+    call_once(flag, [&] { attempts++; });
+    call_once(flag, [&] { attempts++; });
+    EXPECT_EQ(attempts, 2);
+}
+
+TEST(OnceFlag, WakesWaitersWhenTheFirstCallFails) {
+    OnceFlag    flag;
+    Event       started;
+    Event       release;
+    std::thread first([&] {
+        EXPECT_THROW(call_once(flag,
+                               [&] {
+                                   started.set();
+                                   release.wait();
+                                   throw std::runtime_error("failed");
+                               }),
+                     std::runtime_error);
+    });
+    started.wait();
+    std::thread second([&] { call_once(flag, [] {}); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    release.set();
+    first.join();
+    second.join();
+    EXPECT_TRUE(flag.is_done());
+}
+
+TEST(OnceFlag, RunOnceMacroKeepsEachBlockSeparate) {
+    run_twice_in_one_scope();
+    run_twice_in_one_scope();
+    EXPECT_EQ(g_FirstRuns, 1);
+    EXPECT_EQ(g_SecondRuns, 1);
+}
+// NOLINTEND(*)
@@ -0,0 +1,355 @@
+// NOLINTBEGIN(*)
+#include "PulsarCore/Sync/BlockingQueue.hpp"
+#include "PulsarCore/Sync/MpmcQueue.hpp"
+#include "PulsarCore/Sync/MpscQueue.hpp"
+#include "PulsarCore/Sync/SpscQueue.hpp"
+
+#include <array>
+#include <atomic>
+#include <gtest/gtest.h>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+using namespace Pulsar;
+
+namespace {
+    constexpr u64 SPSC_ITEMS = 1'000'000;
+    constexpr u64 MPMC_ITEMS = 100'000;
+
+    struct Tracked_t {
+        static inline std::atomic<int> s_Alive {0};
+
+        Tracked_t() {
+            s_Alive++;
+        }
+
+        explicit Tracked_t(int value) : m_Value(std::make_unique<int>(value)) {
+            s_Alive++;
+        }
+
+        Tracked_t(Tracked_t&& other) noexcept : m_Value(std::move(other.m_Value)) {
+            s_Alive++;
+        }
+
+        Tracked_t& operator=(Tracked_t&& other) noexcept {
+            m_Value = std::move(other.m_Value);
+            return *this;
+        }
+
+        ~Tracked_t() {
+            s_Alive--;
+        }
+
+        std::unique_ptr<int> m_Value;
+    };
+
+    struct Message_t : MpscNode_t {
+        u32 m_Producer = 0;
+        u64 m_Sequence = 0;
+    };
+
+    /// Producers push (producer, sequence) pairs, consumers check every pair arrives exactly
+    /// once and each producer's pairs in order per consumer
+    template<typename Q> void run_mpmc_stress(Q& queue, u32 producers, u32 consumers) {
+        std::vector<std::atomic<u32>> seen(producers * MPMC_ITEMS);
+        std::atomic<u64>              popped {0};
+        std::atomic<bool>             ordered {true};
+        std::vector<std::thread>      threads;
+        for (u32 p = 0; p < producers; p++) {
+            threads.emplace_back([&, p] {
+                for (u64 i = 0; i < MPMC_ITEMS; i++) {
+                    u64 value = p * MPMC_ITEMS + i;
+                    while (!queue.try_push(std::move(value))) {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+        for (u32 c = 0; c < consumers; c++) {
+            threads.emplace_back([&] {
+                std::vector<i64> last(producers, -1);
+                u64              value = 0;
+                while (popped.load(std::memory_order_relaxed) < producers * MPMC_ITEMS) {
+                    if (!queue.try_pop(value)) {
+                        std::this_thread::yield();
+                        continue;
+                    }
+                    popped.fetch_add(1, std::memory_order_relaxed);
+                    seen[value].fetch_add(1, std::memory_order_relaxed);
+                    const u64 producer = value / MPMC_ITEMS;
+                    const auto sequence = static_cast<i64>(value % MPMC_ITEMS);
+                    if (sequence <= last[producer]) {
+                        ordered = false;
+                    }
+                    last[producer] = sequence;
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        EXPECT_TRUE(ordered);
+        for (const auto& count : seen) {
+            ASSERT_EQ(count.load(), 1U);
+        }
+    }
+} // namespace
+
+TEST(SpscQueue, RoundsCapacityAndReportsFullAndEmpty) {
+    SpscQueue<int> queue(5);
+    EXPECT_EQ(queue.capacity(), 8U);
+    int out = 0;
+    EXPECT_FALSE(queue.try_pop(out));
+    for (int i = 0; i < 8; i++) {
+        EXPECT_TRUE(queue.try_push(i));
+    }
+    EXPECT_FALSE(queue.try_push(8));
+    EXPECT_EQ(queue.size_approx(), 8U);
+    for (int i = 0; i < 8; i++) {
+        ASSERT_TRUE(queue.try_pop(out));
+        EXPECT_EQ(out, i);
+    }
+    EXPECT_FALSE(queue.try_pop(out));
+}
+
+TEST(SpscQueue, KeepsOrderAcrossThreads) {
+    SpscQueue<u64> queue(1024);
+    std::thread    producer([&] {
+        for (u64 i = 0; i < SPSC_ITEMS; i++) {
+            while (!queue.try_push(i)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+    u64 expected = 0;
+    u64 value    = 0;
+    while (expected < SPSC_ITEMS) {
+        if (queue.try_pop(value)) {
+            ASSERT_EQ(value, expected);
+            expected++;
+        }
+        else {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+}
+
+TEST(SpscQueue, BatchesKeepOrderAcrossThreads) {
+    SpscQueue<u64> queue(256);
+    std::thread    producer([&] {
+        std::array<u64, 37> batch {};
+        u64                 next = 0;
+        while (next < SPSC_ITEMS) {
+            const usize size = std::min<u64>(batch.size(), SPSC_ITEMS - next);
+            for (usize i = 0; i < size; i++) {
+                batch[i] = next + i;
+            }
+            usize pushed = 0;
+            while (pushed < size) {
+                const usize count =
+                    queue.push_batch(std::span(batch).subspan(pushed, size - pushed));
+                pushed += count;
+                if (count == 0) {
+                    std::this_thread::yield();
+                }
+            }
+            next += size;
+        }
+    });
+    std::array<u64, 64> out {};
+    u64                 expected = 0;
+    while (expected < SPSC_ITEMS) {
+        const usize count = queue.pop_batch(out);
+        for (usize i = 0; i < count; i++) {
+            ASSERT_EQ(out[i], expected++);
+        }
+        if (count == 0) {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+}
+
+TEST(SpscQueue, DestroysRemainingElements) {
+    Tracked_t::s_Alive = 0;
+    {
+        SpscQueue<Tracked_t> queue(4);
+        EXPECT_TRUE(queue.try_emplace(1));
+        EXPECT_TRUE(queue.try_emplace(2));
+        EXPECT_TRUE(queue.try_emplace(3));
+        Tracked_t out;
+        ASSERT_TRUE(queue.try_pop(out));
+        EXPECT_EQ(*out.m_Value, 1);
+        EXPECT_EQ(Tracked_t::s_Alive, 3);
+    }
+    EXPECT_EQ(Tracked_t::s_Alive, 0);
+}
+
+TEST(MpmcQueue, RoundsCapacityAndReportsFullAndEmpty) {
+    MpmcQueue<int> queue(3);
+    EXPECT_EQ(queue.capacity(), 4U);
+    std::array<int, 6> values {1, 2, 3, 4, 5, 6};
+    EXPECT_EQ(queue.push_batch(values), 4U);
+    std::array<int, 6> out {};
+    EXPECT_EQ(queue.pop_batch(out), 4U);
+    EXPECT_EQ(out[0], 1);
+    EXPECT_EQ(out[3], 4);
+    EXPECT_EQ(queue.pop_batch(out), 0U);
+}
+
+TEST(MpmcQueue, DestroysRemainingElements) {
+    Tracked_t::s_Alive = 0;
+    {
+        MpmcQueue<Tracked_t> queue(4);
+        EXPECT_TRUE(queue.try_emplace(1));
+        EXPECT_TRUE(queue.try_emplace(2));
+        EXPECT_EQ(Tracked_t::s_Alive, 2);
+    }
+    EXPECT_EQ(Tracked_t::s_Alive, 0);
+}
+
+TEST(MpmcQueue, DeliversEachValueExactlyOnce) {
+    for (const auto& [producers, consumers] : {std::pair {1U, 4U}, {4U, 1U}, {4U, 4U}}) {
+        MpmcQueue<u64> queue(64);
+        run_mpmc_stress(queue, producers, consumers);
+        EXPECT_EQ(queue.size_approx(), 0U);
+    }
+}
+
+TEST(MpscQueue, KeepsPerProducerOrder) {
+    constexpr u32 PRODUCERS = 4;
+    constexpr u64 ITEMS     = 50'000;
+
+    std::vector<Message_t> messages(PRODUCERS * ITEMS);
+    MpscQueue<Message_t>   queue;
+    std::vector<std::thread> threads;
+    for (u32 p = 0; p < PRODUCERS; p++) {
+        threads.emplace_back([&, p] {
+            std::array<Message_t*, 10> batch {};
+            for (u64 i = 0; i < ITEMS; i += batch.size()) {
+                // Alternate single pushes and chains
+                for (usize j = 0; j < batch.size(); j++) {
+                    Message_t& message = messages[p * ITEMS + i + j];
+                    message.m_Producer = p;
+                    message.m_Sequence = i + j;
+                    batch[j]           = &message;
+                }
+                if (i % 20 == 0) {
+                    queue.push_batch(batch);
+                }
+                else {
+                    for (Message_t* message : batch) {
+                        queue.push(*message);
+                    }
+                }
+            }
+        });
+    }
+    std::array<u64, PRODUCERS>  next {};
+    std::array<Message_t*, 16> out {};
+    u64                        received = 0;
+    while (received < PRODUCERS * ITEMS) {
+        const usize count = queue.pop_batch(out);
+        for (usize i = 0; i < count; i++) {
+            ASSERT_EQ(out[i]->m_Sequence, next[out[i]->m_Producer]++);
+        }
+        received += count;
+        if (count == 0) {
+            std::this_thread::yield();
+        }
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(queue.pop(), nullptr);
+}
+
+template<typename W> class BlockingQueueTest : public testing::Test {
+protected:
+    void SetUp() override {
+        // A spinning waiter holds the only core until it is preempted
+        if (std::is_same_v<W, SpinWait> && std::thread::hardware_concurrency() < 2) {
+            GTEST_SKIP() << "SpinWait needs a second core";
+        }
+    }
+};
+using WaitStrategies = testing::Types<SpinWait, YieldWait, FutexWait>;
+TYPED_TEST_SUITE(BlockingQueueTest, WaitStrategies);
+
+TYPED_TEST(BlockingQueueTest, SpscHandsOverEveryValue) {
+    constexpr u64 ITEMS = 200'000;
+
+    // A tiny queue, so both sides block often
+    BlockingQueue<SpscQueue<u64>, TypeParam> queue(4);
+    std::thread                              producer([&] {
+        for (u64 i = 0; i < ITEMS; i++) {
+            queue.push(i);
+        }
+    });
+    for (u64 i = 0; i < ITEMS; i++) {
+        ASSERT_EQ(queue.pop(), i);
+    }
+    producer.join();
+}
+
+TYPED_TEST(BlockingQueueTest, MpmcBatchesHandOverEveryValue) {
+    constexpr u32 PRODUCERS = 3;
+    constexpr u64 ITEMS     = 30'000;
+
+    BlockingQueue<MpmcQueue<u64>, TypeParam> queue(8);
+    std::vector<std::thread>                 threads;
+    std::atomic<u64>                         sum {0};
+    std::atomic<u64>                         received {0};
+    for (u32 p = 0; p < PRODUCERS; p++) {
+        threads.emplace_back([&] {
+            std::array<u64, 5> batch {};
+            for (u64 i = 0; i < ITEMS; i += batch.size()) {
+                for (usize j = 0; j < batch.size(); j++) {
+                    batch[j] = i + j + 1;
+                }
+                queue.push_batch(batch);
+            }
+        });
+    }
+    for (u32 c = 0; c < 2; c++) {
+        threads.emplace_back([&] {
+            std::array<u64, 7> out {};
+            while (true) {
+                const usize count = queue.pop_batch(out);
+                usize       stops = 0;
+                for (usize i = 0; i < count; i++) {
+                    if (out[i] == 0) {
+                        stops++;
+                    }
+                    sum += out[i];
+                }
+                received += count - stops;
+                if (stops != 0) {
+                    // Hand the stop values meant for the other consumer back
+                    for (usize i = 1; i < stops; i++) {
+                        queue.push(0);
+                    }
+                    return;
+                }
+            }
+        });
+    }
+    for (u32 p = 0; p < PRODUCERS; p++) {
+        threads[p].join();
+    }
+    while (received.load() < PRODUCERS * ITEMS) {
+        std::this_thread::yield();
+    }
+    // One stop value per consumer
+    queue.push(0);
+    queue.push(0);
+    for (usize i = PRODUCERS; i < threads.size(); i++) {
+        threads[i].join();
+    }
+    EXPECT_EQ(sum.load(), PRODUCERS * ITEMS * (ITEMS + 1) / 2);
+}
+// NOLINTEND(*)
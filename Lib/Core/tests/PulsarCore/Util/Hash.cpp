@@ -0,0 +1,41 @@
+// NOLINTBEGIN(*)
+#include "PulsarCore/Util/Hash.hpp"
+
+#include <gtest/gtest.h>
+#include <string_view>
+#include <vector>
+
+using namespace Pulsar;
+
+namespace {
+    std::span<const std::byte> bytes(std::string_view text) {
+        return std::as_bytes(std::span(text.data(), text.size()));
+    }
+} // namespace
+
+TEST(Hash, Fnv1aMatchesReference) {
+    static_assert(fnv1a_64("") == 0xcbf29ce484222325);
+    EXPECT_EQ(fnv1a_64("a"), 0xaf63dc4c8601ec8c);
+    EXPECT_EQ(fnv1a_64("foobar"), 0x85944171f73967e8);
+}
+
+TEST(Hash, Crc32cMatchesReference) {
+    EXPECT_EQ(crc32c(bytes("")), 0u);
+    EXPECT_EQ(crc32c(bytes("123456789")), 0xe3069283u);
+    // 32 zero bytes, from RFC 3720
+    const std::vector<std::byte> zeros(32);
+    EXPECT_EQ(crc32c(zeros), 0x8a9136aau);
+}
+
+TEST(Hash, Crc32cContinues) {
+    // Odd sizes exercise the byte tail after the 8-byte steps
+    std::vector<std::byte> data(1001);
+    for (usize i = 0; i < data.size(); i++) {
+        data[i] = std::byte(i * 31 + 7);
+    }
+    const std::span<const std::byte> all = data;
+    for (usize split : {0, 1, 7, 8, 500, 1001}) {
+        EXPECT_EQ(crc32c(all.subspan(split), crc32c(all.first(split))), crc32c(all));
+    }
+}
+// NOLINTEND(*)
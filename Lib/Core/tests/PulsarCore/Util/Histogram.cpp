@@ -0,0 +1,44 @@
+// NOLINTBEGIN(*)
+#include "PulsarCore/Util/Histogram.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace Pulsar;
+
+TEST(LatencyHistogram, SmallValuesAreExact) {
+    LatencyHistogram histogram;
+    EXPECT_EQ(histogram.percentile(0.5), 0U);
+    for (u64 i = 1; i <= 10; i++) {
+        histogram.record(i);
+    }
+    EXPECT_EQ(histogram.count(), 10U);
+    EXPECT_EQ(histogram.min(), 1U);
+    EXPECT_EQ(histogram.max(), 10U);
+    EXPECT_DOUBLE_EQ(histogram.mean(), 5.5);
+    EXPECT_EQ(histogram.percentile(0.5), 5U);
+    EXPECT_EQ(histogram.percentile(0.9), 9U);
+    EXPECT_EQ(histogram.percentile(1.0), 10U);
+    EXPECT_EQ(histogram.percentile(0.0), 1U);
+}
+
+TEST(LatencyHistogram, PercentilesWithinBucketError) {
+    LatencyHistogram histogram;
+    // 1 ms to 100 ms in 10 µs steps, like frame times in nanoseconds
+    for (u64 ns = 1'000'000; ns <= 100'000'000; ns += 10'000) {
+        histogram.record(ns);
+    }
+    const auto near = [](u64 actual, f64 expected) {
+        return std::abs(static_cast<f64>(actual) - expected) <= expected * 0.031;
+    };
+    EXPECT_TRUE(near(histogram.percentile(0.5), 50'500'000.0));
+    EXPECT_TRUE(near(histogram.percentile(0.99), 99'010'000.0));
+    EXPECT_EQ(histogram.max(), 100'000'000U);
+    EXPECT_EQ(histogram.percentile(1.0), 100'000'000U);
+
+    histogram.record(~u64 {0});
+    EXPECT_EQ(histogram.max(), ~u64 {0});
+    histogram.reset();
+    EXPECT_EQ(histogram.count(), 0U);
+    EXPECT_EQ(histogram.max(), 0U);
+}
+// NOLINTEND(*)
@@ -0,0 +1,64 @@
+// NOLINTBEGIN(*)
+#include "PulsarCore/Util/PerfCounters.hpp"
+
+#include <gtest/gtest.h>
+#include <thread>
+
+using namespace Pulsar;
+
+namespace {
+    u64 busy_work() {
+        volatile u64 sum = 0;
+        for (u64 i = 0; i < 1'000'000; i++) {
+            sum = sum + i * i;
+        }
+        return sum;
+    }
+} // namespace
+
+TEST(PerfCounters, DifferenceKeepsCommonCounters) {
+    PerfCounterValues_t start;
+    start.m_Values[0] = 10;
+    start.m_Values[1] = 20;
+    start.m_Available = 0b11;
+    PerfCounterValues_t end;
+    end.m_Values[0] = 15;
+    end.m_Values[1] = 50;
+    end.m_Values[2] = 7;
+    end.m_Available = 0b101;
+
+    const PerfCounterValues_t delta = end - start;
+    EXPECT_TRUE(delta.has(PerfCounter::Cycles));
+    EXPECT_FALSE(delta.has(PerfCounter::Instructions));
+    EXPECT_FALSE(delta.has(PerfCounter::CacheMisses));
+    EXPECT_EQ(delta.get(PerfCounter::Cycles), 5u);
+}
+
+TEST(PerfCounters, CountsOrExplainsWhyNot) {
+    const PerfCounterGroup&   group = PerfCounterGroup::for_current_thread();
+    const PerfCounterValues_t start = group.read();
+    busy_work();
+    const PerfCounterValues_t delta = group.read() - start;
+    if (!group.is_available()) {
+        EXPECT_FALSE(group.error().empty());
+        EXPECT_EQ(delta.m_Available, 0u);
+        GTEST_SKIP() << group.error();
+    }
+    for (usize i = 0; i < PERF_COUNTER_COUNT; i++) {
+        const auto counter = static_cast<PerfCounter>(i);
+        EXPECT_EQ(group.has(counter), delta.has(counter)) << to_string(counter);
+    }
+    if (delta.has(PerfCounter::Instructions)) {
+        // Each iteration is at least a multiply and an add
+        EXPECT_GE(delta.get(PerfCounter::Instructions), 2'000'000u);
+    }
+}
+
+TEST(PerfCounters, GroupsArePerThread) {
+    const PerfCounterGroup* main  = &PerfCounterGroup::for_current_thread();
+    const PerfCounterGroup* other = nullptr;
+    std::thread([&other] { other = &PerfCounterGroup::for_current_thread(); }).join();
+    EXPECT_NE(main, other);
+    EXPECT_EQ(main, &PerfCounterGroup::for_current_thread());
+}
+// NOLINTEND(*)
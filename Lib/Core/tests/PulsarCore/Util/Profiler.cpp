@@ -0,0 +1,116 @@
+// NOLINTBEGIN(*)
+#ifndef PULSAR_PROFILE
+    #define PULSAR_PROFILE
+#endif
+#include "PulsarCore/Util/Profiler.hpp"
+
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+
+using namespace Pulsar;
+
+namespace {
+    usize count_of(const std::string& text, std::string_view needle) {
+        usize count = 0;
+        for (usize position = text.find(needle); position != std::string::npos;
+             position       = text.find(needle, position + needle.size())) {
+            count++;
+        }
+        return count;
+    }
+
+    void profiled_function() {
+        PULSAR_PROFILE_FUNCTION();
+    }
+} // namespace
+
+TEST(Profiler, RecordsOnlyWhileStarted) {
+    Profiler::start();
+    Profiler::stop();
+    PULSAR_PROFILE_SCOPE("Ignored");
+    EXPECT_FALSE(Profiler::is_enabled());
+    EXPECT_EQ(Profiler::event_count(), 0u);
+}
+
+TEST(Profiler, ExportsZonesFramesAndCounters) {
+    Profiler::start();
+    PULSAR_PROFILE_THREAD_NAME("Main \"thread\"");
+    {
+        PULSAR_PROFILE_SCOPE("Outer");
+        profiled_function();
+        PULSAR_PROFILE_COUNTER("Entities", 42.5);
+    }
+    PULSAR_PROFILE_FRAME("Frame");
+    std::thread([] {
+        PULSAR_PROFILE_THREAD_NAME("Worker");
+        PULSAR_PROFILE_SCOPE("Job");
+    }).join();
+    Profiler::stop();
+
+    EXPECT_EQ(Profiler::event_count(), 8u);
+    const std::string trace = Profiler::chrome_trace();
+    EXPECT_TRUE(trace.starts_with(R"({"displayTimeUnit":"ns","traceEvents":[)"));
+    EXPECT_TRUE(trace.ends_with("]}\n"));
+    EXPECT_EQ(count_of(trace, "{"), count_of(trace, "}"));
+    EXPECT_EQ(count_of(trace, R"("ph":"B")"), 3u);
+    EXPECT_EQ(count_of(trace, R"("ph":"E")"), 3u);
+    EXPECT_EQ(count_of(trace, R"("name":"profiled_function","ph":"B")"), 1u);
+    EXPECT_EQ(count_of(trace, R"("name":"Frame","ph":"i")"), 1u);
+    EXPECT_EQ(count_of(trace, R"("args":{"value":42.5})"), 1u);
+    EXPECT_EQ(count_of(trace, R"("args":{"name":"Main \"thread\""})"), 1u);
+    EXPECT_EQ(count_of(trace, R"("args":{"name":"Worker"})"), 1u);
+}
+
+TEST(Profiler, BalancesZonesCutBySession) {
+    Profiler::start();
+    Profiler::end_zone("StartedBefore");
+    Profiler::begin_zone("Outer");
+    Profiler::begin_zone("StillOpen");
+    Profiler::end_zone("StillOpen");
+    Profiler::begin_zone("StoppedAfter");
+    Profiler::stop();
+
+    const std::string trace = Profiler::chrome_trace();
+    EXPECT_EQ(count_of(trace, R"("ph":"B")"), 3u);
+    EXPECT_EQ(count_of(trace, R"("ph":"E")"), 3u);
+    EXPECT_EQ(count_of(trace, "StartedBefore"), 0u);
+}
+
+TEST(Profiler, AttachesPerfCountersToZones) {
+    Profiler::start({.m_PerfCounters = true});
+    EXPECT_TRUE(Profiler::is_perf_enabled());
+    {
+        PULSAR_PROFILE_SCOPE("Counted");
+        profiled_function();
+    }
+    Profiler::stop();
+    EXPECT_FALSE(Profiler::is_perf_enabled());
+
+    const std::string trace = Profiler::chrome_trace();
+    EXPECT_EQ(count_of(trace, R"("ph":"B")"), 2u);
+    EXPECT_EQ(count_of(trace, R"("ph":"E")"), 2u);
+    EXPECT_EQ(count_of(trace, "{"), count_of(trace, "}"));
+    // Both zones carry the counters that can be read on their end event
+    const PerfCounterValues_t values = PerfCounterGroup::for_current_thread().read();
+    for (usize i = 0; i < PERF_COUNTER_COUNT; i++) {
+        const auto        counter = static_cast<PerfCounter>(i);
+        const std::string key     = std::string("\"") + to_string(counter) + "\":";
+        EXPECT_EQ(count_of(trace, key), values.has(counter) ? 2u : 0u) << trace;
+    }
+}
+
+TEST(Profiler, GrowsAndRestartsEmpty) {
+    Profiler::start();
+    for (int i = 0; i < 10000; i++) {
+        PULSAR_PROFILE_SCOPE("Loop");
+    }
+    Profiler::stop();
+    EXPECT_EQ(Profiler::event_count(), 20000u);
+
+    Profiler::start();
+    PULSAR_PROFILE_FRAME("Frame");
+    Profiler::stop();
+    EXPECT_EQ(Profiler::event_count(), 1u);
+}
+// NOLINTEND(*)
@@ -0,0 +1,49 @@
+#include "PulsarCore/Log/BinaryLog.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <span>
+#include <string_view>
+#include <vector>
+
+/// Turns a binary log written by `LogMode::Binary` back into text
+/// Usage: PulsarLogDecode <input.plog> [output.txt]
+int main(int argc, char* argv[]) {
+    const std::span<char*> args(argv, static_cast<size_t>(argc));
+    if (args.size() < 2 || args.size() > 3) {
+        fmt::print(stderr, "Usage: {} <input.plog> [output.txt]\n", args[0]);
+        return 2;
+    }
+
+    std::ifstream input(args[1], std::ios::binary);
+    if (!input) {
+        fmt::print(stderr, "Failed to open {}\n", args[1]);
+        return 1;
+    }
+    const std::vector<Pulsar::u8> data(
+        (std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+
+    std::FILE* output = stdout;
+    if (args.size() == 3) {
+        output = std::fopen(args[2], "w");
+        if (output == nullptr) {
+            fmt::print(stderr, "Failed to create {}\n", args[2]);
+            return 1;
+        }
+    }
+
+    const auto records = Pulsar::BinaryLog::decode(data, [output](std::string_view line) {
+        std::fwrite(line.data(), 1, line.size(), output);
+        std::fputc('\n', output);
+    });
+    if (output != stdout) {
+        std::fclose(output);
+    }
+    if (!records.has_value()) {
+        fmt::print(stderr, "Failed to decode {}: {}\n", args[1], records.error());
+        return 1;
+    }
+    fmt::print(stderr, "Decoded {} records\n", records.value());
+    return 0;
+}
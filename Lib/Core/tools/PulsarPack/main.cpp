@@ -0,0 +1,78 @@
+#include "PulsarCore/IO/Package.hpp"
+#include "PulsarCore/IO/PackageWriter.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <fmt/format.h>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+namespace {
+    /// Packs every regular file under `directory`, named by its path relative to it
+    int pack(const std::filesystem::path& output, const std::filesystem::path& directory) {
+        std::error_code                    error;
+        std::vector<std::filesystem::path> files;
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(directory, error)) {
+            if (entry.is_regular_file()) {
+                files.push_back(entry.path());
+            }
+        }
+        if (error) {
+            fmt::print(stderr, "Failed to list {}: {}\n", directory.string(), error.message());
+            return 1;
+        }
+        // Sorted, so the same directory always gives the same package
+        std::ranges::sort(files);
+
+        Pulsar::PackageWriter writer;
+        for (const auto& file : files) {
+            writer.add_file(file.lexically_relative(directory).generic_string(), file);
+        }
+        const auto size = writer.write(output);
+        if (!size.has_value()) {
+            fmt::print(stderr, "Failed to write {}: {}\n", output.string(), size.error());
+            return 1;
+        }
+        fmt::print(stderr, "Packed {} files into {} ({} bytes)\n", writer.size(), output.string(),
+            size.value());
+        return 0;
+    }
+
+    /// Lists the entries of `input` and checks every blob against its checksum
+    int list(const std::filesystem::path& input) {
+        const auto package = Pulsar::Package::open(input);
+        if (!package.has_value()) {
+            fmt::print(stderr, "Failed to open {}\n", package.error());
+            return 1;
+        }
+        Pulsar::usize corrupt = 0;
+        for (const Pulsar::PackageEntry_t& entry : package->entries()) {
+            const bool valid = package->verify(entry);
+            corrupt += valid ? 0 : 1;
+            fmt::print("{:>12} {:>10} {:08x} {}{}\n", entry.m_Offset, entry.m_Size,
+                entry.m_Checksum, package->name(entry), valid ? "" : " (corrupt)");
+        }
+        fmt::print(stderr, "{} entries, {} corrupt\n", package->entries().size(), corrupt);
+        return corrupt == 0 ? 0 : 1;
+    }
+} // namespace
+
+/// Builds and inspects `.pak` asset packages
+/// Usage: PulsarPack <output.pak> <directory>
+///        PulsarPack --list <input.pak>
+int main(int argc, char* argv[]) {
+    const std::span<char*> args(argv, static_cast<size_t>(argc));
+    if (args.size() != 3) {
+        fmt::print(stderr, "Usage: {} <output.pak> <directory>\n", args[0]);
+        fmt::print(stderr, "       {} --list <input.pak>\n", args[0]);
+        return 2;
+    }
+    if (std::string_view(args[1]) == "--list") {
+        return list(args[2]);
+    }
+    return pack(args[1], args[2]);
+}
@@ -0,0 +1,274 @@
+// NOLINTBEGIN(*)
+#include "PulsarCore/BenchmarkPerfCounters.hpp"
+#include "PulsarWindow/EventQueue.hpp"
+
+#include <benchmark/benchmark.h>
+#include <bitset>
+#include <memory>
+#include <vector>
+
+using namespace Pulsar;
+
+namespace {
+    constexpr usize EVENT_COUNT = 100'000;
+
+    struct InputState_t {
+        std::bitset<static_cast<usize>(Key::COUNT)> m_Keys;
+        Vec2                                        m_Mouse {};
+        Vec2                                        m_Scroll {};
+        u32                                         m_Buttons = 0;
+    };
+
+    /// Half mouse motion, the rest keys, buttons and scrolling, like a busy frame of real input
+    std::vector<Event_t> synthetic_events() {
+        std::vector<Event_t> events;
+        events.reserve(EVENT_COUNT);
+        for (u64 i = 0; i < EVENT_COUNT; i++) {
+            const auto fi = static_cast<f32>(i);
+            switch (i % 8) {
+                case 1:
+                case 5:
+                    events.push_back(Event_t::key(
+                        static_cast<Key>(1 + i % (static_cast<u64>(Key::COUNT) - 1)), i % 16 < 8));
+                    break;
+                case 3:
+                    events.push_back(Event_t::mouse_button(MouseButton::LEFT, i % 16 < 8));
+                    break;
+                case 7:
+                    events.push_back(Event_t::mouse_scrolled({0, 1}));
+                    break;
+                default:
+                    events.push_back(Event_t::mouse_moved({fi, fi * 0.5F}));
+                    break;
+            }
+        }
+        return events;
+    }
+
+    void apply(const Event_t& event, InputState_t& input) {
+        switch (event.m_Type) {
+            case EventType::KEY:
+                input.m_Keys[static_cast<usize>(event.m_Key.m_Key)] = event.m_Key.m_Pressed;
+                break;
+            case EventType::MOUSE_MOVED:
+                input.m_Mouse = event.m_MouseMove.m_Position;
+                break;
+            case EventType::MOUSE_BUTTON:
+                input.m_Buttons ^= 1U << static_cast<u32>(event.m_MouseButton.m_Button);
+                break;
+            case EventType::MOUSE_SCROLLED:
+                input.m_Scroll.y += event.m_Scroll.m_Delta.y;
+                break;
+            default:
+                break;
+        }
+    }
+
+    /// The callback design: the backend calls a listener per event as it drains the OS queue
+    class EventListener {
+    public:
+        virtual ~EventListener()                                       = default;
+        virtual void on_key(Key key, bool pressed)                     = 0;
+        virtual void on_mouse_moved(Vec2 position)                     = 0;
+        virtual void on_mouse_button(MouseButton button, bool pressed) = 0;
+        virtual void on_mouse_scrolled(Vec2 delta)                     = 0;
+    };
+
+    class InputListener final : public EventListener {
+    public:
+        void on_key(Key key, bool pressed) override {
+            m_Input.m_Keys[static_cast<usize>(key)] = pressed;
+        }
+
+        void on_mouse_moved(Vec2 position) override {
+            m_Input.m_Mouse = position;
+        }
+
+        void on_mouse_button(MouseButton button, [[maybe_unused]] bool pressed) override {
+            m_Input.m_Buttons ^= 1U << static_cast<u32>(button);
+        }
+
+        void on_mouse_scrolled(Vec2 delta) override {
+            m_Input.m_Scroll.y += delta.y;
+        }
+
+        InputState_t m_Input;
+    };
+
+    void notify(const std::vector<EventListener*>& listeners, const Event_t& event) {
+        for (EventListener* listener : listeners) {
+            switch (event.m_Type) {
+                case EventType::KEY:
+                    listener->on_key(event.m_Key.m_Key, event.m_Key.m_Pressed);
+                    break;
+                case EventType::MOUSE_MOVED:
+                    listener->on_mouse_moved(event.m_MouseMove.m_Position);
+                    break;
+                case EventType::MOUSE_BUTTON:
+                    listener->on_mouse_button(
+                        event.m_MouseButton.m_Button, event.m_MouseButton.m_Pressed);
+                    break;
+                case EventType::MOUSE_SCROLLED:
+                    listener->on_mouse_scrolled(event.m_Scroll.m_Delta);
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+
+    /// The heap design: one polymorphic object per event, queued and applied later
+    struct HeapEvent {
+        virtual ~HeapEvent()                          = default;
+        virtual void apply(InputState_t& input) const = 0;
+    };
+
+    struct HeapKeyEvent final : HeapEvent {
+        HeapKeyEvent(Key key, bool pressed) : m_Key(key), m_Pressed(pressed) {}
+
+        void apply(InputState_t& input) const override {
+            input.m_Keys[static_cast<usize>(m_Key)] = m_Pressed;
+        }
+
+        Key  m_Key;
+        bool m_Pressed;
+    };
+
+    struct HeapMouseMoveEvent final : HeapEvent {
+        explicit HeapMouseMoveEvent(Vec2 position) : m_Position(position) {}
+
+        void apply(InputState_t& input) const override {
+            input.m_Mouse = m_Position;
+        }
+
+        Vec2 m_Position;
+    };
+
+    struct HeapMouseButtonEvent final : HeapEvent {
+        explicit HeapMouseButtonEvent(MouseButton button) : m_Button(button) {}
+
+        void apply(InputState_t& input) const override {
+            input.m_Buttons ^= 1U << static_cast<u32>(m_Button);
+        }
+
+        MouseButton m_Button;
+    };
+
+    struct HeapScrollEvent final : HeapEvent {
+        explicit HeapScrollEvent(Vec2 delta) : m_Delta(delta) {}
+
+        void apply(InputState_t& input) const override {
+            input.m_Scroll.y += m_Delta.y;
+        }
+
+        Vec2 m_Delta;
+    };
+
+    std::unique_ptr<HeapEvent> make_heap_event(const Event_t& event) {
+        switch (event.m_Type) {
+            case EventType::KEY:
+                return std::make_unique<HeapKeyEvent>(event.m_Key.m_Key, event.m_Key.m_Pressed);
+            case EventType::MOUSE_BUTTON:
+                return std::make_unique<HeapMouseButtonEvent>(event.m_MouseButton.m_Button);
+            case EventType::MOUSE_SCROLLED:
+                return std::make_unique<HeapScrollEvent>(event.m_Scroll.m_Delta);
+            default:
+                return std::make_unique<HeapMouseMoveEvent>(event.m_MouseMove.m_Position);
+        }
+    }
+} // namespace
+
+/// What `poll_events` adds: copying and stamping 100k drained events into the batch
+static void BM_EventQueueDrain(benchmark::State& state) {
+    const std::vector<Event_t>  source = synthetic_events();
+    EventQueue                  queue(EVENT_COUNT);
+    u64                         now = 0;
+    const BenchmarkPerfCounters perf(state);
+    for (auto _ : state) {
+        queue.clear();
+        for (const Event_t& event : source) {
+            queue.push(event, now++);
+        }
+        benchmark::DoNotOptimize(queue.events().data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(i64(state.iterations() * EVENT_COUNT));
+}
+
+/// The consumer side: one switch per event over the span of a full batch
+static void BM_EventQueueDispatch(benchmark::State& state) {
+    const std::vector<Event_t> source = synthetic_events();
+    EventQueue                 queue(EVENT_COUNT);
+    for (const Event_t& event : source) {
+        queue.push(event, 0);
+    }
+    InputState_t                input;
+    const BenchmarkPerfCounters perf(state);
+    for (auto _ : state) {
+        for (const Event_t& event : queue.events()) {
+            apply(event, input);
+        }
+        benchmark::DoNotOptimize(input);
+    }
+    state.SetItemsProcessed(i64(state.iterations() * EVENT_COUNT));
+}
+
+/// A consumer that only cares about keys, skipping the rest through the filtered view
+static void BM_EventQueueFilterKeys(benchmark::State& state) {
+    const std::vector<Event_t> source = synthetic_events();
+    EventQueue                 queue(EVENT_COUNT);
+    for (const Event_t& event : source) {
+        queue.push(event, 0);
+    }
+    InputState_t                input;
+    const BenchmarkPerfCounters perf(state);
+    for (auto _ : state) {
+        for (const Event_t& event : queue.of_type(EventType::KEY)) {
+            input.m_Keys[static_cast<usize>(event.m_Key.m_Key)] = event.m_Key.m_Pressed;
+        }
+        benchmark::DoNotOptimize(input);
+    }
+    state.SetItemsProcessed(i64(state.iterations() * EVENT_COUNT));
+}
+
+/// The same events through a virtual call per event and registered listener
+static void BM_VirtualCallbackDispatch(benchmark::State& state) {
+    const std::vector<Event_t>  source = synthetic_events();
+    InputListener               listener;
+    std::vector<EventListener*> listeners = {&listener};
+    benchmark::DoNotOptimize(listeners.data());
+    const BenchmarkPerfCounters perf(state);
+    for (auto _ : state) {
+        for (const Event_t& event : source) {
+            notify(listeners, event);
+        }
+        benchmark::DoNotOptimize(listener.m_Input);
+    }
+    state.SetItemsProcessed(i64(state.iterations() * EVENT_COUNT));
+}
+
+/// The same events as heap allocated polymorphic objects, queued then applied
+static void BM_HeapEventDispatch(benchmark::State& state) {
+    const std::vector<Event_t>              source = synthetic_events();
+    std::vector<std::unique_ptr<HeapEvent>> queue;
+    InputState_t                            input;
+    const BenchmarkPerfCounters             perf(state);
+    for (auto _ : state) {
+        queue.clear();
+        for (const Event_t& event : source) {
+            queue.push_back(make_heap_event(event));
+        }
+        for (const auto& event : queue) {
+            event->apply(input);
+        }
+        benchmark::DoNotOptimize(input);
+    }
+    state.SetItemsProcessed(i64(state.iterations() * EVENT_COUNT));
+}
+
+BENCHMARK(BM_EventQueueDrain)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_EventQueueDispatch)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_EventQueueFilterKeys)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_VirtualCallbackDispatch)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_HeapEventDispatch)->Unit(benchmark::kMicrosecond);
+// NOLINTEND(*)
@@ -0,0 +1,95 @@
+// NOLINTBEGIN(*)
+#include "PulsarCore/BenchmarkPerfCounters.hpp"
+#include "PulsarWindow/HeadlessWindow.hpp"
+
+#include <benchmark/benchmark.h>
+#include <bitset>
+#include <vector>
+
+using namespace Pulsar;
+
+namespace {
+    /// What a frame does with its events at the least: fold them into the input state
+    struct InputState_t {
+        std::bitset<static_cast<usize>(Key::COUNT)> m_Keys;
+        Vec2                                        m_Mouse {};
+        UVec2                                       m_Size {};
+    };
+
+    void dispatch(const Window& window, InputState_t& input) {
+        for (const Event_t& event : window.events()) {
+            switch (event.m_Type) {
+                case EventType::KEY:
+                    input.m_Keys[static_cast<usize>(event.m_Key.m_Key)] = event.m_Key.m_Pressed;
+                    break;
+                case EventType::MOUSE_MOVED:
+                    input.m_Mouse = event.m_MouseMove.m_Position;
+                    break;
+                case EventType::RESIZED:
+                    input.m_Size = event.m_Resize.m_Size;
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+
+    Event_t synthetic_event(u64 i) {
+        if (i % 2 == 0) {
+            return Event_t::mouse_moved({static_cast<f32>(i % 1920), static_cast<f32>(i % 1080)});
+        }
+        const auto key = static_cast<Key>(1 + i % (static_cast<u64>(Key::COUNT) - 1));
+        return Event_t::key(key, i % 4 == 1);
+    }
+} // namespace
+
+/// One frame of the loop: range(0) events injected, polled and dispatched
+static void BM_HeadlessFrame(benchmark::State& state) {
+    HeadlessWindow              window;
+    InputState_t                input;
+    const auto                  events = static_cast<u64>(state.range(0));
+    u64                         next   = 0;
+    const BenchmarkPerfCounters perf(state);
+    for (auto _ : state) {
+        for (u64 i = 0; i < events; i++) {
+            window.inject(synthetic_event(next++));
+        }
+        if (window.should_close()) {
+            break;
+        }
+        window.poll_events();
+        dispatch(window, input);
+    }
+    benchmark::DoNotOptimize(input);
+    state.SetItemsProcessed(i64(state.iterations()));
+}
+
+/// A whole scripted run of 10k frames, the way a headless engine benchmark drives the loop
+static void BM_HeadlessScriptedRun(benchmark::State& state) {
+    constexpr u64                FRAMES = 10'000;
+    std::vector<ScriptedEvent_t> script;
+    for (u64 frame = 0; frame < FRAMES; frame += 3) {
+        script.push_back({frame, synthetic_event(frame)});
+        script.push_back({frame, synthetic_event(frame + 1)});
+    }
+    InputState_t input;
+    u64          time = 0;
+    for (auto _ : state) {
+        HeadlessWindow window({.m_FrameCount = FRAMES});
+        window.script(script);
+        while (!window.should_close()) {
+            window.poll_events();
+            dispatch(window, input);
+        }
+        time += window.time_ns();
+    }
+    benchmark::DoNotOptimize(input);
+    benchmark::DoNotOptimize(time);
+    state.SetItemsProcessed(i64(state.iterations() * FRAMES));
+}
+
+BENCHMARK(BM_HeadlessFrame)->Arg(0)->Arg(8)->Arg(64);
+BENCHMARK(BM_HeadlessScriptedRun)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
+// NOLINTEND(*)
@@ -0,0 +1,130 @@
+// NOLINTBEGIN(*)
+#include "PulsarCore/Util/Sleep.hpp"
+#include "PulsarCore/Util/Timestamp.hpp"
+#include "PulsarWindow/InputChannel.hpp"
+#include "PulsarWindow/InputThread.hpp"
+
+#include <algorithm>
+#include <array>
+#include <benchmark/benchmark.h>
+#include <vector>
+
+using namespace Pulsar;
+
+namespace {
+    constexpr u64 RUN_NS          = 500'000'000;
+    constexpr u64 EVENT_PERIOD_NS = 250'000;
+
+    /// A mouse that moves every `EVENT_PERIOD_NS`, independent of when anyone looks. Each event
+    /// is stamped with the moment it was due, like the OS stamps an event when it arrives.
+    class SyntheticDevice final : public InputSource {
+    public:
+        SyntheticDevice() : m_Next(monotonic_ns() + EVENT_PERIOD_NS) {
+        }
+
+        void sample(EventQueue& out) override {
+            const u64 now = monotonic_ns();
+            while (m_Next <= now) {
+                m_Position += 1.0F;
+                out.push(Event_t::mouse_moved({m_Position, m_Position}), m_Next);
+                m_Next += EVENT_PERIOD_NS;
+            }
+        }
+
+    private:
+        u64 m_Next;
+        f32 m_Position = 0.0F;
+    };
+
+    void report(benchmark::State& state, std::vector<u64>& latencies) {
+        if (latencies.empty()) {
+            state.SkipWithError("no events reached the consumer");
+            return;
+        }
+        std::ranges::sort(latencies);
+        const auto at = [&](f64 quantile) {
+            const auto index =
+                static_cast<usize>(quantile * static_cast<f64>(latencies.size() - 1));
+            return static_cast<f64>(latencies[index]) * 1e-3;
+        };
+        state.counters["p50_us"] = at(0.5);
+        state.counters["p99_us"] = at(0.99);
+        state.counters["max_us"] = at(1.0);
+        state.counters["events"] = static_cast<f64>(latencies.size());
+    }
+} // namespace
+
+/// Event-to-consumer latency through an `InputThread` sampling every range(0) µs and a consumer
+/// draining the channel every range(1) µs, e.g. a simulation thread checking input mid-frame
+static void BM_InputThreadLatency(benchmark::State& state) {
+    const auto       samplePeriod  = static_cast<u64>(state.range(0)) * 1000;
+    const auto       consumePeriod = static_cast<u64>(state.range(1)) * 1000;
+    std::vector<u64> latencies;
+    for (auto _ : state) {
+        SyntheticDevice          device;
+        InputChannel             channel;
+        InputThread              thread(device, channel, {.m_SamplePeriodNs = samplePeriod});
+        std::array<Event_t, 256> out {};
+        const u64                end      = monotonic_ns() + RUN_NS;
+        u64                      deadline = monotonic_ns();
+        while (deadline < end) {
+            const usize count = channel.drain(out);
+            const u64   now   = monotonic_ns();
+            for (usize i = 0; i < count; i++) {
+                latencies.push_back(now - out[i].m_TimeNs);
+            }
+            deadline += consumePeriod;
+            sleep_until_ns(deadline);
+        }
+        state.counters["high_priority"] = thread.high_priority() ? 1.0 : 0.0;
+    }
+    report(state, latencies);
+}
+
+/// The baseline: input is only read by the frame's `poll_events`, here at 60 Hz
+static void BM_FrameBoundLatency(benchmark::State& state) {
+    constexpr u64    FRAME_NS = 16'666'667;
+    std::vector<u64> latencies;
+    for (auto _ : state) {
+        SyntheticDevice device;
+        EventQueue      batch;
+        const u64       end      = monotonic_ns() + RUN_NS;
+        u64             deadline = monotonic_ns();
+        while (deadline < end) {
+            batch.clear();
+            device.sample(batch);
+            const u64 now = monotonic_ns();
+            for (const Event_t& event : batch.events()) {
+                latencies.push_back(now - event.m_TimeNs);
+            }
+            deadline += FRAME_NS;
+            sleep_until_ns(deadline);
+        }
+    }
+    report(state, latencies);
+}
+
+/// What reading the latest state costs a consumer while the input thread keeps publishing
+static void BM_InputSnapshotRead(benchmark::State& state) {
+    SyntheticDevice device;
+    InputChannel    channel;
+    InputThread     thread(device, channel, {.m_SamplePeriodNs = 100'000});
+    u64             count = 0;
+    for (auto _ : state) {
+        const InputState_t snapshot = channel.snapshot();
+        count += snapshot.m_EventCount;
+    }
+    benchmark::DoNotOptimize(count);
+    state.SetItemsProcessed(i64(state.iterations()));
+}
+
+BENCHMARK(BM_InputThreadLatency)
+    ->Args({1000, 1000})
+    ->Args({250, 250})
+    ->Args({250, 100})
+    ->Iterations(1)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_FrameBoundLatency)->Iterations(1)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_InputSnapshotRead);
+// NOLINTEND(*)
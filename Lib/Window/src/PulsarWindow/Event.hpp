@@ -0,0 +1,271 @@
+#pragma once
+
+#include "PulsarCore/Types.hpp"
+
+#include <type_traits>
+
+namespace Pulsar {
+    /// Keys by their position on a US layout, independent of the backend's key codes
+    enum class Key : u16 {
+        UNKNOWN,
+        SPACE,
+        APOSTROPHE,
+        COMMA,
+        MINUS,
+        PERIOD,
+        SLASH,
+        NUM_0,
+        NUM_1,
+        NUM_2,
+        NUM_3,
+        NUM_4,
+        NUM_5,
+        NUM_6,
+        NUM_7,
+        NUM_8,
+        NUM_9,
+        SEMICOLON,
+        EQUAL,
+        A,
+        B,
+        C,
+        D,
+        E,
+        F,
+        G,
+        H,
+        I,
+        J,
+        K,
+        L,
+        M,
+        N,
+        O,
+        P,
+        Q,
+        R,
+        S,
+        T,
+        U,
+        V,
+        W,
+        X,
+        Y,
+        Z,
+        LEFT_BRACKET,
+        BACKSLASH,
+        RIGHT_BRACKET,
+        GRAVE_ACCENT,
+        ESCAPE,
+        ENTER,
+        TAB,
+        BACKSPACE,
+        INSERT,
+        DELETE,
+        RIGHT,
+        LEFT,
+        DOWN,
+        UP,
+        PAGE_UP,
+        PAGE_DOWN,
+        HOME,
+        END,
+        F1,
+        F2,
+        F3,
+        F4,
+        F5,
+        F6,
+        F7,
+        F8,
+        F9,
+        F10,
+        F11,
+        F12,
+        LEFT_SHIFT,
+        LEFT_CONTROL,
+        LEFT_ALT,
+        LEFT_SUPER,
+        RIGHT_SHIFT,
+        RIGHT_CONTROL,
+        RIGHT_ALT,
+        RIGHT_SUPER,
+        COUNT,
+    };
+
+    enum class MouseButton : u8 {
+        LEFT,
+        RIGHT,
+        MIDDLE,
+        COUNT,
+    };
+
+    /// Buttons by position, in the order of the SDL/GLFW gamepad mapping (south is A on an Xbox
+    /// pad, cross on a PlayStation pad)
+    enum class GamepadButton : u8 {
+        SOUTH,
+        EAST,
+        WEST,
+        NORTH,
+        LEFT_BUMPER,
+        RIGHT_BUMPER,
+        BACK,
+        START,
+        GUIDE,
+        LEFT_THUMB,
+        RIGHT_THUMB,
+        DPAD_UP,
+        DPAD_RIGHT,
+        DPAD_DOWN,
+        DPAD_LEFT,
+        COUNT,
+    };
+
+    /// Sticks in [-1, 1] with +y down, triggers in [-1, 1] from released to fully pressed
+    enum class GamepadAxis : u8 {
+        LEFT_X,
+        LEFT_Y,
+        RIGHT_X,
+        RIGHT_Y,
+        LEFT_TRIGGER,
+        RIGHT_TRIGGER,
+        COUNT,
+    };
+
+    /// Gamepads the backends report, indexed by `m_Gamepad` in the gamepad events
+    constexpr u8 MAX_GAMEPADS = 4;
+
+    enum class EventType : u8 {
+        /// The user asked to close the window, `should_close` is true from then on
+        CLOSE_REQUESTED,
+        RESIZED,
+        FOCUS_CHANGED,
+        KEY,
+        MOUSE_MOVED,
+        MOUSE_BUTTON,
+        MOUSE_SCROLLED,
+        GAMEPAD_CONNECTED,
+        GAMEPAD_BUTTON,
+        GAMEPAD_AXIS,
+    };
+
+    struct ResizeEvent_t {
+        UVec2 m_Size;
+    };
+
+    struct FocusEvent_t {
+        bool m_Focused;
+    };
+
+    struct KeyEvent_t {
+        Key  m_Key;
+        bool m_Pressed;
+        /// A press generated by holding the key down
+        bool m_Repeat;
+    };
+
+    struct MouseMoveEvent_t {
+        /// In window coordinates, from the top left corner of the content area
+        Vec2 m_Position;
+    };
+
+    struct MouseButtonEvent_t {
+        MouseButton m_Button;
+        bool        m_Pressed;
+    };
+
+    struct ScrollEvent_t {
+        Vec2 m_Delta;
+    };
+
+    struct GamepadConnectionEvent_t {
+        u8   m_Gamepad;
+        bool m_Connected;
+    };
+
+    struct GamepadButtonEvent_t {
+        u8            m_Gamepad;
+        GamepadButton m_Button;
+        bool          m_Pressed;
+    };
+
+    struct GamepadAxisEvent_t {
+        u8          m_Gamepad;
+        GamepadAxis m_Axis;
+        f32         m_Value;
+    };
+
+    /// A window or input event, a tagged union of the structs above
+    /// # Usage
+    /// Switch on `m_Type` and read the matching member, or build one with the factory functions.
+    /// The window stamps `m_TimeNs` when the event enters its queue.
+    /// # Layout
+    /// 24 bytes and trivially copyable, so a batch of events is a flat array that is copied with
+    /// `memcpy` and never touches the heap.
+    struct Event_t {
+        /// When the backend received the event, on the `monotonic_ns` clock for real windows and
+        /// on the window clock for the headless one
+        u64       m_TimeNs = 0;
+        EventType m_Type;
+        // NOLINTBEGIN(cppcoreguidelines-pro-type-union-access)
+        union {
+            ResizeEvent_t            m_Resize;
+            FocusEvent_t             m_Focus;
+            KeyEvent_t               m_Key;
+            MouseMoveEvent_t         m_MouseMove;
+            MouseButtonEvent_t       m_MouseButton;
+            ScrollEvent_t            m_Scroll;
+            GamepadConnectionEvent_t m_GamepadConnection;
+            GamepadButtonEvent_t     m_GamepadButton;
+            GamepadAxisEvent_t       m_GamepadAxis;
+        };
+        // NOLINTEND(cppcoreguidelines-pro-type-union-access)
+
+        [[nodiscard]] static constexpr Event_t close_requested() {
+            return {.m_Type = EventType::CLOSE_REQUESTED, .m_Resize = {}};
+        }
+
+        [[nodiscard]] static constexpr Event_t resized(UVec2 size) {
+            return {.m_Type = EventType::RESIZED, .m_Resize = {size}};
+        }
+
+        [[nodiscard]] static constexpr Event_t focus_changed(bool focused) {
+            return {.m_Type = EventType::FOCUS_CHANGED, .m_Focus = {focused}};
+        }
+
+        [[nodiscard]] static constexpr Event_t key(Key key, bool pressed, bool repeat = false) {
+            return {.m_Type = EventType::KEY, .m_Key = {key, pressed, repeat}};
+        }
+
+        [[nodiscard]] static constexpr Event_t mouse_moved(Vec2 position) {
+            return {.m_Type = EventType::MOUSE_MOVED, .m_MouseMove = {position}};
+        }
+
+        [[nodiscard]] static constexpr Event_t mouse_button(MouseButton button, bool pressed) {
+            return {.m_Type = EventType::MOUSE_BUTTON, .m_MouseButton = {button, pressed}};
+        }
+
+        [[nodiscard]] static constexpr Event_t mouse_scrolled(Vec2 delta) {
+            return {.m_Type = EventType::MOUSE_SCROLLED, .m_Scroll = {delta}};
+        }
+
+        [[nodiscard]] static constexpr Event_t gamepad_connected(u8 gamepad, bool connected) {
+            return {.m_Type = EventType::GAMEPAD_CONNECTED,
+                .m_GamepadConnection = {gamepad, connected}};
+        }
+
+        [[nodiscard]] static constexpr Event_t gamepad_button(
+            u8 gamepad, GamepadButton button, bool pressed) {
+            return {.m_Type = EventType::GAMEPAD_BUTTON,
+                .m_GamepadButton = {gamepad, button, pressed}};
+        }
+
+        [[nodiscard]] static constexpr Event_t gamepad_axis(
+            u8 gamepad, GamepadAxis axis, f32 value) {
+            return {.m_Type = EventType::GAMEPAD_AXIS, .m_GamepadAxis = {gamepad, axis, value}};
+        }
+    };
+
+    static_assert(sizeof(Event_t) == 24);
+    static_assert(std::is_trivially_copyable_v<Event_t>);
+} // namespace Pulsar
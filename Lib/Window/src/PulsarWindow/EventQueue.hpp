@@ -0,0 +1,116 @@
+#pragma once
+
+#include "PulsarCore/Types.hpp"
+#include "PulsarWindow/Event.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <ranges>
+#include <span>
+
+namespace Pulsar {
+    /// The events of one `poll_events` batch, in a buffer allocated once
+    /// # Usage
+    /// The window calls `clear` and then `push` for every event the backend drains. Consumers
+    /// read the batch as a span, or only the events of one type through `of_type`. `types` tells
+    /// in one load whether a type is in the batch at all.
+    /// When the buffer is full, a mouse move or scroll is folded into the last event if that is
+    /// of the same type (latest position, summed delta), anything else is dropped and counted.
+    /// # Performance
+    /// Pushing is a bounds check and a 24 byte store; the batch never reallocates, so pointers
+    /// into it stay valid until the next `clear`. Every batch starts at the front of the buffer:
+    /// the previous batch is gone by then, and it keeps the batch one contiguous span.
+    class EventQueue {
+    public:
+        static constexpr usize DEFAULT_CAPACITY = 4096;
+
+        explicit EventQueue(usize capacity = DEFAULT_CAPACITY)
+            : m_Capacity(std::max<usize>(capacity, 1)),
+              m_Events(std::make_unique_for_overwrite<Event_t[]>( // NOLINT(*-avoid-c-arrays)
+                  m_Capacity)) {
+        }
+
+        /// Starts a new batch, the events of the previous one are discarded
+        void clear() {
+            m_Size  = 0;
+            m_Types = 0;
+        }
+
+        /// Appends `event` stamped with `timeNs`, returns false when it had to be dropped
+        bool push(const Event_t& event, u64 timeNs) {
+            if (m_Size == m_Capacity) [[unlikely]] {
+                return coalesce(event, timeNs);
+            }
+            // Copy, then stamp in place: stamping a local copy first makes the compiler assemble
+            // it on the stack, and reloading that as a whole stalls on store forwarding
+            Event_t& slot = m_Events[m_Size++];
+            slot          = event;
+            slot.m_TimeNs = timeNs;
+            m_Types |= type_bit(event.m_Type);
+            return true;
+        }
+
+        [[nodiscard]] std::span<const Event_t> events() const {
+            return {m_Events.get(), m_Size};
+        }
+
+        /// The events of one type in arrival order, a lazy view over `events`
+        [[nodiscard]] auto of_type(EventType type) const {
+            return events() | std::views::filter([type](const Event_t& event) {
+                return event.m_Type == type;
+            });
+        }
+
+        /// A bit per `EventType` that occurs in the batch
+        [[nodiscard]] u32 types() const {
+            return m_Types;
+        }
+
+        [[nodiscard]] bool contains(EventType type) const {
+            return (m_Types & type_bit(type)) != 0;
+        }
+
+        [[nodiscard]] usize size() const {
+            return m_Size;
+        }
+
+        [[nodiscard]] usize capacity() const {
+            return m_Capacity;
+        }
+
+        /// Events lost to a full buffer since construction
+        [[nodiscard]] u64 dropped() const {
+            return m_Dropped;
+        }
+
+        [[nodiscard]] static constexpr u32 type_bit(EventType type) {
+            return 1U << static_cast<u32>(type);
+        }
+
+    private:
+        bool coalesce(const Event_t& event, u64 timeNs) {
+            Event_t& last = m_Events[m_Size - 1];
+            if (last.m_Type == event.m_Type) {
+                if (event.m_Type == EventType::MOUSE_MOVED) {
+                    last.m_MouseMove = event.m_MouseMove;
+                    last.m_TimeNs    = timeNs;
+                    return true;
+                }
+                if (event.m_Type == EventType::MOUSE_SCROLLED) {
+                    last.m_Scroll.m_Delta.x += event.m_Scroll.m_Delta.x;
+                    last.m_Scroll.m_Delta.y += event.m_Scroll.m_Delta.y;
+                    last.m_TimeNs = timeNs;
+                    return true;
+                }
+            }
+            m_Dropped++;
+            return false;
+        }
+
+        usize                      m_Capacity;
+        std::unique_ptr<Event_t[]> m_Events; // NOLINT(*-avoid-c-arrays)
+        usize                      m_Size    = 0;
+        u32                        m_Types   = 0;
+        u64                        m_Dropped = 0;
+    };
+} // namespace Pulsar
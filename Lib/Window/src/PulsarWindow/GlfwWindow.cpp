@@ -0,0 +1,253 @@
+#include "GlfwWindow.hpp"
+
+#include "PulsarCore/Log.hpp"
+#include "PulsarCore/Util/Timestamp.hpp"
+
+#include <GLFW/glfw3.h>
+
+namespace Pulsar {
+    namespace {
+        /// Live windows, GLFW is initialized while there are any. Main thread only.
+        u32 g_WindowCount = 0; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+        void on_error(int code, const char* description) {
+            PL_LOG_CAT_ERROR(Window, "GLFW error {}: {}", code, description);
+        }
+
+        Key translate_key(int key) {
+            if (key >= GLFW_KEY_A && key <= GLFW_KEY_Z) {
+                return static_cast<Key>(static_cast<int>(Key::A) + (key - GLFW_KEY_A));
+            }
+            if (key >= GLFW_KEY_0 && key <= GLFW_KEY_9) {
+                return static_cast<Key>(static_cast<int>(Key::NUM_0) + (key - GLFW_KEY_0));
+            }
+            if (key >= GLFW_KEY_F1 && key <= GLFW_KEY_F12) {
+                return static_cast<Key>(static_cast<int>(Key::F1) + (key - GLFW_KEY_F1));
+            }
+            switch (key) {
+                case GLFW_KEY_SPACE:
+                    return Key::SPACE;
+                case GLFW_KEY_APOSTROPHE:
+                    return Key::APOSTROPHE;
+                case GLFW_KEY_COMMA:
+                    return Key::COMMA;
+                case GLFW_KEY_MINUS:
+                    return Key::MINUS;
+                case GLFW_KEY_PERIOD:
+                    return Key::PERIOD;
+                case GLFW_KEY_SLASH:
+                    return Key::SLASH;
+                case GLFW_KEY_SEMICOLON:
+                    return Key::SEMICOLON;
+                case GLFW_KEY_EQUAL:
+                    return Key::EQUAL;
+                case GLFW_KEY_LEFT_BRACKET:
+                    return Key::LEFT_BRACKET;
+                case GLFW_KEY_BACKSLASH:
+                    return Key::BACKSLASH;
+                case GLFW_KEY_RIGHT_BRACKET:
+                    return Key::RIGHT_BRACKET;
+                case GLFW_KEY_GRAVE_ACCENT:
+                    return Key::GRAVE_ACCENT;
+                case GLFW_KEY_ESCAPE:
+                    return Key::ESCAPE;
+                case GLFW_KEY_ENTER:
+                    return Key::ENTER;
+                case GLFW_KEY_TAB:
+                    return Key::TAB;
+                case GLFW_KEY_BACKSPACE:
+                    return Key::BACKSPACE;
+                case GLFW_KEY_INSERT:
+                    return Key::INSERT;
+                case GLFW_KEY_DELETE:
+                    return Key::DELETE;
+                case GLFW_KEY_RIGHT:
+                    return Key::RIGHT;
+                case GLFW_KEY_LEFT:
+                    return Key::LEFT;
+                case GLFW_KEY_DOWN:
+                    return Key::DOWN;
+                case GLFW_KEY_UP:
+                    return Key::UP;
+                case GLFW_KEY_PAGE_UP:
+                    return Key::PAGE_UP;
+                case GLFW_KEY_PAGE_DOWN:
+                    return Key::PAGE_DOWN;
+                case GLFW_KEY_HOME:
+                    return Key::HOME;
+                case GLFW_KEY_END:
+                    return Key::END;
+                case GLFW_KEY_LEFT_SHIFT:
+                    return Key::LEFT_SHIFT;
+                case GLFW_KEY_LEFT_CONTROL:
+                    return Key::LEFT_CONTROL;
+                case GLFW_KEY_LEFT_ALT:
+                    return Key::LEFT_ALT;
+                case GLFW_KEY_LEFT_SUPER:
+                    return Key::LEFT_SUPER;
+                case GLFW_KEY_RIGHT_SHIFT:
+                    return Key::RIGHT_SHIFT;
+                case GLFW_KEY_RIGHT_CONTROL:
+                    return Key::RIGHT_CONTROL;
+                case GLFW_KEY_RIGHT_ALT:
+                    return Key::RIGHT_ALT;
+                case GLFW_KEY_RIGHT_SUPER:
+                    return Key::RIGHT_SUPER;
+                default:
+                    return Key::UNKNOWN;
+            }
+        }
+
+        GlfwWindow& self(GLFWwindow* window) {
+            return *static_cast<GlfwWindow*>(glfwGetWindowUserPointer(window));
+        }
+    } // namespace
+
+    Result<std::unique_ptr<GlfwWindow>, std::string> GlfwWindow::create(
+        const WindowSettings_t& settings) {
+        if (g_WindowCount == 0) {
+            glfwSetErrorCallback(on_error);
+            if (glfwInit() != GLFW_TRUE) {
+                return Err<std::string>("Failed to initialize GLFW");
+            }
+        }
+        glfwDefaultWindowHints();
+        // The renderer creates its own surface, no OpenGL context needed
+        glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
+        glfwWindowHint(GLFW_VISIBLE, settings.visible ? GLFW_TRUE : GLFW_FALSE);
+        glfwWindowHint(GLFW_RESIZABLE, settings.resizable ? GLFW_TRUE : GLFW_FALSE);
+        GLFWmonitor* monitor = settings.fullscreen ? glfwGetPrimaryMonitor() : nullptr;
+        GLFWwindow*  handle  = glfwCreateWindow(static_cast<int>(settings.inner_size.x),
+            static_cast<int>(settings.inner_size.y), settings.title.c_str(), monitor, nullptr);
+        if (handle == nullptr) {
+            if (g_WindowCount == 0) {
+                glfwTerminate();
+            }
+            return Err<std::string>("Failed to create a GLFW window");
+        }
+        g_WindowCount++;
+
+        int width  = 0;
+        int height = 0;
+        glfwGetFramebufferSize(handle, &width, &height);
+        // The constructor is private, make_unique cannot reach it
+        std::unique_ptr<GlfwWindow> window(new GlfwWindow(
+            handle, {static_cast<u32>(width), static_cast<u32>(height)}, settings.event_capacity));
+        glfwSetWindowUserPointer(handle, window.get());
+        glfwSetWindowCloseCallback(handle, on_close);
+        glfwSetFramebufferSizeCallback(handle, on_resize);
+        glfwSetWindowFocusCallback(handle, on_focus);
+        glfwSetKeyCallback(handle, on_key);
+        glfwSetCursorPosCallback(handle, on_cursor);
+        glfwSetMouseButtonCallback(handle, on_mouse_button);
+        glfwSetScrollCallback(handle, on_scroll);
+        return window;
+    }
+
+    GlfwWindow::GlfwWindow(GLFWwindow* window, UVec2 innerSize, usize eventCapacity)
+        : Window(eventCapacity), m_Window(window), m_InnerSize(innerSize) {
+    }
+
+    GlfwWindow::~GlfwWindow() {
+        glfwDestroyWindow(m_Window);
+        if (--g_WindowCount == 0) {
+            glfwTerminate();
+        }
+    }
+
+    bool GlfwWindow::should_close() const {
+        return glfwWindowShouldClose(m_Window) == GLFW_TRUE;
+    }
+
+    void GlfwWindow::poll_events() {
+        // Every callback of this one call lands in the same batch
+        clear_events();
+        glfwPollEvents();
+        poll_gamepads();
+    }
+
+    void GlfwWindow::wait_events(u64 timeoutNs) {
+        clear_events();
+        glfwWaitEventsTimeout(static_cast<f64>(timeoutNs) * 1e-9);
+        poll_gamepads();
+    }
+
+    void GlfwWindow::poll_gamepads() {
+        for (u8 pad = 0; pad < MAX_GAMEPADS; pad++) {
+            GamepadState_t&  known = m_Gamepads[pad];
+            GLFWgamepadstate state {};
+            const bool       connected =
+                glfwGetGamepadState(GLFW_JOYSTICK_1 + pad, &state) == GLFW_TRUE;
+            if (connected != known.m_Connected) {
+                known = {.m_Connected = connected};
+                receive(Event_t::gamepad_connected(pad, connected));
+            }
+            if (!connected) {
+                continue;
+            }
+            // GLFW orders buttons and axes like GamepadButton and GamepadAxis
+            for (u32 button = 0; button < static_cast<u32>(GamepadButton::COUNT); button++) {
+                const bool pressed = state.buttons[button] == GLFW_PRESS;
+                if (pressed != known.down(static_cast<GamepadButton>(button))) {
+                    known.m_Buttons ^= 1U << button;
+                    receive(
+                        Event_t::gamepad_button(pad, static_cast<GamepadButton>(button), pressed));
+                }
+            }
+            for (u32 axis = 0; axis < static_cast<u32>(GamepadAxis::COUNT); axis++) {
+                if (state.axes[axis] != known.m_Axes[axis]) {
+                    known.m_Axes[axis] = state.axes[axis];
+                    receive(Event_t::gamepad_axis(
+                        pad, static_cast<GamepadAxis>(axis), state.axes[axis]));
+                }
+            }
+        }
+    }
+
+    void GlfwWindow::receive(const Event_t& event) {
+        // GLFW does not pass on the OS timestamps, the callback runs while the event is drained
+        push_event(event, monotonic_ns());
+    }
+
+    u64 GlfwWindow::time_ns() const {
+        return monotonic_ns();
+    }
+
+    void GlfwWindow::on_close(GLFWwindow* window) {
+        self(window).receive(Event_t::close_requested());
+    }
+
+    void GlfwWindow::on_resize(GLFWwindow* window, int width, int height) {
+        GlfwWindow& target = self(window);
+        target.m_InnerSize = {static_cast<u32>(width), static_cast<u32>(height)};
+        target.receive(Event_t::resized(target.m_InnerSize));
+    }
+
+    void GlfwWindow::on_focus(GLFWwindow* window, int focused) {
+        self(window).receive(Event_t::focus_changed(focused == GLFW_TRUE));
+    }
+
+    void GlfwWindow::on_key(GLFWwindow* window, int key, [[maybe_unused]] int scancode, int action,
+        [[maybe_unused]] int mods) {
+        self(window).receive(
+            Event_t::key(translate_key(key), action != GLFW_RELEASE, action == GLFW_REPEAT));
+    }
+
+    void GlfwWindow::on_cursor(GLFWwindow* window, double x, double y) {
+        self(window).receive(Event_t::mouse_moved({static_cast<f32>(x), static_cast<f32>(y)}));
+    }
+
+    void GlfwWindow::on_mouse_button(
+        GLFWwindow* window, int button, int action, [[maybe_unused]] int mods) {
+        if (button > GLFW_MOUSE_BUTTON_MIDDLE) {
+            return;
+        }
+        // GLFW numbers left, right, middle like MouseButton
+        self(window).receive(
+            Event_t::mouse_button(static_cast<MouseButton>(button), action == GLFW_PRESS));
+    }
+
+    void GlfwWindow::on_scroll(GLFWwindow* window, double x, double y) {
+        self(window).receive(Event_t::mouse_scrolled({static_cast<f32>(x), static_cast<f32>(y)}));
+    }
+} // namespace Pulsar
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "PulsarCore/Result.hpp"
+#include "PulsarCore/Types.hpp"
+#include "PulsarWindow/InputState.hpp"
+#include "PulsarWindow/Window.hpp"
+
+#include <array>
+#include <memory>
+#include <string>
+
+struct GLFWwindow;
+
+namespace Pulsar {
+    /// A desktop window through GLFW
+    /// # Usage
+    /// Create and poll it on the main thread, GLFW does not allow anything else. GLFW itself is
+    /// initialized with the first window and terminated with the last.
+    class GlfwWindow final : public Window {
+    public:
+        /// Fails when GLFW cannot be initialized (no display server) or the window cannot be
+        /// created
+        [[nodiscard]] static Result<std::unique_ptr<GlfwWindow>, std::string> create(
+            const WindowSettings_t& settings = {});
+
+        ~GlfwWindow() override;
+
+        [[nodiscard]] bool should_close() const override;
+        void               poll_events() override;
+
+        /// Like `poll_events`, but sleeps until at least one event arrives or `timeoutNs` passes.
+        /// Lets the main thread pump OS events as they arrive while the game runs elsewhere, see
+        /// `InputChannel`.
+        void wait_events(u64 timeoutNs);
+
+        [[nodiscard]] UVec2 inner_size() const override {
+            return m_InnerSize;
+        }
+
+        [[nodiscard]] u64 time_ns() const override;
+
+        [[nodiscard]] GLFWwindow* native_handle() const {
+            return m_Window;
+        }
+
+    private:
+        GlfwWindow(GLFWwindow* window, UVec2 innerSize, usize eventCapacity);
+
+        void receive(const Event_t& event);
+        /// GLFW has no gamepad callbacks, the state is polled and diffed into events
+        void poll_gamepads();
+
+        static void on_close(GLFWwindow* window);
+        static void on_resize(GLFWwindow* window, int width, int height);
+        static void on_focus(GLFWwindow* window, int focused);
+        static void on_key(GLFWwindow* window, int key, int scancode, int action, int mods);
+        static void on_cursor(GLFWwindow* window, double x, double y);
+        static void on_mouse_button(GLFWwindow* window, int button, int action, int mods);
+        static void on_scroll(GLFWwindow* window, double x, double y);
+
+        GLFWwindow*                              m_Window;
+        UVec2                                    m_InnerSize;
+        std::array<GamepadState_t, MAX_GAMEPADS> m_Gamepads {};
+    };
+} // namespace Pulsar
@@ -0,0 +1,47 @@
+#include "HeadlessWindow.hpp"
+
+#include <algorithm>
+
+namespace Pulsar {
+    HeadlessWindow::HeadlessWindow(const HeadlessWindowSettings_t& settings)
+        : Window(settings.m_EventCapacity), m_Settings(settings), m_InnerSize(settings.m_InnerSize),
+          m_Now(settings.m_StartTimeNs) {
+    }
+
+    void HeadlessWindow::poll_events() {
+        clear_events();
+        m_Now += m_Settings.m_FrameTimeNs;
+        while (m_NextScripted < m_Script.size() && m_Script[m_NextScripted].m_Frame <= m_Frame) {
+            deliver(m_Script[m_NextScripted].m_Event);
+            m_NextScripted++;
+        }
+        for (const Event_t& event : m_Injected) {
+            deliver(event);
+        }
+        m_Injected.clear();
+        m_Frame++;
+    }
+
+    void HeadlessWindow::script(std::span<const ScriptedEvent_t> events) {
+        m_Script.erase(
+            m_Script.begin(), m_Script.begin() + static_cast<std::ptrdiff_t>(m_NextScripted));
+        m_NextScripted = 0;
+        m_Script.insert(m_Script.end(), events.begin(), events.end());
+        // Stable, so events of one frame keep the order they were scripted in
+        std::ranges::stable_sort(m_Script, {}, &ScriptedEvent_t::m_Frame);
+    }
+
+    void HeadlessWindow::deliver(const Event_t& event) {
+        switch (event.m_Type) {
+            case EventType::CLOSE_REQUESTED:
+                m_CloseRequested = true;
+                break;
+            case EventType::RESIZED:
+                m_InnerSize = event.m_Resize.m_Size;
+                break;
+            default:
+                break;
+        }
+        push_event(event, event.m_TimeNs != 0 ? event.m_TimeNs : m_Now);
+    }
+} // namespace Pulsar
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "PulsarCore/Types.hpp"
+#include "PulsarWindow/Event.hpp"
+#include "PulsarWindow/Window.hpp"
+
+#include <span>
+#include <vector>
+
+namespace Pulsar {
+    struct HeadlessWindowSettings_t {
+        UVec2 m_InnerSize = {1280, 720};
+        /// `should_close` turns true after this many `poll_events`, 0 runs until a close request
+        u64 m_FrameCount = 0;
+        /// How far the clock advances per `poll_events`
+        u64 m_FrameTimeNs = 16'666'667;
+        u64 m_StartTimeNs = 0;
+        /// Events one `poll_events` can hold, see `EventQueue`
+        usize m_EventCapacity = EventQueue::DEFAULT_CAPACITY;
+    };
+
+    /// An event delivered by the `poll_events` call of frame `m_Frame`, counted from 0
+    struct ScriptedEvent_t {
+        u64     m_Frame;
+        Event_t m_Event;
+    };
+
+    /// A window without a display: events come from a script or are injected, time from a clock
+    /// that advances a fixed step per frame
+    /// # Usage
+    /// Runs the same frame loop as a real window, for tests and for benchmarking the engine loop
+    /// on machines without a display server. Frame `n` is the `n`th call to `poll_events`, and
+    /// every call moves the clock forward by `m_FrameTimeNs`. Identical settings and scripts give
+    /// identical runs. Delivered events keep a timestamp that is already set, the others are
+    /// stamped with the clock of the `poll_events` that delivers them.
+    class HeadlessWindow final : public Window {
+    public:
+        explicit HeadlessWindow(const HeadlessWindowSettings_t& settings = {});
+
+        [[nodiscard]] bool should_close() const override {
+            return m_CloseRequested ||
+                   (m_Settings.m_FrameCount != 0 && m_Frame >= m_Settings.m_FrameCount);
+        }
+
+        void poll_events() override;
+
+        [[nodiscard]] UVec2 inner_size() const override {
+            return m_InnerSize;
+        }
+
+        [[nodiscard]] u64 time_ns() const override {
+            return m_Now;
+        }
+
+        /// Adds events to deliver on later frames, in any order. Events for a frame that already
+        /// passed are delivered by the next `poll_events`.
+        void script(std::span<const ScriptedEvent_t> events);
+
+        /// Delivers `event` with the next `poll_events`
+        void inject(const Event_t& event) {
+            m_Injected.push_back(event);
+        }
+
+        /// Moves the clock forward, on top of the fixed step per frame
+        void advance(u64 nanoseconds) {
+            m_Now += nanoseconds;
+        }
+
+        /// Calls to `poll_events` so far
+        [[nodiscard]] u64 frame() const {
+            return m_Frame;
+        }
+
+    private:
+        void deliver(const Event_t& event);
+
+        HeadlessWindowSettings_t     m_Settings;
+        UVec2                        m_InnerSize;
+        u64                          m_Now;
+        u64                          m_Frame          = 0;
+        bool                         m_CloseRequested = false;
+        /// Sorted by frame, `m_NextScripted` is the first one not delivered yet
+        std::vector<ScriptedEvent_t> m_Script;
+        usize                        m_NextScripted = 0;
+        std::vector<Event_t>         m_Injected;
+    };
+} // namespace Pulsar
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "PulsarCore/Sync/DoubleBuffer.hpp"
+#include "PulsarCore/Sync/SpscQueue.hpp"
+#include "PulsarCore/Types.hpp"
+#include "PulsarWindow/Event.hpp"
+#include "PulsarWindow/InputState.hpp"
+
+#include <atomic>
+#include <span>
+
+namespace Pulsar {
+    /// Hands input from the thread that receives it to the thread that runs the game
+    /// # Usage
+    /// One producer thread `submit`s events as they arrive: an `InputThread`, or the main thread
+    /// pumping `GlfwWindow::wait_events`. One consumer thread `drain`s the event stream, in order
+    /// and with the original timestamps. Any thread can read the latest `snapshot` of the state,
+    /// e.g. a render thread that wants the newest camera input just before it submits a frame.
+    /// # Performance
+    /// The stream is a `SpscQueue` and the state a `DoubleBuffer`, both lock-free. The producer
+    /// never waits: when the consumer falls behind by more than the capacity, the newest events
+    /// are dropped from the stream and counted, the snapshot still reflects them.
+    class InputChannel {
+    public:
+        static constexpr usize DEFAULT_CAPACITY = 4096;
+
+        explicit InputChannel(usize capacity = DEFAULT_CAPACITY) : m_Events(capacity) {
+        }
+
+        /// Producer only, folds `events` into the state, queues them and publishes the state once
+        void submit(std::span<const Event_t> events) {
+            if (events.empty()) {
+                return;
+            }
+            for (const Event_t& event : events) {
+                m_State.apply(event);
+                if (!m_Events.try_push(event)) {
+                    m_Dropped.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+            m_Snapshots.publish(m_State);
+        }
+
+        /// Consumer only, moves up to `out.size()` of the oldest queued events into `out` and
+        /// returns how many
+        usize drain(std::span<Event_t> out) {
+            return m_Events.pop_batch(out);
+        }
+
+        /// Any thread, the state after the last `submit`
+        [[nodiscard]] InputState_t snapshot() const {
+            return m_Snapshots.read();
+        }
+
+        /// Any thread, the number of `submit` calls that published a state so far
+        [[nodiscard]] u64 version() const {
+            return m_Snapshots.version();
+        }
+
+        /// Events that did not fit in the stream
+        [[nodiscard]] u64 dropped() const {
+            return m_Dropped.load(std::memory_order_relaxed);
+        }
+
+    private:
+        SpscQueue<Event_t>         m_Events;
+        DoubleBuffer<InputState_t> m_Snapshots;
+        /// The producer's working copy
+        InputState_t     m_State;
+        std::atomic<u64> m_Dropped {0};
+    };
+} // namespace Pulsar
@@ -0,0 +1,63 @@
+#include "InputState.hpp"
+
+namespace Pulsar {
+    namespace {
+        template<typename Bits> void set_bit(Bits& bits, u32 bit, bool value) {
+            if (value) {
+                bits |= Bits {1} << bit;
+            }
+            else {
+                bits &= ~(Bits {1} << bit);
+            }
+        }
+    } // namespace
+
+    void InputState_t::apply(const Event_t& event) {
+        switch (event.m_Type) {
+            case EventType::KEY: {
+                const auto index = static_cast<u32>(event.m_Key.m_Key);
+                set_bit(m_Keys[index / 64], index % 64, event.m_Key.m_Pressed);
+                break;
+            }
+            case EventType::MOUSE_MOVED:
+                m_MousePosition = event.m_MouseMove.m_Position;
+                break;
+            case EventType::MOUSE_BUTTON:
+                set_bit(m_MouseButtons, static_cast<u32>(event.m_MouseButton.m_Button),
+                    event.m_MouseButton.m_Pressed);
+                break;
+            case EventType::MOUSE_SCROLLED:
+                m_ScrollTotal.x += event.m_Scroll.m_Delta.x;
+                m_ScrollTotal.y += event.m_Scroll.m_Delta.y;
+                break;
+            case EventType::GAMEPAD_CONNECTED: {
+                const GamepadConnectionEvent_t& connection = event.m_GamepadConnection;
+                if (connection.m_Gamepad < MAX_GAMEPADS) {
+                    // A pad that comes or goes starts from rest
+                    m_Gamepads[connection.m_Gamepad] = {.m_Connected = connection.m_Connected};
+                }
+                break;
+            }
+            case EventType::GAMEPAD_BUTTON: {
+                const GamepadButtonEvent_t& button = event.m_GamepadButton;
+                if (button.m_Gamepad < MAX_GAMEPADS) {
+                    set_bit(m_Gamepads[button.m_Gamepad].m_Buttons,
+                        static_cast<u32>(button.m_Button), button.m_Pressed);
+                }
+                break;
+            }
+            case EventType::GAMEPAD_AXIS: {
+                const GamepadAxisEvent_t& axis = event.m_GamepadAxis;
+                if (axis.m_Gamepad < MAX_GAMEPADS) {
+                    m_Gamepads[axis.m_Gamepad].m_Axes[static_cast<usize>(axis.m_Axis)] =
+                        axis.m_Value;
+                }
+                break;
+            }
+            default:
+                break;
+        }
+        m_TimeNs = event.m_TimeNs;
+        m_EventCount++;
+    }
+} // namespace Pulsar
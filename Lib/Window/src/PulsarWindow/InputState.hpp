@@ -0,0 +1,55 @@
+#pragma once
+
+#include "PulsarCore/Types.hpp"
+#include "PulsarWindow/Event.hpp"
+
+#include <array>
+
+namespace Pulsar {
+    struct GamepadState_t {
+        std::array<f32, static_cast<usize>(GamepadAxis::COUNT)> m_Axes {};
+        /// A bit per `GamepadButton`
+        u32  m_Buttons   = 0;
+        bool m_Connected = false;
+
+        [[nodiscard]] bool down(GamepadButton button) const {
+            return (m_Buttons & (1U << static_cast<u32>(button))) != 0;
+        }
+
+        [[nodiscard]] f32 axis(GamepadAxis axis) const {
+            return m_Axes[static_cast<usize>(axis)];
+        }
+    };
+
+    /// What is held down and where the pointers are, folded from the event stream
+    /// # Usage
+    /// `apply` every event in order; the state then answers "is it down now" questions without
+    /// looking at events. Trivially copyable, so it can be published as a whole snapshot.
+    struct InputState_t {
+        /// A bit per `Key`
+        std::array<u64, 2> m_Keys {};
+        Vec2               m_MousePosition {};
+        /// Scrolling summed since the state was created, consumers diff two snapshots
+        Vec2 m_ScrollTotal {};
+        /// A bit per `MouseButton`
+        u32                                      m_MouseButtons = 0;
+        std::array<GamepadState_t, MAX_GAMEPADS> m_Gamepads {};
+        /// Timestamp of the last event applied
+        u64 m_TimeNs = 0;
+        /// Events applied since the state was created
+        u64 m_EventCount = 0;
+
+        static_assert(static_cast<usize>(Key::COUNT) <= 128);
+
+        [[nodiscard]] bool key_down(Key key) const {
+            const auto index = static_cast<u32>(key);
+            return (m_Keys[index / 64] & (1ULL << (index % 64))) != 0;
+        }
+
+        [[nodiscard]] bool mouse_down(MouseButton button) const {
+            return (m_MouseButtons & (1U << static_cast<u32>(button))) != 0;
+        }
+
+        void apply(const Event_t& event);
+    };
+} // namespace Pulsar
@@ -0,0 +1,77 @@
+#include "InputThread.hpp"
+
+#include "PulsarCore/Util/Profiler.hpp"
+#include "PulsarCore/Util/Sleep.hpp"
+#include "PulsarCore/Util/Timestamp.hpp"
+
+#include <algorithm>
+
+#ifdef __linux__
+    #include <pthread.h>
+    #include <sched.h>
+#endif
+
+namespace Pulsar {
+    namespace {
+        /// Best effort, returns whether the calling thread now runs with real-time priority
+        bool raise_priority() {
+#ifdef __linux__
+            // Above normal threads, below the kernel's own real-time threads
+            sched_param param {};
+            param.sched_priority = sched_get_priority_min(SCHED_FIFO) + 1;
+            return pthread_setschedparam(pthread_self(), SCHED_FIFO, &param) == 0;
+#else
+            return false;
+#endif
+        }
+    } // namespace
+
+    InputSource::~InputSource() = default;
+
+    void WindowInputSource::sample(EventQueue& out) {
+        m_Window.poll_events();
+        for (const Event_t& event : m_Window.events()) {
+            out.push(event, event.m_TimeNs);
+        }
+    }
+
+    InputThread::InputThread(
+        InputSource& source, InputChannel& channel, const InputThreadConfig_t& config)
+        : m_Source(source), m_Channel(channel), m_Config(config),
+          m_Batch(config.m_SampleCapacity), m_Thread([this] { run(); }) {
+    }
+
+    InputThread::~InputThread() {
+        stop();
+    }
+
+    void InputThread::stop() {
+        m_Stopping.store(true, std::memory_order_relaxed);
+        if (m_Thread.joinable()) {
+            m_Thread.join();
+        }
+    }
+
+    void InputThread::run() {
+        PULSAR_PROFILE_THREAD_NAME("Input");
+        if (m_Config.m_HighPriority) {
+            m_HighPriority.store(raise_priority(), std::memory_order_relaxed);
+        }
+        const u64 period   = std::max<u64>(m_Config.m_SamplePeriodNs, 1);
+        u64       deadline = monotonic_ns();
+        while (!m_Stopping.load(std::memory_order_relaxed)) {
+            m_Batch.clear();
+            m_Source.sample(m_Batch);
+            m_Channel.submit(m_Batch.events());
+            m_Samples.fetch_add(1, std::memory_order_relaxed);
+
+            deadline += period;
+            const u64 now = monotonic_ns();
+            if (deadline < now) {
+                // Fell behind, skip the missed samples instead of running them back to back
+                deadline = now + period - (now - deadline) % period;
+            }
+            sleep_until_ns(deadline);
+        }
+    }
+} // namespace Pulsar
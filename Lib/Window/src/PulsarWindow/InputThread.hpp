@@ -0,0 +1,98 @@
+#pragma once
+
+#include "PulsarCore/Types.hpp"
+#include "PulsarWindow/EventQueue.hpp"
+#include "PulsarWindow/InputChannel.hpp"
+#include "PulsarWindow/Window.hpp"
+
+#include <atomic>
+#include <thread>
+
+namespace Pulsar {
+    /// Where an `InputThread` gets its events from
+    class InputSource {
+    public:
+        InputSource() = default;
+        virtual ~InputSource();
+        InputSource(const InputSource&)            = delete;
+        InputSource(InputSource&&)                 = delete;
+        InputSource& operator=(const InputSource&) = delete;
+        InputSource& operator=(InputSource&&)      = delete;
+
+        /// Called on the input thread once per sample period, pushes what arrived since the last
+        /// call into `out` with the time each event arrived
+        virtual void sample(EventQueue& out) = 0;
+    };
+
+    /// Samples a window from the input thread
+    /// # Usage
+    /// Only for backends that may be polled off the main thread, like `HeadlessWindow`. GLFW
+    /// only polls on the main thread: pump `GlfwWindow::wait_events` there and `submit` the events
+    /// to an `InputChannel` directly instead.
+    class WindowInputSource final : public InputSource {
+    public:
+        explicit WindowInputSource(Window& window) : m_Window(window) {
+        }
+
+        void sample(EventQueue& out) override;
+
+    private:
+        Window& m_Window;
+    };
+
+    struct InputThreadConfig_t {
+        /// How often the source is sampled, 1 ms matches a 1000 Hz mouse
+        u64 m_SamplePeriodNs = 1'000'000;
+        /// Events one sample can hold, see `EventQueue`
+        usize m_SampleCapacity = 1024;
+        /// Asks for real-time scheduling, which needs privileges (`CAP_SYS_NICE` or an rtprio
+        /// limit on Linux) and is silently skipped without them
+        bool m_HighPriority = true;
+    };
+
+    /// A thread that samples an `InputSource` at a fixed rate and submits to an `InputChannel`
+    /// # Usage
+    /// Input then reaches the channel within a sample period of arriving, instead of waiting for
+    /// the next frame's `poll_events`. The consumer drains the channel whenever it wants the
+    /// events, as often as it likes, and reads sub-frame timestamps from them.
+    /// # Performance
+    /// Sampling wakes on absolute deadlines, so the rate does not drift with the time a sample
+    /// takes. Missed deadlines (a descheduled thread) are skipped rather than caught up.
+    class InputThread {
+    public:
+        InputThread(
+            InputSource& source, InputChannel& channel, const InputThreadConfig_t& config = {});
+        ~InputThread();
+
+        InputThread(const InputThread&)            = delete;
+        InputThread(InputThread&&)                 = delete;
+        InputThread& operator=(const InputThread&) = delete;
+        InputThread& operator=(InputThread&&)      = delete;
+
+        /// Stops sampling after the current sample, called by the destructor
+        void stop();
+
+        /// Whether the thread got the real-time priority it asked for, valid once `samples` is
+        /// non-zero
+        [[nodiscard]] bool high_priority() const {
+            return m_HighPriority.load(std::memory_order_relaxed);
+        }
+
+        /// Samples taken so far
+        [[nodiscard]] u64 samples() const {
+            return m_Samples.load(std::memory_order_relaxed);
+        }
+
+    private:
+        void run();
+
+        InputSource&        m_Source;
+        InputChannel&       m_Channel;
+        InputThreadConfig_t m_Config;
+        EventQueue          m_Batch;
+        std::atomic<bool>   m_Stopping {false};
+        std::atomic<bool>   m_HighPriority {false};
+        std::atomic<u64>    m_Samples {0};
+        std::thread         m_Thread;
+    };
+} // namespace Pulsar
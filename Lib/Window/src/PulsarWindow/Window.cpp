@@ -1 +1,6 @@
 #include "Window.hpp"
+
+namespace Pulsar {
+    // Out of line, so the vtable is emitted once
+    Window::~Window() = default;
+} // namespace Pulsar
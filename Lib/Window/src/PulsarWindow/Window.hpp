@@ -1,33 +1,85 @@
 #pragma once
 
 #include "PulsarCore/Types.hpp"
+#include "PulsarWindow/Event.hpp"
+#include "PulsarWindow/EventQueue.hpp"
+
+#include <span>
+#include <string>
 
 namespace Pulsar {
     /// A cross-platform window API, with some inspration from winit
+    /// # Usage
+    /// Call `poll_events` once per frame, then read what happened since the previous call from
+    /// `events`, or only one kind of event from `events(type)`. Backends: `GlfwWindow` for a real
+    /// window, `HeadlessWindow` for tests and benchmarks without a display server.
     /// # Performance
     /// The window functions themselves are not performance critical, but the
     /// underlying windowing systemad and event system can be. Therefore, we can
     /// afford to use inheritance to implement the windowing system, instead of
     /// using a virtual function table structure.
+    /// Events are not dispatched through callbacks: `poll_events` drains the backend into an
+    /// `EventQueue` in one batch, and the frame walks it as a flat array.
     class Window {
     public:
-        Window() = default;
-        virtual ~Window() = default;
-        Window(const Window &) = delete;
-        Window(Window &&) = delete;
-        Window &operator=(const Window &) = delete;
-        Window &operator=(Window &&) = delete;
-    
+        explicit Window(usize eventCapacity = EventQueue::DEFAULT_CAPACITY)
+            : m_Events(eventCapacity) {
+        }
+
+        virtual ~Window();
+        Window(const Window&)            = delete;
+        Window(Window&&)                 = delete;
+        Window& operator=(const Window&) = delete;
+        Window& operator=(Window&&)      = delete;
+
         [[nodiscard]] virtual bool should_close() const = 0;
+
+        /// Replaces the events of the previous call with the ones that arrived since
         virtual void poll_events() = 0;
+
+        /// Size of the content area in pixels
+        [[nodiscard]] virtual UVec2 inner_size() const = 0;
+
+        /// Monotonic time in nanoseconds, the clock the frame loop should run on. Deterministic
+        /// for the headless backend.
+        [[nodiscard]] virtual u64 time_ns() const = 0;
+
+        /// The events collected by the last `poll_events`, in the order they arrived
+        [[nodiscard]] std::span<const Event_t> events() const {
+            return m_Events.events();
+        }
+
+        /// The events of one type collected by the last `poll_events`
+        [[nodiscard]] auto events(EventType type) const {
+            return m_Events.of_type(type);
+        }
+
+        [[nodiscard]] const EventQueue& event_queue() const {
+            return m_Events;
+        }
+
+    protected:
+        void clear_events() {
+            m_Events.clear();
+        }
+
+        void push_event(const Event_t& event, u64 timeNs) {
+            m_Events.push(event, timeNs);
+        }
+
+    private:
+        EventQueue m_Events;
     };
 
     // NOLINTBEGIN(readability-identifier-naming)
     struct WindowSettings_t {
-        UVec2 inner_size = {1280, 720};
-        bool visible      = true;
-        bool resizable    = true;
-        bool fullscreen   = false;
+        std::string title      = "Pulsar";
+        UVec2       inner_size = {1280, 720};
+        bool        visible    = true;
+        bool        resizable  = true;
+        bool        fullscreen = false;
+        /// Events one `poll_events` can hold before mouse motion is coalesced and the rest dropped
+        usize event_capacity = EventQueue::DEFAULT_CAPACITY;
     };
 
     // NOLINTEND(readability-identifier-naming)
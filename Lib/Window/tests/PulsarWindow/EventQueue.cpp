@@ -0,0 +1,70 @@
+// NOLINTBEGIN(*)
+#include "PulsarWindow/EventQueue.hpp"
+#include "PulsarWindow/HeadlessWindow.hpp"
+
+#include <gtest/gtest.h>
+#include <ranges>
+#include <vector>
+
+using namespace Pulsar;
+
+TEST(EventQueue, BatchesAndFiltersByType) {
+    EventQueue queue(16);
+    EXPECT_TRUE(queue.push(Event_t::key(Key::A, true), 10));
+    EXPECT_TRUE(queue.push(Event_t::mouse_moved({1, 2}), 20));
+    EXPECT_TRUE(queue.push(Event_t::key(Key::A, false), 30));
+    ASSERT_EQ(queue.size(), 3U);
+    EXPECT_EQ(queue.events()[1].m_TimeNs, 20U);
+
+    EXPECT_TRUE(queue.contains(EventType::KEY));
+    EXPECT_TRUE(queue.contains(EventType::MOUSE_MOVED));
+    EXPECT_FALSE(queue.contains(EventType::RESIZED));
+
+    std::vector<u64> keyTimes;
+    for (const Event_t& event : queue.of_type(EventType::KEY)) {
+        keyTimes.push_back(event.m_TimeNs);
+    }
+    EXPECT_EQ(keyTimes, (std::vector<u64>{10, 30}));
+
+    const Event_t* storage = queue.events().data();
+    queue.clear();
+    EXPECT_TRUE(queue.events().empty());
+    EXPECT_EQ(queue.types(), 0U);
+    queue.push(Event_t::focus_changed(true), 40);
+    // The next batch reuses the same buffer
+    EXPECT_EQ(queue.events().data(), storage);
+}
+
+TEST(EventQueue, CoalescesMotionWhenFull) {
+    EventQueue queue(2);
+    queue.push(Event_t::key(Key::W, true), 1);
+    queue.push(Event_t::mouse_moved({1, 1}), 2);
+    EXPECT_TRUE(queue.push(Event_t::mouse_moved({5, 6}), 3));
+    EXPECT_FALSE(queue.push(Event_t::key(Key::W, false), 4));
+    ASSERT_EQ(queue.size(), 2U);
+    EXPECT_EQ(queue.events()[1].m_MouseMove.m_Position.x, 5.0F);
+    EXPECT_EQ(queue.events()[1].m_TimeNs, 3U);
+    EXPECT_EQ(queue.dropped(), 1U);
+
+    queue.clear();
+    queue.push(Event_t::mouse_scrolled({0, 1}), 5);
+    queue.push(Event_t::mouse_scrolled({0, 2}), 6);
+    EXPECT_TRUE(queue.push(Event_t::mouse_scrolled({1, 3}), 7));
+    EXPECT_EQ(queue.events()[1].m_Scroll.m_Delta.x, 1.0F);
+    EXPECT_EQ(queue.events()[1].m_Scroll.m_Delta.y, 5.0F);
+}
+
+TEST(EventQueue, WindowStampsEvents) {
+    HeadlessWindow window({.m_FrameTimeNs = 100, .m_EventCapacity = 8});
+    EXPECT_EQ(window.event_queue().capacity(), 8U);
+    window.inject(Event_t::key(Key::SPACE, true));
+    Event_t stamped = Event_t::mouse_moved({3, 4});
+    stamped.m_TimeNs = 42;
+    window.inject(stamped);
+    window.poll_events();
+    ASSERT_EQ(window.events().size(), 2U);
+    EXPECT_EQ(window.events()[0].m_TimeNs, 100U);
+    EXPECT_EQ(window.events()[1].m_TimeNs, 42U);
+    EXPECT_EQ(std::ranges::distance(window.events(EventType::MOUSE_MOVED)), 1);
+}
+// NOLINTEND(*)
@@ -0,0 +1,73 @@
+// NOLINTBEGIN(*)
+#include "PulsarWindow/HeadlessWindow.hpp"
+
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace Pulsar;
+
+TEST(HeadlessWindow, RunsConfiguredFrames) {
+    HeadlessWindow window({.m_FrameCount = 5, .m_FrameTimeNs = 1000, .m_StartTimeNs = 100});
+    EXPECT_EQ(window.time_ns(), 100U);
+    u64 frames = 0;
+    while (!window.should_close()) {
+        window.poll_events();
+        frames++;
+        EXPECT_EQ(window.time_ns(), 100 + frames * 1000);
+    }
+    EXPECT_EQ(frames, 5U);
+    EXPECT_EQ(window.frame(), 5U);
+
+    window.advance(50);
+    EXPECT_EQ(window.time_ns(), 5150U);
+}
+
+TEST(HeadlessWindow, DeliversScriptOnItsFrame) {
+    HeadlessWindow                     window;
+    const std::vector<ScriptedEvent_t> script = {
+        {2, Event_t::key(Key::B, true)},
+        {0, Event_t::mouse_moved({10, 20})},
+        {2, Event_t::key(Key::B, false)},
+        {0, Event_t::key(Key::A, true)},
+    };
+    window.script(script);
+
+    window.poll_events();
+    ASSERT_EQ(window.events().size(), 2U);
+    EXPECT_EQ(window.events()[0].m_Type, EventType::MOUSE_MOVED);
+    EXPECT_EQ(window.events()[0].m_MouseMove.m_Position.y, 20.0F);
+    EXPECT_EQ(window.events()[1].m_Key.m_Key, Key::A);
+
+    window.poll_events();
+    EXPECT_TRUE(window.events().empty());
+
+    window.inject(Event_t::mouse_button(MouseButton::RIGHT, true));
+    window.poll_events();
+    ASSERT_EQ(window.events().size(), 3U);
+    EXPECT_TRUE(window.events()[0].m_Key.m_Pressed);
+    EXPECT_FALSE(window.events()[1].m_Key.m_Pressed);
+    EXPECT_EQ(window.events()[2].m_MouseButton.m_Button, MouseButton::RIGHT);
+
+    // Scripting a frame that already passed delivers on the next poll
+    const ScriptedEvent_t late = {1, Event_t::focus_changed(false)};
+    window.script({&late, 1});
+    window.poll_events();
+    ASSERT_EQ(window.events().size(), 1U);
+    EXPECT_FALSE(window.events()[0].m_Focus.m_Focused);
+}
+
+TEST(HeadlessWindow, CloseAndResizeEvents) {
+    HeadlessWindow window({.m_InnerSize = {640, 480}});
+    EXPECT_EQ(window.inner_size().x, 640U);
+    window.inject(Event_t::resized({800, 600}));
+    window.poll_events();
+    EXPECT_EQ(window.inner_size().y, 600U);
+    EXPECT_FALSE(window.should_close());
+
+    window.inject(Event_t::close_requested());
+    window.poll_events();
+    EXPECT_TRUE(window.should_close());
+    ASSERT_EQ(window.events().size(), 1U);
+    EXPECT_EQ(window.events()[0].m_Type, EventType::CLOSE_REQUESTED);
+}
+// NOLINTEND(*)
@@ -0,0 +1,95 @@
+// NOLINTBEGIN(*)
+#include "PulsarCore/Util/Timestamp.hpp"
+#include "PulsarWindow/HeadlessWindow.hpp"
+#include "PulsarWindow/InputChannel.hpp"
+#include "PulsarWindow/InputThread.hpp"
+
+#include <array>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+using namespace Pulsar;
+
+TEST(InputState, FoldsEvents) {
+    InputState_t state;
+    state.apply(Event_t::key(Key::W, true));
+    state.apply(Event_t::key(Key::RIGHT_SUPER, true));
+    state.apply(Event_t::mouse_button(MouseButton::MIDDLE, true));
+    state.apply(Event_t::mouse_scrolled({0, 2}));
+    state.apply(Event_t::mouse_scrolled({1, -1}));
+    state.apply(Event_t::gamepad_connected(1, true));
+    state.apply(Event_t::gamepad_button(1, GamepadButton::NORTH, true));
+    state.apply(Event_t::gamepad_axis(1, GamepadAxis::RIGHT_TRIGGER, 0.5F));
+    EXPECT_TRUE(state.key_down(Key::W));
+    EXPECT_TRUE(state.key_down(Key::RIGHT_SUPER));
+    EXPECT_FALSE(state.key_down(Key::S));
+    EXPECT_TRUE(state.mouse_down(MouseButton::MIDDLE));
+    EXPECT_EQ(state.m_ScrollTotal.x, 1.0F);
+    EXPECT_EQ(state.m_ScrollTotal.y, 1.0F);
+    EXPECT_TRUE(state.m_Gamepads[1].m_Connected);
+    EXPECT_TRUE(state.m_Gamepads[1].down(GamepadButton::NORTH));
+    EXPECT_EQ(state.m_Gamepads[1].axis(GamepadAxis::RIGHT_TRIGGER), 0.5F);
+    EXPECT_FALSE(state.m_Gamepads[0].m_Connected);
+
+    state.apply(Event_t::key(Key::W, false));
+    state.apply(Event_t::gamepad_connected(1, false));
+    EXPECT_FALSE(state.key_down(Key::W));
+    EXPECT_FALSE(state.m_Gamepads[1].down(GamepadButton::NORTH));
+    EXPECT_EQ(state.m_EventCount, 10U);
+}
+
+TEST(InputChannel, StreamsEventsAndSnapshots) {
+    InputChannel           channel(4);
+    std::array<Event_t, 3> first = {
+        Event_t::key(Key::A, true), Event_t::mouse_moved({4, 5}), Event_t::key(Key::B, true)};
+    first[2].m_TimeNs = 99;
+    channel.submit(first);
+    EXPECT_EQ(channel.version(), 1U);
+    EXPECT_TRUE(channel.snapshot().key_down(Key::B));
+    EXPECT_EQ(channel.snapshot().m_TimeNs, 99U);
+
+    // Two more than the stream holds: dropped from the stream, still in the state
+    const std::array<Event_t, 3> second = {
+        Event_t::key(Key::C, true), Event_t::key(Key::D, true), Event_t::key(Key::E, true)};
+    channel.submit(second);
+    EXPECT_EQ(channel.dropped(), 2U);
+    EXPECT_TRUE(channel.snapshot().key_down(Key::E));
+
+    std::array<Event_t, 8> out {};
+    ASSERT_EQ(channel.drain(out), 4U);
+    EXPECT_EQ(out[1].m_MouseMove.m_Position.y, 5.0F);
+    EXPECT_EQ(out[2].m_TimeNs, 99U);
+    EXPECT_EQ(out[3].m_Key.m_Key, Key::C);
+    EXPECT_EQ(channel.drain(out), 0U);
+}
+
+TEST(InputThread, SamplesWindowOffTheMainThread) {
+    HeadlessWindow window({.m_FrameTimeNs = 1000});
+    window.inject(Event_t::key(Key::SPACE, true));
+    window.inject(Event_t::mouse_moved({7, 8}));
+
+    InputChannel         channel;
+    WindowInputSource    source(window);
+    std::vector<Event_t> received;
+    {
+        InputThread thread(
+            source, channel, {.m_SamplePeriodNs = 100'000, .m_HighPriority = false});
+        std::array<Event_t, 16> out {};
+        const u64               deadline = monotonic_ns() + 5'000'000'000;
+        while (received.size() < 2 && monotonic_ns() < deadline) {
+            const usize count = channel.drain(out);
+            received.insert(received.end(), out.begin(), out.begin() + count);
+            std::this_thread::yield();
+        }
+        EXPECT_FALSE(thread.high_priority());
+    }
+    ASSERT_EQ(received.size(), 2U);
+    EXPECT_EQ(received[0].m_Key.m_Key, Key::SPACE);
+    EXPECT_EQ(received[1].m_Type, EventType::MOUSE_MOVED);
+    // Stamped with the headless clock of the sample that delivered them
+    EXPECT_EQ(received[0].m_TimeNs, 1000U);
+    EXPECT_TRUE(channel.snapshot().key_down(Key::SPACE));
+    EXPECT_GE(window.frame(), 1U);
+}
+// NOLINTEND(*)
@@ -0,0 +1,252 @@
+#!/usr/bin/env python3
+"""Benchmark regression gate for the Google Benchmark executables.
+
+Runs a benchmark binary with repetitions, keeps the JSON output as a baseline and compares later
+runs against it with a one-sided Mann-Whitney U test on the per-repetition times. A benchmark
+regressed when it is significantly slower (p < alpha) and its median slowed down by more than the
+threshold. Only the Python standard library is used, everything stays on this machine.
+
+    BenchCompare.py run --binary PATH --out FILE [--repetitions N] [--filter REGEX]
+    BenchCompare.py compare BASELINE CONTENDER [--alpha A] [--threshold PERCENT]
+    BenchCompare.py gate --binary PATH --baseline FILE [--update-baseline] [run/compare options]
+
+Exit codes: 0 no regression, 1 significant slowdown, 2 usage or runtime errors.
+"""
+
+import argparse
+import json
+import math
+import os
+import statistics
+import subprocess
+import sys
+import tempfile
+
+EXIT_OK = 0
+EXIT_REGRESSION = 1
+EXIT_ERROR = 2
+
+TIME_UNITS_NS = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+# Exact U distributions are cheap up to this many samples per side, ties need the approximation
+EXACT_LIMIT = 50
+
+
+class BenchError(Exception):
+    pass
+
+
+def run_benchmarks(binary, out, repetitions, bench_filter, min_time):
+    command = [
+        binary,
+        f"--benchmark_repetitions={repetitions}",
+        "--benchmark_display_aggregates_only=true",
+        f"--benchmark_out={out}",
+        "--benchmark_out_format=json",
+    ]
+    if bench_filter:
+        command.append(f"--benchmark_filter={bench_filter}")
+    if min_time:
+        command.append(f"--benchmark_min_time={min_time}")
+    print("Running " + " ".join(command), flush=True)
+    try:
+        result = subprocess.run(command, check=False)
+    except OSError as error:
+        raise BenchError(f"Failed to run {binary}: {error}") from error
+    if result.returncode != 0:
+        raise BenchError(f"{binary} exited with {result.returncode}")
+
+
+def load_samples(path, metric):
+    """Per-repetition times in nanoseconds by benchmark name, and the run context"""
+    try:
+        with open(path, encoding="utf-8") as file:
+            data = json.load(file)
+    except (OSError, json.JSONDecodeError) as error:
+        raise BenchError(f"Failed to read {path}: {error}") from error
+
+    samples = {}
+    for entry in data.get("benchmarks", []):
+        if entry.get("run_type", "iteration") != "iteration" or "error_occurred" in entry:
+            continue
+        name = entry.get("run_name", entry["name"])
+        scale = TIME_UNITS_NS.get(entry.get("time_unit", "ns"), 1.0)
+        samples.setdefault(name, []).append(float(entry[metric]) * scale)
+    return samples, data.get("context", {})
+
+
+def exact_u_cdf(m, n):
+    """P(U <= u) for every u, with no ties, by counting rank arrangements"""
+    # counts[i][j][u]: arrangements of i + j samples where the first group gets U = u
+    previous = [[1] for _ in range(n + 1)]
+    for i in range(1, m + 1):
+        current = [[1]]
+        for j in range(1, n + 1):
+            size = i * j + 1
+            counts = [0] * size
+            # Largest value from the first group: it beats all j of the second group
+            for u, count in enumerate(previous[j]):
+                counts[u + j] += count
+            for u, count in enumerate(current[j - 1]):
+                counts[u] += count
+            current.append(counts)
+        previous = current
+    total = math.comb(m + n, m)
+    cdf = []
+    running = 0
+    for count in previous[n]:
+        running += count
+        cdf.append(running / total)
+    return cdf
+
+
+def mann_whitney_greater(first, second):
+    """One-sided p-value for `first` tending to be larger than `second`"""
+    m, n = len(first), len(second)
+    combined = sorted([(value, 0) for value in first] + [(value, 1) for value in second])
+    ranks = [0.0] * len(combined)
+    tie_term = 0.0
+    i = 0
+    while i < len(combined):
+        j = i
+        while j + 1 < len(combined) and combined[j + 1][0] == combined[i][0]:
+            j += 1
+        for k in range(i, j + 1):
+            ranks[k] = (i + j) / 2.0 + 1.0
+        tied = j - i + 1
+        tie_term += tied**3 - tied
+        i = j + 1
+    rank_sum = sum(rank for rank, (_, group) in zip(ranks, combined) if group == 0)
+    u = rank_sum - m * (m + 1) / 2.0
+
+    if tie_term == 0 and m <= EXACT_LIMIT and n <= EXACT_LIMIT:
+        # P(U >= u) = 1 - P(U <= u - 1)
+        cdf = exact_u_cdf(m, n)
+        below = int(round(u)) - 1
+        return 1.0 - (cdf[below] if below >= 0 else 0.0)
+
+    mean = m * n / 2.0
+    variance = m * n / 12.0 * ((m + n + 1) - tie_term / ((m + n) * (m + n - 1)))
+    if variance <= 0:
+        return 1.0
+    z = (u - mean - 0.5) / math.sqrt(variance)
+    return 0.5 * math.erfc(z / math.sqrt(2.0))
+
+
+def format_time(ns):
+    for unit, scale in (("s", 1e9), ("ms", 1e6), ("us", 1e3)):
+        if ns >= scale:
+            return f"{ns / scale:.3g} {unit}"
+    return f"{ns:.3g} ns"
+
+
+def compare(baseline_path, contender_path, alpha, threshold, metric):
+    baseline, baseline_context = load_samples(baseline_path, metric)
+    contender, contender_context = load_samples(contender_path, metric)
+
+    for key in ("host_name", "num_cpus", "mhz_per_cpu", "library_build_type"):
+        if baseline_context.get(key) != contender_context.get(key):
+            print(f"note: {key} differs, {baseline_context.get(key)} in the baseline and "
+                  f"{contender_context.get(key)} now")
+    if contender_context.get("cpu_scaling_enabled"):
+        print("note: CPU frequency scaling is enabled, expect noisy results")
+
+    rows = []
+    regressions = 0
+    for name in sorted(set(baseline) & set(contender)):
+        before, after = baseline[name], contender[name]
+        before_median = statistics.median(before)
+        after_median = statistics.median(after)
+        change = (after_median - before_median) / before_median * 100.0 if before_median else 0.0
+        slower = mann_whitney_greater(after, before)
+        faster = mann_whitney_greater(before, after)
+        if len(before) < 2 or len(after) < 2:
+            verdict = "too few repetitions"
+        elif slower < alpha and change > threshold:
+            verdict = "SLOWER"
+            regressions += 1
+        elif faster < alpha and change < -threshold:
+            verdict = "faster"
+        else:
+            verdict = ""
+        rows.append((name, format_time(before_median), format_time(after_median),
+                     f"{change:+.1f}%", f"{min(slower, faster):.3f}", verdict))
+
+    if rows:
+        header = ("Benchmark", "Baseline", "Now", "Change", "p", "")
+        widths = [max(len(row[i]) for row in rows + [header]) for i in range(len(header))]
+        for row in [header] + rows:
+            print("  ".join(cell.ljust(width) for cell, width in zip(row, widths)).rstrip())
+    for name in sorted(set(baseline) - set(contender)):
+        print(f"missing now: {name}")
+    for name in sorted(set(contender) - set(baseline)):
+        print(f"new: {name}")
+
+    print(f"{regressions} of {len(rows)} benchmarks significantly slower "
+          f"(p < {alpha}, median change above {threshold}%, {metric})")
+    return EXIT_REGRESSION if regressions else EXIT_OK
+
+
+def add_run_arguments(parser):
+    parser.add_argument("--binary", required=True, help="Google Benchmark executable")
+    parser.add_argument("--repetitions", type=int, default=10)
+    parser.add_argument("--filter", default="", help="--benchmark_filter regex")
+    parser.add_argument("--min-time", default="", help="--benchmark_min_time per repetition")
+
+
+def add_compare_arguments(parser):
+    parser.add_argument("--alpha", type=float, default=0.05, help="significance level")
+    parser.add_argument("--threshold", type=float, default=5.0,
+                        help="median slowdown in percent that counts as a regression")
+    parser.add_argument("--metric", choices=("real_time", "cpu_time"), default="real_time")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    commands = parser.add_subparsers(dest="command", required=True)
+
+    run_parser = commands.add_parser("run", help="run the benchmarks and store the JSON output")
+    add_run_arguments(run_parser)
+    run_parser.add_argument("--out", required=True)
+
+    compare_parser = commands.add_parser("compare", help="compare two JSON outputs")
+    compare_parser.add_argument("baseline")
+    compare_parser.add_argument("contender")
+    add_compare_arguments(compare_parser)
+
+    gate_parser = commands.add_parser(
+        "gate", help="run and compare against the baseline, creating it if missing")
+    add_run_arguments(gate_parser)
+    add_compare_arguments(gate_parser)
+    gate_parser.add_argument("--baseline", required=True)
+    gate_parser.add_argument("--update-baseline", action="store_true",
+                             help="store this run as the new baseline instead of comparing")
+
+    args = parser.parse_args()
+    try:
+        if args.command == "run":
+            run_benchmarks(args.binary, args.out, args.repetitions, args.filter, args.min_time)
+            return EXIT_OK
+        if args.command == "compare":
+            return compare(args.baseline, args.contender, args.alpha, args.threshold, args.metric)
+
+        directory = os.path.dirname(os.path.abspath(args.baseline))
+        os.makedirs(directory, exist_ok=True)
+        if args.update_baseline or not os.path.exists(args.baseline):
+            run_benchmarks(args.binary, args.baseline, args.repetitions, args.filter,
+                           args.min_time)
+            print(f"Stored baseline {args.baseline}")
+            return EXIT_OK
+        handle, contender = tempfile.mkstemp(prefix="contender-", suffix=".json", dir=directory)
+        os.close(handle)
+        try:
+            run_benchmarks(args.binary, contender, args.repetitions, args.filter, args.min_time)
+            return compare(args.baseline, contender, args.alpha, args.threshold, args.metric)
+        finally:
+            os.remove(contender)
+    except BenchError as error:
+        print(f"error: {error}", file=sys.stderr)
+        return EXIT_ERROR
+
+
+if __name__ == "__main__":
+    sys.exit(main())
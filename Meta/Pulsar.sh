@@ -38,6 +38,14 @@ elif [[ "${SUBCOMMAND}" == "test" ]]; then
     cd build
     ctest ${@:2} && true
     cd ..
+elif [[ "${SUBCOMMAND}" == "bench-compare" ]]; then
+    # Compares against build/benchmark-baselines, storing the first run as the baseline.
+    # Extra options go to Meta/BenchCompare.py, e.g. --update-baseline or --filter BM_Arena
+    command -v python3 >/dev/null 2>&1 || { echo "No python3 installed. Please install python3." >&2; exit 1; }
+    cmake --build "${BUILD_DIR}" --target PulsarLibCore_Benchmarks
+    python3 Meta/BenchCompare.py gate \
+        --binary "${BUILD_DIR}/artifacts/bin/PulsarLibCore_Benchmarks" \
+        --baseline "${BUILD_DIR}/benchmark-baselines/PulsarLibCore_Benchmarks.json" ${@:2}
 else
     # Print help message
     echo "Usage: $0 [subcommand] [options]"
@@ -46,6 +54,7 @@ else
     echo "  build     - build the project"
     echo "  clean     - clean the project"
     echo "  test      - run the tests"
+    echo "  bench-compare - run the benchmarks and compare them against the stored baseline"
 
     exit 1
 fi